@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gfx/context.hpp>
 #include <mbgl/gfx/headless_frontend.hpp>
 #include <mbgl/map/map.hpp>
 #include <mbgl/map/map_observer.hpp>
@@ -8,6 +10,7 @@
 #include <mbgl/storage/network_status.hpp>
 #include <mbgl/storage/resource_options.hpp>
 #include <mbgl/style/image.hpp>
+#include <mbgl/style/layers/circle_layer.hpp>
 #include <mbgl/style/layers/symbol_layer.hpp>
 #include <mbgl/style/sources/geojson_source.hpp>
 #include <mbgl/style/style.hpp>
@@ -15,6 +18,9 @@
 #include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
 
+#include <ghc/filesystem.hpp>
+
+#include <random>
 #include <sstream>
 
 using namespace mbgl;
@@ -22,6 +28,7 @@ using namespace mbgl;
 namespace {
 
 static std::string cachePath { "benchmark/fixtures/api/cache.db" };
+static std::string programCachePath { "benchmark/fixtures/api/program_cache" };
 constexpr double pixelRatio { 1.0 };
 constexpr Size size { 1000, 1000 };
 
@@ -50,6 +57,24 @@ void prepare_map2(Map& map, optional<std::string> json = nullopt) {
     map.getStyle().addImage(std::make_unique<style::Image>("test-icon", std::move(image), 1.0));
 }
 
+// Creates a map and renders its first frame, with programs cached in `programCachePath`.
+void renderFirstFrame(bool precompilePrograms) {
+    HeadlessFrontend frontend{size, pixelRatio};
+    frontend.getRenderer()->setProgramCacheDir(programCachePath);
+    frontend.getRenderer()->setProgramPrecompilation(precompilePrograms);
+    Map map{frontend,
+            MapObserver::nullObserver(),
+            MapOptions().withMapMode(MapMode::Static).withSize(size).withPixelRatio(pixelRatio),
+            ResourceOptions().withCachePath(cachePath).withAccessToken("foobar")};
+    prepare(map);
+    frontend.render(map);
+}
+
+void clearProgramCache() {
+    ghc::filesystem::remove_all(programCachePath);
+    ghc::filesystem::create_directories(programCachePath);
+}
+
 } // end namespace
 
 static void API_renderStill_reuse_map(::benchmark::State& state) {
@@ -65,6 +90,25 @@ static void API_renderStill_reuse_map(::benchmark::State& state) {
     }
 }
 
+// Renders the Manhattan style, whose fill and symbol layers span several tiles and record their draws
+// in batches grouped by program. Reports the GL state changes and draw calls of a frame.
+static void API_renderStill_batched_draws(::benchmark::State& state) {
+    RenderBenchmark bench;
+    HeadlessFrontend frontend{size, pixelRatio};
+    Map map{frontend,
+            MapObserver::nullObserver(),
+            MapOptions().withMapMode(MapMode::Static).withSize(size).withPixelRatio(pixelRatio),
+            ResourceOptions().withCachePath(cachePath).withAccessToken("foobar")};
+    prepare(map);
+
+    gfx::RenderingStats stats{};
+    for (auto _ : state) {
+        stats = frontend.render(map).stats;
+    }
+    state.counters["stateChanges"] = stats.numStateChanges;
+    state.counters["drawCalls"] = stats.numDrawCalls;
+}
+
 static void API_renderStill_reuse_map_formatted_labels(::benchmark::State& state) {
     RenderBenchmark bench;
     HeadlessFrontend frontend { size, pixelRatio };
@@ -151,9 +195,152 @@ static void API_renderStill_multiple_sources(::benchmark::State& state) {
     }
 }
 
+// Renders 500k small circles of a GeoJSON source. Tiles are laid out before timing starts, so this
+// measures drawing: circles are drawn as instances of one quad if `instancing` is set and the
+// context supports it, and as four vertices each otherwise.
+static void renderCircles(::benchmark::State& state, bool instancing) {
+    using namespace mbgl::style;
+    RenderBenchmark bench;
+    HeadlessFrontend frontend{size, pixelRatio};
+    if (!instancing) {
+        gfx::BackendScope scope{*frontend.getBackend()};
+        frontend.getBackend()->getContext().supportsInstancing = false;
+    }
+    Map map{frontend,
+            MapObserver::nullObserver(),
+            MapOptions().withMapMode(MapMode::Static).withSize(size).withPixelRatio(pixelRatio),
+            ResourceOptions().withCachePath(cachePath).withAccessToken("foobar")};
+    map.getStyle().loadJSON("{}");
+    map.jumpTo(CameraOptions().withCenter(LatLng{0, 0}).withZoom(1.0));
+
+    const std::size_t kCirclesCount = 500000;
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> longitude(-180.0, 180.0);
+    std::uniform_real_distribution<double> latitude(-80.0, 80.0);
+    MultiPoint<double> points;
+    points.reserve(kCirclesCount);
+    for (std::size_t i = 0; i < kCirclesCount; ++i) {
+        points.emplace_back(longitude(generator), latitude(generator));
+    }
+
+    auto source = std::make_unique<GeoJSONSource>("circles");
+    source->setGeoJSON(Geometry<double>{std::move(points)});
+    map.getStyle().addSource(std::move(source));
+    auto layer = std::make_unique<CircleLayer>("circles", "circles");
+    layer->setCircleRadius(2.0f);
+    map.getStyle().addLayer(std::move(layer));
+    frontend.render(map);
+
+    for (auto _ : state) {
+        frontend.render(map);
+    }
+}
+
+static void API_renderStill_circles_instanced(::benchmark::State& state) {
+    renderCircles(state, true);
+}
+
+static void API_renderStill_circles_not_instanced(::benchmark::State& state) {
+    renderCircles(state, false);
+}
+
+// Renders Continuous mode frames of the label-heavy Manhattan style while rotating the map. Placement
+// transitions are disabled, so every frame runs a full symbol placement against the previous one.
+static void API_renderContinuous_placement(::benchmark::State& state) {
+    class LoadObserver : public MapObserver {
+    public:
+        void onDidFinishLoadingMap() override { loaded = true; }
+        bool loaded = false;
+    };
+
+    RenderBenchmark bench;
+    HeadlessFrontend frontend{size, pixelRatio};
+    LoadObserver observer;
+    Map map{frontend,
+            observer,
+            MapOptions().withMapMode(MapMode::Continuous).withSize(size).withPixelRatio(pixelRatio),
+            ResourceOptions().withCachePath(cachePath).withAccessToken("foobar")};
+    prepare(map);
+    map.getStyle().setTransitionOptions(style::TransitionOptions({}, {}, false));
+
+    while (!observer.loaded) {
+        bench.loop.runOnce();
+    }
+
+    double bearing = 0.0;
+    for (auto _ : state) {
+        bearing += 1.0;
+        map.jumpTo(CameraOptions().withBearing(bearing));
+        frontend.renderOnce(map);
+    }
+}
+
+// Renders Continuous mode frames of the pitched Manhattan style while rotating the map. Placement is
+// rate limited with transitions enabled, so most frames only reproject the line labels of the previous one.
+static void API_renderContinuous_reprojection(::benchmark::State& state) {
+    class LoadObserver : public MapObserver {
+    public:
+        void onDidFinishLoadingMap() override { loaded = true; }
+        bool loaded = false;
+    };
+
+    RenderBenchmark bench;
+    HeadlessFrontend frontend{size, pixelRatio};
+    LoadObserver observer;
+    Map map{frontend,
+            observer,
+            MapOptions().withMapMode(MapMode::Continuous).withSize(size).withPixelRatio(pixelRatio),
+            ResourceOptions().withCachePath(cachePath).withAccessToken("foobar")};
+    prepare(map);
+    map.jumpTo(CameraOptions().withPitch(60.0));
+
+    while (!observer.loaded) {
+        bench.loop.runOnce();
+    }
+
+    double bearing = 0.0;
+    for (auto _ : state) {
+        bearing += 0.1;
+        map.jumpTo(CameraOptions().withBearing(bearing));
+        frontend.renderOnce(map);
+    }
+}
+
+// First frame of a new map with an empty program cache: every program variant is compiled, linked
+// and written to the cache while the frame is drawn.
+static void API_renderStill_first_frame_cold_program_cache(::benchmark::State& state) {
+    RenderBenchmark bench;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        clearProgramCache();
+        state.ResumeTiming();
+        renderFirstFrame(false);
+    }
+}
+
+// First frame of a new map with the program cache filled by an earlier run: the variants the style
+// needs are loaded from their binaries before the frame is drawn.
+static void API_renderStill_first_frame_warm_program_cache(::benchmark::State& state) {
+    RenderBenchmark bench;
+    clearProgramCache();
+    renderFirstFrame(false);
+
+    for (auto _ : state) {
+        renderFirstFrame(true);
+    }
+}
+
 BENCHMARK(API_renderStill_reuse_map)->Unit(benchmark::kMillisecond)->Iterations(50);
+BENCHMARK(API_renderStill_batched_draws)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_reuse_map_formatted_labels)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_reuse_map_switch_styles)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_recreate_map)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_recreate_map_2)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_multiple_sources)->Unit(benchmark::kMillisecond)->Iterations(50);
+BENCHMARK(API_renderStill_circles_instanced)->Unit(benchmark::kMillisecond)->Iterations(50);
+BENCHMARK(API_renderStill_circles_not_instanced)->Unit(benchmark::kMillisecond)->Iterations(50);
+BENCHMARK(API_renderStill_first_frame_cold_program_cache)->Unit(benchmark::kMillisecond)->Iterations(20);
+BENCHMARK(API_renderStill_first_frame_warm_program_cache)->Unit(benchmark::kMillisecond)->Iterations(20);
+BENCHMARK(API_renderContinuous_placement)->Unit(benchmark::kMillisecond)->Iterations(200);
+BENCHMARK(API_renderContinuous_reprojection)->Unit(benchmark::kMillisecond)->Iterations(200);
@@ -1,5 +1,8 @@
 #include <benchmark/benchmark.h>
 
+#include <mbgl/style/filter.hpp>
+#include <mbgl/style/layer.hpp>
+#include <mbgl/style/parser.hpp>
 #include <mbgl/tile/vector_tile_data.hpp>
 #include <mbgl/util/io.hpp>
 
@@ -25,4 +28,42 @@ static void Parse_VectorTile(benchmark::State& state) {
     }
 }
 
+// Reads the tile the way GeometryTileWorker::parse() does for a full Streets style, where
+// many style layers filter and read the features of the same source layer.
+static void Parse_VectorTile_Style(benchmark::State& state) {
+    auto data = std::make_shared<std::string>(util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf"));
+
+    style::Parser parser;
+    parser.parse(util::read_file("benchmark/fixtures/api/style.json"));
+
+    std::vector<std::pair<std::string, style::Filter>> layers;
+    for (const auto& layer : parser.layers) {
+        if (!layer->getSourceLayer().empty()) {
+            layers.emplace_back(layer->getSourceLayer(), layer->getFilter());
+        }
+    }
+
+    while (state.KeepRunning()) {
+        std::size_t length = 0;
+        VectorTileData tile(data);
+        // Like the worker, hold on to the source layers so that their decoded features are reused.
+        std::vector<std::unique_ptr<GeometryTileLayer>> sourceLayers;
+        for (const auto& layer : layers) {
+            if (auto geometryLayer = tile.getLayer(layer.first)) {
+                const std::size_t count = geometryLayer->featureCount();
+                for (std::size_t i = 0; i < count; i++) {
+                    auto feature = geometryLayer->getFeature(i);
+                    if (!layer.second(style::expression::EvaluationContext(10.0f, feature.get()))) {
+                        continue;
+                    }
+                    length += feature->getGeometries().size();
+                }
+                sourceLayers.push_back(std::move(geometryLayer));
+            }
+        }
+        benchmark::DoNotOptimize(length);
+    }
+}
+
 BENCHMARK(Parse_VectorTile);
+BENCHMARK(Parse_VectorTile_Style);
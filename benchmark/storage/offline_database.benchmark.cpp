@@ -4,10 +4,13 @@
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/response.hpp>
 #include <mbgl/storage/sqlite3.hpp>
+#include <mbgl/util/io.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/logging.hpp>
 
+#include <atomic>
 #include <random>
+#include <thread>
 
 class OfflineDatabase : public benchmark::Fixture {
 public:
@@ -131,6 +134,52 @@ BENCHMARK_F(OfflineDatabase, GetTile)(benchmark::State& state) {
     }
 }
 
+BENCHMARK_F(OfflineDatabase, GetTileBatchedAccess)(benchmark::State& state) {
+    using namespace mbgl;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> dis(0, tileCount - 1);
+
+    db.setBatchAccessedUpdates(true);
+
+    while (state.KeepRunning()) {
+        auto res = db.get(Resource::tile("mapbox://tile_ambient" + util::toString(dis(gen)), 1, 0, 0, 0, Tileset::Scheme::XYZ));
+        assert(res != nullopt);
+    }
+
+    db.setBatchAccessedUpdates(false);
+}
+
+// Mostly hits with an occasional insertion, as seen when panning around an area that is already cached.
+static void hitHeavyWorkload(benchmark::State& state, mbgl::OfflineDatabase& db, const mbgl::Response& response, unsigned tileCount) {
+    using namespace mbgl;
+
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<> dis(0, tileCount - 1);
+
+    while (state.KeepRunning()) {
+        if (state.iterations() % 20 == 0) {
+            const Resource ambient = Resource::tile("mapbox://HitHeavy" +
+                    util::toString(state.iterations()), 1, 0, 0, 0, Tileset::Scheme::XYZ);
+            db.put(ambient, response);
+        } else {
+            auto res = db.get(Resource::tile("mapbox://tile_ambient" + util::toString(dis(gen)), 1, 0, 0, 0, Tileset::Scheme::XYZ));
+            assert(res != nullopt);
+        }
+    }
+}
+
+BENCHMARK_F(OfflineDatabase, HitHeavy)(benchmark::State& state) {
+    hitHeavyWorkload(state, db, response, tileCount);
+}
+
+BENCHMARK_F(OfflineDatabase, HitHeavyBatchedAccess)(benchmark::State& state) {
+    db.setBatchAccessedUpdates(true);
+    hitHeavyWorkload(state, db, response, tileCount);
+    db.setBatchAccessedUpdates(false);
+}
+
 BENCHMARK_F(OfflineDatabase, AddTilesToFullDatabase)(benchmark::State& state) {
     using namespace mbgl;
 
@@ -194,3 +243,62 @@ BENCHMARK_F(OfflineDatabase, ResizeDatabase)(benchmark::State& state) {
         }
     }
 }
+
+// Latency of cache reads through a separate connection while another connection keeps
+// writing to the ambient cache, as when an offline download runs while the map renders.
+static void OfflineDatabase_ReadUnderWriteLoad(benchmark::State& state, bool writeAheadLog) {
+    using namespace mbgl;
+    using namespace std::chrono_literals;
+
+    const std::string path = "benchmark_offline_database.db";
+    util::deleteFile(path);
+
+    Response response;
+    response.data = std::make_shared<std::string>(50 * 1024, 0);
+    response.expires = util::now() + 1h;
+
+    const unsigned tileCount = 100;
+    {
+        mbgl::OfflineDatabase writer(path, writeAheadLog);
+        for (unsigned i = 0; i < tileCount; ++i) {
+            writer.put(Resource::tile("mapbox://tile_ambient" + util::toString(i), 1, 0, 0, 0, Tileset::Scheme::XYZ),
+                       response);
+        }
+
+        std::atomic<bool> running{true};
+        std::thread writes([&] {
+            for (unsigned i = 0; running; ++i) {
+                writer.put(Resource::tile("mapbox://tile_write" + util::toString(i), 1, 0, 0, 0, Tileset::Scheme::XYZ),
+                           response);
+            }
+        });
+
+        mbgl::OfflineDatabase reader(path, writeAheadLog, true /*readOnly*/);
+        std::mt19937 gen(0);
+        std::uniform_int_distribution<> dis(0, tileCount - 1);
+
+        while (state.KeepRunning()) {
+            auto res = reader.get(
+                Resource::tile("mapbox://tile_ambient" + util::toString(dis(gen)), 1, 0, 0, 0, Tileset::Scheme::XYZ));
+            benchmark::DoNotOptimize(res);
+        }
+
+        running = false;
+        writes.join();
+    }
+
+    util::deleteFile(path);
+    util::deleteFile(path + "-wal");
+    util::deleteFile(path + "-shm");
+}
+
+static void OfflineDatabase_ReadUnderWriteLoad_Delete(benchmark::State& state) {
+    OfflineDatabase_ReadUnderWriteLoad(state, false);
+}
+
+static void OfflineDatabase_ReadUnderWriteLoad_WAL(benchmark::State& state) {
+    OfflineDatabase_ReadUnderWriteLoad(state, true);
+}
+
+BENCHMARK(OfflineDatabase_ReadUnderWriteLoad_Delete)->UseRealTime();
+BENCHMARK(OfflineDatabase_ReadUnderWriteLoad_WAL)->UseRealTime();
@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/util/compression.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/lz4.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+const std::string& tile() {
+    static const std::string data = util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf");
+    return data;
+}
+
+} // namespace
+
+static void Util_Compress_Deflate(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(util::compress(tile()));
+    }
+}
+
+static void Util_Compress_LZ4(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(util::lz4::compress(tile()));
+    }
+}
+
+static void Util_Decompress_Deflate(benchmark::State& state) {
+    const std::string compressed = util::compress(tile());
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(util::decompress(compressed));
+    }
+}
+
+static void Util_Decompress_LZ4(benchmark::State& state) {
+    const std::string compressed = util::lz4::compress(tile());
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(util::lz4::decompress(compressed));
+    }
+}
+
+BENCHMARK(Util_Compress_Deflate);
+BENCHMARK(Util_Compress_LZ4);
+BENCHMARK(Util_Decompress_Deflate);
+BENCHMARK(Util_Decompress_LZ4);
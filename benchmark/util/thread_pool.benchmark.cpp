@@ -0,0 +1,135 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/util/thread_pool.hpp>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+constexpr std::size_t kTaskCount = 10000;
+
+// Burns a little bit of CPU, roughly the cost of a small message handler.
+void work(std::size_t seed) {
+    std::size_t value = seed;
+    for (std::size_t i = 0; i < 64; ++i) {
+        value = value * 31 + i;
+    }
+    benchmark::DoNotOptimize(value);
+}
+
+// Schedules independent tasks from a thread outside of the pool.
+template <class PoolType>
+void scheduleExternal(benchmark::State& state, PoolType& pool) {
+    while (state.KeepRunning()) {
+        std::atomic<std::size_t> remaining{kTaskCount};
+        std::promise<void> done;
+        for (std::size_t i = 0; i < kTaskCount; ++i) {
+            pool.schedule([&, i] {
+                work(i);
+                if (--remaining == 0) done.set_value();
+            });
+        }
+        done.get_future().get();
+    }
+    state.SetItemsProcessed(state.iterations() * kTaskCount);
+}
+
+// Schedules a tree of tasks from within the pool, which is how mailboxes reschedule themselves.
+template <class PoolType>
+void scheduleNested(benchmark::State& state, PoolType& pool) {
+    constexpr std::size_t fanOut = 100;
+    while (state.KeepRunning()) {
+        std::atomic<std::size_t> remaining{fanOut * fanOut};
+        std::promise<void> done;
+        for (std::size_t i = 0; i < fanOut; ++i) {
+            pool.schedule([&, i] {
+                for (std::size_t j = 0; j < fanOut; ++j) {
+                    pool.schedule([&, i, j] {
+                        work(i * fanOut + j);
+                        if (--remaining == 0) done.set_value();
+                    });
+                }
+            });
+        }
+        done.get_future().get();
+    }
+    state.SetItemsProcessed(state.iterations() * fanOut * fanOut);
+}
+
+class Counter {
+public:
+    Counter(ActorRef<Counter>) {}
+
+    void increment(std::atomic<std::size_t>* remaining, std::promise<void>* done) {
+        work(count++);
+        if (--*remaining == 0) done->set_value();
+    }
+
+private:
+    std::size_t count = 0;
+};
+
+// Sends messages to many actors, exercising the Mailbox scheduling path.
+template <class PoolType>
+void actorMessages(benchmark::State& state, PoolType& pool) {
+    constexpr std::size_t actorCount = 100;
+    std::vector<std::unique_ptr<Actor<Counter>>> actors;
+    for (std::size_t i = 0; i < actorCount; ++i) {
+        actors.emplace_back(std::make_unique<Actor<Counter>>(pool));
+    }
+
+    while (state.KeepRunning()) {
+        std::atomic<std::size_t> remaining{kTaskCount};
+        std::promise<void> done;
+        for (std::size_t i = 0; i < kTaskCount; ++i) {
+            actors[i % actorCount]->self().invoke(&Counter::increment, &remaining, &done);
+        }
+        done.get_future().get();
+    }
+    state.SetItemsProcessed(state.iterations() * kTaskCount);
+}
+
+} // namespace
+
+static void ThreadPool_MutexQueue_External(benchmark::State& state) {
+    ParallelScheduler<3> pool;
+    scheduleExternal(state, pool);
+}
+
+static void ThreadPool_WorkStealing_External(benchmark::State& state) {
+    ThreadPool pool(4);
+    scheduleExternal(state, pool);
+}
+
+static void ThreadPool_MutexQueue_Nested(benchmark::State& state) {
+    ParallelScheduler<3> pool;
+    scheduleNested(state, pool);
+}
+
+static void ThreadPool_WorkStealing_Nested(benchmark::State& state) {
+    ThreadPool pool(4);
+    scheduleNested(state, pool);
+}
+
+static void ThreadPool_MutexQueue_Actors(benchmark::State& state) {
+    ParallelScheduler<3> pool;
+    actorMessages(state, pool);
+}
+
+static void ThreadPool_WorkStealing_Actors(benchmark::State& state) {
+    ThreadPool pool(4);
+    actorMessages(state, pool);
+}
+
+BENCHMARK(ThreadPool_MutexQueue_External)->UseRealTime();
+BENCHMARK(ThreadPool_WorkStealing_External)->UseRealTime();
+BENCHMARK(ThreadPool_MutexQueue_Nested)->UseRealTime();
+BENCHMARK(ThreadPool_WorkStealing_Nested)->UseRealTime();
+BENCHMARK(ThreadPool_MutexQueue_Actors)->UseRealTime();
+BENCHMARK(ThreadPool_WorkStealing_Actors)->UseRealTime();
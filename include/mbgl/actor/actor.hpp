@@ -65,6 +65,11 @@ public:
         return parent.self();
     }
 
+    // Sets the priority with which the scheduler processes messages sent to this actor.
+    void setPriority(TaskPriority priority) {
+        parent.mailbox->setPriority(priority);
+    }
+
 private:
     std::shared_ptr<Scheduler> retainer;
     AspiringActor<Object> parent;
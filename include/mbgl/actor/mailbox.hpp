@@ -2,6 +2,8 @@
 
 #include <mbgl/util/optional.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -13,6 +15,7 @@ namespace mbgl {
 
 class Scheduler;
 class Message;
+enum class TaskPriority : uint8_t;
 
 class Mailbox : public std::enable_shared_from_this<Mailbox> {
 public:
@@ -33,6 +36,12 @@ public:
 
     bool isOpen() const;
 
+    // Sets the priority with which the scheduler processes this mailbox. Applies
+    // from the next time the mailbox is scheduled; messages are still processed
+    // in the order they were pushed.
+    void setPriority(TaskPriority);
+    TaskPriority getPriority() const;
+
     void push(std::unique_ptr<Message>);
     void receive();
 
@@ -40,7 +49,10 @@ public:
     static std::function<void()> makeClosure(std::weak_ptr<Mailbox>);
 
 private:
+    void scheduleReceive();
+
     mapbox::base::WeakPtr<Scheduler> weakScheduler;
+    std::atomic<TaskPriority> priority;
 
     std::recursive_mutex receivingMutex;
     std::mutex pushingMutex;
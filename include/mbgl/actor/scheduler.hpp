@@ -4,6 +4,7 @@
 
 #include <mapbox/std/weak.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 
@@ -11,6 +12,18 @@ namespace mbgl {
 
 class Mailbox;
 
+// Relative urgency of a scheduled task, from the most urgent to the least urgent.
+// Schedulers supporting priorities run all of the pending tasks of a higher
+// priority before any task of a lower priority.
+enum class TaskPriority : uint8_t {
+    Critical, // Work blocking the next complete frame, e.g. tiles at the viewport center.
+    Visible,  // Work for content on screen; the default.
+    Prefetch, // Speculative work, e.g. prefetched lower zoom tiles.
+    Idle      // Work that is only useful if nothing else is pending, e.g. cached tiles.
+};
+
+constexpr std::size_t TaskPriorityCount = 4;
+
 /*
     A `Scheduler` is responsible for coordinating the processing of messages by
     one or more actors via their mailboxes. It's an abstract interface. Currently,
@@ -24,7 +37,8 @@ class Mailbox;
         concurrency within a mailbox
 
       Subject to these constraints, processing can happen on whatever thread in the
-      pool is available.
+      pool is available. Idle threads steal work from busy ones, and the pool size
+      is chosen at runtime (see `EXPERIMENTAL_THREAD_POOL_SIZE`).
 
     * `Scheduler::GetCurrent()` is typically used to create a mailbox and `ActorRef`
       for an object that lives on the main thread and is not itself wrapped an
@@ -39,6 +53,9 @@ public:
 
     // Enqueues a function for execution.
     virtual void schedule(std::function<void()>) = 0;
+    // Enqueues a function for execution with the given priority. Schedulers that
+    // don't support priorities process it like any other scheduled function.
+    virtual void scheduleWithPriority(TaskPriority, std::function<void()> fn) { schedule(std::move(fn)); }
     // Makes a weak pointer to this Scheduler.
     virtual mapbox::base::WeakPtr<Scheduler> makeWeakPtr() = 0;
 
@@ -8,20 +8,32 @@ struct RenderingStats {
     bool isZero() const;
 
     int numDrawCalls;
+    // Changes of the bound program and of depth, stencil, color, face culling and line width
+    // state; assignments that leave the state as it was are not counted.
+    int numStateChanges;
     int numActiveTextures;
     int numCreatedTextures;
+    // Vertex and index buffers, including those that share a pooled GL buffer.
     int numBuffers;
     int numFrameBuffers;
 
     int memTextures;
+    // Bytes of index and vertex data in the ranges handed out by the buffer pools, without
+    // alignment padding (see memBufferPoolUsed).
     int memIndexBuffers;
     int memVertexBuffers;
 
+    // Bytes in use in, and total size of, the pooled vertex and index buffer blocks, including
+    // alignment padding. Sampled at the end of every frame.
+    int memBufferPoolUsed;
+    int memBufferPoolCapacity;
+
     RenderingStats& operator+=(const RenderingStats& right);
 };
 
 inline RenderingStats& RenderingStats::operator+=(const RenderingStats& r) {
     numDrawCalls += r.numDrawCalls;
+    numStateChanges += r.numStateChanges;
     numActiveTextures += r.numActiveTextures;
     numCreatedTextures += r.numCreatedTextures;
     numBuffers += r.numBuffers;
@@ -30,6 +42,8 @@ inline RenderingStats& RenderingStats::operator+=(const RenderingStats& r) {
     memTextures += r.memTextures;
     memIndexBuffers += r.memIndexBuffers;
     memVertexBuffers += r.memVertexBuffers;
+    memBufferPoolUsed += r.memBufferPoolUsed;
+    memBufferPoolCapacity += r.memBufferPoolCapacity;
     return *this;
 }
 
@@ -128,6 +128,16 @@ public:
     void setPrefetchZoomDelta(uint8_t delta);
     uint8_t getPrefetchZoomDelta() const;
 
+    // Tile cache
+    //
+    // Tiles that go out of view are kept in a cache shared by all sources so that they can be
+    // shown again without being reloaded. By default the cache holds a number of tiles derived
+    // from the viewport size. Setting a size in bytes also bounds the approximate memory held
+    // by all cached tiles (layout buffers, feature index, glyph and icon atlases), so that
+    // cheap tiles don't take up room needed by expensive ones. Zero removes the bound.
+    void setTileCacheSize(std::size_t bytes);
+    std::size_t getTileCacheSize() const;
+
     // Debug
     void setDebug(MapDebugOptions);
     MapDebugOptions getDebug() const;
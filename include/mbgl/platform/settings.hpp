@@ -15,6 +15,10 @@ DECLARE_MAPBOX_SETTING(EXPERIMENTAL_THREAD_PRIORITY_FILE, thread_priority_file);
 DECLARE_MAPBOX_SETTING(EXPERIMENTAL_THREAD_PRIORITY_NETWORK, thread_priority_network);
 DECLARE_MAPBOX_SETTING(EXPERIMENTAL_THREAD_PRIORITY_DATABASE, thread_priority_database);
 
+// The value for EXPERIMENTAL_THREAD_POOL_SIZE key, must be an unsigned integer.
+// Only affects pools created after the value is set.
+DECLARE_MAPBOX_SETTING(EXPERIMENTAL_THREAD_POOL_SIZE, thread_pool_size);
+
 // Settings class provides non-persistent, in-process key-value storage.
 class Settings final {
 public:
@@ -2,9 +2,11 @@
 
 #include <mbgl/renderer/query.hpp>
 #include <mbgl/annotation/annotation.hpp>
+#include <mbgl/util/chrono.hpp>
 #include <mbgl/util/geo.hpp>
 #include <mbgl/util/geojson.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -40,6 +42,22 @@ struct PlacedSymbolData {
     std::string layer;
 };
 
+struct TileCacheStats {
+    // Number of cached tiles
+    std::size_t tiles;
+    // Approximate memory held by the cached tiles, in bytes
+    std::size_t memoryUsage;
+    // Memory budget in bytes (see Map::setTileCacheSize()); zero if bounded by tile count only
+    std::size_t memoryBudget;
+    // Maximum number of cached tiles
+    std::size_t size;
+    // Tiles taken from the cache, and tiles looked up but not found
+    uint64_t hits;
+    uint64_t misses;
+    // Tiles evicted to stay within the limits
+    uint64_t evictions;
+};
+
 class Renderer {
 public:
     Renderer(gfx::RendererBackend&, float pixelRatio_, const optional<std::string>& localFontFamily = {});
@@ -101,8 +119,66 @@ public:
      */
     const std::vector<PlacedSymbolData>& getPlacedSymbolsData() const;
 
+    /**
+     * @brief In Continuous map mode, spreads symbol placement over several frames,
+     * spending at most roughly `budget` on it per frame.
+     *
+     * Until a placement completes, frames are rendered with the previous placement.
+     * With `nullopt` (the default), every placement completes in the frame it starts.
+     */
+    void setPlacementBudget(optional<Duration> budget);
+
+    /**
+     * @brief In Continuous map mode, lets a placement take over the result of the previous one
+     * while the map is only panned by a few pixels and the symbols have not changed, instead of
+     * colliding all symbols again. This saves CPU time while panning continuously.
+     *
+     * Symbols entering or leaving the viewport during such pans are placed when the next full
+     * placement runs. Disabled by default.
+     */
+    void setIncrementalPlacement(bool enabled);
+
+    /**
+     * @brief In Static and Tile map modes, projects the collision circles of line labels on the
+     * background threads before placing them. The placement result is the same either way.
+     * Enabled by default.
+     */
+    void setParallelPlacement(bool enabled);
+
+    /**
+     * @brief Sets the directory in which linked shader programs are cached, so that later runs
+     * load them instead of compiling them again. Cache files are specific to the shaders, the
+     * pixel ratio and the graphics driver.
+     *
+     * Only takes effect if set before the first `render()` call. Programs are not cached by
+     * default, nor where the driver does not support program binaries. Cache files are written
+     * when the renderer is destroyed or reduces its memory use, not while rendering.
+     */
+    void setProgramCacheDir(const optional<std::string>& dir);
+
+    /**
+     * @brief Enables or disables precompiling of shader programs. When enabled, every variant
+     * found in the program cache of the programs used by the layers of the style is loaded
+     * before the first frame showing these layers is drawn, instead of whenever a layer type or
+     * a data-driven variant is first drawn, which would stall the frames that draw them.
+     *
+     * Only has an effect with a program cache directory that an earlier run filled; a run
+     * with an empty cache still compiles each variant when it is first drawn. Disabled by default.
+     */
+    void setProgramPrecompilation(bool enabled);
+
+    /**
+     * @brief Enables or disables clipping the fill and line draws of each tile with a scissor
+     * rectangle instead of a stencil mask, where no tile overlaps another and the map is neither
+     * pitched nor rotated by other than a multiple of 90 degrees. This skips drawing the stencil
+     * masks. Disabled by default.
+     */
+    void setTileScissorClipping(bool enabled);
+
     // Memory
     void reduceMemoryUse();
+    // Returns the state of the tile cache shared by all sources.
+    TileCacheStats getTileCacheStats() const;
     void clearData();
 
 private:
@@ -23,6 +23,13 @@ public:
     void pause() override;
     void resume() override;
 
+    /*
+     * In-memory cache of responses that the main resource loader keeps in front of this
+     * database. Operations that change or remove resources in the database clear it, so that
+     * it never serves responses the database no longer has.
+     */
+    std::shared_ptr<ResponseCache> getResponseCache() const override;
+
     // Methods common to Ambient cache and Offline functionality
 
     /*
@@ -12,6 +12,7 @@ namespace mbgl {
 
 class AsyncRequest;
 class Resource;
+class ResponseCache;
 
 // TODO: Rename to ResourceProviderType
 enum FileSourceType : uint8_t {
@@ -86,6 +87,10 @@ public:
     // When supported, sets the modifier of the requested resources.
     virtual void setResourceTransform(ResourceTransform) {} // NOLINT(performance-unnecessary-value-param)
 
+    // Returns the in-memory cache of responses that a resource loader may keep in front of this
+    // file source, if the file source owns one and clears it whenever its resources change.
+    virtual std::shared_ptr<ResponseCache> getResponseCache() const { return nullptr; }
+
 protected:
     FileSource() = default;
 };
@@ -104,10 +109,23 @@ constexpr const char* API_BASE_URL_KEY = "api-base-url";
 // type: unsigned
 constexpr const char* MAX_CONCURRENT_REQUESTS_KEY = "max-concurrent-requests";
 
+// Property name to set / get the size in bytes of the in-memory cache that the main resource loader keeps in front of
+// the database. Zero disables it.
+// type: uint64_t
+constexpr const char* MEMORY_CACHE_SIZE_KEY = "memory-cache-size";
+
 // Properties that may be supported by database file sources:
 
 // Property to set database mode. When set, database opens in read-only mode; database opens in read-write-create mode
 // otherwise. type: bool
 constexpr const char* READ_ONLY_MODE_KEY = "read-only-mode";
 
+// Property to batch updates of the ambient cache access timestamps used for LRU eviction. When set, reads no longer
+// write to the database immediately. type: bool
+constexpr const char* BATCH_ACCESSED_UPDATES_KEY = "batch-accessed-updates";
+
+// Property to compress newly stored resources with a codec that decompresses faster than deflate at a lower
+// compression ratio. Databases written in this mode can't be read by versions without support for it. type: bool
+constexpr const char* FAST_COMPRESSION_KEY = "fast-compression";
+
 } // namespace mbgl
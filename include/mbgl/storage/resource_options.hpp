@@ -96,6 +96,41 @@ public:
      */
     uint64_t maximumCacheSize() const;
 
+    /**
+     * @brief Sets whether the cache database uses a write-ahead log. In this mode
+     * the database is opened with `journal_mode = WAL` and `synchronous = NORMAL`,
+     * and cache reads are served by a pool of read-only connections, so they no
+     * longer wait for offline downloads or ambient cache writes. Disabling it
+     * migrates an existing database back to the rollback journal. Off by default.
+     *
+     * @param enabled Whether to use a write-ahead log.
+     * @return reference to ResourceOptions for chaining options together.
+     */
+    ResourceOptions& withWriteAheadLog(bool enabled);
+
+    /**
+     * @brief Gets the previously set (or default) write-ahead log setting.
+     *
+     * @return true if the cache database uses a write-ahead log.
+     */
+    bool writeAheadLog() const;
+
+    /**
+     * @brief Sets the number of read-only connections used for cache reads when
+     * the write-ahead log is enabled. Zero serves all reads on the database thread.
+     *
+     * @param count Number of read-only connections.
+     * @return reference to ResourceOptions for chaining options together.
+     */
+    ResourceOptions& withDatabaseReaderCount(uint32_t count);
+
+    /**
+     * @brief Gets the previously set (or default) number of read-only connections.
+     *
+     * @return number of read-only connections.
+     */
+    uint32_t databaseReaderCount() const;
+
     /**
      * @brief Sets the platform context. A platform context is usually an object
      * that assists the creation of a file source.
@@ -48,6 +48,10 @@ constexpr uint8_t DEFAULT_PREFETCH_ZOOM_DELTA = 4;
 
 constexpr uint64_t DEFAULT_MAX_CACHE_SIZE = 50 * 1024 * 1024;
 
+// Default size of the in-memory tier in front of the cache database, enough for the
+// style, sprites, glyphs and the tiles of a few screens.
+constexpr std::size_t DEFAULT_MEMORY_CACHE_SIZE = 16 * 1024 * 1024;
+
 // Default ImageManager's cache size for images added via onStyleImageMissing API.
 // Average sprite size with 1.0 pixel ratio is ~2kB, 8kB for pixel ratio of 2.0.
 constexpr std::size_t DEFAULT_ON_DEMAND_IMAGES_CACHE_SIZE = 100 * 8192;
@@ -7,11 +7,13 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/mapbox.hpp>
 #include <mbgl/util/expected.hpp>
+#include <mbgl/util/chrono.hpp>
 
 #include <list>
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 
 namespace mapbox {
 namespace sqlite {
@@ -37,7 +39,10 @@ struct MapboxTileLimitExceededException :  util::Exception {
 
 class OfflineDatabase {
 public:
-    OfflineDatabase(std::string path);
+    // With `writeAheadLog`, the database uses `journal_mode = WAL` and `synchronous = NORMAL` so
+    // that read-only connections to the same file can read while this one writes. Opening a
+    // database in WAL mode without it switches the database back to the rollback journal.
+    OfflineDatabase(std::string path, bool writeAheadLog = false, bool readOnly = false);
     ~OfflineDatabase();
 
     void changePath(const std::string&);
@@ -94,6 +99,23 @@ public:
 
     void reopenDatabaseReadOnly(bool readOnly);
 
+    // When enabled, reads of ambient cache entries no longer write the
+    // `accessed` timestamp immediately. Timestamps are collected in memory
+    // and written in a single transaction once enough of them accumulate,
+    // after a while, before eviction and when the database is packed or
+    // closed. Disabling flushes pending timestamps.
+    void setBatchAccessedUpdates(bool);
+
+    // When enabled, blobs written from now on are compressed with LZ4, which
+    // decompresses several times faster than deflate at a lower ratio. Rows
+    // keep the codec they were written with. Databases containing such rows
+    // can't be read by versions that only know deflate.
+    void setFastCompression(bool fastCompression_) { fastCompression = fastCompression_; }
+
+    // Updates the `accessed` timestamp of a resource that was read through
+    // another connection to the same database.
+    void recordAccess(const Resource&);
+
 private:
     class DatabaseSizeChangeStats;
 
@@ -103,6 +125,7 @@ private:
     void handleError(const std::runtime_error& ex, const char* action);
     void handleError(const char* action);
 
+    void configureJournal();
     void removeExisting();
     void removeOldCacheTable();
     void createSchema();
@@ -114,17 +137,26 @@ private:
     void vacuum();
     void checkFlags();
 
+    // Records an access for a batched update of the `accessed` column.
+    void recordResourceAccess(const std::string& url);
+    void recordTileAccess(const Resource::TileData&);
+    // Writes batched timestamps if enough of them accumulated or the last
+    // flush is too old. Must not be called within a transaction.
+    void flushAccessedTimestampsIfNeeded();
+    // Writes all batched timestamps; runs within the caller's transaction, if any.
+    void flushAccessedTimestamps();
+
     mapbox::sqlite::Statement& getStatement(const char *);
 
     optional<std::pair<Response, uint64_t>> getTile(const Resource::TileData&);
     optional<int64_t> hasTile(const Resource::TileData&);
     bool putTile(const Resource::TileData&, const Response&,
-                 const std::string&, bool compressed);
+                 const std::string&, int64_t compression);
 
     optional<std::pair<Response, uint64_t>> getResource(const Resource&);
     optional<int64_t> hasResource(const Resource&);
     bool putResource(const Resource&, const Response&,
-                     const std::string&, bool compressed);
+                     const std::string&, int64_t compression);
 
     uint64_t putRegionResourceInternal(int64_t regionID, const Resource&, const Response&);
 
@@ -183,6 +215,14 @@ private:
 
     bool autopack = true;
     bool readOnly = false;
+    const bool writeAheadLog;
+    bool fastCompression = false;
+
+    using TileKey = std::tuple<std::string, uint8_t, int32_t, int32_t, int8_t>;
+    bool batchAccessedUpdates = false;
+    std::map<std::string, Timestamp> pendingResourceAccesses;
+    std::map<TileKey, Timestamp> pendingTileAccesses;
+    Timestamp lastAccessedFlush = util::now();
 };
 
 } // namespace mbgl
@@ -6,35 +6,52 @@
 #include <mbgl/storage/offline_download.hpp>
 #include <mbgl/storage/resource_options.hpp>
 #include <mbgl/storage/response.hpp>
+#include <mbgl/storage/response_cache.hpp>
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/logging.hpp>
 #include <mbgl/util/platform.hpp>
 #include <mbgl/util/thread.hpp>
 
+#include <atomic>
 #include <map>
 #include <utility>
+#include <vector>
 
 namespace mbgl {
+namespace {
+
+void respond(optional<Response> offlineResponse, const ActorRef<FileSourceRequest>& req) {
+    if (!offlineResponse) {
+        offlineResponse.emplace();
+        offlineResponse->noContent = true;
+        offlineResponse->error =
+            std::make_unique<Response::Error>(Response::Error::Reason::NotFound, "Not found in offline database");
+    } else if (!offlineResponse->isUsable()) {
+        offlineResponse->error =
+            std::make_unique<Response::Error>(Response::Error::Reason::NotFound, "Cached resource is unusable");
+    }
+    req.invoke(&FileSourceRequest::setResponse, *offlineResponse);
+}
+
+} // namespace
+
 class DatabaseFileSourceThread {
 public:
-    DatabaseFileSourceThread(std::shared_ptr<FileSource> onlineFileSource_, const std::string& cachePath)
-        : db(std::make_unique<OfflineDatabase>(cachePath)), onlineFileSource(std::move(onlineFileSource_)) {}
+    DatabaseFileSourceThread(std::shared_ptr<FileSource> onlineFileSource_,
+                             const std::string& cachePath,
+                             bool writeAheadLog)
+        : db(std::make_unique<OfflineDatabase>(cachePath, writeAheadLog)),
+          onlineFileSource(std::move(onlineFileSource_)) {}
 
     void request(const Resource& resource, const ActorRef<FileSourceRequest>& req) {
-        optional<Response> offlineResponse =
-            (resource.storagePolicy != Resource::StoragePolicy::Volatile) ? db->get(resource) : nullopt;
-        if (!offlineResponse) {
-            offlineResponse.emplace();
-            offlineResponse->noContent = true;
-            offlineResponse->error =
-                std::make_unique<Response::Error>(Response::Error::Reason::NotFound, "Not found in offline database");
-        } else if (!offlineResponse->isUsable()) {
-            offlineResponse->error =
-                std::make_unique<Response::Error>(Response::Error::Reason::NotFound, "Cached resource is unusable");
-        }
-        req.invoke(&FileSourceRequest::setResponse, *offlineResponse);
+        respond((resource.storagePolicy != Resource::StoragePolicy::Volatile) ? db->get(resource) : nullopt, req);
     }
 
+    void recordAccess(const Resource& resource) { db->recordAccess(resource); }
+
+    // Runs the callback once all previously queued messages were processed.
+    void sync(const std::function<void()>& callback) { callback(); }
+
     void setDatabasePath(const std::string& path, const std::function<void()>& callback) {
         db->changePath(path);
         if (callback) {
@@ -124,6 +141,10 @@ public:
 
     void reopenDatabaseReadOnly(bool readOnly) { db->reopenDatabaseReadOnly(readOnly); }
 
+    void setBatchAccessedUpdates(bool batch) { db->setBatchAccessedUpdates(batch); }
+
+    void setFastCompression(bool fastCompression) { db->setFastCompression(fastCompression); }
+
 private:
     expected<OfflineDownload*, std::exception_ptr> getDownload(int64_t regionID) {
         if (!onlineFileSource) {
@@ -149,33 +170,164 @@ private:
     std::shared_ptr<FileSource> onlineFileSource;
 };
 
+// Serves cache reads through a read-only connection while the database thread writes. Only
+// used with a write-ahead log, where readers see the last committed state without waiting.
+class DatabaseFileSourceReadThread {
+public:
+    DatabaseFileSourceReadThread(ActorRef<DatabaseFileSourceThread> writer_, std::string path_)
+        : writer(std::move(writer_)), path(std::move(path_)) {}
+
+    void request(const Resource& resource, const ActorRef<FileSourceRequest>& req) {
+        if (!db) {
+            db = std::make_unique<OfflineDatabase>(path, true /*writeAheadLog*/, true /*readOnly*/);
+        }
+        optional<Response> offlineResponse = db->get(resource);
+        if (offlineResponse) {
+            // Read-only connections can't update the timestamp used for LRU eviction.
+            writer.invoke(&DatabaseFileSourceThread::recordAccess, resource);
+        }
+        respond(std::move(offlineResponse), req);
+    }
+
+    void setDatabasePath(const std::string& path_) {
+        db.reset();
+        path = path_;
+    }
+
+private:
+    ActorRef<DatabaseFileSourceThread> writer;
+    std::string path;
+    std::unique_ptr<OfflineDatabase> db;
+};
+
 class DatabaseFileSource::Impl {
 public:
-    Impl(std::shared_ptr<FileSource> onlineFileSource, const std::string& cachePath)
-        : thread(std::make_unique<util::Thread<DatabaseFileSourceThread>>(
+    Impl(std::shared_ptr<FileSource> onlineFileSource, const ResourceOptions& options)
+        : path(options.cachePath()),
+          responseCache(std::make_shared<ResponseCache>(util::DEFAULT_MEMORY_CACHE_SIZE)),
+          thread(std::make_unique<util::Thread<DatabaseFileSourceThread>>(
               util::makeThreadPrioritySetter(platform::EXPERIMENTAL_THREAD_PRIORITY_DATABASE),
               "DatabaseFileSource",
               std::move(onlineFileSource),
-              cachePath)) {}
+              options.cachePath(),
+              options.writeAheadLog())) {
+        // An in-memory database can't be shared between connections.
+        if (!options.writeAheadLog() || options.cachePath() == ":memory:") {
+            return;
+        }
+
+        for (uint32_t i = 0; i < options.databaseReaderCount(); ++i) {
+            readers.emplace_back(std::make_unique<util::Thread<DatabaseFileSourceReadThread>>(
+                util::makeThreadPrioritySetter(platform::EXPERIMENTAL_THREAD_PRIORITY_DATABASE),
+                "DatabaseFileSourceRead",
+                thread->actor(),
+                options.cachePath()));
+        }
+
+        // Readers open the database lazily, which must not happen before it was created or migrated.
+        if (!readers.empty()) {
+            thread->actor().invoke(&DatabaseFileSourceThread::sync, [state = readerState] { state->enabled = true; });
+        }
+    }
 
     ActorRef<DatabaseFileSourceThread> actor() const { return thread->actor(); }
 
-    void pause() { thread->pause(); }
-    void resume() { thread->resume(); }
+    // Returns a reader for a cache read, if any is currently usable. Reads through readers may
+    // miss resources that were forwarded but not yet written by the database thread.
+    optional<ActorRef<DatabaseFileSourceReadThread>> reader() const {
+        if (readers.empty() || !readerState->enabled || !ambientCacheEnabled || paused) {
+            return nullopt;
+        }
+        return readers[readerState->next++ % readers.size()]->actor();
+    }
+
+    // Stops serving reads through readers until the database at `path` is ready, after the
+    // database thread changed or recreated it.
+    std::function<void()> reopenReaders(const std::string& path, std::function<void()> callback) {
+        if (readers.empty()) {
+            return callback;
+        }
+
+        readerState->enabled = false;
+        std::vector<ActorRef<DatabaseFileSourceReadThread>> refs;
+        for (const auto& reader : readers) {
+            refs.push_back(reader->actor());
+        }
+        return [refs = std::move(refs), path, state = readerState, callback = std::move(callback)] {
+            for (const auto& ref : refs) {
+                ref.invoke(&DatabaseFileSourceReadThread::setDatabasePath, path);
+            }
+            state->enabled = true;
+            if (callback) {
+                callback();
+            }
+        };
+    }
+
+    const std::shared_ptr<ResponseCache>& getResponseCache() const { return responseCache; }
+
+    // Drops the in-memory responses now and again once the database thread has changed the
+    // database, so that responses read while the change was pending aren't served afterwards.
+    template <typename... Args>
+    std::function<void(Args...)> invalidateResponses(std::function<void(Args...)> callback) {
+        responseCache->clear();
+        return [cache = responseCache, callback = std::move(callback)](Args... args) {
+            cache->clear();
+            if (callback) {
+                callback(std::move(args)...);
+            }
+        };
+    }
+
+    const std::string& databasePath() const { return path; }
+    void setDatabasePath(const std::string& path_) { path = path_; }
+
+    // Readers don't know about the ambient cache size. With the ambient cache disabled, only
+    // offline regions may be read, which the database thread decides.
+    void setAmbientCacheEnabled(bool enabled) { ambientCacheEnabled = enabled; }
+
+    void pause() {
+        thread->pause();
+        paused = true;
+    }
+    void resume() {
+        paused = false;
+        thread->resume();
+    }
 
 private:
+    struct ReaderState {
+        std::atomic<bool> enabled{false};
+        std::atomic<std::size_t> next{0};
+    };
+
+    std::string path;
+    // Set through the API and read by requests on any thread, like the reader state.
+    std::atomic<bool> paused{false};
+    std::atomic<bool> ambientCacheEnabled{true};
+    const std::shared_ptr<ResponseCache> responseCache;
+    const std::shared_ptr<ReaderState> readerState = std::make_shared<ReaderState>();
     const std::unique_ptr<util::Thread<DatabaseFileSourceThread>> thread;
+    std::vector<std::unique_ptr<util::Thread<DatabaseFileSourceReadThread>>> readers;
 };
 
 DatabaseFileSource::DatabaseFileSource(const ResourceOptions& options)
     : impl(std::make_unique<Impl>(FileSourceManager::get()->getFileSource(FileSourceType::Network, options),
-                                  options.cachePath())) {}
+                                  options)) {}
 
 DatabaseFileSource::~DatabaseFileSource() = default;
 
 std::unique_ptr<AsyncRequest> DatabaseFileSource::request(const Resource& resource, Callback callback) {
     auto req = std::make_unique<FileSourceRequest>(std::move(callback));
-    impl->actor().invoke(&DatabaseFileSourceThread::request, resource, req->actor());
+    optional<ActorRef<DatabaseFileSourceReadThread>> reader;
+    if (resource.storagePolicy != Resource::StoragePolicy::Volatile) {
+        reader = impl->reader();
+    }
+    if (reader) {
+        reader->invoke(&DatabaseFileSourceReadThread::request, resource, req->actor());
+    } else {
+        impl->actor().invoke(&DatabaseFileSourceThread::request, resource, req->actor());
+    }
     return req;
 }
 
@@ -196,11 +348,17 @@ bool DatabaseFileSource::canRequest(const Resource& resource) const {
 }
 
 void DatabaseFileSource::setDatabasePath(const std::string& path, std::function<void()> callback) {
-    impl->actor().invoke(&DatabaseFileSourceThread::setDatabasePath, path, std::move(callback));
+    impl->setDatabasePath(path);
+    impl->actor().invoke(&DatabaseFileSourceThread::setDatabasePath,
+                         path,
+                         impl->reopenReaders(path, impl->invalidateResponses(std::move(callback))));
 }
 
 void DatabaseFileSource::resetDatabase(std::function<void(std::exception_ptr)> callback) {
-    impl->actor().invoke(&DatabaseFileSourceThread::resetDatabase, std::move(callback));
+    impl->actor().invoke(&DatabaseFileSourceThread::resetDatabase, impl->invalidateResponses(std::move(callback)));
+    // The database file was replaced; readers must not keep reading the deleted one.
+    impl->actor().invoke(&DatabaseFileSourceThread::sync,
+                         impl->reopenReaders(impl->databasePath(), std::function<void()>()));
 }
 
 void DatabaseFileSource::packDatabase(std::function<void(std::exception_ptr)> callback) {
@@ -212,18 +370,21 @@ void DatabaseFileSource::runPackDatabaseAutomatically(bool autopack) {
 }
 
 void DatabaseFileSource::put(const Resource& resource, const Response& response) {
+    impl->getResponseCache()->erase(resource);
     impl->actor().invoke(&DatabaseFileSourceThread::put, resource, response);
 }
 
 void DatabaseFileSource::invalidateAmbientCache(std::function<void(std::exception_ptr)> callback) {
-    impl->actor().invoke(&DatabaseFileSourceThread::invalidateAmbientCache, std::move(callback));
+    impl->actor().invoke(&DatabaseFileSourceThread::invalidateAmbientCache,
+                         impl->invalidateResponses(std::move(callback)));
 }
 
 void DatabaseFileSource::clearAmbientCache(std::function<void(std::exception_ptr)> callback) {
-    impl->actor().invoke(&DatabaseFileSourceThread::clearAmbientCache, std::move(callback));
+    impl->actor().invoke(&DatabaseFileSourceThread::clearAmbientCache, impl->invalidateResponses(std::move(callback)));
 }
 
 void DatabaseFileSource::setMaximumAmbientCacheSize(uint64_t size, std::function<void(std::exception_ptr)> callback) {
+    impl->setAmbientCacheEnabled(size > 0);
     impl->actor().invoke(&DatabaseFileSourceThread::setMaximumAmbientCacheSize, size, std::move(callback));
 }
 
@@ -253,12 +414,13 @@ void DatabaseFileSource::updateOfflineMetadata(
 
 void DatabaseFileSource::deleteOfflineRegion(const OfflineRegion& region,
                                              std::function<void(std::exception_ptr)> callback) {
-    impl->actor().invoke(&DatabaseFileSourceThread::deleteRegion, region, std::move(callback));
+    impl->actor().invoke(&DatabaseFileSourceThread::deleteRegion, region, impl->invalidateResponses(std::move(callback)));
 }
 
 void DatabaseFileSource::invalidateOfflineRegion(const OfflineRegion& region,
                                                  std::function<void(std::exception_ptr)> callback) {
-    impl->actor().invoke(&DatabaseFileSourceThread::invalidateRegion, region.getID(), std::move(callback));
+    impl->actor().invoke(
+        &DatabaseFileSourceThread::invalidateRegion, region.getID(), impl->invalidateResponses(std::move(callback)));
 }
 
 void DatabaseFileSource::setOfflineRegionObserver(const OfflineRegion& region,
@@ -283,12 +445,20 @@ void DatabaseFileSource::setOfflineMapboxTileCountLimit(uint64_t limit) const {
 void DatabaseFileSource::setProperty(const std::string& key, const mapbox::base::Value& value) {
     if (key == READ_ONLY_MODE_KEY && value.getBool()) {
         impl->actor().invoke(&DatabaseFileSourceThread::reopenDatabaseReadOnly, *value.getBool());
+    } else if (key == BATCH_ACCESSED_UPDATES_KEY && value.getBool()) {
+        impl->actor().invoke(&DatabaseFileSourceThread::setBatchAccessedUpdates, *value.getBool());
+    } else if (key == FAST_COMPRESSION_KEY && value.getBool()) {
+        impl->actor().invoke(&DatabaseFileSourceThread::setFastCompression, *value.getBool());
     } else {
         std::string message = "Resource provider does not support property " + key;
         Log::Error(Event::General, message.c_str());
     }
 }
 
+std::shared_ptr<ResponseCache> DatabaseFileSource::getResponseCache() const {
+    return impl->getResponseCache();
+}
+
 void DatabaseFileSource::pause() {
     impl->pause();
 }
@@ -6,6 +6,9 @@
 #include <mbgl/storage/main_resource_loader.hpp>
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/resource_options.hpp>
+#include <mbgl/storage/response_cache.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/logging.hpp>
 #include <mbgl/util/stopwatch.hpp>
 #include <mbgl/util/thread.hpp>
 
@@ -19,11 +22,13 @@ public:
     MainResourceLoaderThread(std::shared_ptr<FileSource> assetFileSource_,
                              std::shared_ptr<FileSource> databaseFileSource_,
                              std::shared_ptr<FileSource> localFileSource_,
-                             std::shared_ptr<FileSource> onlineFileSource_)
+                             std::shared_ptr<FileSource> onlineFileSource_,
+                             std::shared_ptr<ResponseCache> responseCache_)
         : assetFileSource(std::move(assetFileSource_)),
           databaseFileSource(std::move(databaseFileSource_)),
           localFileSource(std::move(localFileSource_)),
-          onlineFileSource(std::move(onlineFileSource_)) {}
+          onlineFileSource(std::move(onlineFileSource_)),
+          responseCache(std::move(responseCache_)) {}
 
     void request(AsyncRequest* req, const Resource& resource, const ActorRef<FileSourceRequest>& ref) {
         auto callback = [ref](const Response& res) { ref.invoke(&FileSourceRequest::setResponse, res); };
@@ -41,6 +46,10 @@ public:
             return onlineFileSource->request(res, [=, ptr = parentKeepAlive](const Response& response) {
                 if (databaseFileSource) {
                     databaseFileSource->forward(res, response, nullptr);
+                    if (!response.error) {
+                        // A 304 refreshes the metadata in the database only; drop the stale copy.
+                        responseCache->put(res, response);
+                    }
                 }
                 if (res.kind == Resource::Kind::Tile) {
                     // onlineResponse.data will be null if data not modified
@@ -67,12 +76,22 @@ public:
             // Local file request
             tasks[req] = localFileSource->request(resource, callback);
         } else if (databaseFileSource && databaseFileSource->canRequest(resource)) {
+            // Responses read before are served from memory without touching the database.
+            optional<Response> cachedResponse = responseCache->get(resource);
+
             // Try cache only request if needed.
             if (resource.loadingMethod == Resource::LoadingMethod::CacheOnly) {
-                tasks[req] = databaseFileSource->request(resource, callback);
+                if (cachedResponse) {
+                    callback(*cachedResponse);
+                    return;
+                }
+                tasks[req] = databaseFileSource->request(resource, [=](const Response& response) {
+                    responseCache->put(resource, response);
+                    callback(response);
+                });
             } else {
                 // Cache request with fallback to network with cache control
-                tasks[req] = databaseFileSource->request(resource, [=](const Response& response) {
+                auto onCacheResponse = [=](const Response& response) {
                     Resource res = resource;
 
                     // Resource is in the cache
@@ -95,6 +114,15 @@ public:
                     }
 
                     tasks[req] = requestFromNetwork(res, std::move(tasks[req]));
+                };
+
+                if (cachedResponse) {
+                    onCacheResponse(*cachedResponse);
+                    return;
+                }
+                tasks[req] = databaseFileSource->request(resource, [=](const Response& response) {
+                    responseCache->put(resource, response);
+                    onCacheResponse(response);
                 });
             }
         } else if (auto networkReq = requestFromNetwork(resource, nullptr)) {
@@ -122,6 +150,7 @@ private:
     const std::shared_ptr<FileSource> databaseFileSource;
     const std::shared_ptr<FileSource> localFileSource;
     const std::shared_ptr<FileSource> onlineFileSource;
+    const std::shared_ptr<ResponseCache> responseCache;
     std::map<AsyncRequest*, std::unique_ptr<AsyncRequest>> tasks;
 };
 
@@ -136,13 +165,20 @@ public:
           localFileSource(std::move(localFileSource_)),
           onlineFileSource(std::move(onlineFileSource_)),
           supportsCacheOnlyRequests_(bool(databaseFileSource)),
+          // The database owns the memory tier, so that changes to the database invalidate it. A
+          // database file source that does not own one, e.g. one registered by a custom
+          // factory, gets a memory tier of the loader.
+          responseCache(databaseFileSource && databaseFileSource->getResponseCache()
+                            ? databaseFileSource->getResponseCache()
+                            : std::make_shared<ResponseCache>(util::DEFAULT_MEMORY_CACHE_SIZE)),
           thread(std::make_unique<util::Thread<MainResourceLoaderThread>>(
               util::makeThreadPrioritySetter(platform::EXPERIMENTAL_THREAD_PRIORITY_WORKER),
               "ResourceLoaderThread",
               assetFileSource,
               databaseFileSource,
               localFileSource,
-              onlineFileSource)) {}
+              onlineFileSource,
+              responseCache)) {}
 
     std::unique_ptr<AsyncRequest> request(const Resource& resource, Callback callback) {
         auto req = std::make_unique<FileSourceRequest>(std::move(callback));
@@ -163,6 +199,8 @@ public:
 
     bool supportsCacheOnlyRequests() const { return supportsCacheOnlyRequests_; }
 
+    ResponseCache& getResponseCache() { return *responseCache; }
+
     void pause() { thread->pause(); }
 
     void resume() { thread->resume(); }
@@ -173,6 +211,7 @@ private:
     const std::shared_ptr<FileSource> localFileSource;
     const std::shared_ptr<FileSource> onlineFileSource;
     const bool supportsCacheOnlyRequests_;
+    const std::shared_ptr<ResponseCache> responseCache;
     const std::unique_ptr<util::Thread<MainResourceLoaderThread>> thread;
 };
 
@@ -196,6 +235,32 @@ bool MainResourceLoader::canRequest(const Resource& resource) const {
     return impl->canRequest(resource);
 }
 
+void MainResourceLoader::setProperty(const std::string& key, const mapbox::base::Value& value) {
+    if (key == MEMORY_CACHE_SIZE_KEY) {
+        if (auto* size = value.getUint()) {
+            impl->getResponseCache().setMaximumSize(static_cast<std::size_t>(*size));
+        } else {
+            Log::Error(Event::General, "Invalid memory-cache-size property value type.");
+        }
+    } else {
+        std::string message = "Resource provider does not support property " + key;
+        Log::Error(Event::General, message.c_str());
+    }
+}
+
+mapbox::base::Value MainResourceLoader::getProperty(const std::string& key) const {
+    if (key == MEMORY_CACHE_SIZE_KEY) {
+        return uint64_t(impl->getResponseCache().getMaximumSize());
+    }
+    std::string message = "Resource provider does not support property " + key;
+    Log::Error(Event::General, message.c_str());
+    return {};
+}
+
+ResponseCacheStats MainResourceLoader::getResponseCacheStats() const {
+    return impl->getResponseCache().getStats();
+}
+
 void MainResourceLoader::pause() {
     impl->pause();
 }
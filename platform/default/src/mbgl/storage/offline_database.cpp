@@ -3,6 +3,7 @@
 #include <mbgl/storage/sqlite3.hpp>
 #include <mbgl/util/compression.hpp>
 #include <mbgl/util/io.hpp>
+#include <mbgl/util/lz4.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/chrono.hpp>
 #include <mbgl/util/logging.hpp>
@@ -12,8 +13,33 @@
 
 namespace mbgl {
 
-OfflineDatabase::OfflineDatabase(std::string path_)
-    : path(std::move(path_)) {
+namespace {
+
+// Number of batched `accessed` timestamps that triggers a flush.
+constexpr std::size_t kMaxPendingAccesses = 256;
+// Maximum age of batched `accessed` timestamps before they get flushed.
+constexpr Seconds kMaxPendingAccessesAge{30};
+
+// Values of the `compressed` column. Older versions only know 0 and 1.
+constexpr int64_t kUncompressed = 0;
+constexpr int64_t kDeflate = 1;
+constexpr int64_t kLZ4 = 2;
+
+std::string decompress(const std::string& data, int64_t compression) {
+    switch (compression) {
+    case kDeflate:
+        return util::decompress(data);
+    case kLZ4:
+        return util::lz4::decompress(data);
+    default:
+        throw std::runtime_error("unknown compression codec " + util::toString(compression));
+    }
+}
+
+} // namespace
+
+OfflineDatabase::OfflineDatabase(std::string path_, bool writeAheadLog_, bool readOnly_)
+    : path(std::move(path_)), readOnly(readOnly_), writeAheadLog(writeAheadLog_) {
     try {
         initialize();
     } catch (...) {
@@ -51,7 +77,7 @@ void OfflineDatabase::initialize() {
         // Newly created database, or old cache-only database; remove old table if it exists.
         removeOldCacheTable();
         createSchema();
-        return;
+        break;
     case 2:
         migrateToVersion3();
         // fall through
@@ -66,11 +92,27 @@ void OfflineDatabase::initialize() {
         // fall through
     case 6:
         // Happy path; we're done
-        return;
+        break;
     default:
         // Downgrade: delete the database and try to reinitialize.
         removeExisting();
         initialize();
+        return;
+    }
+
+    configureJournal();
+}
+
+// The journal mode is persistent, while the synchronous setting applies to this connection only.
+void OfflineDatabase::configureJournal() {
+    assert(db);
+
+    if (writeAheadLog) {
+        db->exec("PRAGMA journal_mode = WAL");
+        db->exec("PRAGMA synchronous = NORMAL");
+    } else if (getPragma<std::string>("PRAGMA journal_mode") == "wal") {
+        db->exec("PRAGMA journal_mode = DELETE");
+        db->exec("PRAGMA synchronous = FULL");
     }
 }
 
@@ -82,6 +124,14 @@ void OfflineDatabase::changePath(const std::string& path_) {
 }
 
 void OfflineDatabase::cleanup() {
+    try {
+        if (db && !readOnly) flushAccessedTimestamps();
+    } catch (...) {
+        handleError("update timestamps");
+    }
+    pendingResourceAccesses.clear();
+    pendingTileAccesses.clear();
+
     // Deleting these SQLite objects may result in exceptions
     try {
         statements.clear();
@@ -151,6 +201,8 @@ void OfflineDatabase::removeExisting() {
 
     statements.clear();
     db.reset();
+    pendingResourceAccesses.clear();
+    pendingTileAccesses.clear();
 
     util::deleteFile(path);
 }
@@ -245,6 +297,7 @@ optional<Response> OfflineDatabase::get(const Resource& resource) try {
     }
 
     auto result = getInternal(resource);
+    flushAccessedTimestampsIfNeeded();
     return result ? optional<Response>{ result->first } : nullopt;
 } catch (...) {
     handleError("read resource");
@@ -297,13 +350,15 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
     }
 
     std::string compressedData;
-    bool compressed = false;
+    int64_t compression = kUncompressed;
     uint64_t size = 0;
 
     if (response.data) {
-        compressedData = util::compress(*response.data);
-        compressed = compressedData.size() < response.data->size();
-        size = compressed ? compressedData.size() : response.data->size();
+        compressedData = fastCompression ? util::lz4::compress(*response.data) : util::compress(*response.data);
+        if (compressedData.size() < response.data->size()) {
+            compression = fastCompression ? kLZ4 : kDeflate;
+        }
+        size = compression != kUncompressed ? compressedData.size() : response.data->size();
     }
 
     optional<DatabaseSizeChangeStats> stats;
@@ -320,12 +375,12 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
     if (resource.kind == Resource::Kind::Tile) {
         assert(resource.tileData);
         inserted = putTile(*resource.tileData, response,
-                compressed ? compressedData : response.data ? *response.data : "",
-                compressed);
+                compression != kUncompressed ? compressedData : response.data ? *response.data : "",
+                compression);
     } else {
         inserted = putResource(resource, response,
-                compressed ? compressedData : response.data ? *response.data : "",
-                compressed);
+                compression != kUncompressed ? compressedData : response.data ? *response.data : "",
+                compression);
     }
 
     if (stats) {
@@ -337,7 +392,7 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
 
 optional<std::pair<Response, uint64_t>> OfflineDatabase::getResource(const Resource& resource) {
     // Update accessed timestamp used for LRU eviction.
-    if (!readOnly) {
+    if (!readOnly && !batchAccessedUpdates) {
         try {
             mapbox::sqlite::Query accessedQuery{getStatement("UPDATE resources SET accessed = ?1 WHERE url = ?2")};
             accessedQuery.bind(1, util::now());
@@ -367,6 +422,10 @@ optional<std::pair<Response, uint64_t>> OfflineDatabase::getResource(const Resou
         return nullopt;
     }
 
+    if (!readOnly && batchAccessedUpdates) {
+        recordResourceAccess(resource.url);
+    }
+
     Response response;
     uint64_t size = 0;
 
@@ -378,8 +437,8 @@ optional<std::pair<Response, uint64_t>> OfflineDatabase::getResource(const Resou
     auto data = query.get<optional<std::string>>(4);
     if (!data) {
         response.noContent = true;
-    } else if (query.get<bool>(5)) {
-        response.data = std::make_shared<std::string>(util::decompress(*data));
+    } else if (const int64_t compression = query.get<int64_t>(5)) {
+        response.data = std::make_shared<std::string>(decompress(*data, compression));
         size = data->length();
     } else {
         response.data = std::make_shared<std::string>(*data);
@@ -402,7 +461,7 @@ optional<int64_t> OfflineDatabase::hasResource(const Resource& resource) {
 bool OfflineDatabase::putResource(const Resource& resource,
                                   const Response& response,
                                   const std::string& data,
-                                  bool compressed) {
+                                  int64_t compression) {
     checkFlags();
 
     if (response.notModified) {
@@ -451,7 +510,7 @@ bool OfflineDatabase::putResource(const Resource& resource,
         updateQuery.bind(8, false);
     } else {
         updateQuery.bindBlob(7, data.data(), data.size(), false);
-        updateQuery.bind(8, compressed);
+        updateQuery.bind(8, compression);
     }
 
     updateQuery.run();
@@ -478,7 +537,7 @@ bool OfflineDatabase::putResource(const Resource& resource,
         insertQuery.bind(9, false);
     } else {
         insertQuery.bindBlob(8, data.data(), data.size(), false);
-        insertQuery.bind(9, compressed);
+        insertQuery.bind(9, compression);
     }
 
     insertQuery.run();
@@ -488,7 +547,7 @@ bool OfflineDatabase::putResource(const Resource& resource,
 
 optional<std::pair<Response, uint64_t>> OfflineDatabase::getTile(const Resource::TileData& tile) {
     // Update accessed timestamp used for LRU eviction.
-    if (!readOnly) {
+    if (!readOnly && !batchAccessedUpdates) {
         try {
             // clang-format off
             mapbox::sqlite::Query accessedQuery{ getStatement(
@@ -540,6 +599,10 @@ optional<std::pair<Response, uint64_t>> OfflineDatabase::getTile(const Resource:
         return nullopt;
     }
 
+    if (!readOnly && batchAccessedUpdates) {
+        recordTileAccess(tile);
+    }
+
     Response response;
     uint64_t size = 0;
 
@@ -551,8 +614,8 @@ optional<std::pair<Response, uint64_t>> OfflineDatabase::getTile(const Resource:
     optional<std::string> data = query.get<optional<std::string>>(4);
     if (!data) {
         response.noContent = true;
-    } else if (query.get<bool>(5)) {
-        response.data = std::make_shared<std::string>(util::decompress(*data));
+    } else if (const int64_t compression = query.get<int64_t>(5)) {
+        response.data = std::make_shared<std::string>(decompress(*data, compression));
         size = data->length();
     } else {
         response.data = std::make_shared<std::string>(*data);
@@ -590,7 +653,7 @@ optional<int64_t> OfflineDatabase::hasTile(const Resource::TileData& tile) {
 bool OfflineDatabase::putTile(const Resource::TileData& tile,
                               const Response& response,
                               const std::string& data,
-                              bool compressed) {
+                              int64_t compression) {
     checkFlags();
 
     if (response.notModified) {
@@ -654,7 +717,7 @@ bool OfflineDatabase::putTile(const Resource::TileData& tile,
         updateQuery.bind(7, false);
     } else {
         updateQuery.bindBlob(6, data.data(), data.size(), false);
-        updateQuery.bind(7, compressed);
+        updateQuery.bind(7, compression);
     }
 
     updateQuery.run();
@@ -684,7 +747,7 @@ bool OfflineDatabase::putTile(const Resource::TileData& tile,
         insertQuery.bind(12, false);
     } else {
         insertQuery.bindBlob(11, data.data(), data.size(), false);
-        insertQuery.bind(12, compressed);
+        insertQuery.bind(12, compression);
     }
 
     insertQuery.run();
@@ -961,7 +1024,9 @@ std::exception_ptr OfflineDatabase::deleteRegion(OfflineRegion&& region) try {
 }
 
 optional<std::pair<Response, uint64_t>> OfflineDatabase::getRegionResource(const Resource& resource) try {
-    return getInternal(resource);
+    auto result = getInternal(resource);
+    flushAccessedTimestampsIfNeeded();
+    return result;
 } catch (...) {
     handleError("read region resource");
     return nullopt;
@@ -1214,6 +1279,9 @@ T OfflineDatabase::getPragma(const char* sql) {
 // us from calling VACUUM or keeping a running total, which can be costly.
 bool OfflineDatabase::evict(uint64_t neededFreeSize, DatabaseSizeChangeStats& stats) {
     checkFlags();
+
+    // Batched timestamps must be visible to the LRU queries below.
+    flushAccessedTimestamps();
     uint64_t ambientCacheSize =
         (initAmbientCacheSize() == nullptr) ? *currentAmbientCacheSize : maximumAmbientCacheSize;
     uint64_t newAmbientCacheSize = ambientCacheSize + neededFreeSize + stats.pageSize();
@@ -1427,6 +1495,7 @@ void OfflineDatabase::markUsedResources(int64_t regionID, const std::list<Resour
 
 std::exception_ptr OfflineDatabase::pack() try {
     if (!db) initialize();
+    if (!readOnly) flushAccessedTimestamps();
     vacuum();
     return nullptr;
 } catch (...) {
@@ -1454,6 +1523,108 @@ void OfflineDatabase::reopenDatabaseReadOnly(bool readOnly_) {
     }
 }
 
+void OfflineDatabase::setBatchAccessedUpdates(bool batch) {
+    if (batchAccessedUpdates == batch) return;
+    batchAccessedUpdates = batch;
+    if (!batch && db && !readOnly) {
+        try {
+            flushAccessedTimestamps();
+        } catch (...) {
+            handleError("update timestamps");
+        }
+    }
+}
+
+void OfflineDatabase::recordAccess(const Resource& resource) try {
+    if (readOnly) return;
+    if (!db) initialize();
+
+    if (resource.kind == Resource::Kind::Tile) {
+        assert(resource.tileData);
+        recordTileAccess(*resource.tileData);
+    } else {
+        recordResourceAccess(resource.url);
+    }
+
+    if (batchAccessedUpdates) {
+        flushAccessedTimestampsIfNeeded();
+    } else {
+        flushAccessedTimestamps();
+    }
+} catch (...) {
+    handleError("update timestamp");
+}
+
+void OfflineDatabase::recordResourceAccess(const std::string& url) {
+    pendingResourceAccesses[url] = util::now();
+}
+
+void OfflineDatabase::recordTileAccess(const Resource::TileData& tile) {
+    pendingTileAccesses[TileKey{tile.urlTemplate, tile.pixelRatio, tile.x, tile.y, tile.z}] = util::now();
+}
+
+void OfflineDatabase::flushAccessedTimestampsIfNeeded() {
+    if (pendingResourceAccesses.empty() && pendingTileAccesses.empty()) return;
+    if (pendingResourceAccesses.size() + pendingTileAccesses.size() < kMaxPendingAccesses &&
+        util::now() - lastAccessedFlush < kMaxPendingAccessesAge) {
+        return;
+    }
+
+    try {
+        mapbox::sqlite::Transaction transaction(*db, mapbox::sqlite::Transaction::Immediate);
+        flushAccessedTimestamps();
+        transaction.commit();
+    } catch (const mapbox::sqlite::Exception& ex) {
+        if (ex.code == mapbox::sqlite::ResultCode::NotADB || ex.code == mapbox::sqlite::ResultCode::Corrupt) {
+            throw;
+        }
+
+        // If we don't have any indication that the database is corrupt, continue as usual.
+        Log::Warning(Event::Database, static_cast<int>(ex.code), "Can't update timestamp: %s", ex.what());
+    }
+}
+
+void OfflineDatabase::flushAccessedTimestamps() {
+    lastAccessedFlush = util::now();
+    if (pendingResourceAccesses.empty() && pendingTileAccesses.empty()) return;
+
+    // Take the pending entries first so that a failing flush can't make them grow without bound;
+    // losing a few timestamps only makes eviction slightly less accurate.
+    auto resources = std::move(pendingResourceAccesses);
+    auto tiles = std::move(pendingTileAccesses);
+    pendingResourceAccesses.clear();
+    pendingTileAccesses.clear();
+
+    for (const auto& access : resources) {
+        mapbox::sqlite::Query query{
+            getStatement("UPDATE resources SET accessed = max(accessed, ?1) WHERE url = ?2")};
+        query.bind(1, access.second);
+        query.bind(2, access.first);
+        query.run();
+    }
+
+    for (const auto& access : tiles) {
+        // clang-format off
+        mapbox::sqlite::Query query{ getStatement(
+            "UPDATE tiles "
+            "SET accessed       = max(accessed, ?1) "
+            "WHERE url_template = ?2 "
+            "  AND pixel_ratio  = ?3 "
+            "  AND x            = ?4 "
+            "  AND y            = ?5 "
+            "  AND z            = ?6 ") };
+        // clang-format on
+
+        query.bind(1, access.second);
+        query.bind(2, std::get<0>(access.first));
+        query.bind(3, std::get<1>(access.first));
+        query.bind(4, std::get<2>(access.first));
+        query.bind(5, std::get<3>(access.first));
+        query.bind(6, std::get<4>(access.first));
+        query.run();
+    }
+}
+
 OfflineDatabase::DatabaseSizeChangeStats::DatabaseSizeChangeStats(OfflineDatabase* db_) : db(db_) {
     assert(db);
     pageSize_ = db->getPragma<int64_t>("PRAGMA page_size");
@@ -6,9 +6,13 @@
 #include <zlib.h>
 #endif
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <vector>
 
 // Check zlib library version.
 const static bool zlibVersionCheck __attribute__((unused)) = []() {
@@ -31,73 +35,139 @@ namespace util {
 // cause a link error.
 #undef compress
 
-std::string compress(const std::string &raw) {
-    z_stream deflate_stream;
-    memset(&deflate_stream, 0, sizeof(deflate_stream));
+namespace {
+
+struct DeflateStream {
+    DeflateStream() {
+        memset(&stream, 0, sizeof(stream));
+        if (deflateInit(&stream, Z_DEFAULT_COMPRESSION) != Z_OK) {
+            throw std::runtime_error("failed to initialize deflate");
+        }
+    }
+    ~DeflateStream() { deflateEnd(&stream); }
+    bool reset() { return deflateReset(&stream) == Z_OK; }
+
+    z_stream stream;
+};
+
+struct InflateStream {
+    InflateStream() {
+        memset(&stream, 0, sizeof(stream));
+        if (inflateInit(&stream) != Z_OK) {
+            throw std::runtime_error("failed to initialize inflate");
+        }
+    }
+    ~InflateStream() { inflateEnd(&stream); }
+    bool reset() { return inflateReset(&stream) == Z_OK; }
+
+    z_stream stream;
+};
+
+// Setting up a z_stream allocates and initializes several tables, which costs as much
+// as compressing a small tile. Streams are reset and kept for reuse instead. They are
+// pooled rather than held in thread-local storage, which isn't available everywhere.
+template <class Stream>
+class StreamPool {
+public:
+    std::unique_ptr<Stream> acquire() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!streams.empty()) {
+                auto stream = std::move(streams.back());
+                streams.pop_back();
+                return stream;
+            }
+        }
+        return std::make_unique<Stream>();
+    }
+
+    void release(std::unique_ptr<Stream> stream) {
+        if (!stream->reset()) return;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (streams.size() < maxPooledStreams) {
+            streams.push_back(std::move(stream));
+        }
+    }
 
-    // TODO: reuse z_streams
-    if (deflateInit(&deflate_stream, Z_DEFAULT_COMPRESSION) != Z_OK) {
-        throw std::runtime_error("failed to initialize deflate");
+    static StreamPool& get() {
+        // Intentionally leaked so that threads still running at exit can use it.
+        static auto* pool = new StreamPool();
+        return *pool;
     }
 
-    deflate_stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(raw.data()));
-    deflate_stream.avail_in = uInt(raw.size());
+private:
+    static constexpr std::size_t maxPooledStreams = 4;
 
-    std::string result;
-    char out[16384];
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Stream>> streams;
+};
+
+template <class Stream>
+class PooledStream {
+public:
+    PooledStream() : stream(StreamPool<Stream>::get().acquire()) {}
+    ~PooledStream() { StreamPool<Stream>::get().release(std::move(stream)); }
+
+    z_stream* operator->() { return &stream->stream; }
+    z_stream* get() { return &stream->stream; }
+
+private:
+    std::unique_ptr<Stream> stream;
+};
+
+} // namespace
+
+std::string compress(const std::string &raw) {
+    PooledStream<DeflateStream> deflate_stream;
+
+    deflate_stream->next_in = reinterpret_cast<Bytef *>(const_cast<char *>(raw.data()));
+    deflate_stream->avail_in = uInt(raw.size());
+
+    // Compress straight into the result, which usually fits in a single pass.
+    std::string result(deflateBound(deflate_stream.get(), uLong(raw.size())), '\0');
 
     int code;
     do {
-        deflate_stream.next_out = reinterpret_cast<Bytef *>(out);
-        deflate_stream.avail_out = sizeof(out);
-        code = deflate(&deflate_stream, Z_FINISH);
-        if (result.size() < deflate_stream.total_out) {
-            // append the block to the output string
-            result.append(out, deflate_stream.total_out - result.size());
+        if (deflate_stream->total_out == result.size()) {
+            result.resize(result.size() * 2);
         }
+        deflate_stream->next_out = reinterpret_cast<Bytef *>(&result[deflate_stream->total_out]);
+        deflate_stream->avail_out = uInt(result.size() - deflate_stream->total_out);
+        code = deflate(deflate_stream.get(), Z_FINISH);
     } while (code == Z_OK);
 
-    deflateEnd(&deflate_stream);
-
     if (code != Z_STREAM_END) {
-        throw std::runtime_error(deflate_stream.msg);
+        throw std::runtime_error(deflate_stream->msg ? deflate_stream->msg : "compression error");
     }
 
+    result.resize(deflate_stream->total_out);
     return result;
 }
 
 std::string decompress(const std::string &raw) {
-    z_stream inflate_stream;
-    memset(&inflate_stream, 0, sizeof(inflate_stream));
+    PooledStream<InflateStream> inflate_stream;
 
-    // TODO: reuse z_streams
-    if (inflateInit(&inflate_stream) != Z_OK) {
-        throw std::runtime_error("failed to initialize inflate");
-    }
-
-    inflate_stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(raw.data()));
-    inflate_stream.avail_in = uInt(raw.size());
+    inflate_stream->next_in = reinterpret_cast<Bytef *>(const_cast<char *>(raw.data()));
+    inflate_stream->avail_in = uInt(raw.size());
 
-    std::string result;
-    char out[15384];
+    // Inflate straight into the result, growing it geometrically.
+    std::string result(std::max<std::size_t>(raw.size() * 4, 1024), '\0');
 
     int code;
     do {
-        inflate_stream.next_out = reinterpret_cast<Bytef *>(out);
-        inflate_stream.avail_out = sizeof(out);
-        code = inflate(&inflate_stream, 0);
-        // result.append(out, sizeof(out) - inflate_stream.avail_out);
-        if (result.size() < inflate_stream.total_out) {
-            result.append(out, inflate_stream.total_out - result.size());
+        if (inflate_stream->total_out == result.size()) {
+            result.resize(result.size() * 2);
         }
+        inflate_stream->next_out = reinterpret_cast<Bytef *>(&result[inflate_stream->total_out]);
+        inflate_stream->avail_out = uInt(result.size() - inflate_stream->total_out);
+        code = inflate(inflate_stream.get(), Z_NO_FLUSH);
     } while (code == Z_OK);
 
-    inflateEnd(&inflate_stream);
-
     if (code != Z_STREAM_END) {
-        throw std::runtime_error(inflate_stream.msg ? inflate_stream.msg : "decompression error");
+        throw std::runtime_error(inflate_stream->msg ? inflate_stream->msg : "decompression error");
     }
 
+    result.resize(inflate_stream->total_out);
     return result;
 }
 } // namespace util
@@ -607,6 +607,7 @@ const std::string setCenterOp("setCenter");
 const std::string setZoomOp("setZoom");
 const std::string setBearingOp("setBearing");
 const std::string setPitchOp("setPitch");
+const std::string setTileScissorClippingOp("setTileScissorClipping");
 const std::string setFilterOp("setFilter");
 const std::string setLayerZoomRangeOp("setLayerZoomRange");
 const std::string setLightOp("setLight");
@@ -794,6 +795,15 @@ TestOperations parseTestOperations(TestMetadata& metadata) {
                 ctx.getMap().jumpTo(mbgl::CameraOptions().withPitch(pitch));
                 return true;
             });
+        } else if (operationArray[0].GetString() == setTileScissorClippingOp) {
+            // setTileScissorClipping
+            assert(operationArray.Size() >= 2u);
+            assert(operationArray[1].IsBool());
+            bool enabled = operationArray[1].GetBool();
+            result.emplace_back([enabled](TestContext& ctx) {
+                ctx.getFrontend().getRenderer()->setTileScissorClipping(enabled);
+                return true;
+            });
         } else if (operationArray[0].GetString() == setFilterOp) {
             // setFilter
             assert(operationArray.Size() >= 3u);
@@ -2,6 +2,7 @@
 
 require('@mapbox/flow-remove-types/register');
 
+const fs = require('fs');
 const path = require('path');
 const outputPath = 'src/mbgl/programs';
 const zlib = require('zlib');
@@ -11,6 +12,13 @@ var shaders = require('../mapbox-gl-js/src/shaders');
 
 require('./style-code');
 
+// Shaders that only exist in this repository. They are added last, so that they don't move the
+// offsets of the shared shaders.
+shaders.circleInstanced = {
+    vertexSource: fs.readFileSync('src/mbgl/shaders/circle_instanced.vertex.glsl', 'utf8'),
+    fragmentSource: shaders.circle.fragmentSource
+};
+
 let concatenated = '';
 let offsets = {};
 
@@ -6,9 +6,9 @@
 
 namespace mbgl {
 
-Mailbox::Mailbox() = default;
+Mailbox::Mailbox() : priority(TaskPriority::Visible) {}
 
-Mailbox::Mailbox(Scheduler& scheduler_) : weakScheduler(scheduler_.makeWeakPtr()) {}
+Mailbox::Mailbox(Scheduler& scheduler_) : weakScheduler(scheduler_.makeWeakPtr()), priority(TaskPriority::Visible) {}
 
 void Mailbox::open(Scheduler& scheduler_) {
     assert(!weakScheduler);
@@ -26,7 +26,7 @@ void Mailbox::open(Scheduler& scheduler_) {
     
     if (!queue.empty()) {
         auto guard = weakScheduler.lock();
-        if (weakScheduler) weakScheduler->schedule(makeClosure(shared_from_this()));
+        if (weakScheduler) scheduleReceive();
     }
 }
 
@@ -46,6 +46,14 @@ bool Mailbox::isOpen() const {
     return bool(weakScheduler);
 }
 
+void Mailbox::setPriority(TaskPriority priority_) {
+    priority = priority_;
+}
+
+TaskPriority Mailbox::getPriority() const {
+    return priority;
+}
+
 void Mailbox::push(std::unique_ptr<Message> message) {
     std::lock_guard<std::mutex> pushingLock(pushingMutex);
 
@@ -58,7 +66,7 @@ void Mailbox::push(std::unique_ptr<Message> message) {
     queue.push(std::move(message));
     auto guard = weakScheduler.lock();
     if (wasEmpty && weakScheduler) {
-        weakScheduler->schedule(makeClosure(shared_from_this()));
+        scheduleReceive();
     }
 }
 
@@ -86,10 +94,14 @@ void Mailbox::receive() {
     (*message)();
 
     if (!wasEmpty) {
-        weakScheduler->schedule(makeClosure(shared_from_this()));
+        scheduleReceive();
     }
 }
 
+void Mailbox::scheduleReceive() {
+    weakScheduler->scheduleWithPriority(priority, makeClosure(shared_from_this()));
+}
+
 // static
 void Mailbox::maybeReceive(const std::weak_ptr<Mailbox>& mailbox) {
     if (auto locked = mailbox.lock()) {
@@ -210,6 +210,12 @@ void FeatureIndex::setBucketLayerIDs(const std::string& bucketLeaderID, const st
     bucketLayerIDs[bucketLeaderID] = layerIDs;
 }
 
+std::size_t FeatureIndex::getMemoryUsage() const {
+    // Each indexed feature takes at least one grid element and one cell entry.
+    using Element = std::pair<IndexedSubfeature, GridIndex<IndexedSubfeature>::BBox>;
+    return sortIndex * (sizeof(Element) + sizeof(std::size_t));
+}
+
 DynamicFeatureIndex::~DynamicFeatureIndex() = default;
 
 void DynamicFeatureIndex::query(std::unordered_map<std::string, std::vector<Feature>>& result,
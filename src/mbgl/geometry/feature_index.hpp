@@ -100,6 +100,9 @@ public:
 
     void setBucketLayerIDs(const std::string& bucketLeaderID, const std::vector<std::string>& layerIDs);
 
+    // Approximate memory held by the index, in bytes; excludes the tile data.
+    std::size_t getMemoryUsage() const;
+
     std::unordered_map<std::string, std::vector<Feature>> lookupSymbolFeatures(
         const std::vector<IndexedSubfeature>& symbolFeatures,
         const RenderedQueryOptions& options,
@@ -17,5 +17,23 @@ optional<AttributeBinding> offsetAttributeBinding(const optional<AttributeBindin
     }
 }
 
+optional<AttributeBinding> instancedAttributeBinding(const optional<AttributeBinding>& binding) {
+    if (binding) {
+        AttributeBinding result = *binding;
+        result.divisor = 1;
+        return result;
+    } else {
+        return binding;
+    }
+}
+
+optional<AttributeBinding> offsetInstancedAttributeBinding(const optional<AttributeBinding>& binding, std::size_t instanceOffset) {
+    if (binding && binding->divisor != 0) {
+        return offsetAttributeBinding(binding, instanceOffset / binding->divisor);
+    } else {
+        return binding;
+    }
+}
+
 } // namespace gfx
 } // namespace mbgl
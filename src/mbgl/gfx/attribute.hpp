@@ -84,12 +84,15 @@ public:
     uint8_t vertexStride;
     const VertexBufferResource* vertexBufferResource;
     uint32_t vertexOffset;
+    // Number of instances drawn before the attribute advances, or 0 if it advances per vertex.
+    uint32_t divisor;
 
     friend bool operator==(const AttributeBinding& lhs, const AttributeBinding& rhs) {
         return lhs.attribute == rhs.attribute &&
                lhs.vertexStride == rhs.vertexStride &&
                lhs.vertexBufferResource == rhs.vertexBufferResource &&
-               lhs.vertexOffset == rhs.vertexOffset;
+               lhs.vertexOffset == rhs.vertexOffset &&
+               lhs.divisor == rhs.divisor;
     }
 };
 
@@ -248,10 +251,13 @@ AttributeBinding attributeBinding(const VertexBuffer<detail::VertexType<As...>>&
         Descriptor::data.stride,
         &buffer.getResource(),
         0,
+        0,
     };
 }
 
 optional<gfx::AttributeBinding> offsetAttributeBinding(const optional<gfx::AttributeBinding>& binding, std::size_t vertexOffset);
+optional<gfx::AttributeBinding> instancedAttributeBinding(const optional<gfx::AttributeBinding>& binding);
+optional<gfx::AttributeBinding> offsetInstancedAttributeBinding(const optional<gfx::AttributeBinding>& binding, std::size_t instanceOffset);
 
 template <class>
 class AttributeBindings;
@@ -276,6 +282,16 @@ public:
         return { offsetAttributeBinding(Base::template get<As>(), vertexOffset)... };
     }
 
+    // Returns bindings that advance once per instance instead of once per vertex.
+    AttributeBindings instanced() const {
+        return { instancedAttributeBinding(Base::template get<As>())... };
+    }
+
+    // Offsets the bindings that advance per instance, leaving the per-vertex ones untouched.
+    AttributeBindings offsetInstances(const std::size_t instanceOffset) const {
+        return { offsetInstancedAttributeBinding(Base::template get<As>(), instanceOffset)... };
+    }
+
     uint32_t activeCount() const {
         uint32_t result = 0;
         util::ignore({ ((result += bool(Base::template get<As>())), 0)... });
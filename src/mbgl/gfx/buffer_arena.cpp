@@ -0,0 +1,79 @@
+#include <mbgl/gfx/buffer_arena.hpp>
+
+#include <cassert>
+#include <iterator>
+
+namespace mbgl {
+namespace gfx {
+
+constexpr std::size_t BufferArena::alignment;
+
+BufferArena::BufferArena(std::size_t capacity_)
+    : capacity(capacity_ / alignment * alignment) {
+    if (capacity > 0) {
+        freeRanges.emplace(0, capacity);
+    }
+}
+
+optional<std::size_t> BufferArena::allocate(std::size_t size) {
+    size = align(size > 0 ? size : 1);
+
+    // Best fit: use the smallest free range the allocation fits into, keeping large ranges
+    // available for large buckets.
+    auto best = freeRanges.end();
+    for (auto it = freeRanges.begin(); it != freeRanges.end(); ++it) {
+        if (it->second >= size && (best == freeRanges.end() || it->second < best->second)) {
+            best = it;
+            if (best->second == size) {
+                break;
+            }
+        }
+    }
+
+    if (best == freeRanges.end()) {
+        return {};
+    }
+
+    const std::size_t offset = best->first;
+    const std::size_t remaining = best->second - size;
+    freeRanges.erase(best);
+    if (remaining > 0) {
+        freeRanges.emplace(offset + size, remaining);
+    }
+
+    used += size;
+    return offset;
+}
+
+void BufferArena::release(std::size_t offset, std::size_t size) {
+    size = align(size > 0 ? size : 1);
+    assert(offset % alignment == 0);
+    assert(offset + size <= capacity);
+    assert(used >= size);
+    used -= size;
+
+    auto next = freeRanges.lower_bound(offset);
+    assert(next == freeRanges.end() || next->first >= offset + size);
+
+    // Merge with the free range that ends where this one starts.
+    if (next != freeRanges.begin()) {
+        auto previous = std::prev(next);
+        assert(previous->first + previous->second <= offset);
+        if (previous->first + previous->second == offset) {
+            offset = previous->first;
+            size += previous->second;
+            freeRanges.erase(previous);
+        }
+    }
+
+    // Merge with the free range that starts where this one ends.
+    if (next != freeRanges.end() && next->first == offset + size) {
+        size += next->second;
+        freeRanges.erase(next);
+    }
+
+    freeRanges.emplace(offset, size);
+}
+
+} // namespace gfx
+} // namespace mbgl
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <mbgl/util/optional.hpp>
+
+#include <cstddef>
+#include <map>
+
+namespace mbgl {
+namespace gfx {
+
+// Bookkeeping for suballocating ranges from one large buffer. The arena does not own any memory;
+// it only tracks which ranges of [0, capacity) are in use. Released ranges are merged with their
+// free neighbours, so that space freed by evicted tiles can be reused by larger buffers later.
+class BufferArena {
+public:
+    // Offsets and sizes of all ranges are multiples of this, which satisfies the alignment
+    // requirements of all vertex attribute and index types.
+    static constexpr std::size_t alignment = 16;
+
+    explicit BufferArena(std::size_t capacity);
+
+    // Returns the offset of a free range of at least `size` bytes, or nothing if there is none.
+    optional<std::size_t> allocate(std::size_t size);
+
+    // Returns a range obtained from allocate() with the same size to the arena.
+    void release(std::size_t offset, std::size_t size);
+
+    std::size_t getCapacity() const {
+        return capacity;
+    }
+
+    // Number of bytes in allocated ranges, including alignment padding.
+    std::size_t getUsed() const {
+        return used;
+    }
+
+    bool empty() const {
+        return used == 0;
+    }
+
+private:
+    static std::size_t align(std::size_t size) {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+    const std::size_t capacity;
+    std::size_t used = 0;
+    // Free ranges, keyed by offset.
+    std::map<std::size_t, std::size_t> freeRanges;
+};
+
+} // namespace gfx
+} // namespace mbgl
@@ -27,6 +27,8 @@ public:
     static constexpr const uint32_t minimumRequiredVertexBindingCount = 8;
     const uint32_t maximumVertexBindingCount;
     bool supportsHalfFloatTextures = false;
+    // May be cleared before the first frame to draw instanceable geometry per vertex instead.
+    bool supportsInstancing = false;
 
 public:
     Context(Context&&) = delete;
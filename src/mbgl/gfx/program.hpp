@@ -49,6 +49,28 @@ public:
                       const IndexBuffer&,
                       std::size_t indexOffset,
                       std::size_t indexLength) = 0;
+
+    // Like draw(), but draws the indices once for each of `instanceCount` instances. Bindings
+    // with a divisor advance per instance; requires Context::supportsInstancing.
+    virtual void drawInstanced(Context&,
+                               RenderPass&,
+                               const DrawMode&,
+                               const DepthMode&,
+                               const StencilMode&,
+                               const ColorMode&,
+                               const CullFaceMode&,
+                               const UniformValues<UniformList>&,
+                               DrawScope&,
+                               const AttributeBindings<AttributeList>&,
+                               const TextureBindings<TextureList>&,
+                               const IndexBuffer&,
+                               std::size_t indexOffset,
+                               std::size_t indexLength,
+                               std::size_t instanceCount) = 0;
+
+    // Prepares the variants of this program that are known to be needed, so that drawing them
+    // for the first time does not stall on shader compilation.
+    virtual void precompile(Context&) {}
 };
 
 } // namespace gfx
@@ -0,0 +1,59 @@
+#include <mbgl/gfx/render_pass.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace mbgl {
+namespace gfx {
+
+void RenderPass::beginBatch() {
+    assert(!batching);
+    batching = true;
+    batchRank = 0;
+}
+
+void RenderPass::endBatch() {
+    assert(batching);
+    batching = false;
+
+    // Batches rarely use more than a handful of keys, so searching a vector beats hashing.
+    std::vector<std::pair<uint32_t, BatchedDraws*>> keys;
+    for (const auto& batchedDraw : batchedDraws) {
+        const auto key = std::make_pair(batchedDraw.rank, batchedDraw.draws);
+        if (std::find(keys.begin(), keys.end(), key) == keys.end()) {
+            keys.push_back(key);
+        }
+    }
+    std::stable_sort(keys.begin(), keys.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    for (const auto& key : keys) {
+        for (const auto& batchedDraw : batchedDraws) {
+            if (batchedDraw.rank == key.first && batchedDraw.draws == key.second) {
+                applyScissor(batchedDraw.scissor);
+                batchedDraw.draws->draw(batchedDraw.index);
+            }
+        }
+    }
+    applyScissor(scissor);
+
+    batchedDraws.clear();
+    for (const auto& entry : drawsByKey) {
+        entry.draws->clear();
+    }
+}
+
+void RenderPass::batch(BatchedDraws& draws, std::size_t index) {
+    assert(batching);
+    batchedDraws.push_back({ batchRank, &draws, index, scissor });
+}
+
+void RenderPass::setScissor(const optional<ScissorRect>& scissor_) {
+    scissor = scissor_;
+    if (!batching) {
+        applyScissor(scissor);
+    }
+}
+
+} // namespace gfx
+} // namespace mbgl
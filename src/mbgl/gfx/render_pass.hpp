@@ -4,7 +4,11 @@
 #include <mbgl/util/color.hpp>
 #include <mbgl/util/optional.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace mbgl {
 namespace gfx {
@@ -19,6 +23,28 @@ public:
     optional<int32_t> clearStencil;
 };
 
+// A rectangle of the framebuffer, in pixels from its lower left corner.
+struct ScissorRect {
+    int32_t x;
+    int32_t y;
+    uint32_t width;
+    uint32_t height;
+};
+
+inline bool operator==(const ScissorRect& lhs, const ScissorRect& rhs) {
+    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.width == rhs.width && lhs.height == rhs.height;
+}
+
+// Draws recorded for a key of a batch, see RenderPass::batch(). Implementations store the
+// arguments of their draws by value, in a vector that keeps its capacity when cleared.
+class BatchedDraws {
+public:
+    virtual ~BatchedDraws() = default;
+    // Issues the recorded draw with the given index.
+    virtual void draw(std::size_t index) = 0;
+    virtual void clear() = 0;
+};
+
 class RenderPass {
 protected:
     RenderPass() = default;
@@ -27,6 +53,8 @@ protected:
     virtual void pushDebugGroup(const char* name) = 0;
     virtual void popDebugGroup() = 0;
 
+    virtual void applyScissor(const optional<ScissorRect>&) = 0;
+
 public:
     virtual ~RenderPass() = default;
     RenderPass(const RenderPass&) = delete;
@@ -35,6 +63,74 @@ public:
     DebugGroup<RenderPass> createDebugGroup(const char* name) {
         return { *this, name };
     }
+
+    // While a batch is open, draws are recorded with batch() instead of being issued. endBatch()
+    // issues them grouped by rank and by their BatchedDraws: ranks in ascending order, and the
+    // BatchedDraws of a rank in the order in which they first appeared, keeping the order of the
+    // draws of each. Keyed by program, this saves the program and pipeline state changes of layers
+    // that alternate between programs from tile to tile. Draws whose order relative to the draws
+    // of other keys matters must be recorded with different ranks.
+    void beginBatch();
+    void endBatch();
+
+    // Sets the rank of the draws recorded next; each batch starts with rank zero.
+    void setBatchRank(uint32_t rank) {
+        batchRank = rank;
+    }
+
+    bool isBatching() const {
+        return batching;
+    }
+
+    // Returns the draws recorded for `key`, creating them from `args` when the key is first used
+    // with this type in the render pass. They are kept for the batches that follow, so that
+    // recording a draw does not allocate once their storage has grown.
+    template <class Draws, class... Args>
+    Draws& getBatchedDraws(const void* key, Args&&... args) {
+        const void* type = typeKey<Draws>();
+        for (const auto& entry : drawsByKey) {
+            if (entry.key == key && entry.type == type) {
+                return static_cast<Draws&>(*entry.draws);
+            }
+        }
+        auto draws = std::make_unique<Draws>(std::forward<Args>(args)...);
+        Draws& result = *draws;
+        drawsByKey.push_back({ key, type, std::move(draws) });
+        return result;
+    }
+
+    // Records the draw with the given index of `draws`, to be issued by endBatch().
+    void batch(BatchedDraws& draws, std::size_t index);
+
+    // Restricts the draws that follow to the given rectangle, or lifts the restriction. Batched
+    // draws are issued with the rectangle that was set when they were recorded.
+    void setScissor(const optional<ScissorRect>&);
+
+private:
+    template <class Draws>
+    static const void* typeKey() {
+        static const char key = 0;
+        return &key;
+    }
+
+    struct DrawsByKey {
+        const void* key;
+        const void* type;
+        std::unique_ptr<BatchedDraws> draws;
+    };
+
+    struct BatchedDraw {
+        uint32_t rank;
+        BatchedDraws* draws;
+        std::size_t index;
+        optional<ScissorRect> scissor;
+    };
+
+    bool batching = false;
+    uint32_t batchRank = 0;
+    std::vector<DrawsByKey> drawsByKey;
+    std::vector<BatchedDraw> batchedDraws;
+    optional<ScissorRect> scissor;
 };
 
 } // namespace gfx
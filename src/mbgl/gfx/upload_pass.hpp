@@ -8,9 +8,13 @@
 #include <mbgl/gfx/texture.hpp>
 #include <mbgl/util/size.hpp>
 
+#include <vector>
+
 namespace mbgl {
 namespace gfx {
 
+class Context;
+
 class UploadPass {
 protected:
     UploadPass() = default;
@@ -24,6 +28,8 @@ public:
     UploadPass(const UploadPass&) = delete;
     UploadPass& operator=(const UploadPass&) = delete;
 
+    virtual const Context& getContext() const = 0;
+
     DebugGroup<UploadPass> createDebugGroup(const char* name) {
         return { *this, name };
     }
@@ -36,6 +42,23 @@ public:
         return { v.elements(), createVertexBufferResource(v.data(), v.bytes(), usage) };
     }
 
+    // Uploads each vertex `repeat` times in a row, e.g. to draw data that is stored once per
+    // instance without instancing. The vector is left untouched.
+    template <class Vertex>
+    VertexBuffer<Vertex> createVertexBuffer(const VertexVector<Vertex>& v,
+                                            const std::size_t repeat,
+                                            const BufferUsageType usage = BufferUsageType::StaticDraw) {
+        if (repeat == 1) {
+            return { v.elements(), createVertexBufferResource(v.data(), v.bytes(), usage) };
+        }
+        std::vector<Vertex> repeated;
+        repeated.reserve(v.elements() * repeat);
+        for (const auto& vertex : v.vector()) {
+            repeated.insert(repeated.end(), repeat, vertex);
+        }
+        return { repeated.size(), createVertexBufferResource(repeated.data(), repeated.size() * sizeof(Vertex), usage) };
+    }
+
     template <class Vertex>
     void updateVertexBuffer(VertexBuffer<Vertex>& buffer, VertexVector<Vertex>&& v) {
         assert(v.elements() == buffer.elements);
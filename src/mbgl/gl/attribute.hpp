@@ -102,8 +102,14 @@ public:
     }
 
     static std::string defines(const gfx::AttributeBindings<TypeList<As...>>& bindings) {
+        return defines(compute(bindings));
+    }
+
+    // Defines of the program variant for the given key, so that a variant can be compiled
+    // without the bindings it was first drawn with.
+    static std::string defines(uint32_t key) {
         std::string result;
-        util::ignore({ (!bindings.template get<As>()
+        util::ignore({ (!(key & (1 << TypeIndex<As, As...>::value))
                             ? (void)(result += concat_literals<&attributeDefinePrefix, &As::name, &string_literal<'\n'>::value>::value())
                             : (void)0,
                         0)... });
@@ -0,0 +1,104 @@
+#include <mbgl/gl/binary_program.hpp>
+
+#include <protozero/pbf_reader.hpp>
+#include <protozero/pbf_writer.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace mbgl {
+namespace gl {
+
+BinaryProgram::BinaryProgram(std::string identifier)
+    : identifier_(std::move(identifier)) {
+}
+
+BinaryProgram BinaryProgram::parse(const std::string& data) {
+    BinaryProgram result { "" };
+
+    try {
+        protozero::pbf_reader pbf(data);
+        while (pbf.next()) {
+            switch (pbf.tag()) {
+            case 1: // identifier
+                result.identifier_ = pbf.get_string();
+                break;
+            case 2: { // variant
+                auto variant_pbf = pbf.get_message();
+                uint32_t key = 0;
+                Variant variant { 0, {} };
+                bool hasKey = false;
+                bool hasFormat = false;
+                while (variant_pbf.next()) {
+                    switch (variant_pbf.tag()) {
+                    case 1: // key
+                        key = variant_pbf.get_uint32();
+                        hasKey = true;
+                        break;
+                    case 2: // format
+                        variant.format = variant_pbf.get_uint32();
+                        hasFormat = true;
+                        break;
+                    case 3: // code
+                        variant.code = variant_pbf.get_bytes();
+                        break;
+                    default:
+                        variant_pbf.skip();
+                    }
+                }
+                if (!hasKey || !hasFormat || variant.code.empty()) {
+                    throw std::runtime_error("binary program variant is incomplete");
+                }
+                result.variants[key] = std::move(variant);
+                break;
+            }
+            default:
+                pbf.skip();
+            }
+        }
+    } catch (const protozero::exception& error) {
+        throw std::runtime_error(std::string("binary program is malformed: ") + error.what());
+    }
+
+    if (result.identifier_.empty()) {
+        throw std::runtime_error("binary program has no identifier");
+    }
+
+    return result;
+}
+
+std::string BinaryProgram::serialize() const {
+    std::string data;
+    protozero::pbf_writer pbf(data);
+    pbf.add_string(1 /* identifier */, identifier_);
+    for (uint32_t key : keys()) {
+        const Variant& variant = variants.at(key);
+        protozero::pbf_writer variant_pbf(pbf, 2 /* variant */);
+        variant_pbf.add_uint32(1 /* key */, key);
+        variant_pbf.add_uint32(2 /* format */, variant.format);
+        variant_pbf.add_bytes(3 /* code */, variant.code);
+    }
+    return data;
+}
+
+const BinaryProgram::Variant* BinaryProgram::find(uint32_t key) const {
+    auto it = variants.find(key);
+    return it != variants.end() ? &it->second : nullptr;
+}
+
+void BinaryProgram::insert(uint32_t key, BinaryProgramFormat format, std::string code) {
+    variants[key] = { format, std::move(code) };
+}
+
+std::vector<uint32_t> BinaryProgram::keys() const {
+    std::vector<uint32_t> result;
+    result.reserve(variants.size());
+    for (const auto& variant : variants) {
+        result.push_back(variant.first);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+} // namespace gl
+} // namespace mbgl
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <mbgl/gl/types.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+namespace gl {
+
+// The linked binaries of the variants of one program, as stored in the program cache. Variants
+// are keyed by the attribute key they were compiled for (see gl::AttributeKey). The identifier
+// describes the shader sources, defines and driver the binaries were produced with; a binary
+// must not be loaded for any other identifier.
+class BinaryProgram {
+public:
+    struct Variant {
+        BinaryProgramFormat format;
+        std::string code;
+    };
+
+    explicit BinaryProgram(std::string identifier);
+
+    // Parses a serialized program; throws std::runtime_error if the data is malformed.
+    static BinaryProgram parse(const std::string& data);
+
+    std::string serialize() const;
+
+    const std::string& identifier() const {
+        return identifier_;
+    }
+
+    const Variant* find(uint32_t key) const;
+    void insert(uint32_t key, BinaryProgramFormat, std::string code);
+
+    // Keys of all stored variants, in ascending order.
+    std::vector<uint32_t> keys() const;
+
+private:
+    std::string identifier_;
+    std::unordered_map<uint32_t, Variant> variants;
+};
+
+} // namespace gl
+} // namespace mbgl
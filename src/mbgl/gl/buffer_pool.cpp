@@ -0,0 +1,141 @@
+#include <mbgl/gl/buffer_pool.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/defines.hpp>
+#include <mbgl/gl/enum.hpp>
+#include <mbgl/platform/gl_functions.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace mbgl {
+namespace gl {
+
+using namespace platform;
+
+namespace {
+
+// Size of the pooled buffers. Dense tiles have a few hundred kilobytes of vertices, so a block
+// holds the buckets of several tiles.
+constexpr std::size_t blockSize = 1024 * 1024;
+
+// Larger buffers get a buffer of their own, so that a single huge bucket doesn't fragment a block.
+constexpr std::size_t maxPooledSize = blockSize / 4;
+
+GLenum target(BufferType type) {
+    return type == BufferType::Vertex ? GL_ARRAY_BUFFER : GL_ELEMENT_ARRAY_BUFFER;
+}
+
+int& memoryStat(gfx::RenderingStats& stats, BufferType type) {
+    return type == BufferType::Vertex ? stats.memVertexBuffers : stats.memIndexBuffers;
+}
+
+} // namespace
+
+BufferAllocation::BufferAllocation(std::shared_ptr<BufferBlock> block_, std::size_t offset_, std::size_t size_)
+    : block(std::move(block_)), offset(offset_), size(size_) {
+    auto& stats = getContext().renderingStats();
+    stats.numBuffers++;
+    memoryStat(stats, block->type) += int(size);
+}
+
+BufferAllocation::BufferAllocation(BufferAllocation&& other) noexcept
+    : block(std::move(other.block)), offset(other.offset), size(other.size) {
+}
+
+BufferAllocation::~BufferAllocation() {
+    if (block) {
+        block->arena.release(offset, size);
+        auto& stats = getContext().renderingStats();
+        stats.numBuffers--;
+        memoryStat(stats, block->type) -= int(size);
+        assert(stats.numBuffers >= 0);
+        assert(memoryStat(stats, block->type) >= 0);
+    }
+}
+
+BufferPool::BufferPool(Context& context_, BufferType type_) : context(context_), type(type_) {
+}
+
+BufferAllocation BufferPool::allocate(const void* data, std::size_t size, const gfx::BufferUsageType usage) {
+    // Buffers that are rewritten every frame keep their own buffer, so that the driver can
+    // orphan it instead of synchronizing with draws that use the rest of a block.
+    if (usage != gfx::BufferUsageType::StaticDraw || size > maxPooledSize) {
+        auto block = createBlock(data, size, usage);
+        const auto offset = block->arena.allocate(size);
+        assert(offset && *offset == 0);
+        return { std::move(block), *offset, size };
+    }
+
+    for (const auto& block : blocks) {
+        if (const auto offset = block->arena.allocate(size)) {
+            BufferAllocation allocation{ block, *offset, size };
+            update(allocation, data, size);
+            return allocation;
+        }
+    }
+
+    blocks.push_back(createBlock(nullptr, blockSize, usage));
+    const auto offset = blocks.back()->arena.allocate(size);
+    assert(offset);
+    BufferAllocation allocation{ blocks.back(), *offset, size };
+    update(allocation, data, size);
+    return allocation;
+}
+
+void BufferPool::update(const BufferAllocation& allocation, const void* data, std::size_t size) {
+    assert(size <= allocation.getSize());
+    bind(allocation.getBuffer());
+    MBGL_CHECK_ERROR(glBufferSubData(target(type), allocation.getOffset(), size, data));
+}
+
+void BufferPool::bind(BufferID buffer) {
+    if (type == BufferType::Vertex) {
+        context.vertexBuffer = buffer;
+    } else {
+        // Be sure to unbind any existing vertex array object before binding the index buffer
+        // so that we don't mess up another VAO
+        context.bindVertexArray = 0;
+        context.globalVertexArrayState.indexBuffer = buffer;
+    }
+}
+
+void BufferPool::reduceMemoryUsage() {
+    blocks.erase(std::remove_if(blocks.begin(), blocks.end(),
+                                [](const auto& block) { return block->arena.empty(); }),
+                 blocks.end());
+}
+
+std::size_t BufferPool::getUsed() const {
+    std::size_t used = 0;
+    for (const auto& block : blocks) {
+        used += block->arena.getUsed();
+    }
+    return used;
+}
+
+std::size_t BufferPool::getCapacity() const {
+    std::size_t capacity = 0;
+    for (const auto& block : blocks) {
+        capacity += block->arena.getCapacity();
+    }
+    return capacity;
+}
+
+std::shared_ptr<BufferBlock> BufferPool::createBlock(const void* data,
+                                                     std::size_t size,
+                                                     const gfx::BufferUsageType usage) {
+    BufferID id = 0;
+    MBGL_CHECK_ERROR(glGenBuffers(1, &id));
+    // NOLINTNEXTLINE(performance-move-const-arg)
+    UniqueBuffer buffer{ std::move(id), { context } };
+    bind(buffer);
+    MBGL_CHECK_ERROR(glBufferData(target(type), size, data, Enum<gfx::BufferUsageType>::to(usage)));
+    // Round up, so that the arena can hand out the whole buffer of a dedicated block, even an
+    // empty one.
+    const std::size_t alignment = gfx::BufferArena::alignment;
+    const std::size_t capacity = (std::max<std::size_t>(size, 1) + alignment - 1) / alignment * alignment;
+    return std::make_shared<BufferBlock>(std::move(buffer), type, capacity);
+}
+
+} // namespace gl
+} // namespace mbgl
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <mbgl/gfx/buffer_arena.hpp>
+#include <mbgl/gfx/types.hpp>
+#include <mbgl/gl/object.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace mbgl {
+namespace gl {
+
+class Context;
+
+enum class BufferType : bool {
+    Vertex,
+    Index,
+};
+
+// A GL buffer and the ranges of it that are in use.
+class BufferBlock {
+public:
+    BufferBlock(UniqueBuffer&& buffer_, BufferType type_, std::size_t capacity)
+        : buffer(std::move(buffer_)), type(type_), arena(capacity) {}
+
+    UniqueBuffer buffer;
+    const BufferType type;
+    gfx::BufferArena arena;
+};
+
+// A range of a buffer block. The range is returned to the block when the allocation is
+// destroyed; the block is deleted once neither its pool nor any allocation refers to it.
+// Each allocation counts as one buffer in RenderingStats::numBuffers, and its size in
+// memVertexBuffers or memIndexBuffers.
+class BufferAllocation : private util::noncopyable {
+public:
+    BufferAllocation(std::shared_ptr<BufferBlock>, std::size_t offset, std::size_t size);
+    BufferAllocation(BufferAllocation&&) noexcept;
+    ~BufferAllocation();
+
+    BufferID getBuffer() const {
+        return block->buffer;
+    }
+
+    // Offset of the range within the buffer, in bytes.
+    std::size_t getOffset() const {
+        return offset;
+    }
+
+    std::size_t getSize() const {
+        return size;
+    }
+
+    Context& getContext() const {
+        return block->buffer.get_deleter().context;
+    }
+
+private:
+    std::shared_ptr<BufferBlock> block;
+    std::size_t offset;
+    std::size_t size;
+};
+
+// Suballocates vertex or index buffers from a few large GL buffers, so that buckets don't pay for
+// one glBufferData() call and one GL object each, and so that the space of evicted tiles is
+// reused instead of freed and reallocated. Buffers that are updated often or that are too large
+// to share a block get a buffer of their own.
+class BufferPool : private util::noncopyable {
+public:
+    BufferPool(Context&, BufferType);
+
+    // Uploads the data to a new range and returns it.
+    BufferAllocation allocate(const void* data, std::size_t size, gfx::BufferUsageType);
+
+    // Replaces the first `size` bytes of the range; must not exceed the size of the allocation.
+    void update(const BufferAllocation&, const void* data, std::size_t size);
+
+    // Binds the buffer to the target of this pool.
+    void bind(BufferID);
+
+    // Drops blocks that have no ranges in use.
+    void reduceMemoryUsage();
+
+    // Bytes in use and total bytes of the pooled blocks.
+    std::size_t getUsed() const;
+    std::size_t getCapacity() const;
+
+private:
+    std::shared_ptr<BufferBlock> createBlock(const void* data, std::size_t size, gfx::BufferUsageType);
+
+    Context& context;
+    const BufferType type;
+    std::vector<std::shared_ptr<BufferBlock>> blocks;
+};
+
+} // namespace gl
+} // namespace mbgl
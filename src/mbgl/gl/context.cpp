@@ -1,4 +1,5 @@
 #include <mbgl/gl/context.hpp>
+#include <mbgl/gl/binary_program.hpp>
 #include <mbgl/gl/enum.hpp>
 #include <mbgl/gl/renderer_backend.hpp>
 #include <mbgl/gl/texture_resource.hpp>
@@ -9,10 +10,14 @@
 #include <mbgl/gl/command_encoder.hpp>
 #include <mbgl/gl/debugging_extension.hpp>
 #include <mbgl/gl/vertex_array_extension.hpp>
+#include <mbgl/gl/program_binary_extension.hpp>
+#include <mbgl/gl/instanced_arrays_extension.hpp>
 #include <mbgl/util/traits.hpp>
 #include <mbgl/util/std.hpp>
 #include <mbgl/util/logging.hpp>
+#include <mbgl/util/io.hpp>
 
+#include <cassert>
 #include <cstring>
 
 namespace mbgl {
@@ -59,6 +64,7 @@ Context::Context(RendererBackend& backend_)
       stats() {}
 
 Context::~Context() {
+    writeProgramCaches();
     if (cleanupOnDestruction) {
         reset();
         assert(stats.isZero());
@@ -122,6 +128,30 @@ void Context::initializeExtensions(const std::function<gl::ProcAddress(const cha
         if (!supportsVertexArrays()) {
             Log::Warning(Event::OpenGL, "Not using Vertex Array Objects");
         }
+
+        instancedArrays = std::make_unique<extension::InstancedArrays>(fn);
+        if (instancedArrays->drawElementsInstanced && instancedArrays->vertexAttribDivisor) {
+            supportsInstancing = true;
+        } else {
+            instancedArrays.reset();
+        }
+
+        programBinary = std::make_unique<extension::ProgramBinary>(fn);
+        if (supportsProgramBinaries()) {
+            // Some drivers advertise the extension without supporting a single binary format.
+            GLint binaryFormats = 0;
+            MBGL_CHECK_ERROR(glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats));
+            if (binaryFormats <= 0) {
+                programBinary.reset();
+            }
+        }
+
+        for (auto name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+            if (const auto* value = reinterpret_cast<const char*>(MBGL_CHECK_ERROR(glGetString(name)))) {
+                driverID += value;
+            }
+            driverID += '\n';
+        }
     }
 }
 
@@ -181,6 +211,56 @@ UniqueProgram Context::createProgram(ShaderID vertexShader, ShaderID fragmentSha
     return result;
 }
 
+UniqueProgram Context::createProgram(BinaryProgramFormat binaryFormat, const std::string& binaryProgram) {
+    assert(supportsProgramBinaries());
+    UniqueProgram result { MBGL_CHECK_ERROR(glCreateProgram()), { this } };
+    MBGL_CHECK_ERROR(programBinary->programBinary(result,
+                                                  static_cast<GLenum>(binaryFormat),
+                                                  binaryProgram.data(),
+                                                  static_cast<GLint>(binaryProgram.size())));
+    verifyProgramLinkage(result);
+    return result;
+}
+
+optional<std::pair<BinaryProgramFormat, std::string>> Context::getBinaryProgram(ProgramID program_) const {
+    if (!supportsProgramBinaries()) {
+        return {};
+    }
+    GLint binaryLength;
+    MBGL_CHECK_ERROR(glGetProgramiv(program_, GL_PROGRAM_BINARY_LENGTH, &binaryLength));
+    if (binaryLength <= 0) {
+        return {};
+    }
+    std::string binary;
+    binary.resize(binaryLength);
+    GLenum binaryFormat;
+    MBGL_CHECK_ERROR(programBinary->getProgramBinary(
+        program_, binaryLength, &binaryLength, &binaryFormat, const_cast<char*>(binary.data())));
+    if (size_t(binaryLength) != binary.size()) {
+        return {};
+    }
+    return { { binaryFormat, std::move(binary) } };
+}
+
+bool Context::supportsProgramBinaries() const {
+    return programBinary && programBinary->programBinary && programBinary->getProgramBinary;
+}
+
+void Context::setProgramCacheChanged(const std::string& path, std::shared_ptr<const BinaryProgram> binaries) {
+    changedProgramCaches[path] = std::move(binaries);
+}
+
+void Context::writeProgramCaches() {
+    for (const auto& cache : changedProgramCaches) {
+        try {
+            util::write_file(cache.first, cache.second->serialize());
+        } catch (const std::runtime_error& error) {
+            Log::Warning(Event::OpenGL, "Failed to write program cache %s: %s", cache.first.c_str(), error.what());
+        }
+    }
+    changedProgramCaches.clear();
+}
+
 void Context::linkProgram(ProgramID program_) {
     MBGL_CHECK_ERROR(glLinkProgram(program_));
     verifyProgramLinkage(program_);
@@ -455,12 +535,15 @@ std::unique_ptr<gfx::DrawScopeResource> Context::createDrawScopeResource() {
 void Context::reset() {
     std::copy(pooledTextures.begin(), pooledTextures.end(), std::back_inserter(abandonedTextures));
     pooledTextures.resize(0);
+    vertexBufferPool.reduceMemoryUsage();
+    indexBufferPool.reduceMemoryUsage();
     performCleanup();
 }
 
 void Context::setDirtyState() {
     // Note: does not set viewport/scissorTest/bindFramebuffer to dirty
     // since they are handled separately in the view object.
+    scissor.setDirty();
     stencilFunc.setDirty();
     stencilMask.setDirty();
     stencilTest.setDirty();
@@ -526,62 +609,67 @@ void Context::clear(optional<mbgl::Color> color,
     MBGL_CHECK_ERROR(glClear(mask));
 
     stats.numDrawCalls = 0;
+    stats.numStateChanges = 0;
 }
 
 void Context::setCullFaceMode(const gfx::CullFaceMode& mode) {
-    cullFace = mode.enabled;
+    update(cullFace, mode.enabled);
 
     // These shouldn't need to be updated when face culling is disabled, but we
     // might end up having the same isssues with Adreno 2xx GPUs as noted in
     // Context::setDepthMode.
-    cullFaceSide = mode.side;
-    cullFaceWinding = mode.winding;
+    update(cullFaceSide, mode.side);
+    update(cullFaceWinding, mode.winding);
+}
+
+void Context::setProgram(ProgramID program_) {
+    update(program, program_);
 }
 
 void Context::setDepthMode(const gfx::DepthMode& depth) {
     if (depth.func == gfx::DepthFunctionType::Always && depth.mask != gfx::DepthMaskType::ReadWrite) {
-        depthTest = false;
+        update(depthTest, false);
 
         // Workaround for rendering errors on Adreno 2xx GPUs. Depth-related state should
         // not matter when the depth test is disabled, but on these GPUs it apparently does.
         // https://github.com/mapbox/mapbox-gl-native/issues/9164
-        depthFunc = depth.func;
-        depthMask = depth.mask;
-        depthRange = depth.range;
+        update(depthFunc, depth.func);
+        update(depthMask, depth.mask);
+        update(depthRange, depth.range);
     } else {
-        depthTest = true;
-        depthFunc = depth.func;
-        depthMask = depth.mask;
-        depthRange = depth.range;
+        update(depthTest, true);
+        update(depthFunc, depth.func);
+        update(depthMask, depth.mask);
+        update(depthRange, depth.range);
     }
 }
 
 void Context::setStencilMode(const gfx::StencilMode& stencil) {
     if (stencil.test.is<gfx::StencilMode::Always>() && !stencil.mask) {
-        stencilTest = false;
+        update(stencilTest, false);
     } else {
-        stencilTest = true;
-        stencilMask = stencil.mask;
-        stencilOp = { stencil.fail, stencil.depthFail, stencil.pass };
+        update(stencilTest, true);
+        update(stencilMask, stencil.mask);
+        update(stencilOp, { stencil.fail, stencil.depthFail, stencil.pass });
         apply_visitor([&] (const auto& test) {
-            stencilFunc = { test.func, stencil.ref, test.mask };
+            update(stencilFunc, { test.func, stencil.ref, test.mask });
         }, stencil.test);
     }
 }
 
 void Context::setColorMode(const gfx::ColorMode& color) {
     if (color.blendFunction.is<gfx::ColorMode::Replace>()) {
-        blend = false;
+        update(blend, false);
     } else {
-        blend = true;
-        blendColor = color.blendColor;
+        update(blend, true);
+        update(blendColor, color.blendColor);
         apply_visitor([&] (const auto& blendFunction) {
-            blendEquation = gfx::ColorBlendEquationType(blendFunction.equation);
-            blendFunc = { blendFunction.srcFactor, blendFunction.dstFactor };
+            update(blendEquation, gfx::ColorBlendEquationType(blendFunction.equation));
+            update(blendFunc, { blendFunction.srcFactor, blendFunction.dstFactor });
         }, color.blendFunction);
     }
 
-    colorMask = color.mask;
+    update(colorMask, color.mask);
 }
 
 std::unique_ptr<gfx::CommandEncoder> Context::createCommandEncoder() {
@@ -604,24 +692,28 @@ void Context::finish() {
     MBGL_CHECK_ERROR(glFinish());
 }
 
-void Context::draw(const gfx::DrawMode& drawMode,
-                   std::size_t indexOffset,
-                   std::size_t indexLength) {
+void Context::setDrawMode(const gfx::DrawMode& drawMode) {
     switch (drawMode.type) {
     case gfx::DrawModeType::Points:
 #if not MBGL_USE_GLES2
         // In OpenGL ES 2, the point size is set in the vertex shader.
-        pointSize = drawMode.size;
+        update(pointSize, drawMode.size);
 #endif // MBGL_USE_GLES2
         break;
     case gfx::DrawModeType::Lines:
     case gfx::DrawModeType::LineLoop:
     case gfx::DrawModeType::LineStrip:
-        lineWidth = drawMode.size;
+        update(lineWidth, drawMode.size);
         break;
     default:
         break;
     }
+}
+
+void Context::draw(const gfx::DrawMode& drawMode,
+                   std::size_t indexOffset,
+                   std::size_t indexLength) {
+    setDrawMode(drawMode);
 
     MBGL_CHECK_ERROR(glDrawElements(
         Enum<gfx::DrawModeType>::to(drawMode.type),
@@ -632,6 +724,23 @@ void Context::draw(const gfx::DrawMode& drawMode,
     stats.numDrawCalls++;
 }
 
+void Context::drawInstanced(const gfx::DrawMode& drawMode,
+                            std::size_t indexOffset,
+                            std::size_t indexLength,
+                            std::size_t instanceCount) {
+    assert(supportsInstancing);
+    setDrawMode(drawMode);
+
+    MBGL_CHECK_ERROR(instancedArrays->drawElementsInstanced(
+        Enum<gfx::DrawModeType>::to(drawMode.type),
+        static_cast<GLsizei>(indexLength),
+        GL_UNSIGNED_SHORT,
+        reinterpret_cast<GLvoid*>(sizeof(uint16_t) * indexOffset),
+        static_cast<GLsizei>(instanceCount)));
+
+    stats.numDrawCalls++;
+}
+
 void Context::performCleanup() {
     // TODO: Find a better way to unbind VAOs after we're done with them without introducing
     // unnecessary bind(0)/bind(N) sequences.
@@ -666,7 +775,6 @@ void Context::performCleanup() {
             }
         }
         MBGL_CHECK_ERROR(glDeleteBuffers(int(abandonedBuffers.size()), abandonedBuffers.data()));
-        stats.numBuffers -= int(abandonedBuffers.size());
         abandonedBuffers.clear();
     }
 
@@ -714,10 +822,16 @@ void Context::performCleanup() {
                                                abandonedRenderbuffers.data()));
         abandonedRenderbuffers.clear();
     }
+
+    stats.memBufferPoolUsed = int(vertexBufferPool.getUsed() + indexBufferPool.getUsed());
+    stats.memBufferPoolCapacity = int(vertexBufferPool.getCapacity() + indexBufferPool.getCapacity());
 }
 
 void Context::reduceMemoryUsage() {
+    vertexBufferPool.reduceMemoryUsage();
+    indexBufferPool.reduceMemoryUsage();
     performCleanup();
+    writeProgramCaches();
 
     // Ensure that all pending actions are executed to ensure that they happen before the app goes
     // to the background.
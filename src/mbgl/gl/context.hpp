@@ -2,6 +2,7 @@
 
 #include <mbgl/gfx/context.hpp>
 #include <mbgl/gl/object.hpp>
+#include <mbgl/gl/buffer_pool.hpp>
 #include <mbgl/gl/state.hpp>
 #include <mbgl/gl/value.hpp>
 #include <mbgl/gl/framebuffer.hpp>
@@ -17,6 +18,7 @@
 
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <vector>
 #include <array>
@@ -28,10 +30,13 @@ namespace gl {
 constexpr size_t TextureMax = 64;
 using ProcAddress = void (*)();
 class RendererBackend;
+class BinaryProgram;
 
 namespace extension {
 class VertexArray;
 class Debugging;
+class ProgramBinary;
+class InstancedArrays;
 } // namespace extension
 
 class Context final : public gfx::Context {
@@ -52,6 +57,19 @@ public:
 
     UniqueShader createShader(ShaderType type, const std::initializer_list<const char*>& sources);
     UniqueProgram createProgram(ShaderID vertexShader, ShaderID fragmentShader, const char* location0AttribName);
+    UniqueProgram createProgram(BinaryProgramFormat binaryFormat, const std::string& binaryProgram);
+    optional<std::pair<BinaryProgramFormat, std::string>> getBinaryProgram(ProgramID) const;
+    bool supportsProgramBinaries() const;
+    // Vendor, renderer and version of the driver; program binaries are only valid for the driver
+    // that produced them.
+    const std::string& getDriverID() const {
+        return driverID;
+    }
+    // Marks the program cache file at `path` as out of date. Changed caches are written when the
+    // context reduces its memory usage or is destroyed, not whenever a variant is linked, so
+    // that frames never wait for the file system.
+    void setProgramCacheChanged(const std::string& path, std::shared_ptr<const BinaryProgram>);
+    void writeProgramCaches();
     void verifyProgramLinkage(ProgramID);
     void linkProgram(ProgramID);
     UniqueTexture createUniqueTexture();
@@ -90,11 +108,18 @@ public:
     void setStencilMode(const gfx::StencilMode&);
     void setColorMode(const gfx::ColorMode&);
     void setCullFaceMode(const gfx::CullFaceMode&);
+    void setProgram(ProgramID);
 
     void draw(const gfx::DrawMode&,
               std::size_t indexOffset,
               std::size_t indexLength);
 
+    // Draws the indices `instanceCount` times; requires supportsInstancing.
+    void drawInstanced(const gfx::DrawMode&,
+                       std::size_t indexOffset,
+                       std::size_t indexLength,
+                       std::size_t instanceCount);
+
     void finish();
 
     // Actually remove the objects we marked as abandoned with the above methods.
@@ -114,7 +139,9 @@ public:
             && abandonedBuffers.empty()
             && abandonedTextures.empty()
             && abandonedVertexArrays.empty()
-            && abandonedFramebuffers.empty();
+            && abandonedFramebuffers.empty()
+            && vertexBufferPool.getCapacity() == 0
+            && indexBufferPool.getCapacity() == 0;
     }
 
     void setDirtyState();
@@ -123,10 +150,22 @@ public:
         return debugging.get();
     }
 
+    BufferPool& getVertexBufferPool() {
+        return vertexBufferPool;
+    }
+
+    BufferPool& getIndexBufferPool() {
+        return indexBufferPool;
+    }
+
     extension::VertexArray* getVertexArrayExtension() const {
         return vertexArray.get();
     }
 
+    extension::InstancedArrays* getInstancedArraysExtension() const {
+        return instancedArrays.get();
+    }
+
     void setCleanupOnDestruction(bool cleanup) {
         cleanupOnDestruction = cleanup;
     }
@@ -138,12 +177,17 @@ private:
     gfx::RenderingStats stats;
     std::unique_ptr<extension::Debugging> debugging;
     std::unique_ptr<extension::VertexArray> vertexArray;
+    std::unique_ptr<extension::ProgramBinary> programBinary;
+    std::unique_ptr<extension::InstancedArrays> instancedArrays;
+    std::string driverID;
+    std::map<std::string, std::shared_ptr<const BinaryProgram>> changedProgramCaches;
 
 public:
     State<value::ActiveTextureUnit> activeTextureUnit;
     State<value::BindFramebuffer> bindFramebuffer;
     State<value::Viewport> viewport;
     State<value::ScissorTest> scissorTest;
+    State<value::Scissor> scissor;
     std::array<State<value::BindTexture>, 2> texture;
     State<value::Program> program;
     State<value::BindVertexBuffer> vertexBuffer;
@@ -205,6 +249,18 @@ private:
     VertexArray createVertexArray();
     bool supportsVertexArrays() const;
 
+    // Updates the state that the draw mode depends on, like the line width.
+    void setDrawMode(const gfx::DrawMode&);
+
+    // Assigns a piece of state, counting it in the rendering stats if that changes it.
+    template <typename T, typename... Args>
+    void update(State<T, Args...>& state, const typename T::Type& value) {
+        if (state != value) {
+            state = value;
+            stats.numStateChanges++;
+        }
+    }
+
     friend detail::ProgramDeleter;
     friend detail::ShaderDeleter;
     friend detail::BufferDeleter;
@@ -223,6 +279,10 @@ private:
     std::vector<FramebufferID> abandonedFramebuffers;
     std::vector<RenderbufferID> abandonedRenderbuffers;
 
+    // Declared after abandonedBuffers, which the blocks of the pools are returned to.
+    BufferPool vertexBufferPool { *this, BufferType::Vertex };
+    BufferPool indexBufferPool { *this, BufferType::Index };
+
 public:
     // For testing
     bool disableVAOExtension = false;
@@ -1,14 +1,10 @@
-#include <mbgl/gl/context.hpp>
 #include <mbgl/gl/index_buffer_resource.hpp>
 
 namespace mbgl {
 namespace gl {
 
-IndexBufferResource::~IndexBufferResource() {
-    auto& stats = buffer.get_deleter().context.renderingStats();
-    stats.memIndexBuffers -= byteSize;
-    assert(stats.memIndexBuffers >= 0);
-}
+// The allocation accounts for the buffer in the rendering stats.
+IndexBufferResource::~IndexBufferResource() = default;
 
 } // namespace gl
-} // namespace mbgl
\ No newline at end of file
+} // namespace mbgl
@@ -1,17 +1,18 @@
 #pragma once
 
 #include <mbgl/gfx/index_buffer.hpp>
-#include <mbgl/gl/object.hpp>
+#include <mbgl/gl/buffer_pool.hpp>
 
 namespace mbgl {
 namespace gl {
 
 class IndexBufferResource : public gfx::IndexBufferResource {
 public:
-    IndexBufferResource(UniqueBuffer&& buffer_, int byteSize_) : buffer(std::move(buffer_)), byteSize(byteSize_) {}
+    IndexBufferResource(BufferAllocation&& allocation_, int byteSize_)
+        : allocation(std::move(allocation_)), byteSize(byteSize_) {}
     ~IndexBufferResource() override;
 
-    UniqueBuffer buffer;
+    BufferAllocation allocation;
     int byteSize;
 };
 
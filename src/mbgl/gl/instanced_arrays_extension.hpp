@@ -0,0 +1,39 @@
+#pragma once
+
+#include <mbgl/gl/extension.hpp>
+#include <mbgl/gl/defines.hpp>
+#include <mbgl/platform/gl_functions.hpp>
+
+namespace mbgl {
+namespace gl {
+namespace extension {
+
+class InstancedArrays {
+public:
+    template <typename Fn>
+    InstancedArrays(const Fn& loadExtension)
+        : drawElementsInstanced(
+              loadExtension({ { "GL_ARB_draw_instanced", "glDrawElementsInstancedARB" },
+                              { "GL_ANGLE_instanced_arrays", "glDrawElementsInstancedANGLE" },
+                              { "GL_EXT_instanced_arrays", "glDrawElementsInstancedEXT" },
+                              { "GL_EXT_draw_instanced", "glDrawElementsInstancedEXT" } })),
+          vertexAttribDivisor(
+              loadExtension({ { "GL_ARB_instanced_arrays", "glVertexAttribDivisorARB" },
+                              { "GL_ANGLE_instanced_arrays", "glVertexAttribDivisorANGLE" },
+                              { "GL_EXT_instanced_arrays", "glVertexAttribDivisorEXT" },
+                              { "GL_NV_instanced_arrays", "glVertexAttribDivisorNV" } })) {
+    }
+
+    const ExtensionFunction<void(platform::GLenum mode,
+                                 platform::GLsizei count,
+                                 platform::GLenum type,
+                                 const void* indices,
+                                 platform::GLsizei primcount)>
+        drawElementsInstanced;
+
+    const ExtensionFunction<void(platform::GLuint index, platform::GLuint divisor)> vertexAttribDivisor;
+};
+
+} // namespace extension
+} // namespace gl
+} // namespace mbgl
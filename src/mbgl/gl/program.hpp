@@ -5,6 +5,7 @@
 #include <mbgl/gl/object.hpp>
 #include <mbgl/gl/context.hpp>
 #include <mbgl/gl/draw_scope_resource.hpp>
+#include <mbgl/gl/index_buffer_resource.hpp>
 #include <mbgl/gfx/vertex_buffer.hpp>
 #include <mbgl/gfx/index_buffer.hpp>
 #include <mbgl/gfx/uniform.hpp>
@@ -12,12 +13,14 @@
 #include <mbgl/gl/attribute.hpp>
 #include <mbgl/gl/uniform.hpp>
 #include <mbgl/gl/texture.hpp>
+#include <mbgl/gl/binary_program.hpp>
 #include <mbgl/util/io.hpp>
 
 #include <mbgl/util/logging.hpp>
 #include <mbgl/programs/program_parameters.hpp>
 #include <mbgl/programs/gl/shader_source.hpp>
 #include <mbgl/programs/gl/shaders.hpp>
+#include <mbgl/programs/gl/preludes.hpp>
 
 #include <string>
 
@@ -55,6 +58,13 @@ public:
             textureStates.queryLocations(program);
         }
 
+        Instance(Context& context, BinaryProgramFormat binaryFormat, const std::string& binaryProgram)
+            : program(context.createProgram(binaryFormat, binaryProgram)) {
+            attributeLocations.queryLocations(program);
+            uniformStates.queryLocations(program);
+            textureStates.queryLocations(program);
+        }
+
         static std::unique_ptr<Instance>
         createInstance(gl::Context& context,
                        const ProgramParameters& programParameters,
@@ -96,26 +106,64 @@ public:
               std::size_t indexOffset,
               std::size_t indexLength) override {
         auto& context = static_cast<gl::Context&>(genericContext);
+        bind(context, depthMode, stencilMode, colorMode, cullFaceMode, uniformValues, drawScope,
+             attributeBindings, textureBindings, indexBuffer);
+        context.draw(drawMode, indexBufferOffset(indexBuffer) + indexOffset, indexLength);
+    }
+
+    void drawInstanced(gfx::Context& genericContext,
+                       gfx::RenderPass&,
+                       const gfx::DrawMode& drawMode,
+                       const gfx::DepthMode& depthMode,
+                       const gfx::StencilMode& stencilMode,
+                       const gfx::ColorMode& colorMode,
+                       const gfx::CullFaceMode& cullFaceMode,
+                       const gfx::UniformValues<UniformList>& uniformValues,
+                       gfx::DrawScope& drawScope,
+                       const gfx::AttributeBindings<AttributeList>& attributeBindings,
+                       const gfx::TextureBindings<TextureList>& textureBindings,
+                       const gfx::IndexBuffer& indexBuffer,
+                       std::size_t indexOffset,
+                       std::size_t indexLength,
+                       std::size_t instanceCount) override {
+        auto& context = static_cast<gl::Context&>(genericContext);
+        bind(context, depthMode, stencilMode, colorMode, cullFaceMode, uniformValues, drawScope,
+             attributeBindings, textureBindings, indexBuffer);
+        context.drawInstanced(drawMode, indexBufferOffset(indexBuffer) + indexOffset, indexLength, instanceCount);
+    }
+
+    // Loads every variant found in the program cache, i.e. every variant drawn by an earlier run
+    // with the same shaders, defines and driver. Without a cache file, as on the first run, there
+    // is nothing to precompile and variants are compiled when they are first drawn.
+    void precompile(gfx::Context& genericContext) override {
+        auto& context = static_cast<gl::Context&>(genericContext);
+        loadBinaries(context);
+        if (binaries) {
+            for (const uint32_t key : binaries->keys()) {
+                getInstance(context, key);
+            }
+        }
+    }
 
+private:
+    void bind(gl::Context& context,
+              const gfx::DepthMode& depthMode,
+              const gfx::StencilMode& stencilMode,
+              const gfx::ColorMode& colorMode,
+              const gfx::CullFaceMode& cullFaceMode,
+              const gfx::UniformValues<UniformList>& uniformValues,
+              gfx::DrawScope& drawScope,
+              const gfx::AttributeBindings<AttributeList>& attributeBindings,
+              const gfx::TextureBindings<TextureList>& textureBindings,
+              const gfx::IndexBuffer& indexBuffer) {
         context.setDepthMode(depthMode);
         context.setStencilMode(stencilMode);
         context.setColorMode(colorMode);
         context.setCullFaceMode(cullFaceMode);
 
         const uint32_t key = gl::AttributeKey<AttributeList>::compute(attributeBindings);
-        auto it = instances.find(key);
-        if (it == instances.end()) {
-            it = instances
-                     .emplace(key,
-                              Instance::createInstance(
-                                  context,
-                                  programParameters,
-                                  gl::AttributeKey<AttributeList>::defines(attributeBindings)))
-                     .first;
-        }
-
-        auto& instance = *it->second;
-        context.program = instance.program;
+        auto& instance = getInstance(context, key);
+        context.setProgram(instance.program);
 
         instance.uniformStates.bind(uniformValues);
 
@@ -125,14 +173,98 @@ public:
         vertexArray.bind(context,
                         indexBuffer,
                         instance.attributeLocations.toBindingArray(attributeBindings));
+    }
 
-        context.draw(drawMode,
-                     indexOffset,
-                     indexLength);
+    // The index buffer may be a range of a pooled buffer; its offset is a multiple of the
+    // arena alignment and therefore of the index size.
+    static std::size_t indexBufferOffset(const gfx::IndexBuffer& indexBuffer) {
+        return indexBuffer.getResource<gl::IndexBufferResource>().allocation.getOffset() / sizeof(uint16_t);
+    }
+
+    Instance& getInstance(gl::Context& context, const uint32_t key) {
+        auto it = instances.find(key);
+        if (it == instances.end()) {
+            it = instances.emplace(key, createInstance(context, key)).first;
+        }
+        return *it->second;
+    }
+
+    std::unique_ptr<Instance> createInstance(gl::Context& context, const uint32_t key) {
+        loadBinaries(context);
+        if (binaries) {
+            if (const auto* variant = binaries->find(key)) {
+                try {
+                    return std::make_unique<Instance>(context, variant->format, variant->code);
+                } catch (const std::runtime_error& error) {
+                    Log::Warning(Event::OpenGL,
+                                 "Could not load cached program %s: %s",
+                                 programs::gl::ShaderSource<Name>::name,
+                                 error.what());
+                }
+            }
+        }
+
+        auto instance = Instance::createInstance(
+            context, programParameters, gl::AttributeKey<AttributeList>::defines(key));
+
+        if (binaries) {
+            if (auto binary = context.getBinaryProgram(instance->program)) {
+                binaries->insert(key, binary->first, std::move(binary->second));
+                context.setProgramCacheChanged(*cachePath, binaries);
+            }
+        }
+
+        return instance;
+    }
+
+    // Reads the cached binaries of this program, the first time a variant is needed. Leaves
+    // `binaries` empty if programs are not cached.
+    void loadBinaries(gl::Context& context) {
+        if (binariesLoaded) {
+            return;
+        }
+        binariesLoaded = true;
+
+        if (!context.supportsProgramBinaries()) {
+            return;
+        }
+        const std::string identifier =
+            programs::gl::programIdentifier(programParameters.getDefines(),
+                                            {},
+                                            programs::gl::preludeHash,
+                                            programs::gl::ShaderSource<Name>::hash) +
+            context.getDriverID();
+        cachePath = programParameters.cachePath(programs::gl::ShaderSource<Name>::name, identifier);
+        if (!cachePath) {
+            return;
+        }
+
+        binaries = std::make_shared<BinaryProgram>(identifier);
+        try {
+            if (auto data = util::readFile(*cachePath)) {
+                auto cached = BinaryProgram::parse(*data);
+                if (cached.identifier() == identifier) {
+                    *binaries = std::move(cached);
+                } else {
+                    Log::Warning(Event::OpenGL,
+                                 "Cached program %s changed. Recompilation required.",
+                                 programs::gl::ShaderSource<Name>::name);
+                }
+            }
+        } catch (const std::runtime_error& error) {
+            Log::Warning(Event::OpenGL,
+                         "Could not load cached program %s: %s",
+                         programs::gl::ShaderSource<Name>::name,
+                         error.what());
+        }
     }
 
-private:
     std::map<uint32_t, std::unique_ptr<Instance>> instances;
+
+    bool binariesLoaded = false;
+    optional<std::string> cachePath;
+    // Shared with the context until it has written the cache file.
+    std::shared_ptr<BinaryProgram> binaries;
 };
 
 } // namespace gl
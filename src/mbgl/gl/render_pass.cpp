@@ -3,13 +3,23 @@
 #include <mbgl/gl/renderable_resource.hpp>
 #include <mbgl/gl/context.hpp>
 
+#include <algorithm>
+
 namespace mbgl {
 namespace gl {
 
 RenderPass::RenderPass(gl::CommandEncoder& commandEncoder_,
                        const char* name,
                        const gfx::RenderPassDescriptor& descriptor)
-    : commandEncoder(commandEncoder_), debugGroup(commandEncoder.createDebugGroup(name)) {
+    : commandEncoder(commandEncoder_),
+      debugGroup(commandEncoder.createDebugGroup(name)),
+      scissorTest(commandEncoder.context.scissorTest.getCurrentValue()),
+      // The cached scissor box is not seeded from GL, so the box of a scissor test that is already
+      // enabled, e.g. by the host, is read back.
+      scissorBox(scissorTest ? value::Scissor::Get() : commandEncoder.context.scissor.getCurrentValue()) {
+    if (scissorTest) {
+        commandEncoder.context.scissor.setCurrentValue(scissorBox);
+    }
     descriptor.renderable.getResource<gl::RenderableResource>().bind();
     const auto clearDebugGroup(commandEncoder.createDebugGroup("clear"));
     commandEncoder.context.clear(descriptor.clearColor, descriptor.clearDepth,
@@ -24,5 +34,34 @@ void RenderPass::popDebugGroup() {
     commandEncoder.popDebugGroup();
 }
 
+void RenderPass::applyScissor(const optional<gfx::ScissorRect>& rect) {
+    auto& context = commandEncoder.context;
+    if (!rect) {
+        context.scissor = scissorBox;
+        context.scissorTest = scissorTest;
+        return;
+    }
+
+    // Scissor rectangles are in window coordinates, while the rectangle is relative to the
+    // framebuffer the viewport covers.
+    const auto viewport = context.viewport.getCurrentValue();
+    int32_t left = viewport.x + rect->x;
+    int32_t bottom = viewport.y + rect->y;
+    int32_t right = left + static_cast<int32_t>(rect->width);
+    int32_t top = bottom + static_cast<int32_t>(rect->height);
+    if (scissorTest) {
+        // Draws must not leave the box that the scissor test was enabled with.
+        left = std::max(left, scissorBox.x);
+        bottom = std::max(bottom, scissorBox.y);
+        right = std::min(right, scissorBox.x + static_cast<int32_t>(scissorBox.size.width));
+        top = std::min(top, scissorBox.y + static_cast<int32_t>(scissorBox.size.height));
+    }
+    context.scissor = { left,
+                        bottom,
+                        { static_cast<uint32_t>(std::max(right - left, 0)),
+                          static_cast<uint32_t>(std::max(top - bottom, 0)) } };
+    context.scissorTest = true;
+}
+
 } // namespace gl
 } // namespace mbgl
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/gfx/render_pass.hpp>
+#include <mbgl/gl/value.hpp>
 
 namespace mbgl {
 namespace gfx {
@@ -21,10 +22,14 @@ public:
 private:
     void pushDebugGroup(const char* name) override;
     void popDebugGroup() override;
+    void applyScissor(const optional<gfx::ScissorRect>&) override;
 
 private:
     gl::CommandEncoder& commandEncoder;
     const gfx::DebugGroup<gfx::CommandEncoder> debugGroup;
+    // Scissor state when the pass began; restored when the scissor rectangle is lifted.
+    const bool scissorTest;
+    const value::Scissor::Type scissorBox;
 };
 
 } // namespace gl
@@ -16,51 +16,34 @@ UploadPass::UploadPass(gl::CommandEncoder& commandEncoder_, const char* name)
     : commandEncoder(commandEncoder_), debugGroup(commandEncoder.createDebugGroup(name)) {
 }
 
+const gfx::Context& UploadPass::getContext() const {
+    return commandEncoder.context;
+}
+
 std::unique_ptr<gfx::VertexBufferResource> UploadPass::createVertexBufferResource(
     const void* data, std::size_t size, const gfx::BufferUsageType usage) {
-    BufferID id = 0;
-    MBGL_CHECK_ERROR(glGenBuffers(1, &id));
-    commandEncoder.context.renderingStats().numBuffers++;
-    commandEncoder.context.renderingStats().memVertexBuffers += size;
-    // NOLINTNEXTLINE(performance-move-const-arg)
-    UniqueBuffer result{ std::move(id), { commandEncoder.context } };
-    commandEncoder.context.vertexBuffer = result;
-    MBGL_CHECK_ERROR(
-        glBufferData(GL_ARRAY_BUFFER, size, data, Enum<gfx::BufferUsageType>::to(usage)));
-    return std::make_unique<gl::VertexBufferResource>(std::move(result), size);
+    return std::make_unique<gl::VertexBufferResource>(
+        commandEncoder.context.getVertexBufferPool().allocate(data, size, usage), size);
 }
 
 void UploadPass::updateVertexBufferResource(gfx::VertexBufferResource& resource,
                                             const void* data,
                                             std::size_t size) {
-    commandEncoder.context.vertexBuffer = static_cast<gl::VertexBufferResource&>(resource).buffer;
-    MBGL_CHECK_ERROR(glBufferSubData(GL_ARRAY_BUFFER, 0, size, data));
+    commandEncoder.context.getVertexBufferPool().update(
+        static_cast<gl::VertexBufferResource&>(resource).allocation, data, size);
 }
 
 std::unique_ptr<gfx::IndexBufferResource> UploadPass::createIndexBufferResource(
     const void* data, std::size_t size, const gfx::BufferUsageType usage) {
-    BufferID id = 0;
-    MBGL_CHECK_ERROR(glGenBuffers(1, &id));
-    commandEncoder.context.renderingStats().numBuffers++;
-    commandEncoder.context.renderingStats().memIndexBuffers += size;
-    // NOLINTNEXTLINE(performance-move-const-arg)
-    UniqueBuffer result{ std::move(id), { commandEncoder.context } };
-    commandEncoder.context.bindVertexArray = 0;
-    commandEncoder.context.globalVertexArrayState.indexBuffer = result;
-    MBGL_CHECK_ERROR(
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, Enum<gfx::BufferUsageType>::to(usage)));
-    return std::make_unique<gl::IndexBufferResource>(std::move(result), size);
+    return std::make_unique<gl::IndexBufferResource>(
+        commandEncoder.context.getIndexBufferPool().allocate(data, size, usage), size);
 }
 
 void UploadPass::updateIndexBufferResource(gfx::IndexBufferResource& resource,
                                            const void* data,
                                            std::size_t size) {
-    // Be sure to unbind any existing vertex array object before binding the index buffer
-    // so that we don't mess up another VAO
-    commandEncoder.context.bindVertexArray = 0;
-    commandEncoder.context.globalVertexArrayState.indexBuffer =
-        static_cast<gl::IndexBufferResource&>(resource).buffer;
-    MBGL_CHECK_ERROR(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, size, data));
+    commandEncoder.context.getIndexBufferPool().update(
+        static_cast<gl::IndexBufferResource&>(resource).allocation, data, size);
 }
 
 std::unique_ptr<gfx::TextureResource>
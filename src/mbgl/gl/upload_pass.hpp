@@ -18,6 +18,8 @@ class UploadPass final : public gfx::UploadPass {
 public:
     UploadPass(gl::CommandEncoder&, const char* name);
 
+    const gfx::Context& getContext() const override;
+
 private:
     void pushDebugGroup(const char* name) override;
     void popDebugGroup() override;
@@ -2,6 +2,7 @@
 #include <mbgl/gl/context.hpp>
 #include <mbgl/gl/vertex_buffer_resource.hpp>
 #include <mbgl/gl/vertex_array_extension.hpp>
+#include <mbgl/gl/instanced_arrays_extension.hpp>
 #include <mbgl/gl/enum.hpp>
 
 namespace mbgl {
@@ -280,6 +281,19 @@ ScissorTest::Type ScissorTest::Get() {
     return scissorTest;
 }
 
+const constexpr Scissor::Type Scissor::Default;
+
+void Scissor::Set(const Type& value) {
+    MBGL_CHECK_ERROR(glScissor(value.x, value.y, value.size.width, value.size.height));
+}
+
+Scissor::Type Scissor::Get() {
+    GLint scissor[4];
+    MBGL_CHECK_ERROR(glGetIntegerv(GL_SCISSOR_BOX, scissor));
+    return { static_cast<int32_t>(scissor[0]), static_cast<int32_t>(scissor[1]),
+             { static_cast<uint32_t>(scissor[2]), static_cast<uint32_t>(scissor[3]) } };
+}
+
 const constexpr BindFramebuffer::Type BindFramebuffer::Default;
 
 void BindFramebuffer::Set(const Type& value) {
@@ -491,7 +505,9 @@ GLint components(const gfx::AttributeDataType type) {
 
 void VertexAttribute::Set(const Type& binding, Context& context, AttributeLocation location) {
     if (binding) {
-        context.vertexBuffer = reinterpret_cast<const gl::VertexBufferResource&>(*binding->vertexBufferResource).buffer;
+        const auto& allocation =
+            reinterpret_cast<const gl::VertexBufferResource&>(*binding->vertexBufferResource).allocation;
+        context.vertexBuffer = allocation.getBuffer();
         MBGL_CHECK_ERROR(glEnableVertexAttribArray(location));
         MBGL_CHECK_ERROR(glVertexAttribPointer(
             location,
@@ -499,7 +515,14 @@ void VertexAttribute::Set(const Type& binding, Context& context, AttributeLocati
             vertexType(binding->attribute.dataType),
             static_cast<GLboolean>(false),
             static_cast<GLsizei>(binding->vertexStride),
-            reinterpret_cast<GLvoid*>(binding->attribute.offset + (binding->vertexStride * binding->vertexOffset))));
+            reinterpret_cast<GLvoid*>(allocation.getOffset() + binding->attribute.offset +
+                                      (binding->vertexStride * binding->vertexOffset))));
+        // The divisor outlives the binding, so it is reset for per-vertex attributes as well.
+        if (auto* instancedArrays = context.getInstancedArraysExtension()) {
+            MBGL_CHECK_ERROR(instancedArrays->vertexAttribDivisor(location, binding->divisor));
+        } else {
+            assert(binding->divisor == 0);
+        }
     } else {
         MBGL_CHECK_ERROR(glDisableVertexAttribArray(location));
     }
@@ -192,6 +192,13 @@ struct ScissorTest {
     static Type Get();
 };
 
+struct Scissor {
+    using Type = Viewport::Type;
+    static const constexpr Type Default = { 0, 0, { 0, 0 } };
+    static void Set(const Type&);
+    static Type Get();
+};
+
 constexpr bool operator!=(const Viewport::Type& a, const Viewport::Type& b) {
     return a.x != b.x || a.y != b.y || a.size != b.size;
 }
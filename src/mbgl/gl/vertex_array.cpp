@@ -9,7 +9,7 @@ void VertexArray::bind(Context& context,
                        const gfx::IndexBuffer& indexBuffer,
                        const AttributeBindingArray& bindings) {
     context.bindVertexArray = state->vertexArray;
-    state->indexBuffer = indexBuffer.getResource<gl::IndexBufferResource>().buffer;
+    state->indexBuffer = indexBuffer.getResource<gl::IndexBufferResource>().allocation.getBuffer();
 
     state->bindings.reserve(bindings.size());
 
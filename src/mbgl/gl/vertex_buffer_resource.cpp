@@ -1,14 +1,10 @@
-#include <mbgl/gl/context.hpp>
 #include <mbgl/gl/vertex_buffer_resource.hpp>
 
 namespace mbgl {
 namespace gl {
 
-VertexBufferResource::~VertexBufferResource() {
-    auto& stats = buffer.get_deleter().context.renderingStats();
-    stats.memVertexBuffers -= byteSize;
-    assert(stats.memVertexBuffers >= 0);
-}
+// The allocation accounts for the buffer in the rendering stats.
+VertexBufferResource::~VertexBufferResource() = default;
 
 } // namespace gl
-} // namespace mbgl
\ No newline at end of file
+} // namespace mbgl
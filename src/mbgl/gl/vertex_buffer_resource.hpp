@@ -1,17 +1,18 @@
 #pragma once
 
 #include <mbgl/gfx/vertex_buffer.hpp>
-#include <mbgl/gl/object.hpp>
+#include <mbgl/gl/buffer_pool.hpp>
 
 namespace mbgl {
 namespace gl {
 
 class VertexBufferResource : public gfx::VertexBufferResource {
 public:
-    VertexBufferResource(UniqueBuffer&& buffer_, int byteSize_) : buffer(std::move(buffer_)), byteSize(byteSize_) {}
+    VertexBufferResource(BufferAllocation&& allocation_, int byteSize_)
+        : allocation(std::move(allocation_)), byteSize(byteSize_) {}
     ~VertexBufferResource() override;
 
-    UniqueBuffer buffer;
+    BufferAllocation allocation;
     int byteSize;
 };
 
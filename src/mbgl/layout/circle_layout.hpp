@@ -91,11 +91,11 @@ private:
                    std::size_t featureIndex,
                    float sortKey,
                    const CanonicalTileID& canonical) {
-        constexpr const uint16_t vertexLength = 4;
+        constexpr const std::size_t vertexLength = CircleBucket::verticesPerCircle;
+        constexpr const std::size_t indexLength = CircleBucket::indicesPerCircle;
 
         auto& segments = bucket.segments;
-        auto& vertices = bucket.vertices;
-        auto& triangles = bucket.triangles;
+        auto& instances = bucket.instances;
 
         for (auto& circle : geometry) {
             for (auto& point : circle) {
@@ -111,39 +111,25 @@ private:
                 if (segments.empty() ||
                     segments.back().vertexLength + vertexLength > std::numeric_limits<uint16_t>::max()) {
                     // Move to a new segments because the old one can't hold the geometry.
-                    segments.emplace_back(vertices.elements(), triangles.elements(), 0ul, 0ul, sortKey);
+                    segments.emplace_back(instances.elements() * vertexLength,
+                                          instances.elements() * indexLength,
+                                          0ul,
+                                          0ul,
+                                          sortKey);
                 }
 
-                // this geometry will be of the Point type, and we'll derive
-                // two triangles from it.
-                //
-                // ┌─────────┐
-                // │ 4     3 │
-                // │         │
-                // │ 1     2 │
-                // └─────────┘
-                //
-                vertices.emplace_back(CircleProgram::vertex(point, -1, -1)); // 1
-                vertices.emplace_back(CircleProgram::vertex(point, 1, -1));  // 2
-                vertices.emplace_back(CircleProgram::vertex(point, 1, 1));   // 3
-                vertices.emplace_back(CircleProgram::vertex(point, -1, 1));  // 4
+                // One instance per circle. The bucket expands it into a quad on upload if the
+                // context can't draw instances.
+                instances.emplace_back(CircleInstancedProgram::instance(point));
 
                 auto& segment = segments.back();
-                assert(segment.vertexLength <= std::numeric_limits<uint16_t>::max());
-                uint16_t index = segment.vertexLength;
-
-                // 1, 2, 3
-                // 1, 4, 3
-                triangles.emplace_back(index, index + 1, index + 2);
-                triangles.emplace_back(index, index + 3, index + 2);
-
                 segment.vertexLength += vertexLength;
-                segment.indexLength += 6;
+                segment.indexLength += indexLength;
             }
         }
 
         for (auto& pair : bucket.paintPropertyBinders) {
-            pair.second.populateVertexVectors(feature, vertices.elements(), featureIndex, {}, {}, canonical);
+            pair.second.populateVertexVectors(feature, instances.elements(), featureIndex, {}, {}, canonical);
         }
     }
 
@@ -83,6 +83,7 @@ public:
         : sourceLayer(std::move(sourceLayer_)),
           zoom(parameters.tileID.overscaledZ),
           overscaling(parameters.tileID.overscaleFactor()),
+          cancellationToken(parameters.cancellationToken),
           hasPattern(false) {
         assert(!group.empty());
         auto leaderLayerProperties = staticImmutableCast<LayerPropertiesType>(group.front());
@@ -108,7 +109,7 @@ public:
         }
 
         const size_t featureCount = sourceLayer->featureCount();
-        for (size_t i = 0; i < featureCount; ++i) {
+        for (size_t i = 0; i < featureCount && !cancellationToken.isCancelled(); ++i) {
             auto feature = sourceLayer->getFeature(i);
             if (!leaderLayerProperties->layerImpl().filter(
                     style::expression::EvaluationContext(this->zoom, feature.get())
@@ -171,7 +172,11 @@ public:
                       const bool /*showCollisionBoxes*/,
                       const CanonicalTileID& canonical) override {
         auto bucket = std::make_shared<BucketType>(layout, layerPropertiesMap, zoom, overscaling);
+        bucket->setCancellationToken(cancellationToken);
         for (auto & patternFeature : features) {
+            if (cancellationToken.isCancelled()) {
+                break;
+            }
             const auto i = patternFeature.i;
             std::unique_ptr<GeometryTileFeature> feature = std::move(patternFeature.feature);
             const PatternLayerMap& patterns = patternFeature.patterns;
@@ -197,6 +202,7 @@ protected:
 
     const float zoom;
     const uint32_t overscaling;
+    const util::CancellationToken cancellationToken;
     std::string sourceLayerID;
     bool hasPattern;
 };
@@ -108,6 +108,8 @@ public:
     std::array<float, 2> textOffset;
     std::array<float, 2> iconOffset;
     std::u16string key;
+    // Hash of the key, computed once at layout time for cross-tile matching and sorting.
+    std::size_t keyHash;
     bool isDuplicate;
     optional<size_t> placedRightTextIndex;
     optional<size_t> placedCenterTextIndex;
@@ -6,6 +6,7 @@
 #include <mbgl/renderer/image_atlas.hpp>
 #include <mbgl/text/get_anchors.hpp>
 #include <mbgl/text/shaping.hpp>
+#include <mbgl/text/shaping_cache.hpp>
 #include <mbgl/util/utf.hpp>
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/string.hpp>
@@ -89,6 +90,7 @@ SymbolLayout::SymbolLayout(const BucketParameters& parameters,
       canonicalID(parameters.tileID.canonical),
       mode(parameters.mode),
       pixelRatio(parameters.pixelRatio),
+      cancellationToken(parameters.cancellationToken),
       tileSize(util::tileSize * overscaling),
       tilePixelRatio(float(util::EXTENT) / tileSize),
       layout(createLayout(toSymbolLayerProperties(layers.at(0)).layerImpl().layout, zoom)) {
@@ -131,7 +133,7 @@ SymbolLayout::SymbolLayout(const BucketParameters& parameters,
 
     // Determine glyph dependencies
     const size_t featureCount = sourceLayer->featureCount();
-    for (size_t i = 0; i < featureCount; ++i) {
+    for (size_t i = 0; i < featureCount && !cancellationToken.isCancelled(); ++i) {
         auto feature = sourceLayer->getFeature(i);
         if (!leader.filter(expression::EvaluationContext(this->zoom, feature.get())
                                .withCanonicalTileID(&parameters.tileID.canonical)))
@@ -350,6 +352,13 @@ void SymbolLayout::prepareSymbols(const GlyphMap& glyphMap,
     const bool textAlongLine = layout->get<TextRotationAlignment>() == AlignmentType::Map && !isPointPlacement;
 
     for (auto it = features.begin(); it != features.end(); ++it) {
+        if (cancellationToken.isCancelled()) {
+            // The tile is obsolete, drop whatever was laid out so far.
+            symbolInstances.clear();
+            sortKeyRanges.clear();
+            break;
+        }
+
         auto& feature = *it;
         if (feature.geometry.empty()) continue;
 
@@ -371,7 +380,7 @@ void SymbolLayout::prepareSymbols(const GlyphMap& glyphMap,
                                     WritingModeType writingMode,
                                     SymbolAnchorType textAnchor,
                                     TextJustifyType textJustify) {
-                Shaping result = getShaping(
+                Shaping result = ShapingCache::getShared().getShaping(
                     /* string */ formattedText,
                     /* maxWidth: ems */
                     isPointPlacement ? layout->evaluate<TextMaxWidth>(zoom, feature, canonicalID) * util::ONE_EM : 0.0f,
@@ -387,7 +396,8 @@ void SymbolLayout::prepareSymbols(const GlyphMap& glyphMap,
                     /* images */ imagePositions,
                     layoutTextSize,
                     layoutTextSizeAtBucketZoomLevel,
-                    allowVerticalPlacement);
+                    allowVerticalPlacement,
+                    cancellationToken);
 
                 return result;
             };
@@ -775,6 +785,10 @@ void SymbolLayout::createBucket(const ImagePositions&,
                                                  iconsInText);
 
     for (SymbolInstance &symbolInstance : bucket->symbolInstances) {
+        if (cancellationToken.isCancelled()) {
+            return;
+        }
+
         const bool hasText = symbolInstance.hasText();
         const bool hasIcon = symbolInstance.hasIcon();
         const bool singleLine = symbolInstance.singleLine;
@@ -118,6 +118,7 @@ private:
     const CanonicalTileID canonicalID;
     const MapMode mode;
     const float pixelRatio;
+    const util::CancellationToken cancellationToken;
 
     const uint32_t tileSize;
     const float tilePixelRatio;
@@ -378,10 +378,20 @@ namespace mbgl {
         const mat4 glCoordMatrix = getGlCoordMatrix(posMatrix, pitchWithMap, rotateWithMap, state, pixelsToTileUnits);
         
         dynamicVertexArray.clear();
-        
+
+        // Project all anchors in one batch; most labels are on screen and need them.
+        std::vector<Point<float>> anchors;
+        anchors.reserve(placedSymbols.size());
+        for (const auto& placedSymbol : placedSymbols) {
+            anchors.push_back(placedSymbol.anchorPoint);
+        }
+        std::vector<vec4> projectedAnchors(anchors.size());
+        matrix::transformPoints(projectedAnchors.data(), anchors.data(), anchors.size(), posMatrix);
+
         bool useVertical = false;
 
-        for (auto& placedSymbol : placedSymbols) {
+        for (std::size_t i = 0; i < placedSymbols.size(); ++i) {
+            const PlacedSymbol& placedSymbol = placedSymbols[i];
             // Don't do calculations for vertical glyphs unless the previous symbol was horizontal
             // and we determined that vertical glyphs were necessary.
             // Also don't do calculations for symbols that are collided and fully faded out
@@ -392,8 +402,7 @@ namespace mbgl {
             // Awkward... but we're counting on the paired "vertical" symbol coming immediately after its horizontal counterpart
             useVertical = false;
             
-			vec4 anchorPos = {{ placedSymbol.anchorPoint.x, placedSymbol.anchorPoint.y, 0, 1 }};
-            matrix::transformMat4(anchorPos, anchorPos, posMatrix);
+            const vec4& anchorPos = projectedAnchors[i];
 
             // Don't bother calculating the correct point for invisible labels.
             if (!isVisible(anchorPos, clippingBuffer)) {
@@ -490,6 +490,15 @@ uint8_t Map::getPrefetchZoomDelta() const {
     return impl->prefetchZoomDelta;
 }
 
+void Map::setTileCacheSize(std::size_t bytes) {
+    impl->tileCacheSize = bytes;
+    impl->onUpdate();
+}
+
+std::size_t Map::getTileCacheSize() const {
+    return impl->tileCacheSize;
+}
+
 bool Map::isFullyLoaded() const {
     return impl->style->impl->isLoaded() && impl->rendererFullyLoaded;
 }
@@ -70,6 +70,7 @@ public:
     bool cameraMutated = false;
 
     uint8_t prefetchZoomDelta = util::DEFAULT_PREFETCH_ZOOM_DELTA;
+    std::size_t tileCacheSize = 0;
 
     bool loading = false;
     bool rendererFullyLoaded;
@@ -81,6 +81,10 @@ public:
     BackgroundLayerPrograms(gfx::Context& context, const ProgramParameters& programParameters)
         : background(context, programParameters),
           backgroundPattern(context, programParameters) {}
+    void precompile(gfx::Context& context) override {
+        background.program->precompile(context);
+        backgroundPattern.program->precompile(context);
+    }
     BackgroundProgram background;
     BackgroundPatternProgram backgroundPattern;
 };
@@ -3,5 +3,6 @@
 namespace mbgl {
 
 static_assert(sizeof(CircleLayoutVertex) == 4, "expected CircleLayoutVertex size");
+static_assert(sizeof(CircleInstance) == 4, "expected CircleInstance size");
 
 } // namespace mbgl
@@ -49,11 +49,62 @@ public:
 using CircleLayoutVertex = CircleProgram::LayoutVertex;
 using CircleAttributes = CircleProgram::AttributeList;
 
+// Draws every circle as an instance of a single quad: the corners of the quad are the vertices,
+// and the center and the data-driven paint properties of a circle advance once per instance.
+class CircleInstancedProgram : public Program<
+    CircleInstancedProgram,
+    gfx::PrimitiveType::Triangle,
+    TypeList<
+        attributes::extrude,
+        attributes::pos>,
+    TypeList<
+        uniforms::matrix,
+        uniforms::scale_with_map,
+        uniforms::extrude_scale,
+        uniforms::device_pixel_ratio,
+        uniforms::camera_to_center_distance,
+        uniforms::pitch_with_map>,
+    TypeList<>,
+    style::CirclePaintProperties>
+{
+public:
+    using Program::Program;
+
+    using QuadVertex = gfx::Vertex<TypeList<attributes::extrude>>;
+    using InstanceVertex = gfx::Vertex<TypeList<attributes::pos>>;
+
+    static QuadVertex quadVertex(int16_t ex, int16_t ey) {
+        return QuadVertex { {{ ex, ey }} };
+    }
+
+    static InstanceVertex instance(Point<int16_t> p) {
+        return InstanceVertex { {{ p.x, p.y }} };
+    }
+
+    static AttributeBindings computeAllAttributeBindings(
+        const gfx::VertexBuffer<QuadVertex>& quadVertexBuffer,
+        const gfx::VertexBuffer<InstanceVertex>& instanceBuffer,
+        const Binders& paintPropertyBinders,
+        const typename PaintProperties::PossiblyEvaluated& currentProperties) {
+        return gfx::AttributeBindings<TypeList<attributes::extrude>>(quadVertexBuffer)
+            .concat(gfx::AttributeBindings<TypeList<attributes::pos>>(instanceBuffer).instanced())
+            .concat(paintPropertyBinders.attributeBindings(currentProperties).instanced());
+    }
+};
+
+using CircleInstance = CircleInstancedProgram::InstanceVertex;
+
 class CircleLayerPrograms final : public LayerTypePrograms  {
 public:
     CircleLayerPrograms(gfx::Context& context, const ProgramParameters& programParameters)
-        : circle(context, programParameters) {}
+        : circle(context, programParameters),
+          circleInstanced(context, programParameters) {}
+    void precompile(gfx::Context& context) override {
+        circle.program->precompile(context);
+        circleInstanced.program->precompile(context);
+    }
     CircleProgram circle;
+    CircleInstancedProgram circleInstanced;
 };
 
 } // namespace mbgl
@@ -89,20 +89,21 @@ public:
                 drawScopeIt = segment.drawScopes.emplace(layerID, context.createDrawScope()).first;
             }
 
-            program->draw(context,
-                          renderPass,
-                          drawMode,
-                          depthMode,
-                          stencilMode,
-                          colorMode,
-                          cullFaceMode,
-                          uniformValues,
-                          drawScopeIt->second,
-                          allAttributeBindings.offset(segment.vertexOffset),
-                          textureBindings,
-                          indexBuffer,
-                          segment.indexOffset,
-                          segment.indexLength);
+            drawOrBatch(*program,
+                        context,
+                        renderPass,
+                        drawMode,
+                        depthMode,
+                        stencilMode,
+                        colorMode,
+                        cullFaceMode,
+                        uniformValues,
+                        drawScopeIt->second,
+                        allAttributeBindings.offset(segment.vertexOffset),
+                        textureBindings,
+                        indexBuffer,
+                        segment.indexOffset,
+                        segment.indexLength);
         }
     }
 };
@@ -172,20 +173,21 @@ public:
                 drawScopeIt = segment.drawScopes.emplace(layerID, context.createDrawScope()).first;
             }
 
-            program->draw(context,
-                          renderPass,
-                          drawMode,
-                          depthMode,
-                          stencilMode,
-                          colorMode,
-                          cullFaceMode,
-                          uniformValues,
-                          drawScopeIt->second,
-                          allAttributeBindings.offset(segment.vertexOffset),
-                          textureBindings,
-                          indexBuffer,
-                          segment.indexOffset,
-                          segment.indexLength);
+            drawOrBatch(*program,
+                        context,
+                        renderPass,
+                        drawMode,
+                        depthMode,
+                        stencilMode,
+                        colorMode,
+                        cullFaceMode,
+                        uniformValues,
+                        drawScopeIt->second,
+                        allAttributeBindings.offset(segment.vertexOffset),
+                        textureBindings,
+                        indexBuffer,
+                        segment.indexOffset,
+                        segment.indexLength);
         }
     }
 };
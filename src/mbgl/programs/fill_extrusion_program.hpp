@@ -123,6 +123,10 @@ public:
         : fillExtrusion(context, programParameters),
           fillExtrusionPattern(context, programParameters) {
     }
+    void precompile(gfx::Context& context) override {
+        fillExtrusion.program->precompile(context);
+        fillExtrusionPattern.program->precompile(context);
+    }
     FillExtrusionProgram fillExtrusion;
     FillExtrusionPatternProgram fillExtrusionPattern;
 };
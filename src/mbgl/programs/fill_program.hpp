@@ -110,6 +110,12 @@ public:
           fillPattern(context, programParameters),
           fillOutline(context, programParameters),
           fillOutlinePattern(context, programParameters) {}
+    void precompile(gfx::Context& context) override {
+        fill.program->precompile(context);
+        fillPattern.program->precompile(context);
+        fillOutline.program->precompile(context);
+        fillOutlinePattern.program->precompile(context);
+    }
     FillProgram fill;
     FillPatternProgram fillPattern;
     FillOutlineProgram fillOutline;
@@ -10,474 +10,507 @@ namespace programs {
 namespace gl {
 
 constexpr const uint8_t compressedShaderSource[] = {
-    0x78, 0xda, 0xed, 0x3d, 0x6b, 0x6f, 0xe3, 0x38, 0x92, 0xfb, 0x39, 0xbf, 0xc2, 0x83, 0x01, 0x16,
-    0x92, 0x2c, 0x5b, 0xb6, 0x93, 0xf4, 0x63, 0xb4, 0xba, 0x41, 0xa3, 0x1f, 0x73, 0x01, 0x66, 0xba,
-    0x1b, 0x9d, 0xd9, 0xbd, 0xc5, 0x0e, 0x1a, 0x86, 0x64, 0x2b, 0x8e, 0x6e, 0x6d, 0xcb, 0x67, 0x2b,
-    0x89, 0x9d, 0x45, 0xfe, 0xfb, 0xb1, 0xf8, 0x26, 0x45, 0xca, 0x8f, 0xc4, 0xce, 0x63, 0x84, 0xc1,
-    0x74, 0x2c, 0xb2, 0x58, 0x2c, 0x92, 0xc5, 0x62, 0x55, 0x91, 0x2c, 0xfe, 0x98, 0x5d, 0x0c, 0xd3,
-    0x8b, 0xc6, 0x2f, 0xbf, 0xf6, 0x3f, 0x9e, 0x1f, 0xcd, 0xe6, 0xe9, 0x20, 0x5b, 0x64, 0xf9, 0xb4,
-    0x71, 0x99, 0x8d, 0x2e, 0x67, 0x8d, 0x8b, 0x71, 0x1e, 0x17, 0xe1, 0xd1, 0x8f, 0xe9, 0x78, 0x91,
-    0x1e, 0xfd, 0x98, 0x5d, 0x34, 0x7e, 0x40, 0xb0, 0xd9, 0x34, 0x1d, 0x3a, 0xe3, 0xfc, 0x66, 0xe6,
-    0x1e, 0xfd, 0x48, 0x3e, 0x1b, 0xf0, 0x85, 0xa0, 0xa6, 0xc3, 0xec, 0x42, 0x05, 0x9b, 0xa4, 0xc3,
-    0xec, 0x6a, 0x22, 0x41, 0xd2, 0x04, 0x23, 0x30, 0xae, 0x53, 0x80, 0xe2, 0x4f, 0x0e, 0x48, 0xfe,
-    0x5c, 0xa7, 0x83, 0x5e, 0xe3, 0x6a, 0x3a, 0x8b, 0x07, 0xff, 0xee, 0x63, 0xe2, 0x9c, 0x41, 0x3e,
-    0x5d, 0x14, 0x84, 0xd0, 0x06, 0x24, 0xa7, 0xc3, 0x7f, 0xc4, 0xe3, 0xab, 0xd4, 0x6d, 0xfc, 0x27,
-    0x9b, 0xb2, 0x94, 0xb3, 0x69, 0x81, 0x13, 0x23, 0x94, 0xe4, 0xc8, 0x40, 0x21, 0xc0, 0x5c, 0x77,
-    0x22, 0x15, 0x2c, 0xe8, 0x9d, 0xbe, 0x0a, 0xe7, 0x69, 0x71, 0x35, 0x9f, 0x36, 0xa0, 0x42, 0xe7,
-    0xba, 0xe3, 0xab, 0x10, 0xad, 0xeb, 0x8e, 0x87, 0x80, 0xdc, 0xf0, 0x4e, 0x26, 0x28, 0x47, 0xff,
-    0x66, 0xc5, 0xca, 0x40, 0xd2, 0x17, 0x92, 0x43, 0x89, 0x42, 0xff, 0xd3, 0x04, 0x89, 0x20, 0x06,
-    0x12, 0xf4, 0x94, 0xaa, 0x49, 0x23, 0x45, 0x09, 0x37, 0xe8, 0xf6, 0x5e, 0xb7, 0x3b, 0xfe, 0x24,
-    0x1f, 0xaa, 0x05, 0xfd, 0x5e, 0xbb, 0xe3, 0x12, 0x82, 0x4e, 0x1a, 0xc3, 0x74, 0x90, 0x0f, 0xd3,
-    0xfe, 0x20, 0x1f, 0xe7, 0x73, 0x4a, 0x0e, 0x26, 0x34, 0x9d, 0x42, 0xfa, 0xf0, 0x3d, 0xa4, 0x23,
-    0x62, 0x44, 0x45, 0x27, 0x8e, 0xd2, 0xa9, 0x32, 0xdc, 0x1f, 0x9d, 0xef, 0x88, 0xa8, 0xd3, 0x53,
-    0x54, 0xa9, 0x1d, 0xa6, 0xcb, 0x60, 0x8e, 0x10, 0x09, 0xa4, 0xe5, 0x14, 0x78, 0x92, 0x2d, 0xfb,
-    0xb8, 0x25, 0x12, 0x19, 0xd2, 0x10, 0xf8, 0x72, 0x67, 0x15, 0x82, 0x26, 0x54, 0x4c, 0x1e, 0x29,
-    0x44, 0x84, 0x2f, 0x7f, 0x76, 0xbf, 0xfb, 0x05, 0x6b, 0xac, 0x54, 0x91, 0xd6, 0xe0, 0x13, 0x5a,
-    0x13, 0xa6, 0x71, 0x51, 0xaa, 0x0a, 0x43, 0x4c, 0xb2, 0x29, 0xce, 0x8e, 0x94, 0x3e, 0xc3, 0x14,
-    0xcb, 0x85, 0x05, 0x01, 0xf4, 0x1b, 0xb5, 0xd8, 0x0d, 0x09, 0x86, 0x78, 0xb9, 0x11, 0x86, 0x9e,
-    0x86, 0xe1, 0x18, 0x30, 0x48, 0xcd, 0x65, 0x94, 0xf8, 0x0c, 0x21, 0x6b, 0x62, 0xaf, 0x31, 0x4a,
-    0x8b, 0xfe, 0x2c, 0x2e, 0x8a, 0x74, 0x3e, 0xed, 0xcf, 0xf2, 0x85, 0xd2, 0x97, 0xd9, 0x32, 0x1d,
-    0xa3, 0x3a, 0xf3, 0xf9, 0xb0, 0x7f, 0x35, 0x9b, 0xa5, 0x73, 0xdf, 0x92, 0x89, 0xe6, 0xa8, 0x96,
-    0x49, 0x11, 0x2e, 0xb2, 0x5b, 0x6d, 0x18, 0xb2, 0x71, 0xda, 0xbf, 0x9a, 0x66, 0xc5, 0xa2, 0x5f,
-    0xe4, 0x7d, 0x8c, 0x63, 0xa1, 0x14, 0xcc, 0x17, 0xa4, 0xf7, 0x7a, 0x8d, 0xfc, 0xe2, 0x62, 0x91,
-    0x16, 0x11, 0x70, 0x23, 0xfb, 0xbf, 0x4c, 0x90, 0x5c, 0x91, 0x0b, 0xf3, 0xa6, 0xdd, 0x31, 0xa5,
-    0x35, 0xcb, 0xd4, 0x2a, 0x50, 0xac, 0xaf, 0x1c, 0x13, 0x7d, 0x1e, 0x22, 0xaa, 0x49, 0xa8, 0x71,
-    0x03, 0xb9, 0x58, 0x78, 0x77, 0xf4, 0x97, 0x1f, 0xcd, 0x32, 0x8e, 0xca, 0xa2, 0xa7, 0x27, 0xe5,
-    0xfe, 0x82, 0xe8, 0x9f, 0x67, 0xc9, 0x55, 0x91, 0x92, 0x0e, 0x8f, 0x61, 0xd0, 0x43, 0xd4, 0xe2,
-    0x8b, 0x7c, 0x3e, 0x41, 0xfc, 0x56, 0x20, 0xa6, 0xef, 0xa3, 0x3f, 0xf3, 0x6c, 0x19, 0x5e, 0xe7,
-    0xd9, 0x10, 0x25, 0x65, 0x53, 0x07, 0x8d, 0xc9, 0x68, 0xdc, 0xff, 0x9a, 0x2f, 0xb2, 0x02, 0xb5,
-    0x2e, 0x62, 0x10, 0x1e, 0x9e, 0xde, 0x18, 0x85, 0xdf, 0xf1, 0xbb, 0x2e, 0x74, 0x08, 0x43, 0x45,
-    0xe6, 0x0f, 0xe1, 0x58, 0x8e, 0x9f, 0x4e, 0x5f, 0x26, 0xce, 0x4a, 0x35, 0x7c, 0x9a, 0xc7, 0x23,
-    0xc2, 0xf0, 0xb4, 0xa4, 0x27, 0x60, 0x8f, 0x68, 0x57, 0x7f, 0xf9, 0xc7, 0xc7, 0x6f, 0x1f, 0xbe,
-    0xbd, 0xfb, 0x9f, 0xfe, 0xd9, 0xe7, 0xf3, 0xaf, 0x1f, 0xdf, 0xff, 0xfe, 0xe5, 0xdb, 0x91, 0x52,
-    0x12, 0xd3, 0xd4, 0x45, 0x12, 0x2b, 0x64, 0x6d, 0x96, 0xa8, 0x52, 0x1b, 0x28, 0xd1, 0x8a, 0x24,
-    0x6d, 0x5f, 0x1e, 0xdb, 0x7e, 0x5c, 0x99, 0x9b, 0x94, 0x72, 0x75, 0xd6, 0xac, 0x02, 0xc0, 0x1c,
-    0x58, 0xea, 0x94, 0xc5, 0x20, 0x1e, 0xcb, 0xf5, 0xaa, 0xe9, 0x49, 0x29, 0xdd, 0xc4, 0xab, 0xa1,
-    0x71, 0x78, 0xaf, 0xe3, 0xf9, 0x2a, 0x9b, 0x8e, 0x48, 0xd2, 0x35, 0x24, 0xa1, 0x6a, 0x0c, 0x89,
-    0xc9, 0x0e, 0x43, 0x4e, 0xd1, 0x45, 0xba, 0x1c, 0x31, 0x74, 0x89, 0x6f, 0xe8, 0x05, 0x9f, 0xb7,
-    0xdb, 0xd3, 0x07, 0xc0, 0x37, 0x37, 0xd1, 0xc7, 0x95, 0xb3, 0x8a, 0x93, 0x7b, 0x57, 0x9c, 0xe8,
-    0x15, 0x27, 0x6b, 0x2a, 0x56, 0x99, 0x5c, 0x66, 0x8d, 0x62, 0x6c, 0x67, 0x9b, 0x64, 0x6e, 0xcf,
-    0x43, 0xe5, 0x92, 0x8a, 0x72, 0xa5, 0xbc, 0x22, 0x5d, 0x62, 0xf9, 0xa3, 0x73, 0xc4, 0x44, 0xe2,
-    0x69, 0x7d, 0xaa, 0xb1, 0xf4, 0x45, 0x3c, 0x99, 0x8d, 0xd3, 0x79, 0xef, 0x03, 0xca, 0xcb, 0x26,
-    0xf1, 0x28, 0xdd, 0x95, 0x3b, 0x70, 0x0e, 0xc6, 0x80, 0x7b, 0x15, 0x0b, 0x6a, 0x5a, 0xda, 0xc7,
-    0xd3, 0x8f, 0x09, 0xf4, 0x08, 0x56, 0x20, 0xb5, 0x93, 0x02, 0xde, 0x06, 0x5f, 0xed, 0x21, 0x29,
-    0x43, 0xa0, 0xa6, 0x8b, 0x21, 0x16, 0x08, 0xdd, 0x08, 0xe5, 0x23, 0x59, 0x9d, 0xf6, 0x3e, 0x38,
-    0xb4, 0x01, 0x3e, 0x61, 0x07, 0x95, 0x1c, 0xc4, 0x18, 0x82, 0xa0, 0x44, 0x25, 0xa8, 0x57, 0xa6,
-    0x28, 0xb1, 0x51, 0x94, 0x18, 0x29, 0xea, 0x27, 0x32, 0x4d, 0x3d, 0x33, 0x4d, 0x3d, 0x37, 0x54,
-    0x04, 0x13, 0x54, 0x4a, 0xda, 0xe0, 0x93, 0x62, 0x3e, 0x1e, 0x31, 0xf7, 0x30, 0x32, 0x2e, 0xc9,
-    0xf3, 0x31, 0x17, 0x26, 0x37, 0x59, 0x71, 0x89, 0x00, 0x66, 0x7a, 0xee, 0x2c, 0x2b, 0x06, 0x97,
-    0xe5, 0x5c, 0xca, 0x76, 0xa8, 0x91, 0xf3, 0x2b, 0xa4, 0x85, 0x60, 0x1c, 0x3c, 0x13, 0x96, 0x2e,
-    0xce, 0x6d, 0xc3, 0xf4, 0x3a, 0x1b, 0xa4, 0x74, 0xb6, 0xcd, 0x63, 0x24, 0x3a, 0x38, 0x9c, 0xa4,
-    0xf6, 0xc3, 0xba, 0x10, 0x4f, 0xd2, 0x79, 0x0c, 0x93, 0x6b, 0x90, 0x4e, 0x51, 0x67, 0xf7, 0x87,
-    0xd9, 0xa2, 0x88, 0xa7, 0x83, 0x74, 0xad, 0x04, 0x3b, 0x46, 0xec, 0x38, 0x8c, 0x8b, 0x18, 0x77,
-    0xd6, 0x14, 0x7a, 0xeb, 0xbf, 0xdf, 0x9d, 0xf7, 0xff, 0xfe, 0xf9, 0xec, 0xd3, 0x97, 0x6f, 0xbf,
-    0xf5, 0xe9, 0xba, 0x71, 0x64, 0xa4, 0x0e, 0x67, 0xf5, 0x0b, 0xa9, 0x0a, 0x42, 0x14, 0x1e, 0xca,
-    0x98, 0xae, 0x55, 0xac, 0x2a, 0x29, 0x8b, 0x64, 0xd0, 0x55, 0x5c, 0x6d, 0x8f, 0xb2, 0xcc, 0x49,
-    0x8b, 0xb2, 0x81, 0xb0, 0x79, 0x8c, 0x56, 0xee, 0x85, 0x99, 0x32, 0x92, 0xa7, 0x90, 0xc6, 0x54,
-    0x08, 0xda, 0x0b, 0x04, 0x82, 0x53, 0xa7, 0x28, 0x18, 0x0d, 0x9a, 0xa9, 0x51, 0xa8, 0xc2, 0xb0,
-    0x4a, 0xd6, 0x50, 0x99, 0x8c, 0xaf, 0x2c, 0xbd, 0x07, 0x39, 0x0a, 0x85, 0x38, 0x97, 0x92, 0x07,
-    0x99, 0x9c, 0x38, 0xa9, 0x18, 0x4e, 0xd7, 0xe8, 0x2a, 0x61, 0x5d, 0x43, 0x12, 0x9d, 0x1d, 0xe6,
-    0xf2, 0x34, 0xd3, 0x4a, 0x18, 0x57, 0x35, 0xca, 0xb4, 0x89, 0x59, 0x67, 0x27, 0x4f, 0x82, 0xa9,
-    0xa0, 0x70, 0x51, 0xcc, 0xf3, 0x7f, 0xa7, 0x55, 0xac, 0x27, 0x43, 0xd8, 0x39, 0x50, 0x86, 0x32,
-    0x31, 0xa2, 0x92, 0x5f, 0xc5, 0x8f, 0x3a, 0xe0, 0x7a, 0xda, 0x6f, 0xb2, 0x61, 0x71, 0x59, 0x49,
-    0x3b, 0x86, 0xa8, 0x62, 0x51, 0x19, 0xce, 0xc2, 0xa8, 0x0a, 0xc8, 0x1a, 0x76, 0xd5, 0x61, 0xd7,
-    0xb7, 0xa1, 0x92, 0x51, 0x54, 0x18, 0x2b, 0xbf, 0xa8, 0x60, 0x26, 0xb6, 0xd1, 0x20, 0xaa, 0xb8,
-    0xa7, 0x0c, 0x4a, 0x5c, 0x0d, 0x7c, 0x1d, 0x85, 0x5f, 0x68, 0x2d, 0xad, 0x14, 0x65, 0x03, 0xa2,
-    0x10, 0xeb, 0xa6, 0x28, 0x95, 0x57, 0x3e, 0x17, 0x6b, 0x2e, 0x23, 0x45, 0x97, 0x5c, 0xd1, 0x56,
-    0xf2, 0x89, 0xfc, 0x89, 0x74, 0x1b, 0x9b, 0x49, 0x20, 0x5f, 0x08, 0x2b, 0x5e, 0xa1, 0x49, 0x18,
-    0x45, 0xdb, 0xc8, 0x1b, 0xf8, 0xc7, 0x50, 0x23, 0x24, 0xfb, 0x4c, 0xf0, 0xf0, 0xda, 0x34, 0xe9,
-    0x12, 0x6d, 0x25, 0x43, 0xe8, 0x5f, 0x43, 0x65, 0x34, 0xc7, 0x97, 0x44, 0x8a, 0xa9, 0x4a, 0x8e,
-    0x60, 0x17, 0xd1, 0x20, 0x7f, 0x98, 0x46, 0x54, 0xce, 0xf7, 0x75, 0xa1, 0x61, 0x1a, 0x5f, 0x15,
-    0xe1, 0xce, 0xd3, 0x5e, 0xfe, 0x30, 0x74, 0x8d, 0x9c, 0xed, 0xeb, 0xf2, 0xc0, 0xc2, 0x05, 0x2a,
-    0xca, 0x7b, 0x4c, 0x66, 0xf5, 0xd3, 0x4e, 0x9d, 0x18, 0x3f, 0x7d, 0xa6, 0x9b, 0x86, 0x51, 0xc7,
-    0x6a, 0x9d, 0xaa, 0xd8, 0xb7, 0x45, 0x14, 0x9f, 0x08, 0x57, 0x08, 0x6a, 0x25, 0xb1, 0x7f, 0xc0,
-    0x2d, 0xe6, 0xa1, 0x7f, 0x5a, 0x42, 0xbb, 0x1c, 0x64, 0xf3, 0x01, 0xd2, 0xaf, 0x88, 0x4e, 0x13,
-    0xa1, 0xaa, 0xf0, 0xb0, 0x22, 0x60, 0xaf, 0xd3, 0x3e, 0x75, 0x43, 0x64, 0xac, 0x3b, 0xba, 0x96,
-    0xc5, 0x54, 0xe9, 0x41, 0x3e, 0x9f, 0x22, 0x3d, 0x68, 0xc6, 0x2c, 0x2e, 0x05, 0x15, 0x2d, 0xa9,
-    0x6a, 0x6f, 0xa8, 0xa4, 0x56, 0xa8, 0x19, 0x51, 0x52, 0x3d, 0x87, 0x4c, 0xbe, 0xa6, 0xdc, 0xef,
-    0xa0, 0x69, 0xaa, 0x3a, 0xdc, 0x5d, 0x03, 0xfa, 0x85, 0xba, 0xab, 0x66, 0xf3, 0xfc, 0x7f, 0xd3,
-    0x41, 0x91, 0x0e, 0x19, 0xf9, 0xaa, 0xcd, 0xa7, 0xd0, 0x43, 0x6c, 0xbf, 0xfb, 0xd5, 0xee, 0x39,
-    0x7a, 0x8d, 0xed, 0x9b, 0xa0, 0x42, 0x33, 0x44, 0x96, 0x97, 0xdd, 0x22, 0xd5, 0x48, 0xa1, 0xee,
-    0x08, 0xda, 0xbc, 0x8a, 0x62, 0xe5, 0x46, 0x59, 0x7a, 0x5a, 0xc2, 0xd1, 0x5e, 0xae, 0xb6, 0x6d,
-    0x6a, 0x95, 0xc2, 0x6b, 0xa0, 0x72, 0x87, 0x1a, 0xe4, 0xd2, 0x37, 0xe1, 0xdd, 0x9d, 0xc4, 0xeb,
-    0xf1, 0xb4, 0xc8, 0xe2, 0x71, 0x16, 0x2f, 0xb0, 0xb8, 0x44, 0xcc, 0x1a, 0x98, 0x14, 0xf5, 0xc0,
-    0x58, 0x4f, 0x48, 0x94, 0x6d, 0x60, 0xfd, 0x63, 0x87, 0xd6, 0xd8, 0x5e, 0xfa, 0xec, 0xd7, 0xca,
-    0x57, 0x90, 0x63, 0xe3, 0x78, 0x6b, 0x5d, 0x7d, 0xdf, 0x1a, 0xf7, 0x61, 0x74, 0xe6, 0x3d, 0x2b,
-    0xbf, 0x87, 0xd3, 0x5f, 0x1f, 0x43, 0xef, 0x7c, 0x4c, 0x6d, 0x71, 0xcf, 0x2a, 0x1e, 0x55, 0xef,
-    0x6c, 0xcc, 0xbf, 0x89, 0xb2, 0x66, 0xe5, 0xec, 0x8d, 0x15, 0x2f, 0x0b, 0xcf, 0xae, 0x57, 0xa5,
-    0xec, 0x0c, 0xb9, 0xa9, 0x4e, 0xb4, 0x86, 0xdb, 0xb6, 0x57, 0x66, 0xd6, 0xb0, 0xd2, 0x4e, 0x6a,
-    0xc8, 0x5a, 0x26, 0xb9, 0xb7, 0xea, 0x80, 0xe5, 0x20, 0x92, 0xeb, 0x21, 0x41, 0xc2, 0x84, 0xf7,
-    0x38, 0x9d, 0x8e, 0x10, 0x65, 0xe4, 0x0f, 0x13, 0xb0, 0x6e, 0x68, 0x95, 0xde, 0x14, 0xcf, 0x6d,
-    0xa8, 0x65, 0xa2, 0x35, 0x14, 0xe7, 0xb7, 0x26, 0xf1, 0xd2, 0xc1, 0x7a, 0xb3, 0x26, 0x98, 0x95,
-    0x91, 0xea, 0x17, 0xd1, 0x62, 0x92, 0xe7, 0xc5, 0xe5, 0xa2, 0x48, 0x67, 0x4e, 0xa7, 0xdd, 0xf1,
-    0x75, 0x44, 0xbe, 0x4a, 0x20, 0x51, 0x71, 0x08, 0x0e, 0xaa, 0x8e, 0x46, 0x72, 0x5f, 0x36, 0xfe,
-    0xd6, 0x40, 0x58, 0xba, 0x8d, 0x9f, 0xe1, 0x4f, 0xe3, 0xa7, 0x86, 0x84, 0xbd, 0x84, 0x19, 0xaa,
-    0xd3, 0xb0, 0x13, 0x86, 0x35, 0xaf, 0x40, 0x9a, 0x17, 0x8d, 0xb7, 0xc0, 0xe3, 0xfe, 0x34, 0x8f,
-    0xa9, 0x7e, 0x32, 0xc7, 0x78, 0x9a, 0x5a, 0x28, 0x29, 0xd1, 0xf7, 0xf0, 0xb1, 0xed, 0x7b, 0xf7,
-    0xc4, 0xbe, 0x21, 0x22, 0xc8, 0x59, 0xeb, 0xea, 0x63, 0xa2, 0xc9, 0xec, 0xaf, 0xb3, 0x39, 0x86,
-    0x59, 0x7a, 0x86, 0xb4, 0x93, 0xe9, 0x02, 0x72, 0x36, 0xd9, 0x4b, 0xa0, 0x75, 0xd8, 0x16, 0xf8,
-    0x9b, 0x14, 0x4d, 0xef, 0xc2, 0x2c, 0x39, 0x49, 0x9e, 0xd9, 0x19, 0x02, 0xb5, 0x91, 0x7c, 0xcd,
-    0x0d, 0x42, 0x0a, 0xd3, 0x2c, 0xe3, 0x4a, 0xa4, 0xa2, 0x3f, 0x84, 0x4f, 0x6e, 0x3b, 0x15, 0x82,
-    0xec, 0x76, 0xca, 0xb4, 0xfe, 0xeb, 0xe3, 0xb7, 0x2f, 0x58, 0x2d, 0xc3, 0xdb, 0xdc, 0x41, 0xf7,
-    0x55, 0xbb, 0x13, 0xf2, 0x4d, 0xbc, 0x5f, 0xde, 0xfd, 0xfd, 0xfc, 0xbc, 0xff, 0xfe, 0xcb, 0xc7,
-    0x4f, 0x68, 0x6a, 0x1d, 0xbf, 0x7d, 0xf3, 0xf6, 0xa4, 0xd7, 0x7b, 0xd3, 0x39, 0xe9, 0x74, 0x4f,
-    0x8e, 0x7b, 0xaf, 0x37, 0xf6, 0x24, 0xd0, 0x71, 0x20, 0x7f, 0x0c, 0x36, 0x14, 0xc9, 0xf0, 0xc5,
-    0xa0, 0x68, 0xc6, 0xa6, 0xdc, 0xed, 0xd1, 0x76, 0x7d, 0x6b, 0x5e, 0xa3, 0x1e, 0xdc, 0xbb, 0x40,
-    0x4f, 0x4b, 0x60, 0x5e, 0x1f, 0xf6, 0x37, 0xb2, 0xd8, 0x08, 0xc2, 0xf3, 0x68, 0xf1, 0x7f, 0xf3,
-    0xc2, 0x69, 0xa1, 0x64, 0x6f, 0x9c, 0x8f, 0x1c, 0x18, 0x8d, 0x80, 0x34, 0x30, 0x90, 0x66, 0x43,
-    0x20, 0x06, 0xc2, 0x75, 0x83, 0x63, 0x34, 0x44, 0x9c, 0xf9, 0xa3, 0x73, 0x4f, 0xaf, 0x38, 0xd4,
-    0x84, 0x3f, 0xd3, 0xe5, 0x09, 0xd1, 0x25, 0x3b, 0x8c, 0xd8, 0x5f, 0xf9, 0x82, 0xcc, 0x72, 0xdd,
-    0x6c, 0x6c, 0x52, 0x60, 0x22, 0x25, 0x8c, 0xa2, 0x04, 0x66, 0xa6, 0x24, 0x17, 0xd4, 0x99, 0x20,
-    0x66, 0xf4, 0x4e, 0x93, 0xf7, 0xa1, 0x26, 0xe0, 0x96, 0x0c, 0x6d, 0xd5, 0x9b, 0x28, 0x59, 0x9b,
-    0x30, 0x26, 0xc9, 0x1d, 0x46, 0x2d, 0xd4, 0x8d, 0x1e, 0x1a, 0x33, 0xfc, 0xff, 0x30, 0x2f, 0x1c,
-    0xde, 0x76, 0x9f, 0xff, 0x62, 0xfc, 0x70, 0x1d, 0x8f, 0x23, 0x82, 0xc6, 0x93, 0xba, 0xce, 0x13,
-    0x64, 0x7b, 0xe9, 0x72, 0xe6, 0x0c, 0xb5, 0x65, 0x09, 0x0f, 0x1c, 0x2a, 0x0a, 0x3b, 0x4d, 0xec,
-    0x7f, 0xf7, 0x00, 0x7b, 0xd6, 0x37, 0xf9, 0x7c, 0x3c, 0xdc, 0x74, 0xd7, 0x77, 0xab, 0x35, 0xc9,
-    0xa3, 0xc8, 0xa5, 0x6d, 0xde, 0xf6, 0x32, 0x8a, 0xc9, 0x5f, 0xfa, 0xbd, 0x02, 0xb1, 0xd5, 0x22,
-    0x69, 0x2b, 0x99, 0x01, 0xcb, 0xbb, 0x8c, 0xa6, 0x1c, 0xb2, 0x26, 0xcf, 0x51, 0x8a, 0xfd, 0x84,
-    0xc0, 0x9a, 0x46, 0xd0, 0x63, 0x25, 0x86, 0x1d, 0x38, 0x0c, 0xec, 0xb6, 0xe7, 0xd2, 0x46, 0x9d,
-    0x02, 0x25, 0x2a, 0xf7, 0xb1, 0x94, 0x28, 0x7c, 0x98, 0x6b, 0xda, 0xb0, 0xde, 0xeb, 0x10, 0x42,
-    0x67, 0x13, 0xe5, 0xa1, 0x94, 0x18, 0x4f, 0x07, 0x97, 0xf9, 0xdc, 0x9c, 0xc7, 0x26, 0x6c, 0x19,
-    0xd3, 0x38, 0x1e, 0xa4, 0x06, 0x3e, 0x58, 0x5c, 0x66, 0x17, 0x45, 0xb8, 0x11, 0x27, 0x55, 0x6b,
-    0x0b, 0x76, 0xf7, 0x05, 0x1b, 0x21, 0x3a, 0x7b, 0x18, 0x29, 0x7a, 0xf2, 0x34, 0x2f, 0xfe, 0xbe,
-    0x80, 0x74, 0x6d, 0x0f, 0x59, 0xf2, 0x3b, 0x7d, 0xcd, 0xd1, 0x74, 0x2b, 0xb1, 0xa2, 0xe8, 0x0f,
-    0xc2, 0x89, 0xf2, 0xbc, 0x17, 0x54, 0x51, 0x28, 0x46, 0x55, 0xa4, 0x22, 0x6d, 0xdf, 0xa8, 0xc5,
-    0xf2, 0xf1, 0x18, 0x9f, 0xd3, 0xe9, 0xcf, 0xd2, 0xf9, 0x62, 0x86, 0xe0, 0xb2, 0xeb, 0x94, 0x78,
-    0x41, 0xa2, 0xc1, 0x18, 0x71, 0x04, 0x1a, 0xba, 0xd3, 0x26, 0xc8, 0x0c, 0xa7, 0xa2, 0xe5, 0x81,
-    0xb5, 0x76, 0x17, 0xeb, 0xb8, 0x27, 0x30, 0xfc, 0x6b, 0x15, 0x3f, 0x26, 0x2a, 0x74, 0xef, 0x8f,
-    0xc3, 0x47, 0xbb, 0x49, 0x87, 0x71, 0x8d, 0xcf, 0xc7, 0xab, 0x68, 0x55, 0xc8, 0x86, 0x25, 0x62,
-    0xac, 0x82, 0xa7, 0x30, 0x1d, 0x13, 0x91, 0xb8, 0x92, 0xfd, 0x37, 0xbb, 0x0c, 0x28, 0xb5, 0x4a,
-    0xc6, 0xb3, 0xcb, 0x38, 0x42, 0xfd, 0x17, 0x1a, 0xa5, 0x1c, 0x6e, 0x34, 0x6b, 0xb8, 0x87, 0x81,
-    0xb1, 0xd7, 0x8d, 0x55, 0xd5, 0xf8, 0xaf, 0x06, 0x4c, 0x45, 0x93, 0x02, 0x2c, 0x95, 0xc4, 0xd3,
-    0x95, 0x96, 0xbe, 0x23, 0xc5, 0x29, 0x49, 0xc6, 0xf2, 0x5e, 0xd4, 0xee, 0x86, 0x77, 0x07, 0x99,
-    0x85, 0x4f, 0x6a, 0xba, 0x69, 0xe9, 0xda, 0x36, 0xb2, 0xa6, 0x08, 0x98, 0x93, 0x99, 0x92, 0x52,
-    0xcf, 0x5c, 0xe3, 0xcc, 0x95, 0xe9, 0x9b, 0xc5, 0xc3, 0x21, 0xea, 0xc0, 0xfe, 0x45, 0x3c, 0x28,
-    0x72, 0xf0, 0xb5, 0xf6, 0x4a, 0x13, 0x9b, 0xf3, 0x4f, 0x69, 0x3a, 0xab, 0x85, 0xf7, 0x31, 0xbb,
-    0xd9, 0xf8, 0x47, 0x71, 0xb2, 0x10, 0x02, 0xa6, 0xbd, 0x72, 0x25, 0x65, 0x56, 0xd0, 0xa7, 0xd2,
-    0x13, 0x6a, 0xfc, 0x10, 0x6d, 0xe1, 0xe3, 0xae, 0xa4, 0x5e, 0x52, 0x1b, 0xf8, 0xea, 0x7f, 0x8d,
-    0xa0, 0xb0, 0x07, 0x9e, 0xd5, 0xfd, 0x34, 0xb8, 0x5e, 0x17, 0x6f, 0x92, 0x6a, 0xb1, 0xb5, 0x70,
-    0x1b, 0xec, 0x2a, 0xd5, 0x06, 0x54, 0x9c, 0xf5, 0xd8, 0x71, 0x68, 0x85, 0x60, 0xcd, 0xa3, 0xa4,
-    0x35, 0xc7, 0xad, 0x74, 0x3f, 0x09, 0x5d, 0xd8, 0x33, 0xe1, 0x0c, 0x0d, 0x2e, 0xb5, 0x2e, 0xb2,
-    0x58, 0x8d, 0xc0, 0x81, 0x61, 0x14, 0x15, 0x0b, 0x8e, 0x8d, 0x4a, 0x55, 0x55, 0x8c, 0x7f, 0x80,
-    0xa5, 0xd2, 0xe1, 0x28, 0xc5, 0x7c, 0x6b, 0xf4, 0x1d, 0x55, 0x3a, 0xb8, 0x5a, 0xca, 0x06, 0x26,
-    0xf4, 0x74, 0x4b, 0xc7, 0x6c, 0xf5, 0x32, 0x11, 0xf7, 0xa3, 0x6d, 0xdd, 0xd0, 0x58, 0xe7, 0xea,
-    0x3a, 0xdc, 0xcc, 0x35, 0x03, 0x5d, 0x33, 0x8e, 0x57, 0x46, 0xc9, 0x8a, 0xb0, 0x10, 0x35, 0x3b,
-    0x78, 0xd3, 0x7d, 0x8b, 0xac, 0xd2, 0x70, 0xbd, 0xa2, 0xae, 0xa0, 0x2b, 0x1d, 0xc5, 0x35, 0xec,
-    0x9b, 0x98, 0xb4, 0x71, 0x8a, 0xc4, 0xd0, 0xa6, 0xb2, 0xe4, 0x67, 0x15, 0x96, 0xd5, 0x6a, 0x9a,
-    0xe3, 0x43, 0x41, 0xc3, 0x01, 0x38, 0x4a, 0x80, 0xaf, 0x20, 0x50, 0xbf, 0xda, 0xb1, 0x1b, 0x6e,
-    0xe7, 0x6a, 0x7b, 0x6e, 0x27, 0xc1, 0x9e, 0xd2, 0x81, 0xa6, 0x92, 0xc1, 0xfd, 0xe8, 0xe7, 0x50,
-    0x0e, 0x70, 0x54, 0x63, 0x53, 0x77, 0xec, 0xa3, 0xec, 0x5a, 0x3e, 0xf0, 0x8e, 0xdf, 0x9e, 0x77,
-    0xa2, 0xb6, 0xda, 0x0e, 0x32, 0xd8, 0xd6, 0x0f, 0x72, 0xf4, 0x75, 0x0b, 0x59, 0x61, 0xf4, 0x9f,
-    0x18, 0xbc, 0x0c, 0xb6, 0xc1, 0xb9, 0x2a, 0xc6, 0xd9, 0xb4, 0xf2, 0xa8, 0x9f, 0x02, 0x62, 0x97,
-    0x31, 0x0a, 0x98, 0x49, 0xd6, 0xa8, 0x00, 0x55, 0x5c, 0x55, 0x82, 0x7c, 0x41, 0xb2, 0x47, 0xed,
-    0x70, 0xe5, 0xcb, 0x24, 0x8b, 0x14, 0x00, 0xbf, 0x34, 0x18, 0x26, 0xd9, 0xa4, 0xe1, 0xdc, 0xa9,
-    0x37, 0x1f, 0x5b, 0x56, 0x61, 0x9e, 0x8d, 0x1c, 0xd5, 0xd6, 0x08, 0x14, 0x0b, 0xa2, 0x09, 0x93,
-    0x26, 0x00, 0x2f, 0x37, 0xe3, 0x7a, 0xf5, 0xac, 0xc6, 0x56, 0x8c, 0x7f, 0x70, 0x76, 0x3d, 0x9c,
-    0x30, 0x54, 0x1b, 0xba, 0x0b, 0x9f, 0xdc, 0x53, 0x48, 0x0a, 0xd5, 0x57, 0xe8, 0xe5, 0x68, 0x60,
-    0x5a, 0x5c, 0x0c, 0xe6, 0x73, 0x64, 0xe0, 0xad, 0x98, 0xc6, 0x4b, 0xac, 0x11, 0xf0, 0xc3, 0x6a,
-    0x5b, 0xba, 0x60, 0x4d, 0x00, 0x16, 0x5d, 0xb5, 0x95, 0xc9, 0xf6, 0x1c, 0x5c, 0x9c, 0x49, 0xe1,
-    0xc3, 0x79, 0xac, 0x1f, 0xee, 0xfa, 0x14, 0x3b, 0x79, 0x82, 0x35, 0xe9, 0xfb, 0x5e, 0x7f, 0xda,
-    0x7c, 0x3a, 0x3c, 0xf9, 0x33, 0xe9, 0xec, 0x12, 0xcb, 0xc5, 0x3c, 0x9f, 0x98, 0xf1, 0xc8, 0x10,
-    0x46, 0x5a, 0x61, 0x99, 0x92, 0x81, 0x54, 0x82, 0xe9, 0x2d, 0x58, 0x29, 0xdb, 0x44, 0x34, 0x1d,
-    0x1e, 0x1d, 0x6e, 0x03, 0xc2, 0x8b, 0xbc, 0x9a, 0x6c, 0x64, 0xb9, 0xad, 0x23, 0xba, 0xc8, 0x2b,
-    0x48, 0x46, 0x99, 0x1b, 0x10, 0x4c, 0xa0, 0x36, 0x5f, 0xae, 0x1e, 0xeb, 0x9c, 0xb1, 0x32, 0xdc,
-    0xf2, 0x47, 0x14, 0xf7, 0x4d, 0x83, 0x24, 0x6d, 0x65, 0xab, 0xa3, 0x18, 0xed, 0x3a, 0x58, 0xe2,
-    0x67, 0x14, 0xf7, 0xcb, 0x9d, 0x6c, 0xac, 0x10, 0xc1, 0x9a, 0xbb, 0x5a, 0xbe, 0x45, 0x0c, 0x37,
-    0xc6, 0x22, 0x99, 0x26, 0x38, 0x46, 0xa3, 0x40, 0xc0, 0xd5, 0x31, 0x15, 0xe2, 0xf6, 0x26, 0xd4,
-    0x71, 0x24, 0x91, 0xa8, 0xc8, 0x84, 0x41, 0xc9, 0x47, 0xe5, 0xa9, 0x47, 0x0f, 0x04, 0xcf, 0x37,
-    0xec, 0x60, 0xa4, 0x42, 0xa6, 0xbd, 0x0c, 0xc5, 0x65, 0x66, 0x35, 0x87, 0x9d, 0xee, 0x01, 0x12,
-    0xce, 0xa9, 0x93, 0x8c, 0xe4, 0xb0, 0x03, 0x3b, 0x45, 0xae, 0xa6, 0xdf, 0x84, 0x9b, 0xad, 0xef,
-    0x40, 0x2b, 0x12, 0xe6, 0x33, 0x6c, 0xe5, 0xe3, 0xeb, 0x91, 0x64, 0x6f, 0xdb, 0x91, 0xbb, 0xa0,
-    0xbd, 0x6c, 0xc9, 0x7d, 0xd6, 0x5e, 0xba, 0x81, 0x20, 0xdf, 0x57, 0x41, 0x57, 0x2a, 0xe8, 0x4a,
-    0x06, 0x35, 0xd5, 0x97, 0x94, 0xeb, 0x4b, 0xd4, 0xfa, 0x92, 0x8a, 0xfa, 0x12, 0xb5, 0xbe, 0xa4,
-    0x54, 0xdf, 0x3d, 0x6f, 0x91, 0xf2, 0x0e, 0xf7, 0xd4, 0x4e, 0xf2, 0xf9, 0x18, 0x3d, 0xd4, 0xb5,
-    0x51, 0x3a, 0x80, 0x6a, 0x3d, 0x89, 0xa5, 0x9e, 0x1d, 0x34, 0xb2, 0x35, 0x57, 0x3d, 0xed, 0x1b,
-    0xab, 0x4c, 0x3c, 0x5e, 0xc4, 0xc3, 0x74, 0xaf, 0x4b, 0xde, 0xe1, 0x56, 0xad, 0x43, 0x2f, 0x37,
-    0xfb, 0x5c, 0x2b, 0xf6, 0x71, 0x90, 0x52, 0xe9, 0xac, 0x5d, 0x04, 0x7a, 0x65, 0x6f, 0x3c, 0x3b,
-    0x81, 0xbd, 0xdd, 0x8d, 0x64, 0xcb, 0x7d, 0xe4, 0x47, 0xba, 0x8d, 0x6c, 0xb9, 0x8b, 0xfc, 0x60,
-    0x37, 0x91, 0xf7, 0x6c, 0x54, 0x98, 0xee, 0x36, 0x83, 0x20, 0xa2, 0x5b, 0x19, 0xde, 0x01, 0x83,
-    0x38, 0x3c, 0x0d, 0x4b, 0xa2, 0x36, 0x1b, 0x6a, 0xb3, 0xa1, 0x36, 0x1b, 0x6a, 0xb3, 0xc1, 0x62,
-    0x36, 0xfc, 0x2b, 0xcf, 0x27, 0xf7, 0x37, 0x1d, 0x5e, 0xba, 0x55, 0x70, 0x90, 0x00, 0x34, 0x95,
-    0xa6, 0x03, 0x1f, 0xa7, 0x03, 0x98, 0x0f, 0xa5, 0xba, 0xd6, 0x5b, 0x03, 0x8a, 0xce, 0xff, 0x10,
-    0x11, 0x5e, 0x6a, 0xd5, 0xbf, 0x56, 0xfd, 0x6b, 0xd5, 0xff, 0x65, 0xa9, 0xfe, 0x1b, 0x2a, 0xea,
-    0x87, 0x51, 0xd1, 0x8f, 0x51, 0xea, 0x18, 0x0e, 0xd7, 0xab, 0xe7, 0x50, 0xd8, 0x94, 0xe2, 0xd9,
-    0xf2, 0x06, 0xae, 0x22, 0x4b, 0x70, 0xae, 0xb8, 0xd1, 0xa0, 0x4b, 0xc2, 0xeb, 0x74, 0x5e, 0x64,
-    0x48, 0xc2, 0xf6, 0x47, 0x70, 0x2e, 0x28, 0x9d, 0x16, 0x61, 0xa5, 0x44, 0x5a, 0x7f, 0x18, 0x14,
-    0xf4, 0xc2, 0x29, 0x2a, 0x8f, 0x50, 0xa6, 0xca, 0x46, 0xf1, 0x09, 0x12, 0x9a, 0x6c, 0xeb, 0xc7,
-    0x7c, 0x2b, 0x38, 0xb6, 0x5e, 0xfb, 0x45, 0x39, 0xf6, 0x7b, 0x4f, 0x90, 0x5b, 0x7d, 0xb3, 0x82,
-    0x41, 0x54, 0x88, 0xb6, 0xcb, 0x8a, 0x8b, 0x57, 0x97, 0x6b, 0x2e, 0x5e, 0x5d, 0x6e, 0x70, 0xb9,
-    0xe3, 0x72, 0x93, 0x1b, 0x40, 0xf7, 0x3d, 0x80, 0xb3, 0xf9, 0x49, 0x8a, 0x4d, 0x74, 0x6c, 0x3c,
-    0x1e, 0x72, 0x2b, 0x20, 0xc1, 0x14, 0x75, 0x04, 0x25, 0xfb, 0x6c, 0x90, 0x8c, 0xf7, 0xa0, 0x48,
-    0xc1, 0x2d, 0x86, 0x41, 0x2e, 0x7c, 0x69, 0xbb, 0x83, 0x75, 0xc9, 0xee, 0x60, 0x5d, 0x56, 0xdd,
-    0xc1, 0x62, 0xc5, 0xb7, 0x19, 0x81, 0xf2, 0xc9, 0x8e, 0x07, 0x3c, 0xc4, 0x83, 0x67, 0x2d, 0x99,
-    0x21, 0x91, 0x34, 0x55, 0x90, 0xd4, 0xbe, 0x0d, 0x71, 0x47, 0xc1, 0x8d, 0x54, 0x70, 0x1d, 0xc0,
-    0x87, 0x1b, 0x52, 0xfa, 0x59, 0x22, 0xf9, 0x64, 0x6e, 0x07, 0x12, 0xee, 0x93, 0xe0, 0x68, 0x2f,
-    0xf1, 0x75, 0xad, 0xb5, 0x4a, 0x60, 0x81, 0x0f, 0x46, 0x76, 0x1a, 0x3f, 0xd3, 0xae, 0x69, 0xfc,
-    0x84, 0xc7, 0x07, 0x54, 0x43, 0xe9, 0xbe, 0xea, 0x35, 0x0e, 0xd2, 0x4b, 0xce, 0x97, 0xcd, 0xbd,
-    0x4e, 0xbb, 0xd7, 0xed, 0xbd, 0x6a, 0x92, 0xcf, 0x11, 0xfa, 0x7c, 0xdd, 0x3d, 0xed, 0xd1, 0xcf,
-    0x04, 0x7d, 0x76, 0x5e, 0xf7, 0x7a, 0x21, 0x9d, 0xde, 0xea, 0x11, 0x4d, 0x7e, 0xea, 0x97, 0x30,
-    0xea, 0x24, 0x01, 0x19, 0x83, 0x65, 0x12, 0x87, 0x3b, 0xf6, 0xc5, 0x3f, 0x18, 0x14, 0xa3, 0x69,
-    0x46, 0x32, 0x30, 0xf7, 0xc7, 0xcc, 0xe1, 0x28, 0x6c, 0x3e, 0x45, 0x7d, 0x47, 0x8e, 0x2f, 0xc3,
-    0xe5, 0x24, 0xd2, 0xfe, 0xa0, 0xfb, 0xea, 0xf8, 0xcd, 0x09, 0x84, 0xc6, 0xe5, 0x12, 0xd1, 0x15,
-    0xd5, 0xcb, 0x25, 0x41, 0xa6, 0x83, 0x24, 0x6e, 0xe9, 0xd2, 0xd1, 0x85, 0x78, 0xaf, 0x24, 0x4b,
-    0x74, 0x42, 0xb3, 0x0c, 0x05, 0x18, 0x7d, 0x09, 0x23, 0x09, 0x82, 0x41, 0x87, 0x61, 0xd5, 0xf8,
-    0x21, 0x82, 0x9b, 0x2c, 0x8d, 0xff, 0x48, 0x10, 0x5e, 0xc4, 0x6a, 0x2c, 0x09, 0x5c, 0xb7, 0xe9,
-    0x18, 0x52, 0x3d, 0xd2, 0x3c, 0xa7, 0x68, 0x62, 0x36, 0xf0, 0x66, 0xf9, 0x8d, 0x43, 0xc6, 0x2b,
-    0xe8, 0x9e, 0x76, 0xe8, 0xb9, 0x57, 0x1f, 0x5a, 0x82, 0x06, 0x03, 0x7d, 0xbc, 0x7d, 0xe3, 0x9b,
-    0x5b, 0x04, 0xb4, 0xe2, 0x60, 0xc4, 0xf4, 0xb0, 0x20, 0xea, 0x58, 0x82, 0x9a, 0x8d, 0xad, 0x4c,
-    0xa5, 0xbc, 0xd6, 0xb4, 0xe7, 0x14, 0x3d, 0xd4, 0x75, 0x2c, 0x63, 0xa7, 0xd9, 0x2e, 0x1d, 0x58,
-    0x8a, 0x78, 0xa4, 0x22, 0x1e, 0xd9, 0x11, 0x8f, 0xaa, 0x11, 0x8f, 0x34, 0xc4, 0x89, 0x8a, 0x38,
-    0xb1, 0x23, 0x4e, 0xaa, 0x11, 0x27, 0x2a, 0x62, 0x4f, 0xd2, 0x1d, 0xd5, 0xa3, 0x1d, 0x62, 0xa9,
-    0xaa, 0xb8, 0x5f, 0x2c, 0x2d, 0x66, 0x4f, 0xd6, 0x43, 0xa7, 0xad, 0x60, 0xf4, 0x58, 0xb1, 0xd1,
-    0x7f, 0x77, 0x4f, 0xc5, 0x60, 0x8f, 0x2a, 0xcb, 0x3d, 0x74, 0x8e, 0xcd, 0xf7, 0x72, 0x60, 0xc8,
-    0x69, 0xbd, 0xa3, 0x07, 0x50, 0x50, 0x94, 0x50, 0x7f, 0xb0, 0xec, 0x99, 0xa2, 0x9d, 0x18, 0xf4,
-    0x96, 0x12, 0xd6, 0x87, 0x55, 0x5b, 0x64, 0xb2, 0x2e, 0xd5, 0xeb, 0xe2, 0x52, 0x51, 0xb3, 0x3e,
-    0x63, 0xc0, 0x5d, 0xbb, 0x46, 0x9f, 0xa0, 0x6b, 0x14, 0x73, 0xe9, 0x56, 0xaa, 0x9a, 0xc6, 0x93,
-    0xdb, 0x69, 0x6a, 0xdb, 0x6b, 0x67, 0x25, 0x4e, 0x8b, 0x76, 0xe1, 0xa7, 0xda, 0xf7, 0xfa, 0x7c,
-    0x8e, 0x6c, 0x54, 0xa9, 0xbc, 0xf4, 0x7e, 0xcd, 0x70, 0x94, 0xf2, 0x1b, 0x6d, 0x32, 0xc8, 0xcb,
-    0x77, 0xda, 0x3e, 0x84, 0xce, 0x4f, 0x72, 0x6e, 0x23, 0x8b, 0x6e, 0xbf, 0xd6, 0x26, 0xb8, 0xe5,
-    0x67, 0x66, 0xc0, 0xe5, 0xc3, 0x70, 0x47, 0xb0, 0xa1, 0xd9, 0xf8, 0xeb, 0x5f, 0x1b, 0x4c, 0xb3,
-    0x8d, 0x40, 0xb1, 0x95, 0x12, 0x6e, 0x11, 0x04, 0x51, 0xba, 0x8f, 0x7e, 0x26, 0xeb, 0xf2, 0xd1,
-    0x4f, 0xe4, 0xad, 0x0c, 0x79, 0x3c, 0xfd, 0x5b, 0x4f, 0xd3, 0x40, 0x0e, 0x72, 0x7e, 0xe5, 0x30,
-    0xa7, 0x57, 0x68, 0x2d, 0x4c, 0x75, 0xb0, 0x18, 0x3f, 0x1b, 0x5a, 0x2f, 0xc7, 0x0f, 0x61, 0xbd,
-    0xc0, 0x85, 0xce, 0x97, 0x62, 0xb2, 0xb0, 0x6e, 0x6d, 0xcf, 0x47, 0xdc, 0x0a, 0xb0, 0x69, 0xff,
-    0x18, 0x33, 0x0e, 0xbb, 0x07, 0x4d, 0xf1, 0xe9, 0xaf, 0x63, 0xb7, 0x64, 0x07, 0xd0, 0x3c, 0x5c,
-    0x8b, 0x34, 0x74, 0x9a, 0x39, 0x70, 0xe8, 0x9d, 0x84, 0x5d, 0x74, 0xd1, 0xfd, 0x2a, 0x95, 0x87,
-    0xd2, 0x0c, 0x5f, 0xf6, 0xd6, 0x05, 0x1e, 0xa8, 0xf5, 0x1a, 0x96, 0x75, 0x14, 0x36, 0xd3, 0x96,
-    0xea, 0x0d, 0x8f, 0x7a, 0xc3, 0x63, 0xe7, 0x0d, 0x0f, 0xfa, 0xf8, 0xd2, 0x92, 0x3e, 0x87, 0x64,
-    0xdf, 0xf3, 0x28, 0x6d, 0x8d, 0xd0, 0x12, 0x9e, 0x26, 0xaf, 0xf6, 0xeb, 0x0f, 0x19, 0x66, 0x13,
-    0x58, 0x29, 0xf2, 0x69, 0xb8, 0x59, 0x68, 0x0a, 0xda, 0xec, 0x87, 0x88, 0xf1, 0x23, 0xc7, 0x65,
-    0x20, 0x11, 0xab, 0x66, 0x8b, 0x6c, 0x8c, 0x60, 0x69, 0x90, 0x58, 0x4e, 0x19, 0xbd, 0xf9, 0x8d,
-    0xf5, 0x60, 0x47, 0xca, 0x40, 0x6a, 0x23, 0x28, 0x6c, 0x81, 0x92, 0xc4, 0xce, 0xbe, 0x2a, 0xa4,
-    0xd2, 0xcb, 0xcc, 0xae, 0x87, 0x91, 0x34, 0x69, 0x45, 0x15, 0x4f, 0x28, 0x69, 0xcf, 0xc4, 0xe1,
-    0x2e, 0xdd, 0x66, 0x61, 0xb2, 0x77, 0xb3, 0xbe, 0xe6, 0xdd, 0xe6, 0x48, 0x52, 0x94, 0xde, 0x52,
-    0x89, 0x97, 0x4a, 0x3a, 0x15, 0x9a, 0xc4, 0x30, 0xa4, 0xfd, 0x81, 0xb4, 0xb0, 0x8f, 0xe3, 0xf4,
-    0x1a, 0x14, 0xa7, 0xa9, 0x43, 0x83, 0x38, 0x23, 0x3e, 0xf5, 0xa9, 0x64, 0xcc, 0xe2, 0x05, 0xbb,
-    0x2f, 0x8d, 0x63, 0xe8, 0x96, 0xf9, 0x95, 0x4c, 0x32, 0x0f, 0xc7, 0x7d, 0x0b, 0x71, 0x60, 0xc7,
-    0x38, 0x82, 0xd8, 0x64, 0xec, 0x3d, 0x2a, 0xd0, 0xa7, 0x20, 0xd9, 0x67, 0x15, 0xbb, 0x01, 0x52,
-    0x4e, 0x91, 0x26, 0x51, 0x7a, 0x88, 0xa5, 0x7a, 0xe0, 0xb0, 0x62, 0x2a, 0x91, 0x0a, 0xfd, 0xd3,
-    0xc4, 0x8a, 0x6d, 0x8b, 0x16, 0x44, 0x9a, 0x37, 0xff, 0xb9, 0xc2, 0x9a, 0x1a, 0xd3, 0xf2, 0x12,
-    0x6b, 0xd9, 0x8e, 0xad, 0xc8, 0xc0, 0x5a, 0x64, 0x6d, 0x6d, 0xc3, 0x4d, 0x28, 0xed, 0x28, 0x45,
-    0x52, 0x43, 0x11, 0x39, 0xff, 0x62, 0x03, 0x6a, 0x54, 0x8c, 0xa3, 0x4d, 0x88, 0x30, 0xd3, 0x7f,
-    0x59, 0xd1, 0x5b, 0xe6, 0x12, 0xd9, 0x06, 0xe4, 0x99, 0x4b, 0xa6, 0xcb, 0x78, 0x34, 0x4a, 0x71,
-    0x10, 0x0d, 0x98, 0xdd, 0xc0, 0xae, 0x8d, 0xbf, 0x35, 0x7a, 0xd8, 0x5e, 0xea, 0xb4, 0x4f, 0x90,
-    0xb1, 0xc4, 0x13, 0x4f, 0xda, 0xa7, 0x38, 0xf1, 0xf8, 0x14, 0xa5, 0xa2, 0x3f, 0xd4, 0x2a, 0x4c,
-    0xe7, 0xd9, 0x35, 0x35, 0x06, 0x07, 0xcd, 0x0b, 0xf4, 0x5f, 0xe6, 0xb6, 0x9c, 0xb8, 0x39, 0x44,
-    0xff, 0x8d, 0x5c, 0xdf, 0x19, 0x35, 0x2f, 0xd1, 0x7f, 0x24, 0x2d, 0x41, 0xff, 0x0d, 0x5c, 0x37,
-    0x68, 0x80, 0x1a, 0x8c, 0xea, 0xf0, 0x1d, 0x82, 0xbc, 0xc5, 0xa7, 0x0a, 0x04, 0x8d, 0x10, 0x04,
-    0x35, 0xbb, 0x6f, 0xdb, 0xbd, 0xd3, 0x57, 0xbd, 0x16, 0x01, 0xd3, 0xe3, 0x6a, 0x61, 0xd5, 0x17,
-    0x0b, 0x22, 0x4c, 0x44, 0x7b, 0x09, 0xe7, 0xe0, 0x21, 0x70, 0x8b, 0x4f, 0xbe, 0x57, 0xfc, 0x9b,
-    0x05, 0x53, 0x13, 0xd6, 0xc3, 0x1e, 0x44, 0xf2, 0x23, 0x49, 0x5e, 0x22, 0x28, 0x4d, 0x72, 0xb2,
-    0x3a, 0x98, 0xda, 0x7a, 0x69, 0x37, 0x46, 0x15, 0xc6, 0x53, 0xe9, 0x7a, 0x00, 0x4b, 0xc7, 0x9a,
-    0x96, 0xee, 0x31, 0xbf, 0x8c, 0x87, 0xf9, 0x8d, 0x9e, 0x0a, 0x02, 0xd8, 0x08, 0x1e, 0x0f, 0x20,
-    0xbc, 0x8b, 0x08, 0x51, 0xf9, 0xf5, 0xac, 0x71, 0xdc, 0xee, 0x9e, 0x74, 0x4f, 0xdf, 0xf6, 0x5e,
-    0x9d, 0x1e, 0x9f, 0xbe, 0x79, 0xfb, 0xfa, 0xed, 0xf1, 0x91, 0x21, 0x5a, 0x10, 0x58, 0xa3, 0xd6,
-    0x40, 0x6d, 0x32, 0x47, 0x3a, 0xe4, 0xa5, 0x3f, 0x64, 0x25, 0x41, 0xb0, 0x46, 0x57, 0x8e, 0xd6,
-    0x88, 0x57, 0x8f, 0x4f, 0x24, 0xba, 0xce, 0x00, 0x19, 0xbe, 0x60, 0xab, 0xc5, 0xd3, 0x85, 0xe3,
-    0x88, 0x26, 0xff, 0xd1, 0xf9, 0xde, 0x92, 0xbe, 0xba, 0xdf, 0x5d, 0x0f, 0x1b, 0x7e, 0x34, 0x64,
-    0x9d, 0xdb, 0x54, 0x33, 0x39, 0xe6, 0x71, 0x3e, 0x4b, 0x23, 0x24, 0x6c, 0xa7, 0x08, 0xba, 0x77,
-    0xea, 0xd1, 0x63, 0xd2, 0x98, 0x22, 0x37, 0x90, 0xea, 0xe5, 0x67, 0xa4, 0x71, 0x1c, 0x9b, 0x88,
-    0xf2, 0x2f, 0x31, 0x39, 0xd1, 0x24, 0xc3, 0x18, 0x28, 0x13, 0xfb, 0x2d, 0x9a, 0xeb, 0xa2, 0x69,
-    0xf7, 0xf5, 0x0c, 0xdf, 0xf5, 0x60, 0x79, 0xdc, 0xb5, 0x01, 0x4e, 0x89, 0x9f, 0xe4, 0x36, 0x72,
-    0xd3, 0x31, 0xa2, 0xe3, 0xc5, 0xdd, 0x57, 0xf1, 0x6d, 0x36, 0xb9, 0xc2, 0x81, 0x8c, 0x49, 0xfa,
-    0xaa, 0xf9, 0xf5, 0x2c, 0x94, 0xf4, 0xf0, 0x6e, 0xfb, 0xcd, 0xeb, 0xd3, 0x96, 0x08, 0x5a, 0xd8,
-    0x6d, 0xbf, 0x3e, 0xa5, 0xf9, 0x68, 0x92, 0x92, 0x87, 0x4a, 0x21, 0x38, 0x12, 0x2f, 0x45, 0xa2,
-    0x56, 0x9e, 0xe3, 0xa6, 0xf3, 0x62, 0xb8, 0x29, 0x20, 0x2f, 0xd0, 0x38, 0xa0, 0xc9, 0x8e, 0x9d,
-    0xac, 0xb8, 0x77, 0xc8, 0x48, 0x04, 0x22, 0x95, 0x21, 0x25, 0x19, 0xae, 0xc7, 0xbe, 0x21, 0x02,
-    0x30, 0x14, 0x60, 0x64, 0x63, 0x86, 0xc1, 0xe3, 0x25, 0x55, 0xc8, 0xf6, 0x50, 0x71, 0x26, 0xdd,
-    0x6b, 0xc5, 0x03, 0x45, 0x52, 0x20, 0xdc, 0x19, 0xf9, 0x45, 0x0d, 0x71, 0xd1, 0xac, 0x5e, 0xd9,
-    0x17, 0x01, 0x2c, 0x4c, 0xc2, 0xc3, 0x80, 0xf2, 0xe9, 0x90, 0xb1, 0x69, 0xd2, 0xfe, 0x72, 0x83,
-    0xaf, 0x67, 0x58, 0x96, 0x08, 0x6e, 0x22, 0x01, 0xa7, 0xa1, 0x10, 0xad, 0x99, 0x04, 0x27, 0x21,
-    0x33, 0xc1, 0x97, 0x98, 0xdf, 0xc7, 0x40, 0x48, 0x6d, 0x41, 0x9c, 0x2c, 0x13, 0x5f, 0x4d, 0x94,
-    0x22, 0x87, 0xe4, 0x16, 0x12, 0x56, 0x94, 0x2a, 0x6e, 0xc7, 0x6e, 0x53, 0xfa, 0xbc, 0x9f, 0x70,
-    0xe3, 0x53, 0x12, 0x53, 0x8a, 0x43, 0x32, 0x9f, 0xbe, 0x79, 0x7d, 0xdc, 0xe9, 0xbe, 0x3a, 0x32,
-    0x49, 0x38, 0xea, 0x97, 0x2c, 0x6f, 0x3e, 0xe1, 0x98, 0xfd, 0xd5, 0xca, 0x6b, 0x39, 0xca, 0xad,
-    0xfc, 0xd8, 0x17, 0x95, 0x36, 0xfa, 0xeb, 0x84, 0x9b, 0xbe, 0x19, 0xa6, 0xc9, 0x37, 0x4a, 0xa6,
-    0x96, 0x8a, 0xa3, 0xf9, 0xf4, 0x4a, 0xb1, 0x9e, 0x46, 0xf1, 0x64, 0x12, 0xb3, 0xc0, 0x3a, 0x86,
-    0xd0, 0xa5, 0xa0, 0xdb, 0x4f, 0xd3, 0x45, 0x7e, 0x11, 0xcf, 0x9f, 0x5d, 0xe0, 0x98, 0xfa, 0x71,
-    0xae, 0x1d, 0xce, 0x95, 0x8e, 0xe2, 0x59, 0xc5, 0xe3, 0x56, 0x2c, 0xb7, 0x2a, 0xce, 0x33, 0x83,
-    0x59, 0x17, 0xe9, 0x59, 0x86, 0xab, 0xea, 0x32, 0xfc, 0x96, 0xac, 0xa5, 0x49, 0x38, 0xcf, 0xde,
-    0x61, 0x38, 0xbb, 0xba, 0x53, 0x38, 0x48, 0x05, 0x09, 0x15, 0x1d, 0xb2, 0xb6, 0x37, 0x36, 0xea,
-    0x0a, 0xb5, 0x1f, 0x9e, 0x5e, 0x90, 0xa1, 0x97, 0xfe, 0xec, 0x14, 0x67, 0x7a, 0x75, 0x60, 0x58,
-    0xb2, 0x81, 0x10, 0x96, 0xe5, 0xcb, 0x73, 0xc2, 0x12, 0x84, 0x5b, 0xa0, 0xd9, 0x92, 0xe7, 0xe5,
-    0x16, 0x91, 0xf7, 0x9d, 0x0d, 0x3d, 0x82, 0x33, 0x7c, 0x31, 0x17, 0x8c, 0xfd, 0x41, 0x4b, 0x6f,
-    0xc3, 0xee, 0x6a, 0x1b, 0x6c, 0xfd, 0xc0, 0x3a, 0xa1, 0xba, 0x07, 0x58, 0xf3, 0xd5, 0xb6, 0x93,
-    0xbc, 0x77, 0x9f, 0x7f, 0x3f, 0x7b, 0xf7, 0xeb, 0xd9, 0xbb, 0xf3, 0xb3, 0xcf, 0xbf, 0xd8, 0x9f,
-    0xdb, 0x01, 0x25, 0x5f, 0x0d, 0x28, 0x1a, 0xc5, 0xec, 0x91, 0x88, 0x56, 0xb7, 0xf7, 0x06, 0x65,
-    0x53, 0xed, 0xa9, 0xcf, 0xb7, 0x08, 0x22, 0x12, 0xca, 0x9c, 0x3c, 0x01, 0x81, 0xc3, 0x54, 0x62,
-    0x6f, 0x81, 0xb4, 0xa4, 0x45, 0x3c, 0x7a, 0x38, 0x01, 0x02, 0x7f, 0x81, 0xdb, 0xa4, 0x5f, 0x37,
-    0xde, 0xab, 0x13, 0x1a, 0x01, 0x5d, 0xf8, 0x07, 0xa5, 0x68, 0xe3, 0x74, 0xa1, 0x25, 0x6f, 0x55,
-    0x29, 0xb3, 0x9e, 0x6f, 0x76, 0x0a, 0x28, 0x1c, 0x30, 0x1d, 0x2c, 0x0f, 0xbe, 0x9b, 0xc6, 0x7e,
-    0xb0, 0x08, 0xeb, 0x21, 0x5b, 0xb9, 0x69, 0x4e, 0xc8, 0xd9, 0x86, 0xfd, 0xc0, 0x9d, 0x40, 0x0d,
-    0xe7, 0x78, 0x7c, 0x41, 0x32, 0x45, 0x0e, 0x1d, 0x64, 0xc0, 0xe5, 0xd1, 0x71, 0x66, 0x1a, 0x32,
-    0xa4, 0x33, 0x2c, 0x4d, 0x87, 0xfd, 0xe2, 0x3a, 0xb5, 0x3c, 0x04, 0xd8, 0xe2, 0xe5, 0x8a, 0x62,
-    0x7e, 0x55, 0x28, 0x65, 0x79, 0xbd, 0x5e, 0x19, 0x4b, 0x0f, 0xbf, 0x65, 0x01, 0x4a, 0x56, 0xd3,
-    0x11, 0xf4, 0x51, 0x3d, 0x9f, 0x3c, 0x74, 0x21, 0x57, 0xa4, 0xf5, 0x19, 0xbe, 0x6c, 0x49, 0xaa,
-    0xf3, 0x44, 0x50, 0x4d, 0xa2, 0x98, 0x68, 0xe2, 0x12, 0x2b, 0xe5, 0xd2, 0x38, 0x6b, 0xf9, 0x05,
-    0x09, 0xb3, 0x8d, 0x94, 0xdb, 0x2b, 0xad, 0x0e, 0xd2, 0x2b, 0xbd, 0x88, 0xfc, 0xd5, 0xab, 0xf1,
-    0xf8, 0x88, 0x20, 0xe5, 0x0d, 0x22, 0x5c, 0xb7, 0xae, 0xfc, 0x2b, 0x78, 0xfa, 0x5d, 0x7b, 0xef,
-    0x8b, 0xf1, 0x9f, 0x6a, 0xa7, 0x02, 0xfd, 0x01, 0x55, 0xec, 0xd8, 0xf6, 0x5f, 0xd5, 0x71, 0x4c,
-    0xf1, 0x4c, 0x7a, 0x4f, 0x29, 0x86, 0xfb, 0xaf, 0x54, 0x99, 0x31, 0x10, 0x25, 0x7e, 0x70, 0x0b,
-    0x75, 0x99, 0x1c, 0x25, 0x94, 0xdd, 0x57, 0x25, 0xb7, 0x4e, 0xad, 0xa5, 0x4c, 0x45, 0x4a, 0x95,
-    0x96, 0xae, 0xe0, 0x7b, 0x25, 0x1d, 0x15, 0x8c, 0x72, 0x49, 0x85, 0x8c, 0xd6, 0x13, 0x18, 0xac,
-    0xa1, 0x26, 0x64, 0xaa, 0x2a, 0xf1, 0xb4, 0x10, 0x8e, 0xf0, 0x31, 0x0b, 0x2b, 0x77, 0x7c, 0xb6,
-    0x54, 0x8a, 0x35, 0xf5, 0xd7, 0xac, 0x2a, 0x9b, 0x94, 0xe2, 0xc7, 0x79, 0x8b, 0xeb, 0x19, 0xbd,
-    0x91, 0xb5, 0xe7, 0x88, 0x79, 0x87, 0x79, 0x79, 0xc9, 0x74, 0xe1, 0x9b, 0x30, 0x87, 0xeb, 0x31,
-    0xe6, 0x69, 0x2f, 0x42, 0x41, 0x42, 0x2f, 0xc2, 0xef, 0x06, 0x35, 0x6d, 0x0b, 0x16, 0x14, 0x93,
-    0xd9, 0x48, 0xbe, 0x28, 0x4e, 0x6c, 0xe1, 0x09, 0xea, 0x31, 0xa8, 0xb0, 0xe5, 0xf0, 0x0a, 0x8a,
-    0x16, 0x46, 0xed, 0xfa, 0xa2, 0x4a, 0x1c, 0x7a, 0xd5, 0x0d, 0x70, 0xba, 0xc5, 0x60, 0xde, 0x43,
-    0x68, 0x2a, 0x6e, 0x19, 0xff, 0xf6, 0xee, 0x9f, 0xfd, 0x5f, 0xcf, 0x3e, 0x7f, 0xec, 0x7f, 0x38,
-    0x3b, 0xff, 0xfd, 0xdd, 0xe7, 0xf7, 0x1f, 0x1b, 0xc7, 0xbd, 0xd7, 0xaf, 0x5e, 0xb7, 0x3b, 0x4f,
-    0xc6, 0x76, 0xde, 0xf4, 0x41, 0x6d, 0x8b, 0x8d, 0xbd, 0x7f, 0xdb, 0x19, 0x89, 0xd5, 0xd1, 0x3c,
-    0x5d, 0x58, 0x03, 0x85, 0xd4, 0x56, 0x6a, 0x6d, 0xa5, 0xbe, 0x54, 0x2b, 0xb5, 0xb6, 0x1b, 0x6b,
-    0xbb, 0xf1, 0x85, 0xd9, 0x8d, 0x4c, 0x9c, 0x6f, 0x6a, 0x3a, 0x06, 0xa5, 0x25, 0xb4, 0x36, 0x26,
-    0x6b, 0x63, 0xb2, 0x36, 0x26, 0x9f, 0x95, 0x31, 0xb9, 0xf1, 0xde, 0xf2, 0xce, 0x66, 0xe6, 0x3d,
-    0xf5, 0xc7, 0x17, 0x63, 0x2a, 0xd6, 0xe6, 0x9e, 0xc1, 0xdc, 0xb3, 0xbc, 0xc9, 0x46, 0x0f, 0x04,
-    0x00, 0x67, 0xab, 0xac, 0x62, 0x7f, 0x9b, 0x6d, 0x3f, 0x56, 0x62, 0xd9, 0x06, 0x64, 0x39, 0xca,
-    0xc2, 0xd7, 0x3f, 0x7f, 0xff, 0xee, 0xd7, 0x8f, 0x20, 0xda, 0x1f, 0xdc, 0x46, 0x5c, 0xb3, 0x83,
-    0x7a, 0x3f, 0x13, 0xf2, 0x3e, 0x36, 0xa2, 0xd8, 0x3d, 0xdd, 0xc1, 0xc9, 0x54, 0x9b, 0x86, 0x3b,
-    0x98, 0x86, 0x4f, 0xc0, 0x12, 0x7b, 0x72, 0xd6, 0xe9, 0x81, 0x4d, 0xc3, 0xfa, 0x42, 0xe8, 0x13,
-    0xba, 0x10, 0xfa, 0xc2, 0x4d, 0xf0, 0xc7, 0x35, 0x79, 0x9f, 0x9a, 0x03, 0xe0, 0x50, 0x26, 0xf8,
-    0x9f, 0xe1, 0x8a, 0xee, 0x23, 0xb9, 0x19, 0x18, 0xdc, 0x76, 0x9b, 0xd4, 0x06, 0x45, 0xab, 0xf6,
-    0x33, 0xd4, 0x7e, 0x86, 0xda, 0xcf, 0x70, 0x28, 0x3f, 0x83, 0x98, 0xae, 0xb1, 0xac, 0xf4, 0x3f,
-    0xac, 0xff, 0x61, 0x9b, 0xeb, 0xa8, 0x8a, 0xac, 0xd3, 0xe3, 0xbc, 0xac, 0x75, 0x64, 0x1c, 0xce,
-    0xc8, 0x79, 0x29, 0xb7, 0x41, 0xff, 0x0c, 0xde, 0x99, 0x27, 0x74, 0xad, 0xf4, 0x11, 0xbd, 0x47,
-    0x75, 0xdc, 0xe4, 0x97, 0xf5, 0x9a, 0x8a, 0xdc, 0xd5, 0x72, 0xfb, 0xd4, 0x36, 0xb7, 0x97, 0x1e,
-    0xef, 0xb5, 0x40, 0x8d, 0x40, 0xac, 0x01, 0xae, 0x4c, 0x38, 0x13, 0x03, 0x4e, 0x44, 0xb5, 0x47,
-    0xfb, 0xbb, 0x0a, 0x23, 0x50, 0x1c, 0x3e, 0x33, 0x97, 0x25, 0xc1, 0xb6, 0x44, 0x5d, 0x49, 0xae,
-    0x37, 0xf3, 0x25, 0x22, 0x50, 0x7b, 0xba, 0xbd, 0x54, 0xe1, 0x93, 0x6a, 0xf8, 0x44, 0x85, 0x5f,
-    0xf5, 0xf1, 0xcb, 0xd2, 0x4d, 0xde, 0x17, 0x48, 0x0f, 0xa2, 0x97, 0xe5, 0x38, 0x7d, 0x98, 0x26,
-    0x47, 0xab, 0x75, 0xd5, 0xec, 0xd1, 0xd7, 0x64, 0x5c, 0x9d, 0xa0, 0x95, 0x40, 0x9e, 0xec, 0x82,
-    0x3c, 0xb1, 0x23, 0x4f, 0x04, 0x6b, 0xe0, 0xf8, 0x27, 0xdb, 0x5f, 0x36, 0xc7, 0x3c, 0x84, 0x7a,
-    0xd5, 0x47, 0x2d, 0x77, 0x25, 0x5c, 0xc9, 0x0e, 0x57, 0xc5, 0x29, 0xae, 0x04, 0xe1, 0x4a, 0x5c,
-    0xc5, 0xc9, 0x0c, 0xb8, 0x8c, 0xd7, 0xc5, 0x51, 0xa5, 0xbe, 0x39, 0x23, 0x71, 0xcd, 0xd7, 0xc4,
-    0x89, 0xdb, 0xf9, 0x01, 0x9f, 0xb5, 0x78, 0x42, 0x4e, 0xe7, 0x07, 0x3d, 0x98, 0x44, 0x07, 0x89,
-    0x3c, 0xeb, 0x1d, 0x97, 0x54, 0x3b, 0xd4, 0xeb, 0xfd, 0x95, 0x94, 0x6e, 0x2a, 0x95, 0x58, 0x4a,
-    0x25, 0xfb, 0x38, 0x04, 0x45, 0x53, 0xa1, 0x86, 0xd8, 0x94, 0x98, 0xec, 0x7e, 0xaa, 0xb2, 0xbe,
-    0x4a, 0x54, 0x1f, 0xd2, 0xaa, 0x0f, 0x69, 0xd9, 0x3c, 0xf1, 0x6c, 0xc8, 0x0c, 0x6e, 0xba, 0x87,
-    0xf0, 0xd2, 0x63, 0x5f, 0x51, 0x05, 0x95, 0x22, 0xdf, 0xda, 0x57, 0x02, 0xc4, 0xc4, 0x5f, 0x52,
-    0x6e, 0x55, 0x6f, 0xaa, 0x60, 0xf5, 0xbd, 0xa8, 0xfa, 0x7c, 0xdb, 0x13, 0x39, 0xdf, 0x76, 0x38,
-    0x77, 0xba, 0x34, 0x15, 0xc5, 0x4f, 0x43, 0xcd, 0x22, 0xd3, 0x57, 0xe7, 0xa7, 0xa9, 0xc9, 0x32,
-    0x26, 0xd3, 0x24, 0xab, 0xbd, 0xde, 0xb5, 0xd7, 0xbb, 0xf6, 0x7a, 0xd7, 0x5e, 0xef, 0xcd, 0xbc,
-    0xde, 0x58, 0xfd, 0x8f, 0xa8, 0x1c, 0xe2, 0x73, 0xd7, 0xd3, 0xcd, 0x99, 0xf6, 0x32, 0x90, 0x84,
-    0x14, 0x1f, 0xbc, 0x12, 0xd8, 0xaa, 0xc9, 0x2d, 0x1d, 0x97, 0x62, 0x4f, 0xd6, 0x62, 0x4f, 0x36,
-    0xc3, 0x9e, 0x48, 0xd8, 0x21, 0x34, 0xda, 0xbe, 0x4f, 0x06, 0xea, 0xb6, 0xd8, 0x62, 0x78, 0x81,
-    0xbb, 0xbf, 0x1c, 0x3b, 0x0b, 0x99, 0x94, 0x4f, 0xcc, 0x02, 0xab, 0xef, 0xb5, 0x55, 0xeb, 0x00,
-    0x87, 0xd3, 0xc1, 0xf7, 0xab, 0x40, 0x3f, 0xc7, 0xab, 0x7a, 0x46, 0x0c, 0x15, 0xe7, 0x1e, 0xca,
-    0x3d, 0x5e, 0xd9, 0xe1, 0x5b, 0xab, 0x4a, 0xcf, 0xcc, 0x25, 0x8b, 0xc4, 0x10, 0xe4, 0xf6, 0x63,
-    0x63, 0x6c, 0x29, 0x2c, 0x4c, 0xdc, 0x76, 0xac, 0x01, 0x27, 0x56, 0xe0, 0xa4, 0x04, 0x8c, 0xbd,
-    0x87, 0xbc, 0x16, 0x9f, 0xa3, 0xf0, 0xb1, 0xa4, 0x73, 0x43, 0xe2, 0x0b, 0x8c, 0x94, 0x97, 0x72,
-    0x4f, 0x5b, 0x42, 0x3e, 0xca, 0xb2, 0x9c, 0x44, 0x33, 0x36, 0xe5, 0x50, 0xb4, 0xfb, 0x3f, 0xe4,
-    0xba, 0xd1, 0xb9, 0xd3, 0x62, 0x8c, 0xd6, 0x9a, 0xb9, 0xfc, 0x4c, 0x06, 0x97, 0xfa, 0x78, 0xed,
-    0xb1, 0x64, 0x26, 0x57, 0x17, 0x17, 0xe9, 0xbc, 0xea, 0x09, 0xdd, 0x2d, 0x83, 0xaa, 0x75, 0x0c,
-    0x69, 0xdd, 0x5d, 0x23, 0xad, 0x75, 0x22, 0xc7, 0x31, 0x47, 0xa5, 0x6c, 0x81, 0x1e, 0x1d, 0xa8,
-    0xf4, 0x37, 0x5c, 0x88, 0x19, 0x45, 0x4a, 0x76, 0x23, 0x12, 0x98, 0x0f, 0x9e, 0x6a, 0x97, 0x3b,
-    0x00, 0x82, 0x89, 0x89, 0xae, 0x92, 0x3a, 0x57, 0xde, 0xc0, 0xee, 0x97, 0xfb, 0x49, 0x7f, 0x66,
-    0xa4, 0xb4, 0xd8, 0x76, 0xec, 0x59, 0xdd, 0x8d, 0xbb, 0xa9, 0x34, 0x3a, 0x73, 0x88, 0x68, 0x85,
-    0x94, 0x8e, 0x05, 0x84, 0x03, 0xaf, 0xca, 0x06, 0x71, 0x59, 0x1e, 0xf9, 0x18, 0x75, 0x1b, 0x0e,
-    0xee, 0xa7, 0xbf, 0xbc, 0x22, 0x5c, 0x9a, 0xd3, 0x62, 0x1e, 0x2f, 0x4c, 0x2f, 0xb3, 0xc0, 0x33,
-    0x29, 0x8b, 0x59, 0x36, 0xed, 0xdf, 0xe0, 0x60, 0xbf, 0x5a, 0xb4, 0x3c, 0x21, 0x98, 0x3b, 0xe5,
-    0x89, 0xd9, 0x21, 0x21, 0xe2, 0x3a, 0x6b, 0xa2, 0xd1, 0x76, 0x09, 0x58, 0x97, 0x84, 0x02, 0x27,
-    0xc8, 0xda, 0x31, 0xb1, 0x10, 0x50, 0x15, 0x34, 0x61, 0x3e, 0x4a, 0x22, 0xf1, 0x33, 0x60, 0x60,
-    0xe1, 0x1d, 0x2f, 0xd4, 0xd5, 0x0b, 0x75, 0x45, 0xa1, 0xae, 0x28, 0xd4, 0x85, 0x42, 0xda, 0x16,
-    0x03, 0xc1, 0xe6, 0xd3, 0x60, 0xb3, 0x6c, 0xf4, 0xe9, 0x0b, 0x50, 0xed, 0x58, 0x0e, 0xc9, 0x8d,
-    0xbb, 0x84, 0xe3, 0x05, 0xb4, 0x21, 0x7c, 0xe1, 0x50, 0xde, 0x10, 0xf6, 0x13, 0x7d, 0xf8, 0x6a,
-    0x8f, 0xc1, 0xf3, 0x02, 0xae, 0x6f, 0xc9, 0xbb, 0x5d, 0xae, 0xac, 0x79, 0xab, 0xdb, 0x25, 0x8f,
-    0x72, 0x17, 0x5f, 0xa7, 0x48, 0x3a, 0xa4, 0x11, 0x7b, 0x2e, 0x89, 0xbd, 0x81, 0xc5, 0x1e, 0xbf,
-    0x72, 0x83, 0x63, 0x08, 0x3f, 0x0a, 0xe1, 0xc9, 0x1d, 0x0a, 0xdb, 0x42, 0x5f, 0x10, 0x8c, 0xad,
-    0x3c, 0xfc, 0x40, 0x30, 0x54, 0x88, 0x67, 0x8f, 0x57, 0x1a, 0x7e, 0x32, 0x7d, 0xc8, 0xd0, 0x03,
-    0x43, 0x81, 0x75, 0x4f, 0x1a, 0xa8, 0xb3, 0xa2, 0xbf, 0x36, 0xc1, 0x65, 0x88, 0xd0, 0x6f, 0x0b,
-    0x1e, 0xa8, 0xc2, 0xdf, 0x20, 0x45, 0x93, 0xb0, 0x58, 0x52, 0x90, 0xe8, 0x6f, 0x8c, 0x48, 0x9f,
-    0x57, 0xe3, 0xe3, 0xb6, 0xd3, 0xe1, 0xf3, 0x59, 0xc0, 0xb6, 0xfb, 0xc9, 0x5f, 0xd4, 0x4b, 0x8b,
-    0x82, 0x4e, 0x99, 0xaf, 0x67, 0x51, 0x29, 0x74, 0x62, 0x79, 0xe7, 0x06, 0x2c, 0x79, 0x6a, 0x54,
-    0x9b, 0x77, 0x75, 0xca, 0x25, 0x60, 0x09, 0x36, 0x15, 0x39, 0x86, 0x4c, 0x6e, 0x6b, 0xa9, 0x02,
-    0x99, 0x79, 0x2c, 0x30, 0xd7, 0xea, 0x12, 0x2a, 0xc9, 0xf3, 0x31, 0x48, 0xa0, 0x05, 0xd9, 0xf8,
-    0x83, 0x98, 0x9e, 0x7d, 0xdc, 0x92, 0x58, 0x5a, 0x06, 0x34, 0xa0, 0x8b, 0x34, 0xc6, 0x82, 0xb6,
-    0x04, 0xa7, 0xbe, 0x25, 0x88, 0x61, 0xab, 0x32, 0x2d, 0x59, 0x83, 0x78, 0x82, 0x18, 0x14, 0xec,
-    0x41, 0x88, 0xaf, 0x87, 0xc4, 0x36, 0x7b, 0xa1, 0xc1, 0x02, 0x3f, 0xcb, 0x8a, 0xc1, 0xa5, 0x4e,
-    0xeb, 0x3c, 0x2f, 0xe2, 0x22, 0xed, 0x2f, 0x56, 0x93, 0x24, 0x1f, 0x5b, 0x0a, 0x92, 0x68, 0x82,
-    0x9a, 0x7d, 0xa4, 0x48, 0xf8, 0xc1, 0xa5, 0x12, 0x6c, 0xd3, 0xb2, 0xbb, 0x46, 0x52, 0xc7, 0x71,
-    0x82, 0xd4, 0xa3, 0xd9, 0x38, 0x9e, 0xa6, 0x16, 0x08, 0x12, 0xed, 0x5a, 0xcb, 0x13, 0x7d, 0x0b,
-    0x92, 0x4f, 0x4f, 0xc6, 0x6d, 0x23, 0xf6, 0xec, 0x24, 0x9e, 0xd9, 0x8e, 0x57, 0x95, 0x6d, 0xaa,
-    0x92, 0x45, 0xa5, 0x0c, 0xfe, 0x33, 0xd8, 0xa8, 0x79, 0x22, 0xaf, 0xab, 0x0b, 0x0d, 0x27, 0x92,
-    0xe7, 0x2b, 0x3f, 0xf8, 0xc2, 0xdc, 0xb7, 0x6a, 0x2e, 0x3b, 0x36, 0x83, 0x75, 0x12, 0xe1, 0x69,
-    0x64, 0x89, 0x30, 0x66, 0x2c, 0x95, 0x9f, 0x90, 0x21, 0xc9, 0x88, 0xf8, 0x29, 0xf7, 0x07, 0x42,
-    0xc2, 0x1f, 0x9d, 0xef, 0xc4, 0x19, 0xc8, 0x28, 0x59, 0x8a, 0x0a, 0x85, 0x30, 0x90, 0x90, 0x23,
-    0x04, 0x9f, 0x90, 0xbc, 0x26, 0x67, 0x63, 0x54, 0xa0, 0xdb, 0x9b, 0xa0, 0x77, 0xfa, 0x0a, 0xad,
-    0x03, 0xf2, 0x34, 0x58, 0xa4, 0xa3, 0x09, 0x84, 0xb1, 0x44, 0x8c, 0x8e, 0x0a, 0xb4, 0x34, 0x31,
-    0xf2, 0x47, 0xef, 0x3b, 0x53, 0x9a, 0x81, 0xd1, 0x60, 0x31, 0xfd, 0xc1, 0x22, 0x2d, 0xe0, 0xc1,
-    0x95, 0x1f, 0xec, 0x42, 0x02, 0x0d, 0x23, 0x6e, 0x37, 0x88, 0x64, 0xd1, 0x56, 0x9f, 0xb6, 0xb2,
-    0xfb, 0xdd, 0x67, 0x02, 0xc3, 0x0d, 0x88, 0x43, 0xf6, 0xae, 0x01, 0xc3, 0xd4, 0x80, 0x2a, 0xef,
-    0x57, 0xa3, 0xa8, 0x4d, 0xc5, 0x4c, 0x72, 0xa9, 0x28, 0xba, 0x53, 0x1d, 0x72, 0x5f, 0xf3, 0x6c,
-    0x5a, 0xac, 0x0b, 0xad, 0x4e, 0xa3, 0x62, 0x73, 0x71, 0x85, 0x64, 0xd4, 0x65, 0x2e, 0xc4, 0x55,
-    0xa4, 0x62, 0x6b, 0xdf, 0x28, 0xc5, 0x18, 0x14, 0x11, 0x3f, 0x91, 0x3e, 0xd5, 0x1b, 0x3f, 0x1f,
-    0x59, 0x11, 0x07, 0x15, 0x32, 0xb2, 0xf1, 0xd3, 0x51, 0x45, 0x6e, 0x60, 0xc5, 0xa9, 0xd0, 0x26,
-    0xb9, 0xce, 0x28, 0x79, 0xc4, 0xa8, 0x03, 0x2b, 0x07, 0xfc, 0xa4, 0x2a, 0xed, 0xd8, 0x70, 0x03,
-    0x2f, 0x77, 0x08, 0x3d, 0xe9, 0x45, 0xa5, 0xd2, 0xec, 0x28, 0x17, 0x67, 0x4b, 0x2e, 0xee, 0x1a,
-    0x3f, 0x63, 0xbe, 0x0a, 0x7a, 0x27, 0xd8, 0x95, 0x8b, 0x47, 0x42, 0x61, 0x4e, 0x2c, 0xbe, 0x89,
-    0x30, 0x07, 0x3b, 0x00, 0xd5, 0x14, 0x12, 0x86, 0x50, 0xe4, 0x3b, 0xd3, 0x34, 0x09, 0x9f, 0x7f,
-    0x5d, 0x3b, 0x88, 0x24, 0x0e, 0x77, 0x17, 0x87, 0x07, 0xe7, 0x4f, 0x0a, 0xc5, 0xfa, 0x78, 0x2d,
-    0x57, 0x41, 0x69, 0x04, 0x31, 0x64, 0x12, 0x99, 0x2a, 0x02, 0x78, 0x63, 0xfa, 0x4d, 0xa8, 0x37,
-    0x03, 0xc7, 0x12, 0x76, 0xe0, 0xb8, 0x17, 0x3e, 0x53, 0xa6, 0xae, 0x44, 0x3e, 0x9c, 0x18, 0x83,
-    0x63, 0x69, 0xe1, 0x9d, 0xdc, 0x15, 0x78, 0x7e, 0x22, 0x5e, 0x9d, 0x46, 0x38, 0x64, 0xad, 0x3c,
-    0x6b, 0x9b, 0x1a, 0x7e, 0x95, 0x3f, 0x49, 0xc1, 0x01, 0x92, 0x60, 0x38, 0x50, 0x6f, 0x75, 0x41,
-    0xf0, 0x52, 0x37, 0xd8, 0x27, 0xed, 0xb8, 0x08, 0xbb, 0xae, 0x39, 0x1a, 0x1f, 0x6f, 0x06, 0x70,
-    0x72, 0x7c, 0xfd, 0xd7, 0x80, 0x46, 0x7d, 0x96, 0xdd, 0xdb, 0x20, 0x3f, 0x4d, 0x2b, 0x24, 0x1f,
-    0x13, 0x19, 0x12, 0x75, 0xa4, 0x12, 0x40, 0x48, 0xb2, 0x02, 0xe5, 0x15, 0x94, 0xba, 0xbc, 0xb5,
-    0x92, 0x81, 0x9a, 0x70, 0xd3, 0xd4, 0x1a, 0xe3, 0xf1, 0x1d, 0xb7, 0xe0, 0x18, 0xb6, 0x4f, 0xe0,
-    0x2d, 0x22, 0x55, 0x68, 0xfa, 0x9c, 0x4f, 0x61, 0x17, 0x87, 0xc9, 0xdb, 0xa0, 0xfb, 0x4a, 0x09,
-    0x56, 0x7e, 0x4d, 0x45, 0x3b, 0xfa, 0x37, 0x90, 0x16, 0x62, 0x60, 0x0f, 0x79, 0xa9, 0x65, 0x6b,
-    0x12, 0xfd, 0x74, 0x54, 0x2d, 0x8c, 0x87, 0xb2, 0x17, 0xba, 0x46, 0x24, 0xe7, 0x23, 0xb1, 0x88,
-    0x4d, 0x16, 0x08, 0xda, 0xac, 0x68, 0x24, 0x8d, 0x9f, 0x5a, 0xaa, 0x86, 0xa2, 0x2e, 0xf0, 0xfc,
-    0x49, 0x2e, 0xf0, 0xc2, 0x40, 0xa0, 0x75, 0x05, 0x69, 0xe7, 0x7b, 0x53, 0x2a, 0xea, 0xba, 0xb6,
-    0x98, 0xe4, 0xd4, 0x12, 0x7b, 0x68, 0xed, 0xe2, 0x70, 0x87, 0x80, 0xb7, 0xf2, 0xd6, 0x49, 0x40,
-    0xc4, 0x8f, 0x45, 0x01, 0x3c, 0xad, 0x75, 0x8a, 0x21, 0x20, 0x1b, 0xab, 0xf4, 0x37, 0x71, 0x37,
-    0xb9, 0xe4, 0x24, 0x59, 0x6d, 0x51, 0x3c, 0x92, 0x45, 0xf1, 0x64, 0x34, 0xf5, 0x7d, 0x9a, 0x2a,
-    0xdb, 0x9a, 0x4d, 0x55, 0xa6, 0x4d, 0xb5, 0x45, 0x01, 0xbc, 0xa3, 0xf8, 0xa2, 0x8e, 0x69, 0x62,
-    0xd7, 0x36, 0xdb, 0x2f, 0xb2, 0xf1, 0xb8, 0xea, 0x94, 0x9c, 0xc8, 0xb7, 0x1f, 0x95, 0x13, 0x30,
-    0xa6, 0xf3, 0x72, 0x52, 0x6e, 0xd5, 0x66, 0x8f, 0x0a, 0x56, 0xf5, 0x9c, 0x58, 0x3c, 0xce, 0xab,
-    0x28, 0x16, 0xf9, 0x76, 0x8a, 0x05, 0x8c, 0x89, 0x62, 0x29, 0xb7, 0x8a, 0x62, 0x15, 0xec, 0x59,
-    0x1f, 0xac, 0xc3, 0x4d, 0xa9, 0x38, 0xa3, 0x25, 0xf2, 0xed, 0xef, 0xff, 0x72, 0x10, 0xe3, 0x1b,
-    0xc0, 0x22, 0xb7, 0xf2, 0xb5, 0x37, 0x05, 0x6c, 0x1d, 0xc1, 0xf6, 0x33, 0x94, 0x3c, 0xbb, 0x9a,
-    0x5c, 0xdb, 0x69, 0x4a, 0x91, 0xb9, 0x96, 0x58, 0x65, 0x2f, 0x6a, 0x13, 0x63, 0x58, 0x9a, 0x70,
-    0xe2, 0xa7, 0xe9, 0x64, 0x99, 0xc8, 0xf5, 0xd5, 0x69, 0x68, 0x3a, 0x63, 0x26, 0xa3, 0xda, 0x69,
-    0x2a, 0x89, 0x9f, 0x26, 0x5a, 0x44, 0xae, 0xaf, 0x4e, 0x30, 0x13, 0x2d, 0x32, 0xaa, 0xed, 0x27,
-    0xc9, 0xc1, 0x8f, 0xa4, 0x49, 0xbc, 0x2f, 0x7e, 0x9a, 0x5e, 0x20, 0xe6, 0x99, 0xbe, 0x3a, 0x21,
-    0x8c, 0x2f, 0x11, 0x4b, 0x98, 0x76, 0xe1, 0x6a, 0xfe, 0xcb, 0x46, 0x08, 0x3d, 0x0c, 0x28, 0x31,
-    0xba, 0x95, 0x0c, 0xba, 0x6b, 0x6a, 0x60, 0xd7, 0xe7, 0xe3, 0x34, 0xa9, 0x3d, 0x21, 0xb5, 0x27,
-    0xa4, 0xf6, 0x84, 0xd4, 0x9e, 0x90, 0xda, 0x13, 0xe2, 0x71, 0xa6, 0x94, 0xbc, 0x1e, 0xae, 0x7e,
-    0x28, 0x43, 0x3e, 0x97, 0xa7, 0x1c, 0xe3, 0x7b, 0x3c, 0xd7, 0x87, 0x78, 0x5c, 0x6b, 0x3e, 0xcb,
-    0xc7, 0x31, 0xb4, 0xf7, 0x1e, 0xbe, 0x10, 0x6a, 0xeb, 0x94, 0x3d, 0x3b, 0xc4, 0xdc, 0x21, 0xfb,
-    0x93, 0x52, 0x2f, 0xf8, 0xe4, 0x31, 0x53, 0x5b, 0xed, 0xd8, 0xb9, 0xc2, 0xae, 0x7b, 0x9d, 0x7f,
-    0xf8, 0xd4, 0xff, 0xfa, 0xcf, 0x06, 0x12, 0xbc, 0x47, 0x65, 0x9b, 0x12, 0x96, 0xd1, 0xb0, 0xca,
-    0x0d, 0x63, 0xb6, 0xfa, 0xe4, 0x53, 0x38, 0xdb, 0x1e, 0x05, 0xd4, 0x0c, 0xda, 0x87, 0xb4, 0xf9,
-    0x0e, 0x6b, 0xaf, 0x1d, 0xd0, 0xd6, 0x3a, 0x94, 0xb9, 0x74, 0x50, 0x5b, 0x67, 0x9f, 0xa6, 0x4a,
-    0x25, 0x9b, 0x6c, 0x67, 0x69, 0x54, 0x1b, 0x1a, 0x5b, 0x19, 0x0a, 0xfb, 0x38, 0xda, 0x27, 0x8d,
-    0xde, 0x76, 0x1a, 0x7b, 0xd5, 0xd0, 0x6c, 0xac, 0x74, 0x13, 0x98, 0x8f, 0x1f, 0x7e, 0xf9, 0xd8,
-    0xff, 0xe5, 0xdd, 0x6f, 0xbf, 0xbd, 0x43, 0x1a, 0x42, 0xb7, 0x73, 0x1a, 0x98, 0xe3, 0x04, 0xc2,
-    0x0c, 0x07, 0x2d, 0x9b, 0xce, 0x72, 0xd0, 0x84, 0xcb, 0xf2, 0x9d, 0xce, 0x76, 0x7e, 0x51, 0x1f,
-    0x2b, 0x89, 0x2c, 0x71, 0x25, 0xcb, 0x6f, 0xd6, 0x51, 0x34, 0x53, 0xa8, 0xca, 0x1b, 0x2a, 0x3a,
-    0x22, 0x60, 0x05, 0x19, 0x35, 0x69, 0xf8, 0x65, 0x69, 0x87, 0x89, 0x8b, 0x44, 0x13, 0x03, 0x87,
-    0xe3, 0xf7, 0x14, 0x49, 0xe8, 0x86, 0xf2, 0xe1, 0xce, 0xab, 0x8b, 0x8b, 0xc8, 0xc1, 0x1b, 0x9f,
-    0x2d, 0x7c, 0x19, 0x83, 0x6e, 0x82, 0x72, 0x75, 0x1a, 0xfa, 0x92, 0x9d, 0x09, 0x8a, 0x24, 0x76,
-    0x21, 0xd5, 0x39, 0xbc, 0xab, 0xbd, 0x6e, 0xbb, 0xfb, 0x36, 0x20, 0x42, 0xbc, 0x29, 0xa8, 0x70,
-    0x2b, 0xc8, 0x20, 0x75, 0x43, 0xcd, 0x62, 0xe4, 0x03, 0xb1, 0xbf, 0x40, 0x91, 0x85, 0x77, 0x12,
-    0xb9, 0xf8, 0x64, 0xa2, 0xc9, 0xaf, 0x0c, 0x5e, 0xe5, 0x76, 0x5c, 0xee, 0x10, 0x52, 0xd7, 0x30,
-    0xc2, 0x1f, 0x9e, 0xbc, 0x1e, 0x28, 0xba, 0x0f, 0xf6, 0x69, 0x4b, 0x67, 0x19, 0x81, 0xb4, 0x96,
-    0x8c, 0xc0, 0x87, 0x94, 0xa6, 0x92, 0xb2, 0xe1, 0xc1, 0x45, 0x4f, 0x5d, 0xf1, 0x9e, 0xb4, 0xcf,
-    0xbb, 0x76, 0x6b, 0xff, 0x99, 0xdd, 0xda, 0xe6, 0xe4, 0x7e, 0x86, 0x06, 0x48, 0xd6, 0x74, 0x4e,
-    0x4c, 0xea, 0xcf, 0x49, 0xed, 0xf2, 0xae, 0x5d, 0xde, 0xb5, 0xcb, 0xbb, 0x76, 0x79, 0xd7, 0x2e,
-    0xef, 0xda, 0xe5, 0xfd, 0x74, 0x5d, 0xde, 0xd4, 0x1d, 0xb2, 0x80, 0xcb, 0x28, 0x11, 0xcf, 0xc3,
-    0x57, 0x85, 0x45, 0xd1, 0xda, 0xef, 0x5d, 0xfb, 0xbd, 0x1f, 0xd5, 0xef, 0xcd, 0x4d, 0xc0, 0xda,
-    0xc9, 0x5d, 0x3b, 0xb9, 0x1f, 0xc3, 0xc9, 0xfd, 0xa7, 0xf5, 0x6c, 0xa3, 0x4e, 0xb3, 0x38, 0xb7,
-    0x3b, 0x68, 0x91, 0xd1, 0xb3, 0xa8, 0x69, 0x24, 0x9c, 0xdf, 0x27, 0x5b, 0x38, 0xbf, 0x7d, 0xb2,
-    0x0a, 0xd9, 0x7c, 0xe0, 0x52, 0x12, 0x44, 0x78, 0xe0, 0xdf, 0x67, 0xef, 0xbf, 0x7c, 0x86, 0x7b,
-    0x5a, 0xf7, 0x71, 0x92, 0x1b, 0xf2, 0x48, 0x53, 0x1e, 0xce, 0x8b, 0xfe, 0x90, 0xf6, 0x62, 0xed,
-    0x2e, 0xaf, 0xdd, 0xe5, 0xb5, 0xbb, 0xfc, 0xf0, 0xee, 0x72, 0x9b, 0xf7, 0x1a, 0x94, 0x0e, 0xe6,
-    0xe9, 0xbe, 0x89, 0x22, 0x90, 0x48, 0x44, 0xe9, 0xc0, 0x6e, 0x73, 0x2c, 0x49, 0x22, 0x21, 0x34,
-    0x43, 0xeb, 0xd9, 0xe1, 0xad, 0x4e, 0x0e, 0x63, 0xb4, 0x3e, 0xc3, 0x7f, 0xff, 0x13, 0xc4, 0xf3,
-    0x14, 0x61, 0x9d, 0x62, 0xbd, 0xd6, 0xe2, 0xed, 0xdf, 0x6c, 0xb7, 0x60, 0xd7, 0x9d, 0x01, 0x83,
-    0xb2, 0x57, 0x3b, 0xfa, 0x6b, 0x47, 0x3f, 0x75, 0xf4, 0xff, 0x3f, 0xe9, 0x2d, 0xb6, 0x55};
+    0x78, 0xda, 0xed, 0x3d, 0xfd, 0x6f, 0xe3, 0x36, 0xb2, 0xf7, 0x73, 0xfe, 0x0a, 0x17, 0x05, 0x0e,
+    0x96, 0x2c, 0x5b, 0xb6, 0x93, 0xec, 0x97, 0x4e, 0xaf, 0x58, 0x6c, 0xb7, 0x7d, 0x01, 0xda, 0xdd,
+    0xc5, 0xa6, 0xbd, 0x77, 0xb8, 0x62, 0x61, 0x48, 0xb6, 0xe2, 0xe8, 0xd5, 0xb1, 0xfc, 0x6c, 0x25,
+    0xb1, 0x73, 0xc8, 0xff, 0xfe, 0x38, 0xfc, 0x26, 0x45, 0xca, 0xb2, 0x1d, 0x3b, 0x1f, 0x15, 0x8a,
+    0x6e, 0x2c, 0x72, 0x38, 0x1c, 0x92, 0xc3, 0xe1, 0xcc, 0x90, 0x1c, 0x7e, 0x9f, 0x5e, 0x8c, 0x92,
+    0x8b, 0xc6, 0xcf, 0xbf, 0x0c, 0x3e, 0x9e, 0x1f, 0xcd, 0xe6, 0xc9, 0x30, 0x5d, 0xa4, 0xd9, 0xb4,
+    0x71, 0x99, 0x8e, 0x2f, 0x67, 0x8d, 0x8b, 0x49, 0x16, 0xe5, 0xc1, 0xd1, 0xf7, 0xc9, 0x64, 0x91,
+    0x1c, 0x7d, 0x9f, 0x5e, 0x34, 0xbe, 0x43, 0xb0, 0xe9, 0x34, 0x19, 0x35, 0x27, 0xd9, 0xed, 0xcc,
+    0x39, 0xfa, 0x9e, 0x7c, 0x36, 0xe0, 0x0b, 0x41, 0x4d, 0x47, 0xe9, 0x85, 0x0a, 0x76, 0x95, 0x8c,
+    0xd2, 0xeb, 0x2b, 0x09, 0x92, 0x26, 0x18, 0x81, 0x71, 0x9d, 0x02, 0x14, 0x7f, 0x72, 0x40, 0xf2,
+    0xe7, 0x26, 0x19, 0xf6, 0x1b, 0xd7, 0xd3, 0x59, 0x34, 0xfc, 0x73, 0x80, 0x89, 0x6b, 0x0e, 0xb3,
+    0xe9, 0x22, 0x27, 0x84, 0x36, 0x20, 0x39, 0x19, 0xfd, 0x33, 0x9a, 0x5c, 0x27, 0x4e, 0xe3, 0x3f,
+    0xe9, 0x94, 0xa5, 0x9c, 0x4d, 0x73, 0x9c, 0x18, 0xa2, 0xa4, 0xa6, 0x0c, 0x14, 0x00, 0xcc, 0x4d,
+    0x37, 0x54, 0xc1, 0xfc, 0xfe, 0xe9, 0xab, 0x60, 0x9e, 0xe4, 0xd7, 0xf3, 0x69, 0x03, 0x2a, 0x6c,
+    0xde, 0x74, 0x3d, 0x15, 0xa2, 0x7d, 0xd3, 0x75, 0x11, 0x90, 0x13, 0xdc, 0xcb, 0x04, 0x65, 0xe8,
+    0xdf, 0x34, 0x5f, 0x19, 0x48, 0xfa, 0x4c, 0x72, 0x28, 0x51, 0xe8, 0x7f, 0x9a, 0x20, 0x11, 0xc4,
+    0x40, 0xfc, 0xbe, 0x52, 0x35, 0x69, 0xa4, 0x28, 0xe1, 0xf8, 0xbd, 0xfe, 0xeb, 0x4e, 0xd7, 0xbb,
+    0xca, 0x46, 0x6a, 0x41, 0xaf, 0xdf, 0xe9, 0x3a, 0x84, 0xa0, 0x93, 0xc6, 0x28, 0x19, 0x66, 0xa3,
+    0x64, 0x30, 0xcc, 0x26, 0xd9, 0x9c, 0x92, 0x83, 0x09, 0x4d, 0xa6, 0x90, 0x3e, 0xfa, 0x00, 0xe9,
+    0x88, 0x18, 0x51, 0xd1, 0x49, 0x53, 0xe9, 0x54, 0x19, 0xee, 0x8f, 0xee, 0x37, 0x44, 0xd4, 0xe9,
+    0x29, 0xaa, 0xd4, 0x0e, 0xd3, 0x63, 0x30, 0x47, 0x88, 0x04, 0xd2, 0x72, 0x0a, 0x7c, 0x95, 0x2e,
+    0x07, 0xb8, 0x25, 0x12, 0x19, 0xd2, 0x10, 0x78, 0x72, 0x67, 0xe5, 0x82, 0x26, 0x54, 0x4c, 0x1e,
+    0x29, 0x44, 0x84, 0x27, 0x7f, 0xf6, 0xbe, 0x79, 0x39, 0x6b, 0xac, 0x54, 0x91, 0xd6, 0xe0, 0x13,
+    0x5a, 0x13, 0xa6, 0x71, 0x51, 0xa8, 0x0a, 0x43, 0x5c, 0xa5, 0x53, 0x9c, 0x1d, 0x2a, 0x7d, 0x86,
+    0x29, 0x96, 0x0b, 0x0b, 0x02, 0xe8, 0x37, 0x6a, 0xb1, 0x13, 0x10, 0x0c, 0xd1, 0xb2, 0x12, 0x86,
+    0xbe, 0x86, 0xe1, 0x18, 0x30, 0x48, 0xcd, 0x65, 0x94, 0x78, 0x0c, 0x21, 0x6b, 0x62, 0xbf, 0x31,
+    0x4e, 0xf2, 0xc1, 0x2c, 0xca, 0xf3, 0x64, 0x3e, 0x1d, 0xcc, 0xb2, 0x85, 0xd2, 0x97, 0xe9, 0x32,
+    0x99, 0xa0, 0x3a, 0xb3, 0xf9, 0x68, 0x70, 0x3d, 0x9b, 0x25, 0x73, 0xcf, 0x92, 0x89, 0xe6, 0xa8,
+    0x96, 0x49, 0x11, 0x2e, 0xd2, 0x3b, 0x6d, 0x18, 0xd2, 0x49, 0x32, 0xb8, 0x9e, 0xa6, 0xf9, 0x62,
+    0x90, 0x67, 0x03, 0x8c, 0x63, 0xa1, 0x14, 0xcc, 0x16, 0xa4, 0xf7, 0xfa, 0x8d, 0xec, 0xe2, 0x62,
+    0x91, 0xe4, 0x21, 0x70, 0x23, 0xfb, 0xbf, 0x48, 0x90, 0x5c, 0x91, 0x03, 0xf3, 0xa6, 0xd3, 0x35,
+    0xa5, 0xb5, 0x8a, 0xd4, 0x2a, 0x50, 0xac, 0xaf, 0x9a, 0x26, 0xfa, 0x5c, 0x44, 0x54, 0x8b, 0x50,
+    0xe3, 0xf8, 0x72, 0xb1, 0xe0, 0xfe, 0xe8, 0x6f, 0xdf, 0x9b, 0x65, 0x1c, 0x95, 0x45, 0x4f, 0x4f,
+    0xca, 0xfd, 0x0d, 0xd1, 0x3f, 0x4f, 0xe3, 0xeb, 0x3c, 0x21, 0x1d, 0x1e, 0xc1, 0xa0, 0x07, 0xa8,
+    0xc5, 0x17, 0xd9, 0xfc, 0x0a, 0xf1, 0x5b, 0x8e, 0x98, 0x7e, 0x80, 0xfe, 0xcc, 0xd3, 0x65, 0x70,
+    0x93, 0xa5, 0x23, 0x94, 0x94, 0x4e, 0x9b, 0x68, 0x4c, 0xc6, 0x93, 0xc1, 0x97, 0x6c, 0x91, 0xe6,
+    0xa8, 0x75, 0x21, 0x83, 0x70, 0xf1, 0xf4, 0xc6, 0x28, 0xbc, 0xae, 0xd7, 0x73, 0xa0, 0x43, 0x18,
+    0x2a, 0x32, 0x7f, 0x08, 0xc7, 0x72, 0xfc, 0x74, 0xfa, 0x32, 0x71, 0x56, 0xa8, 0xe1, 0xa7, 0x79,
+    0x34, 0x26, 0x0c, 0x4f, 0x4b, 0xba, 0x02, 0xf6, 0x88, 0x76, 0xf5, 0xe7, 0x7f, 0x7e, 0xfc, 0xfa,
+    0xe3, 0xd7, 0xf7, 0xff, 0x33, 0x38, 0xfb, 0x74, 0xfe, 0xe5, 0xe3, 0x87, 0xdf, 0x3e, 0x7f, 0x3d,
+    0x52, 0x4a, 0x62, 0x9a, 0x7a, 0x48, 0x62, 0x05, 0xac, 0xcd, 0x12, 0x55, 0x6a, 0x03, 0x25, 0x5a,
+    0x91, 0xa4, 0x1d, 0xc8, 0x63, 0x3b, 0x88, 0x4a, 0x73, 0xe3, 0x42, 0xae, 0xce, 0x9a, 0x65, 0x00,
+    0x98, 0x03, 0x0b, 0x9d, 0xb2, 0x18, 0x46, 0x13, 0xb9, 0x5e, 0x35, 0x3d, 0x2e, 0xa4, 0x9b, 0x78,
+    0x35, 0x30, 0x0e, 0xef, 0x4d, 0x34, 0x5f, 0xa5, 0xd3, 0x31, 0x49, 0xba, 0x81, 0x24, 0x54, 0x8d,
+    0x21, 0x31, 0xde, 0x62, 0xc8, 0x29, 0xba, 0x50, 0x97, 0x23, 0x86, 0x2e, 0xf1, 0x0c, 0xbd, 0xe0,
+    0xf1, 0x76, 0xbb, 0xfa, 0x00, 0x78, 0xe6, 0x26, 0x7a, 0xb8, 0x72, 0x56, 0x71, 0xbc, 0x73, 0xc5,
+    0xb1, 0x5e, 0x71, 0xbc, 0xa6, 0x62, 0x95, 0xc9, 0x65, 0xd6, 0xc8, 0x27, 0x76, 0xb6, 0x89, 0xe7,
+    0xf6, 0x3c, 0x54, 0x2e, 0x2e, 0x29, 0x57, 0xc8, 0xcb, 0x93, 0x25, 0x96, 0x3f, 0x3a, 0x47, 0x5c,
+    0x49, 0x3c, 0xad, 0x4f, 0x35, 0x96, 0xbe, 0x88, 0xae, 0x66, 0x93, 0x64, 0xde, 0xff, 0x11, 0xe5,
+    0xa5, 0x57, 0xd1, 0x38, 0xd9, 0x96, 0x3b, 0x70, 0x0e, 0xc6, 0x80, 0x7b, 0x15, 0x0b, 0x6a, 0x5a,
+    0xda, 0xc3, 0xd3, 0x8f, 0x09, 0xf4, 0x10, 0x56, 0x20, 0xb5, 0x93, 0x7c, 0xde, 0x06, 0x4f, 0xed,
+    0x21, 0x29, 0x43, 0xa0, 0xa6, 0x8b, 0x21, 0x16, 0x08, 0xbd, 0x10, 0xe5, 0x23, 0x59, 0x9d, 0xf4,
+    0x7f, 0x6c, 0xd2, 0x06, 0x78, 0x84, 0x1d, 0x54, 0x72, 0x10, 0x63, 0x08, 0x82, 0x62, 0x95, 0xa0,
+    0x7e, 0x91, 0xa2, 0xd8, 0x46, 0x51, 0x6c, 0xa4, 0x68, 0x10, 0xcb, 0x34, 0xf5, 0xcd, 0x34, 0xf5,
+    0x9d, 0x40, 0x11, 0x4c, 0x50, 0x29, 0x69, 0x83, 0x47, 0x8a, 0x79, 0x78, 0xc4, 0x9c, 0xc3, 0xc8,
+    0xb8, 0x38, 0xcb, 0x26, 0x5c, 0x98, 0xdc, 0xa6, 0xf9, 0x25, 0x02, 0x98, 0xe9, 0xb9, 0xb3, 0x34,
+    0x1f, 0x5e, 0x16, 0x73, 0x29, 0xdb, 0xa1, 0x46, 0xce, 0xaf, 0x91, 0x16, 0x82, 0x71, 0xf0, 0x4c,
+    0x58, 0xba, 0x38, 0xb7, 0x8d, 0x92, 0x9b, 0x74, 0x98, 0xd0, 0xd9, 0x36, 0x8f, 0x90, 0xe8, 0xe0,
+    0x70, 0x92, 0xda, 0x0f, 0xeb, 0x42, 0x74, 0x95, 0xcc, 0x23, 0x98, 0x5c, 0xc3, 0x64, 0x8a, 0x3a,
+    0x7b, 0x30, 0x4a, 0x17, 0x79, 0x34, 0x1d, 0x26, 0x6b, 0x25, 0xd8, 0x31, 0x62, 0xc7, 0x51, 0x94,
+    0x47, 0xb8, 0xb3, 0xa6, 0xd0, 0x5b, 0xff, 0xfd, 0xfe, 0x7c, 0xf0, 0xfb, 0xa7, 0xb3, 0x9f, 0x3e,
+    0x7f, 0xfd, 0x75, 0x40, 0xd7, 0x8d, 0x23, 0x23, 0x75, 0x38, 0x6b, 0x90, 0x4b, 0x55, 0x10, 0xa2,
+    0xf0, 0x50, 0x46, 0x74, 0xad, 0x62, 0x55, 0x49, 0x59, 0x24, 0x83, 0xae, 0xe2, 0x6a, 0x7b, 0x94,
+    0x65, 0x4e, 0x5a, 0x94, 0x0d, 0x84, 0xcd, 0x23, 0xb4, 0x72, 0x2f, 0xcc, 0x94, 0x91, 0x3c, 0x85,
+    0x34, 0xa6, 0x42, 0xd0, 0x5e, 0x20, 0x10, 0x9c, 0x3a, 0x45, 0xc1, 0x68, 0xd0, 0x4c, 0x8d, 0x42,
+    0x15, 0x86, 0x55, 0xb2, 0x86, 0xca, 0x78, 0x72, 0x6d, 0xe9, 0x3d, 0xc8, 0x51, 0x28, 0xc4, 0xb9,
+    0x94, 0x3c, 0xc8, 0xe4, 0xc4, 0x49, 0xc5, 0x70, 0xba, 0x46, 0x57, 0x01, 0xeb, 0x1a, 0x92, 0xe8,
+    0xec, 0x30, 0x97, 0xa7, 0x99, 0x56, 0xc2, 0xb8, 0xaa, 0x51, 0xa4, 0x4d, 0xcc, 0x3a, 0x3b, 0x79,
+    0x12, 0x4c, 0x09, 0x85, 0x8b, 0x7c, 0x9e, 0xfd, 0x99, 0x94, 0xb1, 0x9e, 0x0c, 0x61, 0xe7, 0x40,
+    0x19, 0xca, 0xc4, 0x88, 0x4a, 0x7e, 0x19, 0x3f, 0xea, 0x80, 0xeb, 0x69, 0xbf, 0x4d, 0x47, 0xf9,
+    0x65, 0x29, 0xed, 0x18, 0xa2, 0x8c, 0x45, 0x65, 0x38, 0x0b, 0xa3, 0x2a, 0x20, 0x6b, 0xd8, 0x55,
+    0x87, 0x5d, 0xdf, 0x86, 0x52, 0x46, 0x51, 0x61, 0xac, 0xfc, 0xa2, 0x82, 0x99, 0xd8, 0x46, 0x83,
+    0x28, 0xe3, 0x9e, 0x22, 0x28, 0x71, 0x35, 0xf0, 0x75, 0x14, 0x7e, 0xa1, 0xb5, 0xb4, 0x54, 0x94,
+    0x0d, 0x89, 0x42, 0xac, 0x9b, 0xa2, 0x54, 0x5e, 0x79, 0x5c, 0xac, 0x39, 0x8c, 0x14, 0x5d, 0x72,
+    0x85, 0x1b, 0xc9, 0x27, 0xf2, 0x27, 0xd4, 0x6d, 0x6c, 0x26, 0x81, 0x3c, 0x21, 0xac, 0x78, 0x85,
+    0x26, 0x61, 0x14, 0x6e, 0x22, 0x6f, 0xe0, 0x1f, 0x43, 0x8d, 0x90, 0xec, 0x31, 0xc1, 0xc3, 0x6b,
+    0xd3, 0xa4, 0x4b, 0xb8, 0x91, 0x0c, 0xa1, 0x7f, 0x0d, 0x95, 0xd1, 0x1c, 0x4f, 0x12, 0x29, 0xa6,
+    0x2a, 0x39, 0x82, 0x6d, 0x44, 0x83, 0xfc, 0x61, 0x1a, 0x51, 0x39, 0xdf, 0xd3, 0x85, 0x86, 0x69,
+    0x7c, 0x55, 0x84, 0x5b, 0x4f, 0x7b, 0xf9, 0xc3, 0xd0, 0x35, 0x72, 0xb6, 0xa7, 0xcb, 0x03, 0x0b,
+    0x17, 0xa8, 0x28, 0x77, 0x98, 0xcc, 0xea, 0xa7, 0x9d, 0x3a, 0x31, 0x7e, 0xfa, 0x4c, 0x37, 0x0d,
+    0xa3, 0x8e, 0xd5, 0x3a, 0x55, 0xb1, 0x6f, 0x8b, 0x28, 0x3e, 0x21, 0xae, 0x10, 0xd4, 0x4a, 0x62,
+    0xff, 0x80, 0x5b, 0xcc, 0x45, 0xff, 0xb4, 0x85, 0x76, 0x39, 0x4c, 0xe7, 0x43, 0xa4, 0x5f, 0x11,
+    0x9d, 0x26, 0x44, 0x55, 0xe1, 0x61, 0x45, 0xc0, 0x6e, 0xb7, 0x73, 0xea, 0x04, 0xc8, 0x58, 0x6f,
+    0xea, 0x5a, 0x16, 0x53, 0xa5, 0x87, 0xd9, 0x7c, 0x8a, 0xf4, 0xa0, 0x19, 0xb3, 0xb8, 0x14, 0x54,
+    0xb4, 0xa4, 0xaa, 0xbd, 0xa1, 0x92, 0x5a, 0xa1, 0x56, 0x48, 0x49, 0x75, 0x9b, 0x64, 0xf2, 0xb5,
+    0xe4, 0x7e, 0x07, 0x4d, 0x53, 0xd5, 0xe1, 0xee, 0x1b, 0xd0, 0x2f, 0xd4, 0x5d, 0x35, 0x9b, 0x67,
+    0xff, 0x9b, 0x0c, 0xf3, 0x64, 0xc4, 0xc8, 0x57, 0x6d, 0x3e, 0x85, 0x1e, 0x62, 0xfb, 0xed, 0x56,
+    0xbb, 0xdb, 0xd4, 0x6b, 0xec, 0xdc, 0xfa, 0x25, 0x9a, 0x21, 0xb2, 0xbc, 0xec, 0x16, 0xa9, 0x46,
+    0x0a, 0x75, 0x47, 0xd0, 0xe6, 0x95, 0x14, 0x2b, 0x36, 0xca, 0xd2, 0xd3, 0x12, 0x8e, 0xce, 0x72,
+    0xb5, 0x69, 0x53, 0xcb, 0x14, 0x5e, 0x03, 0x95, 0x5b, 0xd4, 0x20, 0x97, 0xbe, 0x0d, 0xee, 0xef,
+    0x25, 0x5e, 0x8f, 0xa6, 0x79, 0x1a, 0x4d, 0xd2, 0x68, 0x81, 0xc5, 0x25, 0x62, 0x56, 0xdf, 0xa4,
+    0xa8, 0xfb, 0xc6, 0x7a, 0x02, 0xa2, 0x6c, 0x03, 0xeb, 0x1f, 0x37, 0x69, 0x8d, 0x9d, 0xa5, 0xc7,
+    0x7e, 0xad, 0x3c, 0x05, 0x39, 0x36, 0x8e, 0x37, 0xd6, 0xd5, 0xf7, 0xad, 0x71, 0x1f, 0x46, 0x67,
+    0xde, 0xb3, 0xf2, 0x7b, 0x38, 0xfd, 0xf5, 0x31, 0xf4, 0xce, 0xc7, 0xd4, 0x16, 0xf7, 0xac, 0xe2,
+    0x51, 0xf5, 0xce, 0xc6, 0xfc, 0x55, 0x94, 0x35, 0x2b, 0x67, 0x57, 0x56, 0xbc, 0x2c, 0x3c, 0xbb,
+    0x5e, 0x95, 0xb2, 0x33, 0x64, 0x55, 0x9d, 0x68, 0x0d, 0xb7, 0x6d, 0xae, 0xcc, 0xac, 0x61, 0xa5,
+    0xad, 0xd4, 0x90, 0xb5, 0x4c, 0xb2, 0xb3, 0xea, 0x80, 0xe5, 0x20, 0x92, 0xeb, 0x01, 0x41, 0xc2,
+    0x84, 0xf7, 0x24, 0x99, 0x8e, 0x11, 0x65, 0xe4, 0x0f, 0x13, 0xb0, 0x4e, 0x60, 0x95, 0xde, 0x14,
+    0xcf, 0x5d, 0xa0, 0x65, 0xa2, 0x35, 0x14, 0xe7, 0xb7, 0xaf, 0xa2, 0x65, 0x13, 0xeb, 0xcd, 0x9a,
+    0x60, 0x56, 0x46, 0x6a, 0x90, 0x87, 0x8b, 0xab, 0x2c, 0xcb, 0x2f, 0x17, 0x79, 0x32, 0x6b, 0x76,
+    0x3b, 0x5d, 0x4f, 0x47, 0xe4, 0xa9, 0x04, 0x12, 0x15, 0x87, 0xe0, 0xa0, 0xea, 0x68, 0x28, 0xf7,
+    0x65, 0xe3, 0x1f, 0x0d, 0x84, 0xa5, 0xd7, 0xf8, 0x01, 0xfe, 0x34, 0xde, 0x35, 0x24, 0xec, 0x05,
+    0xcc, 0x50, 0x9d, 0x86, 0x9d, 0x30, 0xac, 0x79, 0x05, 0xd2, 0xbc, 0x68, 0xbc, 0x05, 0x2e, 0xf7,
+    0xa7, 0xb9, 0x4c, 0xf5, 0x93, 0x39, 0xc6, 0xd5, 0xd4, 0x42, 0x49, 0x89, 0xde, 0xc1, 0xc7, 0xb6,
+    0xef, 0xdd, 0x13, 0xfb, 0x86, 0x88, 0x20, 0x67, 0xad, 0xab, 0x8f, 0x89, 0x26, 0xb3, 0xbf, 0xce,
+    0xe6, 0x18, 0x66, 0xe9, 0x29, 0xd2, 0x4e, 0xa6, 0x0b, 0xc8, 0xa9, 0xb2, 0x97, 0x40, 0xeb, 0xb0,
+    0x2d, 0xf0, 0xb7, 0x09, 0x9a, 0xde, 0xb9, 0x59, 0x72, 0x92, 0x3c, 0xb3, 0x33, 0x04, 0x6a, 0x23,
+    0xf9, 0x9a, 0x1b, 0x84, 0x14, 0xa6, 0x59, 0xc6, 0x95, 0x48, 0x45, 0x7f, 0x08, 0x9f, 0xdc, 0x66,
+    0x2a, 0x04, 0xd9, 0xed, 0x94, 0x69, 0xfd, 0xf7, 0xc7, 0xaf, 0x9f, 0xb1, 0x5a, 0x86, 0xb7, 0xb9,
+    0xfd, 0xde, 0xab, 0x4e, 0x37, 0xe0, 0x9b, 0x78, 0x3f, 0xbf, 0xff, 0xfd, 0xfc, 0x7c, 0xf0, 0xe1,
+    0xf3, 0xc7, 0x9f, 0xd0, 0xd4, 0x3a, 0x7e, 0xfb, 0xe6, 0xed, 0x49, 0xbf, 0xff, 0xa6, 0x7b, 0xd2,
+    0xed, 0x9d, 0x1c, 0xf7, 0x5f, 0x57, 0xf6, 0x24, 0xd0, 0x71, 0x20, 0x7f, 0x0c, 0x36, 0x14, 0xc9,
+    0xf0, 0xc4, 0xa0, 0x68, 0xc6, 0xa6, 0xdc, 0xed, 0xe1, 0x66, 0x7d, 0x6b, 0x5e, 0xa3, 0x1e, 0xdc,
+    0xbb, 0x40, 0x4f, 0x4b, 0x60, 0x5e, 0x1f, 0x0d, 0x2a, 0x59, 0x6c, 0x04, 0xe1, 0x79, 0xb8, 0xf8,
+    0xbf, 0x79, 0xde, 0x6c, 0xa3, 0x64, 0x77, 0x92, 0x8d, 0x9b, 0x30, 0x1a, 0x3e, 0x69, 0xa0, 0x2f,
+    0xcd, 0x06, 0x5f, 0x0c, 0x84, 0xe3, 0xf8, 0xc7, 0x68, 0x88, 0x38, 0xf3, 0x87, 0xe7, 0xae, 0x5e,
+    0x71, 0xa0, 0x09, 0x7f, 0xa6, 0xcb, 0x13, 0xa2, 0x0b, 0x76, 0x18, 0xb1, 0xbf, 0xb2, 0x05, 0x99,
+    0xe5, 0xba, 0xd9, 0xd8, 0xa2, 0xc0, 0x44, 0x4a, 0x18, 0x45, 0x09, 0xcc, 0x4c, 0x49, 0x2e, 0xa8,
+    0x33, 0x41, 0xcc, 0xe8, 0xad, 0x26, 0xef, 0x43, 0x4d, 0xc0, 0x0d, 0x19, 0xda, 0xaa, 0x37, 0x51,
+    0xb2, 0xaa, 0x30, 0x26, 0xc9, 0x1d, 0x85, 0x6d, 0xd4, 0x8d, 0x2e, 0x1a, 0x33, 0xfc, 0xff, 0x28,
+    0xcb, 0x9b, 0xbc, 0xed, 0x1e, 0xff, 0xc5, 0xf8, 0xe1, 0x26, 0x9a, 0x84, 0x04, 0x8d, 0x2b, 0x75,
+    0x9d, 0x2b, 0xc8, 0x76, 0x93, 0xe5, 0xac, 0x39, 0xd2, 0x96, 0x25, 0x3c, 0x70, 0xa8, 0x28, 0xec,
+    0x34, 0xb1, 0xff, 0x9d, 0x03, 0xec, 0x59, 0xdf, 0x66, 0xf3, 0xc9, 0xa8, 0xea, 0xae, 0xef, 0x46,
+    0x6b, 0x92, 0x4b, 0x91, 0x4b, 0xdb, 0xbc, 0x9d, 0x65, 0x18, 0x91, 0xbf, 0xf4, 0x7b, 0x05, 0x62,
+    0xab, 0x4d, 0xd2, 0x56, 0x32, 0x03, 0x16, 0x77, 0x19, 0x4d, 0x39, 0x64, 0x4d, 0x9e, 0xa3, 0x14,
+    0xfb, 0x09, 0x81, 0x35, 0x8d, 0xa0, 0xc7, 0x4a, 0x0c, 0x3b, 0x70, 0x18, 0xd8, 0xe9, 0xcc, 0xa5,
+    0x8d, 0x3a, 0x05, 0x4a, 0x54, 0xee, 0x61, 0x29, 0x91, 0x7b, 0x30, 0xd7, 0xb4, 0x61, 0xdd, 0xe9,
+    0x10, 0x42, 0xb7, 0x8a, 0xf2, 0x50, 0x48, 0x8c, 0xa6, 0xc3, 0xcb, 0x6c, 0x6e, 0xce, 0x63, 0x13,
+    0xb6, 0x88, 0x69, 0x12, 0x0d, 0x13, 0x03, 0x1f, 0x2c, 0x2e, 0xd3, 0x8b, 0x3c, 0xa8, 0xc4, 0x49,
+    0xe5, 0xda, 0x82, 0xdd, 0x7d, 0xc1, 0x46, 0x88, 0xce, 0x1e, 0x46, 0x8a, 0x9e, 0x3c, 0xcd, 0xf2,
+    0xdf, 0x17, 0x90, 0xae, 0xed, 0x21, 0x4b, 0x7e, 0xa7, 0x2f, 0x19, 0x9a, 0x6e, 0x05, 0x56, 0x14,
+    0xfd, 0x41, 0x38, 0x51, 0x9e, 0xf7, 0x82, 0x2a, 0x0a, 0xc5, 0xa8, 0x0a, 0x55, 0xa4, 0x9d, 0x5b,
+    0xb5, 0x58, 0x36, 0x99, 0xe0, 0x73, 0x3a, 0x83, 0x59, 0x32, 0x5f, 0xcc, 0x10, 0x5c, 0x7a, 0x93,
+    0x10, 0x2f, 0x48, 0x38, 0x9c, 0x20, 0x8e, 0x40, 0x43, 0x77, 0xda, 0x02, 0x99, 0xd1, 0x2c, 0x69,
+    0xb9, 0x6f, 0xad, 0xdd, 0xc1, 0x3a, 0xee, 0x09, 0x0c, 0xff, 0x5a, 0xc5, 0x8f, 0x89, 0x0a, 0xdd,
+    0xfb, 0xd3, 0xe4, 0xa3, 0xdd, 0xa2, 0xc3, 0xb8, 0xc6, 0xe7, 0xe3, 0x96, 0xb4, 0x2a, 0x60, 0xc3,
+    0x12, 0x32, 0x56, 0xc1, 0x53, 0x98, 0x8e, 0x89, 0x48, 0x5c, 0xc9, 0xfe, 0x9b, 0x6d, 0x06, 0x94,
+    0x5a, 0x25, 0x93, 0xd9, 0x65, 0x14, 0xa2, 0xfe, 0x0b, 0x8c, 0x52, 0x0e, 0x37, 0x9a, 0x35, 0xdc,
+    0xc5, 0xc0, 0xd8, 0xeb, 0xc6, 0xaa, 0x6a, 0xfc, 0x57, 0x03, 0xa6, 0xa2, 0x49, 0x01, 0x96, 0x4a,
+    0xe2, 0xe9, 0x4a, 0x4b, 0xdf, 0x93, 0xe2, 0x94, 0x24, 0x63, 0x79, 0x37, 0xec, 0xf4, 0x82, 0xfb,
+    0x83, 0xcc, 0xc2, 0x27, 0x35, 0xdd, 0xb4, 0x74, 0x6d, 0x1b, 0x59, 0x53, 0x04, 0xcc, 0xc9, 0x4c,
+    0x49, 0xa9, 0x67, 0xae, 0x71, 0xe6, 0xca, 0xf4, 0xcd, 0xa2, 0xd1, 0x08, 0x75, 0xe0, 0xe0, 0x22,
+    0x1a, 0xe6, 0x19, 0xf8, 0x5a, 0xfb, 0x85, 0x89, 0xcd, 0xf9, 0xa7, 0x30, 0x9d, 0xd5, 0xc2, 0xfb,
+    0x98, 0xdd, 0x6c, 0xfc, 0xc3, 0x28, 0x5e, 0x08, 0x01, 0xd3, 0x59, 0x39, 0x92, 0x32, 0x2b, 0xe8,
+    0x53, 0xe9, 0x09, 0x34, 0x7e, 0x08, 0x37, 0xf0, 0x71, 0x97, 0x52, 0x2f, 0xa9, 0x0d, 0x7c, 0xf5,
+    0xbf, 0x41, 0x50, 0xd8, 0x03, 0xcf, 0xea, 0x7e, 0x1a, 0x5c, 0xaf, 0x8b, 0x37, 0x49, 0xb5, 0xd8,
+    0x58, 0xb8, 0x0d, 0xb7, 0x95, 0x6a, 0x43, 0x2a, 0xce, 0xfa, 0xec, 0x38, 0xb4, 0x42, 0xb0, 0xe6,
+    0x51, 0xd2, 0x9a, 0xe3, 0x94, 0xba, 0x9f, 0x84, 0x2e, 0xec, 0x9a, 0x70, 0x06, 0x06, 0x97, 0x5a,
+    0x0f, 0x59, 0xac, 0x46, 0x60, 0xdf, 0x30, 0x8a, 0x8a, 0x05, 0xc7, 0x46, 0xa5, 0xac, 0x2a, 0xc6,
+    0x3f, 0xc0, 0x52, 0xc9, 0x68, 0x9c, 0x60, 0xbe, 0x35, 0xfa, 0x8e, 0x4a, 0x1d, 0x5c, 0x6d, 0x65,
+    0x03, 0x13, 0x7a, 0xba, 0xad, 0x63, 0xb6, 0x7a, 0x99, 0x88, 0xfb, 0xd1, 0xb6, 0x6e, 0x68, 0xac,
+    0x73, 0x7d, 0x13, 0x54, 0x73, 0xcd, 0x40, 0xd7, 0x4c, 0xa2, 0x95, 0x51, 0xb2, 0x22, 0x2c, 0x44,
+    0xcd, 0xf6, 0xdf, 0xf4, 0xde, 0x22, 0xab, 0x34, 0x58, 0xaf, 0xa8, 0x2b, 0xe8, 0x0a, 0x47, 0x71,
+    0x0d, 0xfb, 0x26, 0x26, 0x6d, 0x9c, 0x22, 0x31, 0xb4, 0xa9, 0x28, 0xf9, 0x59, 0x85, 0x45, 0xb5,
+    0x9a, 0xe6, 0x78, 0x50, 0xd0, 0x70, 0x00, 0x8e, 0x12, 0xe0, 0x29, 0x08, 0xd4, 0xaf, 0x4e, 0xe4,
+    0x04, 0x9b, 0xb9, 0xda, 0x9e, 0xdb, 0x49, 0xb0, 0xa7, 0x74, 0xa0, 0xa9, 0x60, 0x70, 0x3f, 0xfa,
+    0x39, 0x94, 0x03, 0x1c, 0xd5, 0xa8, 0xea, 0x8e, 0x7d, 0x94, 0x5d, 0xcb, 0x07, 0xde, 0xf1, 0xdb,
+    0xf3, 0x4e, 0xd4, 0x46, 0xdb, 0x41, 0x06, 0xdb, 0xfa, 0x41, 0x8e, 0xbe, 0x6e, 0x20, 0x2b, 0x8c,
+    0xfe, 0x13, 0x83, 0x97, 0xc1, 0x36, 0x38, 0xd7, 0xf9, 0x24, 0x9d, 0x96, 0x1e, 0xf5, 0x53, 0x40,
+    0xec, 0x32, 0x46, 0x01, 0x33, 0xc9, 0x1a, 0x15, 0xa0, 0x8c, 0xab, 0x0a, 0x90, 0x2f, 0x48, 0xf6,
+    0xa8, 0x1d, 0xae, 0x7c, 0x99, 0x64, 0x91, 0x02, 0xe0, 0x15, 0x06, 0xc3, 0x24, 0x9b, 0x34, 0x9c,
+    0x5b, 0xf5, 0xe6, 0x63, 0xcb, 0x2a, 0xcc, 0xb3, 0x61, 0x53, 0xb5, 0x35, 0x7c, 0xc5, 0x82, 0x68,
+    0xc1, 0xa4, 0xf1, 0xc1, 0xcb, 0xcd, 0xb8, 0x5e, 0x3d, 0xab, 0xb1, 0x11, 0xe3, 0x1f, 0x9c, 0x5d,
+    0x0f, 0x27, 0x0c, 0xd5, 0x86, 0x6e, 0xc3, 0x27, 0x3b, 0x0a, 0x49, 0xa1, 0xfa, 0x0a, 0xbd, 0x1c,
+    0x0d, 0x4c, 0x9b, 0x8b, 0xc1, 0x6c, 0x8e, 0x0c, 0xbc, 0x15, 0xd3, 0x78, 0x89, 0x35, 0x02, 0x7e,
+    0x58, 0x6d, 0x4b, 0x17, 0xac, 0x09, 0xc0, 0xa2, 0xab, 0xb6, 0x32, 0xd9, 0x6e, 0x13, 0x17, 0x67,
+    0x52, 0xf8, 0x70, 0x1e, 0xeb, 0x87, 0xbb, 0x3e, 0xc5, 0x4e, 0x9e, 0x60, 0x4d, 0x7a, 0xd7, 0xeb,
+    0x4f, 0xd5, 0xa7, 0xc3, 0x93, 0x3f, 0x93, 0xce, 0x2e, 0xb1, 0x5c, 0xcc, 0xb3, 0x2b, 0x33, 0x1e,
+    0x19, 0xc2, 0x48, 0x2b, 0x2c, 0x53, 0x32, 0x90, 0x4a, 0x30, 0xbd, 0x05, 0x2b, 0x65, 0x9b, 0x88,
+    0xa6, 0xc3, 0xa3, 0xc3, 0x55, 0x20, 0x3c, 0xcf, 0xca, 0xc9, 0x46, 0x96, 0xdb, 0x3a, 0xa2, 0xf3,
+    0xac, 0x84, 0x64, 0x94, 0x59, 0x81, 0x60, 0x02, 0x55, 0x7d, 0xb9, 0x7a, 0xac, 0x73, 0xc6, 0xca,
+    0x70, 0xcb, 0x1f, 0x61, 0x34, 0x30, 0x0d, 0x92, 0xb4, 0x95, 0xad, 0x8e, 0x62, 0xb8, 0xed, 0x60,
+    0x89, 0x9f, 0x61, 0x34, 0x28, 0x76, 0xb2, 0xb1, 0x42, 0x04, 0x6b, 0xee, 0x6a, 0xf9, 0x16, 0x31,
+    0xdc, 0x18, 0x0b, 0x65, 0x9a, 0xe0, 0x18, 0x8d, 0x02, 0x01, 0x57, 0xc7, 0x54, 0x88, 0xbb, 0xdb,
+    0x40, 0xc7, 0x11, 0x87, 0xa2, 0x22, 0x13, 0x06, 0x25, 0x1f, 0x95, 0xa7, 0x1e, 0x3d, 0x10, 0x3c,
+    0x5f, 0xb1, 0x83, 0x91, 0x0a, 0x99, 0xce, 0x32, 0x10, 0x97, 0x99, 0xd5, 0x1c, 0x76, 0xba, 0x07,
+    0x48, 0x38, 0xa7, 0x4e, 0x32, 0x92, 0xc3, 0x0e, 0xec, 0xe4, 0x99, 0x9a, 0x7e, 0x1b, 0x54, 0x5b,
+    0xdf, 0x81, 0x56, 0x24, 0xcc, 0x67, 0xd8, 0xca, 0xc7, 0xd7, 0x23, 0xc9, 0xde, 0x76, 0x53, 0xee,
+    0x82, 0xce, 0xb2, 0x2d, 0xf7, 0x59, 0x67, 0xe9, 0xf8, 0x82, 0x7c, 0x4f, 0x05, 0x5d, 0xa9, 0xa0,
+    0x2b, 0x19, 0xd4, 0x54, 0x5f, 0x5c, 0xac, 0x2f, 0x56, 0xeb, 0x8b, 0x4b, 0xea, 0x8b, 0xd5, 0xfa,
+    0xe2, 0x42, 0x7d, 0x3b, 0xde, 0x22, 0xe5, 0x1d, 0xee, 0xaa, 0x9d, 0xe4, 0xf1, 0x31, 0x7a, 0xa8,
+    0x6b, 0xa3, 0x74, 0x00, 0xd5, 0x7a, 0x62, 0x4b, 0x3d, 0x5b, 0x68, 0x64, 0x6b, 0xae, 0x7a, 0xda,
+    0x37, 0x56, 0x99, 0x78, 0xbc, 0x88, 0x46, 0xc9, 0x5e, 0x97, 0xbc, 0xc3, 0xad, 0x5a, 0x87, 0x5e,
+    0x6e, 0xf6, 0xb9, 0x56, 0xec, 0xe3, 0x20, 0xa5, 0xd2, 0x59, 0xdb, 0x08, 0xf4, 0xd2, 0xde, 0x78,
+    0x76, 0x02, 0x7b, 0xb3, 0x1b, 0xc9, 0x96, 0xfb, 0xc8, 0x8f, 0x74, 0x1b, 0xd9, 0x72, 0x17, 0xf9,
+    0xc1, 0x6e, 0x22, 0xef, 0xd9, 0xa8, 0x30, 0xdd, 0x6d, 0x06, 0x41, 0x44, 0xb7, 0x32, 0xdc, 0x03,
+    0x06, 0x71, 0x78, 0x1a, 0x96, 0x44, 0x6d, 0x36, 0xd4, 0x66, 0x43, 0x6d, 0x36, 0xd4, 0x66, 0x83,
+    0xc5, 0x6c, 0xf8, 0x77, 0x96, 0x5d, 0xed, 0x6e, 0x3a, 0xbc, 0x74, 0xab, 0xe0, 0x20, 0x01, 0x68,
+    0x4a, 0x4d, 0x07, 0x3e, 0x4e, 0x07, 0x30, 0x1f, 0x0a, 0x75, 0xad, 0xb7, 0x06, 0x14, 0x9d, 0xff,
+    0x21, 0x22, 0xbc, 0xd4, 0xaa, 0x7f, 0xad, 0xfa, 0xd7, 0xaa, 0xff, 0xcb, 0x52, 0xfd, 0x2b, 0x2a,
+    0xea, 0x87, 0x51, 0xd1, 0x8f, 0x51, 0xea, 0x04, 0x0e, 0xd7, 0xab, 0xe7, 0x50, 0xd8, 0x94, 0xe2,
+    0xd9, 0xf2, 0x06, 0xae, 0x22, 0x4b, 0x70, 0xae, 0xb8, 0xd1, 0xa0, 0x4b, 0xc2, 0x9b, 0x64, 0x9e,
+    0xa7, 0x48, 0xc2, 0x0e, 0xc6, 0x70, 0x2e, 0x28, 0x99, 0xe6, 0x41, 0xa9, 0x44, 0x5a, 0x7f, 0x18,
+    0x14, 0xf4, 0xc2, 0x29, 0x2a, 0x8f, 0x50, 0x26, 0xca, 0x46, 0xf1, 0x09, 0x12, 0x9a, 0x6c, 0xeb,
+    0xc7, 0x7c, 0x2b, 0x38, 0xb2, 0x5e, 0xfb, 0x45, 0x39, 0xf6, 0x7b, 0x4f, 0x90, 0x5b, 0x7e, 0xb3,
+    0x82, 0x41, 0x94, 0x88, 0xb6, 0xcb, 0x92, 0x8b, 0x57, 0x97, 0x6b, 0x2e, 0x5e, 0x5d, 0x56, 0xb8,
+    0xdc, 0x71, 0x59, 0xe5, 0x06, 0xd0, 0xae, 0x07, 0x70, 0xaa, 0x9f, 0xa4, 0xa8, 0xa2, 0x63, 0xe3,
+    0xf1, 0x90, 0x5b, 0x01, 0x09, 0xa6, 0xa8, 0x23, 0x28, 0xd9, 0x63, 0x83, 0x64, 0xbc, 0x07, 0x45,
+    0x0a, 0x6e, 0x30, 0x0c, 0x72, 0xe1, 0x4b, 0xdb, 0x1d, 0xac, 0x4b, 0x76, 0x07, 0xeb, 0xb2, 0xec,
+    0x0e, 0x16, 0x2b, 0xbe, 0xc9, 0x08, 0x14, 0x4f, 0x76, 0x3c, 0xe0, 0x21, 0x1e, 0x3c, 0x6b, 0xc9,
+    0x0c, 0x09, 0xa5, 0xa9, 0x82, 0xa4, 0xf6, 0x5d, 0x80, 0x3b, 0x0a, 0x6e, 0xa4, 0x82, 0xeb, 0x00,
+    0x3e, 0x9c, 0x80, 0xd2, 0xcf, 0x12, 0xc9, 0x27, 0x73, 0x3b, 0x90, 0x70, 0x9f, 0x04, 0x47, 0x67,
+    0x89, 0xaf, 0x6b, 0xad, 0x55, 0x02, 0x73, 0x7c, 0x30, 0xb2, 0xdb, 0xf8, 0x81, 0x76, 0x4d, 0xe3,
+    0x1d, 0x1e, 0x1f, 0x50, 0x0d, 0xa5, 0xfb, 0xaa, 0x37, 0x38, 0x48, 0x2f, 0x39, 0x5f, 0x36, 0x77,
+    0xbb, 0x9d, 0x7e, 0xaf, 0xff, 0xaa, 0x45, 0x3e, 0xc7, 0xe8, 0xf3, 0x75, 0xef, 0xb4, 0x4f, 0x3f,
+    0x63, 0xf4, 0xd9, 0x7d, 0xdd, 0xef, 0x07, 0x74, 0x7a, 0xab, 0x47, 0x34, 0xf9, 0xa9, 0x5f, 0xc2,
+    0xa8, 0x57, 0x31, 0xc8, 0x18, 0x2c, 0x93, 0x38, 0xdc, 0xb1, 0x27, 0xfe, 0xc1, 0xa0, 0x18, 0x4d,
+    0x2b, 0x94, 0x81, 0xb9, 0x3f, 0x66, 0x0e, 0x47, 0x61, 0xb3, 0x29, 0xea, 0x3b, 0x72, 0x7c, 0x19,
+    0x2e, 0x27, 0x91, 0xf6, 0xfb, 0xbd, 0x57, 0xc7, 0x6f, 0x4e, 0x20, 0x34, 0x2e, 0x97, 0x88, 0x8e,
+    0xa8, 0x5e, 0x2e, 0x09, 0x32, 0x1d, 0x24, 0x71, 0x5b, 0x97, 0x8e, 0x0e, 0xc4, 0x7b, 0x25, 0x59,
+    0xa2, 0x13, 0x5a, 0x45, 0x28, 0xc0, 0xe8, 0x49, 0x18, 0x49, 0x10, 0x0c, 0x3a, 0x0c, 0xab, 0xc6,
+    0x77, 0x21, 0xdc, 0x64, 0x69, 0xfc, 0x47, 0x82, 0x70, 0x43, 0x56, 0x63, 0x41, 0xe0, 0x3a, 0xad,
+    0xa6, 0x21, 0xd5, 0x25, 0xcd, 0x6b, 0xe6, 0x2d, 0xcc, 0x06, 0xee, 0x2c, 0xbb, 0x6d, 0x92, 0xf1,
+    0xf2, 0x7b, 0xa7, 0x5d, 0x7a, 0xee, 0xd5, 0x83, 0x96, 0xa0, 0xc1, 0x40, 0x1f, 0x6f, 0xdf, 0x78,
+    0xe6, 0x16, 0x01, 0xad, 0x38, 0x18, 0x31, 0x3d, 0x2c, 0x88, 0x3a, 0x96, 0xa0, 0x66, 0x63, 0x2b,
+    0x53, 0x29, 0xaf, 0x35, 0x9d, 0x39, 0x45, 0x0f, 0x75, 0x1d, 0xcb, 0xd8, 0x69, 0xb6, 0x43, 0x07,
+    0x96, 0x22, 0x1e, 0xab, 0x88, 0xc7, 0x76, 0xc4, 0xe3, 0x72, 0xc4, 0x63, 0x0d, 0x71, 0xac, 0x22,
+    0x8e, 0xed, 0x88, 0xe3, 0x72, 0xc4, 0xb1, 0x8a, 0xd8, 0x95, 0x74, 0x47, 0xf5, 0x68, 0x87, 0x58,
+    0xaa, 0x4a, 0xee, 0x17, 0x4b, 0x8b, 0xd9, 0x93, 0xf5, 0xd0, 0x69, 0x2b, 0x18, 0x3d, 0x56, 0x6c,
+    0xf4, 0xdf, 0xed, 0xa8, 0x18, 0xec, 0x51, 0x65, 0xd9, 0x41, 0xe7, 0xa8, 0xbe, 0x97, 0x03, 0x43,
+    0x4e, 0xeb, 0x1d, 0x3f, 0x80, 0x82, 0xa2, 0x84, 0xfa, 0x83, 0x65, 0xcf, 0x14, 0xed, 0xc4, 0xa0,
+    0xb7, 0x14, 0xb0, 0x3e, 0xac, 0xda, 0x22, 0x93, 0x75, 0xa9, 0x5e, 0x17, 0x97, 0x8a, 0x9a, 0xf5,
+    0x19, 0x03, 0xee, 0xda, 0x35, 0xfa, 0x04, 0x5d, 0xa3, 0x98, 0x4b, 0x37, 0x52, 0xd5, 0x34, 0x9e,
+    0xdc, 0x4c, 0x53, 0xdb, 0x5c, 0x3b, 0x2b, 0x70, 0x5a, 0xb8, 0x0d, 0x3f, 0xd5, 0xbe, 0xd7, 0xe7,
+    0x73, 0x64, 0xa3, 0x4c, 0xe5, 0xa5, 0xf7, 0x6b, 0x46, 0xe3, 0x84, 0xdf, 0x68, 0x93, 0x41, 0x5e,
+    0xbe, 0xd3, 0xf6, 0x21, 0x74, 0x7e, 0x92, 0x73, 0x17, 0x5a, 0x74, 0xfb, 0xb5, 0x36, 0xc1, 0x1d,
+    0x3f, 0x33, 0x03, 0x2e, 0x1f, 0x86, 0x3b, 0x84, 0x0d, 0xcd, 0xc6, 0xdf, 0xff, 0xde, 0x60, 0x9a,
+    0x6d, 0x08, 0x8a, 0xad, 0x94, 0x70, 0x87, 0x20, 0x88, 0xd2, 0x7d, 0xf4, 0x03, 0x59, 0x97, 0x8f,
+    0xde, 0x91, 0xb7, 0x32, 0xe4, 0xf1, 0xf4, 0xee, 0x5c, 0x4d, 0x03, 0x39, 0xc8, 0xf9, 0x95, 0xc3,
+    0x9c, 0x5e, 0xa1, 0xb5, 0x30, 0xd5, 0xc1, 0x62, 0xfc, 0x54, 0xb4, 0x5e, 0x8e, 0x1f, 0xc2, 0x7a,
+    0x81, 0x0b, 0x9d, 0x2f, 0xc5, 0x64, 0x61, 0xdd, 0xda, 0x99, 0x8f, 0xb9, 0x15, 0x60, 0xd3, 0xfe,
+    0x31, 0x66, 0x1c, 0x76, 0x0f, 0x9a, 0xe2, 0xd1, 0x5f, 0xc7, 0x4e, 0xc1, 0x0e, 0xa0, 0x79, 0xb8,
+    0x16, 0x69, 0xe8, 0x34, 0x73, 0xe0, 0xd0, 0x3b, 0x09, 0xdb, 0xe8, 0xa2, 0xfb, 0x55, 0x2a, 0x0f,
+    0xa5, 0x19, 0xbe, 0xec, 0xad, 0x0b, 0x3c, 0x50, 0xeb, 0x35, 0x2c, 0xeb, 0x28, 0x54, 0xd3, 0x96,
+    0xea, 0x0d, 0x8f, 0x7a, 0xc3, 0x63, 0xeb, 0x0d, 0x0f, 0xfa, 0xf8, 0xd2, 0x92, 0x3e, 0x87, 0x64,
+    0xdf, 0xf3, 0x28, 0x6c, 0x8d, 0xd0, 0x12, 0xae, 0x26, 0xaf, 0xf6, 0xeb, 0x0f, 0x19, 0xa5, 0x57,
+    0xb0, 0x52, 0x64, 0xd3, 0xa0, 0x5a, 0x68, 0x0a, 0xda, 0xec, 0x87, 0x88, 0xf1, 0x23, 0xc7, 0x65,
+    0x20, 0x11, 0xab, 0x66, 0x8b, 0x74, 0x82, 0x60, 0x69, 0x90, 0x58, 0x4e, 0x19, 0xbd, 0xf9, 0x8d,
+    0xf5, 0xe0, 0xa6, 0x94, 0x81, 0xd4, 0x46, 0x50, 0xd8, 0x7c, 0x25, 0x89, 0x9d, 0x7d, 0x55, 0x48,
+    0xa5, 0x97, 0x99, 0x1d, 0x17, 0x23, 0x69, 0xd1, 0x8a, 0x4a, 0x9e, 0x50, 0xd2, 0x9e, 0x89, 0xc3,
+    0x5d, 0xba, 0xc9, 0xc2, 0x64, 0xef, 0x66, 0x7d, 0xcd, 0xbb, 0xcb, 0x90, 0xa4, 0x28, 0xbc, 0xa5,
+    0x12, 0x2d, 0x95, 0x74, 0x2a, 0x34, 0x89, 0x61, 0x48, 0xfb, 0x03, 0x69, 0x61, 0x1f, 0x27, 0xc9,
+    0x0d, 0x28, 0x4e, 0xd3, 0x26, 0x0d, 0xe2, 0x8c, 0xf8, 0xd4, 0xa3, 0x92, 0x31, 0x8d, 0x16, 0xec,
+    0xbe, 0x34, 0x8e, 0xa1, 0x5b, 0xe4, 0x57, 0x32, 0xc9, 0x5c, 0x1c, 0xf7, 0x2d, 0xc0, 0x81, 0x1d,
+    0xa3, 0x10, 0x62, 0x93, 0xb1, 0xf7, 0xa8, 0x40, 0x9f, 0x82, 0x64, 0x8f, 0x55, 0xec, 0xf8, 0x48,
+    0x39, 0x45, 0x9a, 0x44, 0xe1, 0x21, 0x96, 0xf2, 0x81, 0xc3, 0x8a, 0xa9, 0x44, 0x2a, 0xf4, 0x4f,
+    0x0b, 0x2b, 0xb6, 0x6d, 0x5a, 0x10, 0x69, 0xde, 0xfc, 0xe7, 0x0a, 0x6b, 0x6a, 0x4c, 0xcb, 0x8b,
+    0xad, 0x65, 0xbb, 0xb6, 0x22, 0x43, 0x6b, 0x91, 0xb5, 0xb5, 0x8d, 0xaa, 0x50, 0xda, 0x55, 0x8a,
+    0x24, 0x86, 0x22, 0x72, 0xfe, 0x45, 0x05, 0x6a, 0x54, 0x8c, 0xe3, 0x2a, 0x44, 0x98, 0xe9, 0xbf,
+    0x2c, 0xe9, 0x2d, 0x73, 0x89, 0xb4, 0x02, 0x79, 0xe6, 0x92, 0xc9, 0x32, 0x1a, 0x8f, 0x13, 0x1c,
+    0x44, 0x03, 0x66, 0x37, 0xb0, 0x6b, 0xe3, 0x1f, 0x8d, 0x3e, 0xb6, 0x97, 0xba, 0x9d, 0x13, 0x64,
+    0x2c, 0xf1, 0xc4, 0x93, 0xce, 0x29, 0x4e, 0x3c, 0x3e, 0x45, 0xa9, 0xe8, 0x0f, 0xb5, 0x0a, 0x93,
+    0x79, 0x7a, 0x43, 0x8d, 0xc1, 0x61, 0xeb, 0x02, 0xfd, 0x97, 0x3a, 0xed, 0x66, 0xd4, 0x1a, 0xa1,
+    0xff, 0xc6, 0x8e, 0xd7, 0x1c, 0xb7, 0x2e, 0xd1, 0x7f, 0x24, 0x2d, 0x46, 0xff, 0x0d, 0x1d, 0xc7,
+    0x6f, 0x80, 0x1a, 0x8c, 0xea, 0xf0, 0x9a, 0x04, 0x79, 0x9b, 0x4f, 0x15, 0x08, 0x1a, 0x21, 0x08,
+    0x6a, 0xf5, 0xde, 0x76, 0xfa, 0xa7, 0xaf, 0xfa, 0x6d, 0x02, 0xa6, 0xc7, 0xd5, 0xc2, 0xaa, 0x2f,
+    0x16, 0x44, 0x98, 0x88, 0xce, 0x12, 0xce, 0xc1, 0x43, 0xe0, 0x16, 0x8f, 0x7c, 0xaf, 0xf8, 0x37,
+    0x0b, 0xa6, 0x26, 0xac, 0x87, 0x3d, 0x88, 0xe4, 0x47, 0x92, 0xbc, 0x44, 0x50, 0x9a, 0xe4, 0x64,
+    0x79, 0x30, 0xb5, 0xf5, 0xd2, 0x6e, 0x82, 0x2a, 0x8c, 0xa6, 0xd2, 0xf5, 0x00, 0x96, 0x8e, 0x35,
+    0x2d, 0xdd, 0x63, 0x7e, 0x19, 0x8d, 0xb2, 0x5b, 0x3d, 0x15, 0x04, 0xb0, 0x11, 0x3c, 0x1a, 0x42,
+    0x78, 0x17, 0x11, 0xa2, 0xf2, 0xcb, 0x59, 0xe3, 0xb8, 0xd3, 0x3b, 0xe9, 0x9d, 0xbe, 0xed, 0xbf,
+    0x3a, 0x3d, 0x3e, 0x7d, 0xf3, 0xf6, 0xf5, 0xdb, 0xe3, 0x23, 0x43, 0xb4, 0x20, 0xb0, 0x46, 0xad,
+    0x81, 0xda, 0x64, 0x8e, 0x6c, 0x92, 0x97, 0xfe, 0x90, 0x95, 0x04, 0xc1, 0x1a, 0x1d, 0x39, 0x5a,
+    0x23, 0x5e, 0x3d, 0x7e, 0x22, 0xd1, 0x75, 0x86, 0xc8, 0xf0, 0x05, 0x5b, 0x2d, 0x9a, 0x2e, 0x9a,
+    0x4d, 0xd1, 0xe4, 0x3f, 0xba, 0xdf, 0xda, 0xd2, 0x57, 0xef, 0x9b, 0xe3, 0x62, 0xc3, 0x8f, 0x86,
+    0xac, 0x73, 0x5a, 0x6a, 0x26, 0xc7, 0x3c, 0xc9, 0x66, 0x49, 0x88, 0x84, 0xed, 0x14, 0x41, 0xf7,
+    0x4f, 0x5d, 0x7a, 0x4c, 0x1a, 0x53, 0xe4, 0xf8, 0x52, 0xbd, 0xfc, 0x8c, 0x34, 0x8e, 0x63, 0x13,
+    0x52, 0xfe, 0x25, 0x26, 0x27, 0x9a, 0x64, 0x18, 0x03, 0x65, 0x62, 0xaf, 0x4d, 0x73, 0x1d, 0x34,
+    0xed, 0xbe, 0x9c, 0xe1, 0xbb, 0x1e, 0x2c, 0x8f, 0xbb, 0x36, 0xc0, 0x29, 0xf1, 0x4e, 0x6e, 0x23,
+    0x37, 0x1d, 0x43, 0x3a, 0x5e, 0xdc, 0x7d, 0x15, 0xdd, 0xa5, 0x57, 0xd7, 0x38, 0x90, 0x31, 0x49,
+    0x5f, 0xb5, 0xbe, 0x9c, 0x05, 0x92, 0x1e, 0xde, 0xeb, 0xbc, 0x79, 0x7d, 0xda, 0x16, 0x41, 0x0b,
+    0x7b, 0x9d, 0xd7, 0xa7, 0x34, 0x1f, 0x4d, 0x52, 0xf2, 0x50, 0x29, 0x04, 0x47, 0xe2, 0xa5, 0x48,
+    0xd4, 0xca, 0x73, 0xdc, 0x74, 0x5e, 0x0c, 0x37, 0x05, 0xe4, 0x05, 0x1a, 0x07, 0x34, 0xd9, 0xb1,
+    0x93, 0x15, 0xf7, 0x0e, 0x19, 0x09, 0x5f, 0xa4, 0x32, 0xa4, 0x24, 0xc3, 0x71, 0xd9, 0x37, 0x44,
+    0x00, 0x86, 0x02, 0x8c, 0x6c, 0xcc, 0x30, 0x78, 0xbc, 0xa4, 0x0a, 0xd9, 0x1e, 0x2a, 0xce, 0xa4,
+    0x7b, 0xad, 0x78, 0xa0, 0x48, 0x0a, 0x84, 0x3b, 0x23, 0xbf, 0xa8, 0x21, 0x2e, 0x9a, 0xd5, 0x2f,
+    0xfa, 0x22, 0x80, 0x85, 0x49, 0x78, 0x18, 0x50, 0x3e, 0x9b, 0x64, 0x6c, 0x5a, 0xb4, 0xbf, 0x1c,
+    0xff, 0xcb, 0x19, 0x96, 0x25, 0x82, 0x9b, 0x48, 0xc0, 0x69, 0x28, 0x44, 0x6b, 0x26, 0xc1, 0x49,
+    0xc8, 0x4c, 0xf0, 0x24, 0xe6, 0xf7, 0x30, 0x10, 0x52, 0x5b, 0x10, 0x27, 0xcb, 0xc4, 0x97, 0x13,
+    0xa5, 0xc8, 0x21, 0xb9, 0x85, 0x84, 0x15, 0xa5, 0x8a, 0x3b, 0x91, 0xd3, 0x92, 0x3e, 0x77, 0x13,
+    0x6e, 0x7c, 0x4a, 0x62, 0x4a, 0x71, 0x48, 0xe6, 0xd3, 0x37, 0xaf, 0x8f, 0xbb, 0xbd, 0x57, 0x47,
+    0x26, 0x09, 0x47, 0xfd, 0x92, 0xc5, 0xcd, 0x27, 0x1c, 0xb3, 0xbf, 0x5c, 0x79, 0x2d, 0x46, 0xb9,
+    0x95, 0x1f, 0xfb, 0xa2, 0xd2, 0x46, 0x7f, 0x9d, 0xb0, 0xea, 0x9b, 0x61, 0x9a, 0x7c, 0xa3, 0x64,
+    0x6a, 0xa9, 0x38, 0x9a, 0x4f, 0xbf, 0x10, 0xeb, 0x69, 0x1c, 0x5d, 0x5d, 0x45, 0x2c, 0xb0, 0x8e,
+    0x21, 0x74, 0x29, 0xe8, 0xf6, 0xd3, 0x64, 0x91, 0x5d, 0x44, 0xf3, 0x67, 0x17, 0x38, 0xa6, 0x7e,
+    0x9c, 0x6b, 0x8b, 0x73, 0xa5, 0xe3, 0x68, 0x56, 0xf2, 0xb8, 0x15, 0xcb, 0x2d, 0x8b, 0xf3, 0xcc,
+    0x60, 0xd6, 0x45, 0x7a, 0x96, 0xe1, 0xca, 0xba, 0x0c, 0xbf, 0x25, 0x6b, 0x69, 0x12, 0xce, 0xb3,
+    0x77, 0x18, 0xce, 0x2e, 0xef, 0x14, 0x0e, 0x52, 0x42, 0x42, 0x49, 0x87, 0xac, 0xed, 0x8d, 0x4a,
+    0x5d, 0xa1, 0xf6, 0xc3, 0xd3, 0x0b, 0x32, 0xf4, 0xd2, 0x9f, 0x9d, 0xe2, 0x4c, 0xaf, 0x0e, 0x0c,
+    0x4b, 0x36, 0x10, 0xc2, 0xb2, 0x3c, 0x79, 0x4e, 0x58, 0x82, 0x70, 0x0b, 0x34, 0x1b, 0xf2, 0xbc,
+    0xdc, 0x22, 0xf2, 0xbe, 0xb3, 0xa1, 0x47, 0x70, 0x86, 0x27, 0xe6, 0x82, 0xb1, 0x3f, 0x68, 0xe9,
+    0x4d, 0xd8, 0x5d, 0x6d, 0x83, 0xad, 0x1f, 0x58, 0x27, 0x94, 0xf7, 0x00, 0x6b, 0xbe, 0xda, 0x76,
+    0x92, 0xf7, 0xfe, 0xd3, 0x6f, 0x67, 0xef, 0x7f, 0x39, 0x7b, 0x7f, 0x7e, 0xf6, 0xe9, 0x67, 0xfb,
+    0x73, 0x3b, 0xa0, 0xe4, 0xab, 0x01, 0x45, 0xc3, 0x88, 0x3d, 0x12, 0xd1, 0xee, 0xf5, 0xdf, 0xa0,
+    0x6c, 0xaa, 0x3d, 0x0d, 0xf8, 0x16, 0x41, 0x48, 0x42, 0x99, 0x93, 0x27, 0x20, 0x70, 0x98, 0x4a,
+    0xec, 0x2d, 0x90, 0x96, 0xb4, 0x90, 0x47, 0x0f, 0x27, 0x40, 0xe0, 0x2f, 0x70, 0x5a, 0xf4, 0xeb,
+    0xd6, 0x7d, 0x75, 0x42, 0x23, 0xa0, 0x0b, 0xff, 0xa0, 0x14, 0x6d, 0x9c, 0x2e, 0xb4, 0xe4, 0xad,
+    0x2a, 0x65, 0xd6, 0xf3, 0xcd, 0x4e, 0x01, 0x85, 0x03, 0xa6, 0x83, 0xe5, 0xc1, 0x77, 0xd3, 0xd8,
+    0x0f, 0x16, 0x61, 0x3d, 0x60, 0x2b, 0x37, 0xcd, 0x09, 0x38, 0xdb, 0xb0, 0x1f, 0xb8, 0x13, 0xa8,
+    0xe1, 0x1c, 0x4d, 0x2e, 0x48, 0xa6, 0xc8, 0xa1, 0x83, 0x0c, 0xb8, 0x5c, 0x3a, 0xce, 0x4c, 0x43,
+    0x86, 0x74, 0x86, 0xa5, 0xd5, 0x64, 0xbf, 0xb8, 0x4e, 0x2d, 0x0f, 0x01, 0xb6, 0x78, 0xb9, 0xa2,
+    0x98, 0x5d, 0xe7, 0x4a, 0x59, 0x5e, 0xaf, 0x5b, 0xc4, 0xd2, 0xc7, 0x6f, 0x59, 0x80, 0x92, 0xd5,
+    0x6a, 0x0a, 0xfa, 0xa8, 0x9e, 0x4f, 0x1e, 0xba, 0x90, 0x2b, 0xd2, 0xfa, 0x0c, 0x5f, 0xb6, 0x24,
+    0xd5, 0xb9, 0x22, 0xa8, 0x26, 0x51, 0x4c, 0x34, 0x71, 0x89, 0x95, 0x72, 0x69, 0x9c, 0xb5, 0xfc,
+    0x9c, 0x84, 0xd9, 0x46, 0xca, 0xed, 0xb5, 0x56, 0x07, 0xe9, 0x95, 0x7e, 0x48, 0xfe, 0xea, 0xd5,
+    0xb8, 0x7c, 0x44, 0x90, 0xf2, 0x06, 0x11, 0xae, 0xdb, 0xd7, 0xde, 0x35, 0x3c, 0xfd, 0xae, 0xbd,
+    0xf7, 0xc5, 0xf8, 0x4f, 0xb5, 0x53, 0x81, 0x7e, 0x9f, 0x2a, 0x76, 0x6c, 0xfb, 0xaf, 0xec, 0x38,
+    0xa6, 0x78, 0x26, 0xbd, 0xaf, 0x14, 0xc3, 0xfd, 0x57, 0xa8, 0xcc, 0x18, 0x88, 0x12, 0x3f, 0xb8,
+    0x85, 0xba, 0x4c, 0x8e, 0x12, 0xca, 0xee, 0xab, 0x92, 0x5b, 0xa7, 0xd6, 0x52, 0xa6, 0x22, 0x85,
+    0x4a, 0x0b, 0x57, 0xf0, 0xdd, 0x82, 0x8e, 0x0a, 0x46, 0xb9, 0xa4, 0x42, 0x86, 0xeb, 0x09, 0xf4,
+    0xd7, 0x50, 0x13, 0x30, 0x55, 0x95, 0x78, 0x5a, 0x08, 0x47, 0x78, 0x98, 0x85, 0x95, 0x3b, 0x3e,
+    0x1b, 0x2a, 0xc5, 0x9a, 0xfa, 0x6b, 0x56, 0x95, 0x4d, 0x4a, 0xf1, 0xe3, 0xbc, 0xc5, 0xf5, 0x8c,
+    0xde, 0xc8, 0xda, 0x73, 0xc4, 0xbc, 0xc3, 0xbc, 0xbc, 0x64, 0xba, 0xf0, 0x4d, 0x98, 0xc3, 0x71,
+    0x19, 0xf3, 0x74, 0x16, 0x81, 0x20, 0xa1, 0x1f, 0xe2, 0x77, 0x83, 0x5a, 0xb6, 0x05, 0x0b, 0x8a,
+    0xc9, 0x6c, 0x24, 0x5f, 0x14, 0x27, 0xb6, 0xf0, 0x15, 0xea, 0x31, 0xa8, 0xb0, 0xdd, 0xe4, 0x15,
+    0xe4, 0x6d, 0x8c, 0xda, 0xf1, 0x44, 0x95, 0x38, 0xf4, 0xaa, 0xe3, 0xe3, 0x74, 0x8b, 0xc1, 0xbc,
+    0x87, 0xd0, 0x54, 0xdc, 0x32, 0xfe, 0xf5, 0xfd, 0xbf, 0x06, 0xbf, 0x9c, 0x7d, 0xfa, 0x38, 0xf8,
+    0xf1, 0xec, 0xfc, 0xb7, 0xf7, 0x9f, 0x3e, 0x7c, 0x6c, 0x1c, 0xf7, 0x5f, 0xbf, 0x7a, 0xdd, 0xe9,
+    0x3e, 0x19, 0xdb, 0xb9, 0xea, 0x83, 0xda, 0x16, 0x1b, 0x7b, 0xff, 0xb6, 0x33, 0x12, 0xab, 0xe3,
+    0x79, 0xb2, 0xb0, 0x06, 0x0a, 0xa9, 0xad, 0xd4, 0xda, 0x4a, 0x7d, 0xa9, 0x56, 0x6a, 0x6d, 0x37,
+    0xd6, 0x76, 0xe3, 0x0b, 0xb3, 0x1b, 0x99, 0x38, 0xaf, 0x6a, 0x3a, 0xfa, 0x85, 0x25, 0xb4, 0x36,
+    0x26, 0x6b, 0x63, 0xb2, 0x36, 0x26, 0x9f, 0x95, 0x31, 0x59, 0x79, 0x6f, 0x79, 0x6b, 0x33, 0x73,
+    0x47, 0xfd, 0xf1, 0xc5, 0x98, 0x8a, 0xb5, 0xb9, 0x67, 0x30, 0xf7, 0x2c, 0x6f, 0xb2, 0xd1, 0x03,
+    0x01, 0xc0, 0xd9, 0x2a, 0xab, 0xd8, 0xdf, 0x66, 0xdb, 0x8f, 0x95, 0x58, 0xb4, 0x01, 0x59, 0x8e,
+    0xb2, 0xf0, 0x0d, 0xce, 0x3f, 0xbc, 0xff, 0xe5, 0x23, 0x88, 0xf6, 0x07, 0xb7, 0x11, 0xd7, 0xec,
+    0xa0, 0xee, 0x66, 0x42, 0xee, 0x62, 0x23, 0x8a, 0xdd, 0xd3, 0x2d, 0x9c, 0x4c, 0xb5, 0x69, 0xb8,
+    0x85, 0x69, 0xf8, 0x04, 0x2c, 0xb1, 0x27, 0x67, 0x9d, 0x1e, 0xd8, 0x34, 0xac, 0x2f, 0x84, 0x3e,
+    0xa1, 0x0b, 0xa1, 0x2f, 0xdc, 0x04, 0x7f, 0x5c, 0x93, 0xf7, 0xa9, 0x39, 0x00, 0x0e, 0x65, 0x82,
+    0xff, 0x15, 0xae, 0xe8, 0x3e, 0x92, 0x9b, 0x81, 0xc1, 0x6d, 0xb6, 0x49, 0x6d, 0x50, 0xb4, 0x6a,
+    0x3f, 0x43, 0xed, 0x67, 0xa8, 0xfd, 0x0c, 0x87, 0xf2, 0x33, 0x88, 0xe9, 0x1a, 0xc9, 0x4a, 0xff,
+    0xc3, 0xfa, 0x1f, 0x36, 0xb9, 0x8e, 0xaa, 0xc8, 0x3a, 0x3d, 0xce, 0xcb, 0x5a, 0x47, 0xc6, 0xe1,
+    0x8c, 0x9c, 0x97, 0x72, 0x1b, 0xf4, 0xaf, 0xe0, 0x9d, 0x79, 0x42, 0xd7, 0x4a, 0x1f, 0xd1, 0x7b,
+    0x54, 0xc7, 0x4d, 0x7e, 0x59, 0xaf, 0xa9, 0xc8, 0x5d, 0x2d, 0xb7, 0x4f, 0x6d, 0x73, 0x67, 0xe9,
+    0xf2, 0x5e, 0xf3, 0xd5, 0x08, 0xc4, 0x1a, 0xe0, 0xca, 0x84, 0x33, 0x36, 0xe0, 0x44, 0x54, 0xbb,
+    0xb4, 0xbf, 0xcb, 0x30, 0x02, 0xc5, 0xc1, 0x33, 0x73, 0x59, 0x12, 0x6c, 0x4b, 0xd4, 0x95, 0xe4,
+    0x7a, 0x33, 0x5f, 0x22, 0x7c, 0xb5, 0xa7, 0x3b, 0x4b, 0x15, 0x3e, 0x2e, 0x87, 0x8f, 0x55, 0xf8,
+    0xd5, 0x00, 0xbf, 0x2c, 0xdd, 0xe2, 0x7d, 0x81, 0xf4, 0x20, 0x7a, 0x59, 0x8e, 0xd3, 0x87, 0x69,
+    0x6a, 0x6a, 0xb5, 0xae, 0x5a, 0x7d, 0xfa, 0x9a, 0x8c, 0xa3, 0x13, 0xb4, 0x12, 0xc8, 0xe3, 0x6d,
+    0x90, 0xc7, 0x76, 0xe4, 0xb1, 0x60, 0x0d, 0x1c, 0xff, 0x64, 0xf3, 0xcb, 0xe6, 0x98, 0x87, 0x50,
+    0xaf, 0x7a, 0xa8, 0xe5, 0x8e, 0x84, 0x2b, 0xde, 0xe2, 0xaa, 0x38, 0xc5, 0x15, 0x23, 0x5c, 0xb1,
+    0xa3, 0x38, 0x99, 0x01, 0x97, 0xf1, 0xba, 0x38, 0xaa, 0xd4, 0x33, 0x67, 0xc4, 0x8e, 0xf9, 0x9a,
+    0x38, 0x71, 0x3b, 0x3f, 0xe0, 0xb3, 0x16, 0x4f, 0xc8, 0xe9, 0xfc, 0xa0, 0x07, 0x93, 0xe8, 0x20,
+    0x91, 0x67, 0xbd, 0xa3, 0x82, 0x6a, 0x87, 0x7a, 0x7d, 0xb0, 0x92, 0xd2, 0x4d, 0xa5, 0x62, 0x4b,
+    0xa9, 0x78, 0x1f, 0x87, 0xa0, 0x68, 0x2a, 0xd4, 0x10, 0x99, 0x12, 0xe3, 0xed, 0x4f, 0x55, 0xd6,
+    0x57, 0x89, 0xea, 0x43, 0x5a, 0xf5, 0x21, 0x2d, 0x9b, 0x27, 0x9e, 0x0d, 0x99, 0xc1, 0x4d, 0xf7,
+    0x10, 0x5e, 0x7a, 0xec, 0x2b, 0x2a, 0xa1, 0x52, 0xe4, 0x5b, 0xfb, 0x4a, 0x80, 0x98, 0xf8, 0x4b,
+    0xca, 0x2d, 0xeb, 0x4d, 0x15, 0xac, 0xbe, 0x17, 0x55, 0x9f, 0x6f, 0x7b, 0x22, 0xe7, 0xdb, 0x0e,
+    0xe7, 0x4e, 0x97, 0xa6, 0xa2, 0xf8, 0x69, 0xa8, 0x59, 0x64, 0x7a, 0xea, 0xfc, 0x34, 0x35, 0x59,
+    0xc6, 0x64, 0x9a, 0x64, 0xb5, 0xd7, 0xbb, 0xf6, 0x7a, 0xd7, 0x5e, 0xef, 0xda, 0xeb, 0x5d, 0xcd,
+    0xeb, 0x8d, 0xd5, 0xff, 0x90, 0xca, 0x21, 0x3e, 0x77, 0x5d, 0xdd, 0x9c, 0xe9, 0x2c, 0x7d, 0x49,
+    0x48, 0xf1, 0xc1, 0x2b, 0x80, 0xad, 0x5a, 0xdc, 0xd2, 0x71, 0x28, 0xf6, 0x78, 0x2d, 0xf6, 0xb8,
+    0x1a, 0xf6, 0x58, 0xc2, 0x0e, 0xa1, 0xd1, 0xf6, 0x7d, 0x32, 0x50, 0xb7, 0xc5, 0x16, 0xa3, 0x0b,
+    0xdc, 0xfd, 0xc5, 0xd8, 0x59, 0xc8, 0xa4, 0x7c, 0x62, 0x16, 0x58, 0x7d, 0xaf, 0xad, 0x5c, 0x07,
+    0x38, 0x9c, 0x0e, 0xbe, 0x5f, 0x05, 0xfa, 0x39, 0x5e, 0xd5, 0x33, 0x62, 0x28, 0x39, 0xf7, 0x50,
+    0xec, 0xf1, 0xd2, 0x0e, 0xdf, 0x58, 0x55, 0x7a, 0x66, 0x2e, 0x59, 0x24, 0x86, 0x20, 0x77, 0x10,
+    0x19, 0x63, 0x4b, 0x61, 0x61, 0xe2, 0x74, 0x22, 0x0d, 0x38, 0xb6, 0x02, 0xc7, 0x05, 0x60, 0xec,
+    0x3d, 0xe4, 0xb5, 0x78, 0x1c, 0x85, 0x87, 0x25, 0x9d, 0x13, 0x10, 0x5f, 0x60, 0xa8, 0xbc, 0x94,
+    0x7b, 0xda, 0x16, 0xf2, 0x51, 0x96, 0xe5, 0x24, 0x9a, 0xb1, 0x29, 0x87, 0xa2, 0xdd, 0xff, 0x21,
+    0xd7, 0x4a, 0xe7, 0x4e, 0xf3, 0x09, 0x5a, 0x6b, 0xe6, 0xf2, 0x33, 0x19, 0x5c, 0xea, 0xe3, 0xb5,
+    0xc7, 0x92, 0x19, 0x5f, 0x5f, 0x5c, 0x24, 0xf3, 0xb2, 0x27, 0x74, 0x37, 0x0c, 0xaa, 0xd6, 0x35,
+    0xa4, 0xf5, 0xb6, 0x8d, 0xb4, 0xd6, 0x0d, 0x9b, 0x4d, 0x73, 0x54, 0xca, 0x36, 0xe8, 0xd1, 0xbe,
+    0x4a, 0x7f, 0xc3, 0x81, 0x98, 0x51, 0xa4, 0x64, 0x2f, 0x24, 0x81, 0xf9, 0xe0, 0xa9, 0x76, 0xb9,
+    0x03, 0x20, 0x98, 0x98, 0xe8, 0x2a, 0xa9, 0x73, 0xe5, 0x0d, 0xec, 0x41, 0xb1, 0x9f, 0xf4, 0x67,
+    0x46, 0x0a, 0x8b, 0x6d, 0xd7, 0x9e, 0xd5, 0xab, 0xdc, 0x4d, 0x85, 0xd1, 0x99, 0x43, 0x44, 0x2b,
+    0xa4, 0x74, 0x2c, 0x20, 0x1c, 0x78, 0x59, 0x36, 0x88, 0xcb, 0xe2, 0xc8, 0x47, 0xa8, 0xdb, 0x70,
+    0x70, 0x3f, 0xfd, 0xe5, 0x15, 0xe1, 0xd2, 0x9c, 0xe6, 0xf3, 0x68, 0x61, 0x7a, 0x99, 0x05, 0x9e,
+    0x49, 0x59, 0xcc, 0xd2, 0xe9, 0xe0, 0x16, 0x07, 0xfb, 0xd5, 0xa2, 0xe5, 0x09, 0xc1, 0xdc, 0x2d,
+    0x4e, 0xcc, 0x2e, 0x09, 0x11, 0xd7, 0x5d, 0x13, 0x8d, 0xb6, 0x47, 0xc0, 0x7a, 0x24, 0x14, 0x38,
+    0x41, 0xd6, 0x89, 0x88, 0x85, 0x80, 0xaa, 0xa0, 0x09, 0xf3, 0x71, 0x1c, 0x8a, 0x9f, 0x3e, 0x03,
+    0x0b, 0xee, 0x79, 0xa1, 0x9e, 0x5e, 0xa8, 0x27, 0x0a, 0xf5, 0x44, 0xa1, 0x1e, 0x14, 0xd2, 0xb6,
+    0x18, 0x08, 0x36, 0x8f, 0x06, 0x9b, 0x65, 0xa3, 0x4f, 0x5f, 0x80, 0xea, 0x44, 0x72, 0x48, 0x6e,
+    0xdc, 0x25, 0x1c, 0x2f, 0xa0, 0x0d, 0xe0, 0x0b, 0x87, 0xf2, 0x86, 0xb0, 0x9f, 0xe8, 0xc3, 0x53,
+    0x7b, 0x0c, 0x9e, 0x17, 0x70, 0x3c, 0x4b, 0xde, 0xdd, 0x72, 0x65, 0xcd, 0x5b, 0xdd, 0x2d, 0x79,
+    0x94, 0xbb, 0xe8, 0x26, 0x41, 0xd2, 0x21, 0x09, 0xd9, 0x73, 0x49, 0xec, 0x0d, 0x2c, 0xf6, 0xf8,
+    0x95, 0xe3, 0x1f, 0x43, 0xf8, 0x51, 0x08, 0x4f, 0xde, 0xa4, 0xb0, 0x6d, 0xf4, 0x05, 0xc1, 0xd8,
+    0x8a, 0xc3, 0x0f, 0x04, 0x43, 0x85, 0x78, 0xf6, 0xb8, 0x85, 0xe1, 0x27, 0xd3, 0x87, 0x0c, 0x3d,
+    0x30, 0x14, 0x58, 0xf7, 0xa4, 0x81, 0x3a, 0x2b, 0x7a, 0x6b, 0x13, 0x1c, 0x86, 0x08, 0xfd, 0xb6,
+    0xe0, 0x81, 0x2a, 0xbc, 0x0a, 0x29, 0x9a, 0x84, 0xc5, 0x92, 0x82, 0x44, 0x7f, 0x63, 0x44, 0x7a,
+    0xbc, 0x1a, 0x0f, 0xb7, 0x9d, 0x0e, 0x9f, 0xc7, 0x02, 0xb6, 0xed, 0x26, 0x7f, 0x51, 0x2f, 0x2d,
+    0x72, 0x3a, 0x65, 0xbe, 0x9c, 0x85, 0x85, 0xd0, 0x89, 0xc5, 0x9d, 0x1b, 0xb0, 0xe4, 0xa9, 0x51,
+    0x6d, 0xde, 0xd5, 0x29, 0x96, 0x80, 0x25, 0xd8, 0x54, 0xe4, 0x18, 0x32, 0xb9, 0xad, 0xa5, 0x0a,
+    0x64, 0xe6, 0xb1, 0xc0, 0x5c, 0xab, 0x4b, 0xa8, 0x38, 0xcb, 0x26, 0x20, 0x81, 0x16, 0x64, 0xe3,
+    0x0f, 0x62, 0x7a, 0x0e, 0x70, 0x4b, 0x22, 0x69, 0x19, 0xd0, 0x80, 0x2e, 0x92, 0x08, 0x0b, 0xda,
+    0x02, 0x9c, 0xfa, 0x96, 0x20, 0x86, 0x2d, 0xcb, 0xb4, 0x64, 0x0d, 0xa3, 0x2b, 0xc4, 0xa0, 0x60,
+    0x0f, 0x42, 0x7c, 0x3d, 0x24, 0xb6, 0xd9, 0x0b, 0x0d, 0x16, 0xf8, 0x59, 0x9a, 0x0f, 0x2f, 0x75,
+    0x5a, 0xe7, 0x59, 0x1e, 0xe5, 0xc9, 0x60, 0xb1, 0xba, 0x8a, 0xb3, 0x89, 0xa5, 0x20, 0x89, 0x26,
+    0xa8, 0xd9, 0x47, 0x8a, 0x84, 0x1f, 0x5e, 0x2a, 0xc1, 0x36, 0x2d, 0xbb, 0x6b, 0x24, 0x75, 0x12,
+    0xc5, 0x48, 0x3d, 0x9a, 0x4d, 0xa2, 0x69, 0x62, 0x81, 0x20, 0xd1, 0xae, 0xb5, 0x3c, 0xd1, 0xb7,
+    0x20, 0xf9, 0xf4, 0x64, 0xdc, 0x36, 0x62, 0xcf, 0x5e, 0x45, 0x33, 0xdb, 0xf1, 0xaa, 0xa2, 0x4d,
+    0x55, 0xb0, 0xa8, 0x94, 0xc1, 0x7f, 0x06, 0x1b, 0x35, 0x4f, 0xe4, 0x75, 0x75, 0xa1, 0xe1, 0x84,
+    0xf2, 0x7c, 0xe5, 0x07, 0x5f, 0x98, 0xfb, 0x56, 0xcd, 0x65, 0xc7, 0x66, 0xb0, 0x4e, 0x22, 0x3c,
+    0x8d, 0x2c, 0x11, 0xc6, 0x8c, 0xa5, 0xf2, 0x13, 0x32, 0x24, 0x19, 0x11, 0x3f, 0xe5, 0xfe, 0x40,
+    0x48, 0xf8, 0xa3, 0xfb, 0x8d, 0x38, 0x03, 0x19, 0x25, 0x4b, 0x51, 0xa1, 0x10, 0x06, 0x12, 0x72,
+    0x84, 0xe0, 0x27, 0x24, 0xaf, 0xc9, 0xd9, 0x18, 0x15, 0xe8, 0xee, 0xd6, 0xef, 0x9f, 0xbe, 0x42,
+    0xeb, 0x80, 0x3c, 0x0d, 0x16, 0xc9, 0xf8, 0x0a, 0xc2, 0x58, 0x22, 0x46, 0x47, 0x05, 0xda, 0x9a,
+    0x18, 0xf9, 0xa3, 0xff, 0x8d, 0x29, 0xcd, 0xc0, 0x68, 0xb0, 0x98, 0x7e, 0x67, 0x91, 0x16, 0xf0,
+    0xe0, 0xca, 0x77, 0x76, 0x21, 0x81, 0x86, 0x11, 0xb7, 0x1b, 0x44, 0xb2, 0x68, 0xab, 0x47, 0x5b,
+    0xd9, 0xfb, 0xe6, 0x31, 0x81, 0xe1, 0xf8, 0xc4, 0x21, 0x7b, 0xdf, 0x80, 0x61, 0x6a, 0x40, 0x95,
+    0xbb, 0xd5, 0x28, 0x6a, 0x53, 0x31, 0x93, 0x5c, 0x2a, 0x8a, 0xee, 0x55, 0x87, 0xdc, 0x97, 0x2c,
+    0x9d, 0xe6, 0xeb, 0x42, 0xab, 0xd3, 0xa8, 0xd8, 0x5c, 0x5c, 0x21, 0x19, 0x75, 0x99, 0x09, 0x71,
+    0x15, 0xaa, 0xd8, 0x3a, 0xb7, 0x4a, 0x31, 0x06, 0x45, 0xc4, 0x4f, 0xa8, 0x4f, 0xf5, 0xc6, 0x0f,
+    0x47, 0x56, 0xc4, 0x7e, 0x89, 0x8c, 0x6c, 0xbc, 0x3b, 0x2a, 0xc9, 0xf5, 0xad, 0x38, 0x15, 0xda,
+    0x24, 0xd7, 0x19, 0x25, 0x8f, 0x18, 0x75, 0x60, 0xe5, 0x80, 0x9f, 0x54, 0xa5, 0x1d, 0x1b, 0x6e,
+    0xe0, 0xe5, 0x0e, 0xa0, 0x27, 0xdd, 0xb0, 0x50, 0x9a, 0x1d, 0xe5, 0xe2, 0x6c, 0xc9, 0xc5, 0x5d,
+    0xe3, 0x07, 0xcc, 0x57, 0x7e, 0xff, 0x04, 0xbb, 0x72, 0xf1, 0x48, 0x28, 0xcc, 0x89, 0xc5, 0x37,
+    0x11, 0xe6, 0x60, 0x07, 0xa0, 0x9a, 0x02, 0xc2, 0x10, 0x8a, 0x7c, 0x67, 0x9a, 0x26, 0xe1, 0xf3,
+    0x2f, 0x6b, 0x07, 0x91, 0xc4, 0xe1, 0xee, 0xe1, 0xf0, 0xe0, 0xfc, 0x49, 0xa1, 0x48, 0x1f, 0xaf,
+    0xe5, 0xca, 0x2f, 0x8c, 0x20, 0x86, 0x8c, 0x43, 0x53, 0x45, 0x00, 0x6f, 0x4c, 0xbf, 0x0d, 0xf4,
+    0x66, 0xe0, 0x58, 0xc2, 0x4d, 0x38, 0xee, 0x85, 0xcf, 0x94, 0xa9, 0x2b, 0x91, 0x07, 0x27, 0xc6,
+    0xe0, 0x58, 0x5a, 0x70, 0x2f, 0x77, 0x05, 0x9e, 0x9f, 0x88, 0x57, 0xa7, 0x21, 0x0e, 0x59, 0x2b,
+    0xcf, 0xda, 0x96, 0x86, 0x5f, 0xe5, 0x4f, 0x52, 0x70, 0x88, 0x24, 0x18, 0x0e, 0xd4, 0x5b, 0x5e,
+    0x10, 0xbc, 0xd4, 0x0d, 0xf6, 0x49, 0x3b, 0x2e, 0xc4, 0xae, 0x6b, 0x8e, 0xc6, 0xc3, 0x9b, 0x01,
+    0x9c, 0x1c, 0x4f, 0xff, 0x35, 0xa4, 0x51, 0x9f, 0x65, 0xf7, 0x36, 0xc8, 0x4f, 0xd3, 0x0a, 0xc9,
+    0xc7, 0x44, 0x86, 0x44, 0x1d, 0xa9, 0x04, 0x10, 0x92, 0xac, 0x40, 0x79, 0x05, 0xa5, 0x2e, 0x6f,
+    0xad, 0xa4, 0xaf, 0x26, 0xdc, 0xb6, 0xb4, 0xc6, 0xb8, 0x7c, 0xc7, 0xcd, 0x3f, 0x86, 0xed, 0x13,
+    0x78, 0x8b, 0x48, 0x15, 0x9a, 0x1e, 0xe7, 0x53, 0xd8, 0xc5, 0x61, 0xf2, 0xd6, 0xef, 0xbd, 0x52,
+    0x82, 0x95, 0xdf, 0x50, 0xd1, 0x8e, 0xfe, 0xf5, 0xa5, 0x85, 0x18, 0xd8, 0x43, 0x5e, 0x6a, 0xd9,
+    0x9a, 0x44, 0x3f, 0x9b, 0xaa, 0x16, 0xc6, 0x43, 0xd9, 0x0b, 0x5d, 0x23, 0x94, 0xf3, 0x91, 0x58,
+    0xc4, 0x26, 0x0b, 0x04, 0x6d, 0x56, 0x34, 0x92, 0xc6, 0xbb, 0xb6, 0xaa, 0xa1, 0xa8, 0x0b, 0x3c,
+    0x7f, 0x92, 0x0b, 0xbc, 0x30, 0x10, 0x68, 0x5d, 0x41, 0xda, 0xfd, 0xd6, 0x92, 0x8a, 0x3a, 0x8e,
+    0x2d, 0x26, 0x39, 0xb5, 0xc4, 0x1e, 0x5a, 0xbb, 0x38, 0xdc, 0x21, 0xe0, 0x8d, 0xbc, 0x75, 0x12,
+    0x10, 0xf1, 0x63, 0x51, 0x00, 0x57, 0x6b, 0x9d, 0x62, 0x08, 0xc8, 0xc6, 0x2a, 0xfd, 0x4d, 0xdc,
+    0x4d, 0x0e, 0x39, 0x49, 0x56, 0x5b, 0x14, 0x8f, 0x64, 0x51, 0x3c, 0x19, 0x4d, 0x7d, 0x9f, 0xa6,
+    0xca, 0xa6, 0x66, 0x53, 0x99, 0x69, 0x53, 0x6e, 0x51, 0x00, 0xef, 0x28, 0xbe, 0xa8, 0x63, 0x9a,
+    0xd8, 0xb3, 0xcd, 0xf6, 0x8b, 0x74, 0x32, 0x29, 0x3b, 0x25, 0x27, 0xf2, 0xed, 0x47, 0xe5, 0x04,
+    0x8c, 0xe9, 0xbc, 0x9c, 0x94, 0x5b, 0xb6, 0xd9, 0xa3, 0x82, 0x95, 0x3d, 0x27, 0x16, 0x4d, 0xb2,
+    0x32, 0x8a, 0x45, 0xbe, 0x9d, 0x62, 0x01, 0x63, 0xa2, 0x58, 0xca, 0x2d, 0xa3, 0x58, 0x05, 0x7b,
+    0xd6, 0x07, 0xeb, 0x70, 0x53, 0x4a, 0xce, 0x68, 0x89, 0x7c, 0xfb, 0xfb, 0xbf, 0x1c, 0xc4, 0xf8,
+    0x06, 0xb0, 0xc8, 0x2d, 0x7d, 0xed, 0x4d, 0x01, 0x5b, 0x47, 0xb0, 0xfd, 0x0c, 0x25, 0xcf, 0x2e,
+    0x27, 0xd7, 0x76, 0x9a, 0x52, 0x64, 0xae, 0x25, 0x56, 0xd9, 0x8b, 0xaa, 0x62, 0x0c, 0x4b, 0x13,
+    0x4e, 0xfc, 0x34, 0x9d, 0x2c, 0x13, 0xb9, 0x9e, 0x3a, 0x0d, 0x4d, 0x67, 0xcc, 0x64, 0x54, 0x5b,
+    0x4d, 0x25, 0xf1, 0xd3, 0x44, 0x8b, 0xc8, 0xf5, 0xd4, 0x09, 0x66, 0xa2, 0x45, 0x46, 0xb5, 0xf9,
+    0x24, 0x39, 0xf8, 0x91, 0x34, 0x89, 0xf7, 0xc5, 0x4f, 0xd3, 0x0b, 0xc4, 0x3c, 0xd3, 0x53, 0x27,
+    0x84, 0xf1, 0x25, 0x62, 0x09, 0xd3, 0x36, 0x5c, 0xcd, 0x7f, 0xd9, 0x08, 0xa1, 0x87, 0x01, 0x25,
+    0x46, 0xb7, 0x92, 0x41, 0x77, 0x4d, 0x0d, 0xec, 0xfa, 0x7c, 0x9c, 0x26, 0xb5, 0x27, 0xa4, 0xf6,
+    0x84, 0xd4, 0x9e, 0x90, 0xda, 0x13, 0x52, 0x7b, 0x42, 0x5c, 0xce, 0x94, 0x92, 0xd7, 0xc3, 0xd1,
+    0x0f, 0x65, 0xc8, 0xe7, 0xf2, 0x94, 0x63, 0x7c, 0x8f, 0xe7, 0xfa, 0x10, 0x8f, 0x6b, 0xcd, 0x67,
+    0xd9, 0x24, 0x82, 0xf6, 0xee, 0xe0, 0x0b, 0xa1, 0xb6, 0x4e, 0xd1, 0xb3, 0x43, 0xcc, 0x1d, 0xb2,
+    0x3f, 0x29, 0xf5, 0x82, 0x47, 0x1e, 0x33, 0xb5, 0xd5, 0x8e, 0x9d, 0x2b, 0xec, 0xba, 0xd7, 0xf9,
+    0x8f, 0x3f, 0x0d, 0xbe, 0xfc, 0xab, 0x81, 0x04, 0xef, 0x51, 0xd1, 0xa6, 0x84, 0x65, 0x34, 0x28,
+    0x73, 0xc3, 0x98, 0xad, 0x3e, 0xf9, 0x14, 0xce, 0xa6, 0x47, 0x01, 0x35, 0x83, 0xf6, 0x21, 0x6d,
+    0xbe, 0xc3, 0xda, 0x6b, 0x07, 0xb4, 0xb5, 0x0e, 0x65, 0x2e, 0x1d, 0xd4, 0xd6, 0xd9, 0xa7, 0xa9,
+    0x52, 0xca, 0x26, 0x9b, 0x59, 0x1a, 0xe5, 0x86, 0xc6, 0x46, 0x86, 0xc2, 0x3e, 0x8e, 0xf6, 0x49,
+    0xa3, 0xb7, 0x99, 0xc6, 0x5e, 0x36, 0x34, 0x95, 0x95, 0x6e, 0x02, 0xf3, 0xf1, 0xc7, 0x9f, 0x3f,
+    0x0e, 0x7e, 0x7e, 0xff, 0xeb, 0xaf, 0xef, 0x91, 0x86, 0xd0, 0xeb, 0x9e, 0xfa, 0xe6, 0x38, 0x81,
+    0x30, 0xc3, 0x41, 0xcb, 0xa6, 0xb3, 0x1c, 0x34, 0xe1, 0xa2, 0x7c, 0xa7, 0xb3, 0x9d, 0x5f, 0xd4,
+    0xc7, 0x4a, 0x22, 0x4b, 0x5c, 0xc9, 0xf2, 0x9b, 0x75, 0x14, 0xcd, 0x14, 0xaa, 0x72, 0x45, 0x45,
+    0x47, 0x04, 0xac, 0x20, 0xa3, 0x26, 0x0d, 0xbf, 0x2c, 0xed, 0x30, 0x71, 0xa1, 0x68, 0xa2, 0xdf,
+    0xe4, 0xf8, 0x5d, 0x45, 0x12, 0x3a, 0x81, 0x7c, 0xb8, 0xf3, 0xfa, 0xe2, 0x22, 0x6c, 0xe2, 0x8d,
+    0xcf, 0x36, 0xbe, 0x8c, 0x41, 0x37, 0x41, 0xb9, 0x3a, 0x0d, 0x7d, 0xc9, 0xce, 0x04, 0x85, 0x12,
+    0xbb, 0x90, 0xea, 0x9a, 0xbc, 0xab, 0xdd, 0x5e, 0xa7, 0xf7, 0xd6, 0x27, 0x42, 0xbc, 0x25, 0xa8,
+    0x70, 0x4a, 0xc8, 0x20, 0x75, 0x43, 0xcd, 0x62, 0xe4, 0x7d, 0xb1, 0xbf, 0x40, 0x91, 0x05, 0xf7,
+    0x12, 0xb9, 0xf8, 0x64, 0xa2, 0xc9, 0xaf, 0x0c, 0x5e, 0xe5, 0x4e, 0x54, 0xec, 0x10, 0x52, 0xd7,
+    0x28, 0xc4, 0x1f, 0xae, 0xbc, 0x1e, 0x28, 0xba, 0x0f, 0xf6, 0x69, 0x4b, 0x67, 0x19, 0x81, 0xb4,
+    0xb6, 0x8c, 0xc0, 0x83, 0x94, 0x96, 0x92, 0x52, 0xf1, 0xe0, 0xa2, 0xab, 0xae, 0x78, 0x4f, 0xda,
+    0xe7, 0x5d, 0xbb, 0xb5, 0xff, 0xca, 0x6e, 0x6d, 0x73, 0xf2, 0x20, 0x45, 0x03, 0x24, 0x6b, 0x3a,
+    0x27, 0x26, 0xf5, 0xe7, 0xa4, 0x76, 0x79, 0xd7, 0x2e, 0xef, 0xda, 0xe5, 0x5d, 0xbb, 0xbc, 0x6b,
+    0x97, 0x77, 0xed, 0xf2, 0x7e, 0xba, 0x2e, 0x6f, 0xea, 0x0e, 0x59, 0xc0, 0x65, 0x94, 0x90, 0xe7,
+    0xe1, 0xab, 0xc2, 0xa2, 0x68, 0xed, 0xf7, 0xae, 0xfd, 0xde, 0x8f, 0xea, 0xf7, 0xe6, 0x26, 0x60,
+    0xed, 0xe4, 0xae, 0x9d, 0xdc, 0x8f, 0xe1, 0xe4, 0xfe, 0xcb, 0x7a, 0xb6, 0x51, 0xa7, 0x59, 0x9c,
+    0xdb, 0x5d, 0xb4, 0xc8, 0xe8, 0x59, 0xd4, 0x34, 0x12, 0xce, 0xef, 0x93, 0x0d, 0x9c, 0xdf, 0x1e,
+    0x59, 0x85, 0x6c, 0x3e, 0x70, 0x29, 0x09, 0x22, 0x3c, 0xf0, 0xef, 0xb3, 0x0f, 0x9f, 0x3f, 0xc1,
+    0x3d, 0xad, 0x5d, 0x9c, 0xe4, 0x86, 0x3c, 0xd2, 0x94, 0x87, 0xf3, 0xa2, 0x3f, 0xa4, 0xbd, 0x58,
+    0xbb, 0xcb, 0x6b, 0x77, 0x79, 0xed, 0x2e, 0x3f, 0xbc, 0xbb, 0xdc, 0xe6, 0xbd, 0x06, 0xa5, 0x83,
+    0x79, 0xba, 0x6f, 0xc3, 0x10, 0x24, 0x12, 0x51, 0x3a, 0xb0, 0xdb, 0x1c, 0x4b, 0x92, 0x50, 0x08,
+    0xcd, 0xc0, 0x7a, 0x76, 0x78, 0xa3, 0x93, 0xc3, 0x18, 0xad, 0xc7, 0xf0, 0xef, 0x7e, 0x82, 0x78,
+    0x9e, 0x20, 0xac, 0x53, 0xac, 0xd7, 0x5a, 0xbc, 0xfd, 0xd5, 0x76, 0x0b, 0xb6, 0xdd, 0x19, 0x30,
+    0x28, 0x7b, 0xb5, 0xa3, 0xbf, 0x76, 0xf4, 0x57, 0x0a, 0x57, 0x40, 0x97, 0x7c, 0x72, 0x27, 0xbf,
+    0xe0, 0x7d, 0xae, 0x74, 0x39, 0x92, 0xc5, 0x04, 0xda, 0x6e, 0x6f, 0xbc, 0xaa, 0x13, 0xba, 0x5a,
+    0x30, 0x04, 0x16, 0x71, 0xc9, 0xb0, 0x9b, 0xfe, 0xec, 0x22, 0x8c, 0xce, 0xa3, 0x51, 0x7a, 0xbd,
+    0x30, 0x53, 0x46, 0xf2, 0xca, 0x42, 0x43, 0x12, 0x08, 0x4b, 0x6c, 0x48, 0x9a, 0xb9, 0x26, 0x30,
+    0x8d, 0x80, 0xaa, 0xe3, 0xa0, 0x3e, 0xac, 0x42, 0xb5, 0xc8, 0xe7, 0xd9, 0x9f, 0x49, 0x19, 0xeb,
+    0xc9, 0x10, 0x76, 0x0e, 0x94, 0xa1, 0x4c, 0x8c, 0xa8, 0xe4, 0x97, 0xf1, 0xa3, 0x0e, 0xb8, 0x9e,
+    0xf6, 0x12, 0xcf, 0xbb, 0x0c, 0x51, 0xc6, 0xa2, 0x32, 0x9c, 0x85, 0x51, 0x15, 0x90, 0x35, 0xec,
+    0xaa, 0xc3, 0xae, 0x6f, 0x43, 0x29, 0xa3, 0xa8, 0x30, 0x56, 0x7e, 0x51, 0xc1, 0x4c, 0x6c, 0xa3,
+    0x41, 0x94, 0x71, 0x4f, 0x11, 0x54, 0x53, 0x5e, 0xe1, 0xd7, 0x53, 0x09, 0x75, 0x4a, 0xe5, 0x13,
+    0xf9, 0x63, 0xf0, 0xf9, 0x92, 0x0c, 0x4f, 0x08, 0x2b, 0x4b, 0x00, 0x4c, 0x86, 0x60, 0x03, 0x79,
+    0xf3, 0x82, 0x03, 0xac, 0x2a, 0xa2, 0x41, 0xfe, 0x30, 0x8d, 0xa8, 0x9c, 0xef, 0xe9, 0x42, 0xc3,
+    0x34, 0xbe, 0x2a, 0xc2, 0xad, 0xa7, 0xbd, 0xfc, 0x61, 0xe8, 0x1a, 0x39, 0xdb, 0xd3, 0xe5, 0x81,
+    0x85, 0x0b, 0x54, 0x94, 0x3b, 0x4c, 0x66, 0xf5, 0xd3, 0x4e, 0x9d, 0x18, 0x3f, 0x7d, 0xa6, 0x9b,
+    0x86, 0x51, 0xc7, 0x6a, 0x9d, 0xaa, 0x20, 0x15, 0x44, 0xe8, 0x53, 0xae, 0x8f, 0x40, 0xf2, 0x30,
+    0x9d, 0x0f, 0xc1, 0x91, 0x87, 0x35, 0x1b, 0xb2, 0x41, 0x41, 0x75, 0x66, 0x55, 0xc1, 0x62, 0x16,
+    0xd0, 0x30, 0x9b, 0x4f, 0x91, 0x0a, 0x34, 0x63, 0x7e, 0x3a, 0xa5, 0x3c, 0x2d, 0xa9, 0x2a, 0x6e,
+    0x58, 0xe9, 0x56, 0x0a, 0xb5, 0x58, 0x54, 0x47, 0xb7, 0x49, 0xa6, 0x57, 0x4b, 0xee, 0x59, 0x08,
+    0x3a, 0xa3, 0xaa, 0x6f, 0xcc, 0x61, 0xaf, 0x39, 0x1a, 0x29, 0xcd, 0xaa, 0xcf, 0x57, 0xa1, 0x87,
+    0x78, 0x7c, 0x77, 0xab, 0xdd, 0x6d, 0xea, 0x35, 0x76, 0x6e, 0xcb, 0x3c, 0xf0, 0x4e, 0x70, 0x6f,
+    0x0f, 0x5e, 0xa5, 0x91, 0x42, 0xe8, 0x63, 0xcd, 0x2b, 0x29, 0x56, 0x6c, 0x94, 0xa5, 0xa7, 0x65,
+    0xe7, 0xe5, 0x72, 0xb5, 0x69, 0x53, 0xcb, 0x74, 0x5d, 0x03, 0x95, 0x5b, 0xd4, 0xa0, 0x3a, 0x57,
+    0xef, 0x65, 0x93, 0x28, 0x9a, 0xe6, 0x69, 0x34, 0x49, 0xa3, 0x05, 0x16, 0x88, 0xd6, 0x68, 0xbe,
+    0xc6, 0x7a, 0xa8, 0x93, 0x92, 0x1c, 0xd0, 0xe5, 0xc1, 0x46, 0x3d, 0xf6, 0x6b, 0xe5, 0x29, 0xc8,
+    0xb1, 0x4f, 0x72, 0x63, 0x6d, 0x7c, 0xdf, 0x3a, 0xf5, 0x61, 0xb4, 0xe2, 0xe7, 0x1c, 0xd5, 0x52,
+    0x59, 0x86, 0x1e, 0x43, 0xb3, 0x7c, 0x4c, 0x7d, 0x70, 0xcf, 0x4a, 0xdc, 0x5e, 0x42, 0x6d, 0x52,
+    0xce, 0xae, 0xac, 0x5a, 0x3d, 0xa9, 0x60, 0x9d, 0x0a, 0xb7, 0x6d, 0xae, 0xae, 0xac, 0x61, 0xa5,
+    0xad, 0x14, 0x8d, 0xb5, 0x4c, 0xb2, 0xab, 0x72, 0x70, 0xc3, 0x4f, 0x21, 0x98, 0x02, 0x3d, 0xb3,
+    0xf8, 0xa1, 0x34, 0x55, 0xf1, 0xbf, 0xa9, 0xd2, 0x9b, 0xe2, 0x61, 0xaf, 0x75, 0xf1, 0x4c, 0xb4,
+    0x86, 0xe2, 0xfc, 0x36, 0xec, 0x5e, 0x61, 0xcd, 0x58, 0x13, 0xcc, 0xca, 0x48, 0x0d, 0x72, 0x35,
+    0xfe, 0x66, 0xd7, 0xd3, 0x11, 0x79, 0x2a, 0x81, 0x6d, 0x69, 0x4b, 0x8f, 0x2a, 0x9c, 0xa1, 0xdc,
+    0x97, 0x8d, 0x7f, 0xe0, 0x97, 0x78, 0x78, 0xf4, 0x70, 0x09, 0x7b, 0x01, 0x33, 0x54, 0xa7, 0x61,
+    0x27, 0x0c, 0x6b, 0x5e, 0x81, 0x34, 0x07, 0x1a, 0x6f, 0x81, 0xcb, 0x43, 0x08, 0x32, 0x3f, 0x9a,
+    0x27, 0x73, 0x8c, 0xab, 0x29, 0x7e, 0x92, 0x9a, 0xbc, 0x83, 0x7b, 0xed, 0xff, 0x01, 0x13, 0x1b,
+    0xd6, 0x6e};
 
 const char* shaderSource() {
     static std::string decompressed = util::decompress(std::string(reinterpret_cast<const char*>(compressedShaderSource), sizeof(compressedShaderSource)));
@@ -52,6 +52,10 @@ public:
     HeatmapLayerPrograms(gfx::Context& context, const ProgramParameters& programParameters) 
         : heatmap(context, programParameters),
           heatmapTexture(context, programParameters) {}
+    void precompile(gfx::Context& context) override {
+        heatmap.program->precompile(context);
+        heatmapTexture.program->precompile(context);
+    }
     HeatmapProgram heatmap;
     HeatmapTextureProgram heatmapTexture;
 };
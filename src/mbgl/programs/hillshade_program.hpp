@@ -59,6 +59,10 @@ public:
     HillshadeLayerPrograms(gfx::Context& context, const ProgramParameters& programParameters)
         : hillshade(context, programParameters),
           hillshadePrepare(context, programParameters) {}
+    void precompile(gfx::Context& context) override {
+        hillshade.program->precompile(context);
+        hillshadePrepare.program->precompile(context);
+    }
     HillshadeProgram hillshade;
     HillshadePrepareProgram hillshadePrepare;
 };
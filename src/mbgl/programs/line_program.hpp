@@ -190,6 +190,12 @@ public:
           lineGradient(context, programParameters),
           lineSDF(context, programParameters),
           linePattern(context, programParameters) {}
+    void precompile(gfx::Context& context) override {
+        line.program->precompile(context);
+        lineGradient.program->precompile(context);
+        lineSDF.program->precompile(context);
+        linePattern.program->precompile(context);
+    }
     LineProgram line;
     LineGradientProgram lineGradient;
     LineSDFProgram lineSDF;
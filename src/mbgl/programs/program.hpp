@@ -3,20 +3,113 @@
 #include <mbgl/gfx/attribute.hpp>
 #include <mbgl/gfx/uniform.hpp>
 #include <mbgl/gfx/draw_mode.hpp>
+#include <mbgl/gfx/depth_mode.hpp>
+#include <mbgl/gfx/stencil_mode.hpp>
+#include <mbgl/gfx/color_mode.hpp>
+#include <mbgl/gfx/cull_face_mode.hpp>
+#include <mbgl/gfx/texture.hpp>
+#include <mbgl/gfx/program.hpp>
+#include <mbgl/gfx/render_pass.hpp>
 #include <mbgl/programs/segment.hpp>
 #include <mbgl/programs/attributes.hpp>
 #include <mbgl/programs/program_parameters.hpp>
 #include <mbgl/style/paint_property.hpp>
 #include <mbgl/renderer/paint_property_binder.hpp>
 #include <mbgl/util/io.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <unordered_map>
+#include <vector>
 
 namespace mbgl {
 
-namespace gfx {
-class RenderPass;
-} // namespace gfx
+// Draws of a program recorded while a batch is open, see drawOrBatch().
+template <class Name, class DrawMode>
+class BatchedProgramDraws final : public gfx::BatchedDraws {
+public:
+    struct Draw {
+        DrawMode drawMode;
+        gfx::DepthMode depthMode;
+        gfx::StencilMode stencilMode;
+        gfx::ColorMode colorMode;
+        gfx::CullFaceMode cullFaceMode;
+        gfx::UniformValues<typename Name::UniformList> uniformValues;
+        gfx::DrawScope* drawScope;
+        gfx::AttributeBindings<typename Name::AttributeList> attributeBindings;
+        gfx::TextureBindings<typename Name::TextureList> textureBindings;
+        const gfx::IndexBuffer* indexBuffer;
+        std::size_t indexOffset;
+        std::size_t indexLength;
+        optional<std::size_t> instanceCount;
+    };
+
+    BatchedProgramDraws(gfx::Program<Name>& program_, gfx::Context& context_, gfx::RenderPass& renderPass_)
+        : program(program_), context(context_), renderPass(renderPass_) {}
+
+    void draw(std::size_t index) override {
+        const Draw& d = draws[index];
+        if (d.instanceCount) {
+            program.drawInstanced(context, renderPass, d.drawMode, d.depthMode, d.stencilMode, d.colorMode,
+                                  d.cullFaceMode, d.uniformValues, *d.drawScope, d.attributeBindings,
+                                  d.textureBindings, *d.indexBuffer, d.indexOffset, d.indexLength,
+                                  *d.instanceCount);
+        } else {
+            program.draw(context, renderPass, d.drawMode, d.depthMode, d.stencilMode, d.colorMode,
+                         d.cullFaceMode, d.uniformValues, *d.drawScope, d.attributeBindings,
+                         d.textureBindings, *d.indexBuffer, d.indexOffset, d.indexLength);
+        }
+    }
+
+    void clear() override { draws.clear(); }
+
+    std::vector<Draw> draws;
+
+private:
+    gfx::Program<Name>& program;
+    gfx::Context& context;
+    gfx::RenderPass& renderPass;
+};
+
+// Issues a draw, or records it if the render pass has an open batch (see
+// gfx::RenderPass::beginBatch()), in which case the arguments are copied until the batch ends.
+// Draws `instanceCount` instances if given, see gfx::Program::drawInstanced().
+template <class Name, class DrawMode>
+void drawOrBatch(gfx::Program<Name>& program,
+                 gfx::Context& context,
+                 gfx::RenderPass& renderPass,
+                 const DrawMode& drawMode,
+                 const gfx::DepthMode& depthMode,
+                 const gfx::StencilMode& stencilMode,
+                 const gfx::ColorMode& colorMode,
+                 const gfx::CullFaceMode& cullFaceMode,
+                 const gfx::UniformValues<typename Name::UniformList>& uniformValues,
+                 gfx::DrawScope& drawScope,
+                 const gfx::AttributeBindings<typename Name::AttributeList>& attributeBindings,
+                 const gfx::TextureBindings<typename Name::TextureList>& textureBindings,
+                 const gfx::IndexBuffer& indexBuffer,
+                 std::size_t indexOffset,
+                 std::size_t indexLength,
+                 optional<std::size_t> instanceCount = {}) {
+    if (!renderPass.isBatching()) {
+        if (instanceCount) {
+            program.drawInstanced(context, renderPass, drawMode, depthMode, stencilMode, colorMode,
+                                  cullFaceMode, uniformValues, drawScope, attributeBindings,
+                                  textureBindings, indexBuffer, indexOffset, indexLength, *instanceCount);
+        } else {
+            program.draw(context, renderPass, drawMode, depthMode, stencilMode, colorMode,
+                         cullFaceMode, uniformValues, drawScope, attributeBindings,
+                         textureBindings, indexBuffer, indexOffset, indexLength);
+        }
+        return;
+    }
+
+    auto& batched =
+        renderPass.getBatchedDraws<BatchedProgramDraws<Name, DrawMode>>(&program, program, context, renderPass);
+    batched.draws.push_back({ drawMode, depthMode, stencilMode, colorMode, cullFaceMode, uniformValues,
+                              &drawScope, attributeBindings, textureBindings, &indexBuffer, indexOffset,
+                              indexLength, instanceCount });
+    renderPass.batch(batched, batched.draws.size() - 1);
+}
 
 template <class Name,
           gfx::PrimitiveType Primitive,
@@ -95,20 +188,21 @@ public:
             drawScopeIt = segment.drawScopes.emplace(layerID, context.createDrawScope()).first;
         }
 
-        program->draw(context,
-                      renderPass,
-                      drawMode,
-                      depthMode,
-                      stencilMode,
-                      colorMode,
-                      cullFaceMode,
-                      uniformValues,
-                      drawScopeIt->second,
-                      allAttributeBindings.offset(segment.vertexOffset),
-                      textureBindings,
-                      indexBuffer,
-                      segment.indexOffset,
-                      segment.indexLength);
+        drawOrBatch(*program,
+                    context,
+                    renderPass,
+                    drawMode,
+                    depthMode,
+                    stencilMode,
+                    colorMode,
+                    cullFaceMode,
+                    uniformValues,
+                    drawScopeIt->second,
+                    allAttributeBindings.offset(segment.vertexOffset),
+                    textureBindings,
+                    indexBuffer,
+                    segment.indexOffset,
+                    segment.indexLength);
     }
 
     template <class DrawMode>
@@ -138,7 +232,8 @@ public:
                 drawScopeIt = segment.drawScopes.emplace(layerID, context.createDrawScope()).first;
             }
 
-            program->draw(
+            drawOrBatch(
+                *program,
                 context,
                 renderPass,
                 drawMode,
@@ -155,11 +250,94 @@ public:
                 segment.indexLength);
         }
     }
+
+    // Draws the indices of `indexBuffer`, which make up a single instance, once for every
+    // instance in the segment. The segment describes the instances as if each of them had been
+    // expanded into `verticesPerInstance` vertices, so that the same segments can be drawn with
+    // and without instancing.
+    template <class DrawMode, class SegmentAttributeList>
+    void drawInstanced(gfx::Context& context,
+                       gfx::RenderPass& renderPass,
+                       const DrawMode& drawMode,
+                       const gfx::DepthMode& depthMode,
+                       const gfx::StencilMode& stencilMode,
+                       const gfx::ColorMode& colorMode,
+                       const gfx::CullFaceMode& cullFaceMode,
+                       const gfx::IndexBuffer& indexBuffer,
+                       const Segment<SegmentAttributeList>& segment,
+                       const std::size_t verticesPerInstance,
+                       const UniformValues& uniformValues,
+                       const AttributeBindings& allAttributeBindings,
+                       const TextureBindings& textureBindings,
+                       const std::string& layerID) {
+        static_assert(Primitive == gfx::PrimitiveTypeOf<DrawMode>::value, "incompatible draw mode");
+
+        if (!program) {
+            return;
+        }
+
+        auto drawScopeIt = segment.drawScopes.find(layerID);
+        if (drawScopeIt == segment.drawScopes.end()) {
+            drawScopeIt = segment.drawScopes.emplace(layerID, context.createDrawScope()).first;
+        }
+
+        drawOrBatch(*program,
+                    context,
+                    renderPass,
+                    drawMode,
+                    depthMode,
+                    stencilMode,
+                    colorMode,
+                    cullFaceMode,
+                    uniformValues,
+                    drawScopeIt->second,
+                    allAttributeBindings.offsetInstances(segment.vertexOffset / verticesPerInstance),
+                    textureBindings,
+                    indexBuffer,
+                    0,
+                    indexBuffer.elements,
+                    segment.vertexLength / verticesPerInstance);
+    }
+
+    template <class DrawMode, class SegmentAttributeList>
+    void drawInstanced(gfx::Context& context,
+                       gfx::RenderPass& renderPass,
+                       const DrawMode& drawMode,
+                       const gfx::DepthMode& depthMode,
+                       const gfx::StencilMode& stencilMode,
+                       const gfx::ColorMode& colorMode,
+                       const gfx::CullFaceMode& cullFaceMode,
+                       const gfx::IndexBuffer& indexBuffer,
+                       const SegmentVector<SegmentAttributeList>& segments,
+                       const std::size_t verticesPerInstance,
+                       const UniformValues& uniformValues,
+                       const AttributeBindings& allAttributeBindings,
+                       const TextureBindings& textureBindings,
+                       const std::string& layerID) {
+        for (auto& segment : segments) {
+            drawInstanced(context,
+                          renderPass,
+                          drawMode,
+                          depthMode,
+                          stencilMode,
+                          colorMode,
+                          cullFaceMode,
+                          indexBuffer,
+                          segment,
+                          verticesPerInstance,
+                          uniformValues,
+                          allAttributeBindings,
+                          textureBindings,
+                          layerID);
+        }
+    }
 };
 
 class LayerTypePrograms {
 public:
     virtual ~LayerTypePrograms() = default;
+    // Precompiles the programs of the layer type, see gfx::Program::precompile().
+    virtual void precompile(gfx::Context&) = 0;
 };
 
 } // namespace mbgl
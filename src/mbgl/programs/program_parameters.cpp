@@ -1,10 +1,15 @@
 #include <mbgl/programs/program_parameters.hpp>
+#include <mbgl/util/hash.hpp>
 #include <mbgl/util/string.hpp>
 
+#include <iomanip>
+#include <sstream>
+
 namespace mbgl {
 
 ProgramParameters::ProgramParameters(const float pixelRatio,
-                                     const bool overdraw)
+                                     const bool overdraw,
+                                     optional<std::string> cacheDir_)
     : defines([&] {
           std::string result;
           result.reserve(32);
@@ -15,11 +20,22 @@ ProgramParameters::ProgramParameters(const float pixelRatio,
               result += "#define OVERDRAW_INSPECTOR\n";
           }
           return result;
-      }()) {
+      }()),
+      cacheDir(std::move(cacheDir_)) {
 }
 
 const std::string& ProgramParameters::getDefines() const {
     return defines;
 }
 
+optional<std::string> ProgramParameters::cachePath(const char* name, const std::string& identifier) const {
+    if (!cacheDir) {
+        return {};
+    }
+    std::ostringstream ss;
+    ss << *cacheDir << "/com.mapbox.gl.shader." << name << "." << std::setfill('0')
+       << std::setw(sizeof(size_t) * 2) << std::hex << util::hash(defines, identifier) << ".pbf";
+    return ss.str();
+}
+
 } // namespace mbgl
@@ -8,12 +8,18 @@ namespace mbgl {
 
 class ProgramParameters {
 public:
-    ProgramParameters(float pixelRatio, bool overdraw);
+    ProgramParameters(float pixelRatio, bool overdraw, optional<std::string> cacheDir = {});
 
     const std::string& getDefines() const;
 
+    // Path of the program binary cache file of the named program, or nullopt if programs are
+    // not cached. `identifier` must describe everything the binary depends on besides the
+    // defines, such as the shader sources and the driver.
+    optional<std::string> cachePath(const char* name, const std::string& identifier) const;
+
 private:
     std::string defines;
+    optional<std::string> cacheDir;
 };
 
 } // namespace mbgl
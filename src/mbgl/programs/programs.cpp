@@ -9,6 +9,9 @@
 #include <mbgl/programs/line_program.hpp>
 #include <mbgl/programs/raster_program.hpp>
 #include <mbgl/programs/symbol_program.hpp>
+#include <mbgl/style/layer.hpp>
+
+#include <cstring>
 
 namespace mbgl {
 
@@ -83,4 +86,41 @@ SymbolLayerPrograms& Programs::getSymbolLayerPrograms() noexcept {
     return static_cast<SymbolLayerPrograms&>(*symbolPrograms);   
 }
 
+void Programs::precompile(const style::LayerTypeInfo* typeInfo) {
+    if (!precompiledLayerTypes.insert(typeInfo).second) {
+        return;
+    }
+    if (precompiledLayerTypes.size() == 1) {
+        debug.program->precompile(context);
+        clippingMask.program->precompile(context);
+    }
+
+    const char* type = typeInfo->type;
+    LayerTypePrograms* programs = nullptr;
+    if (std::strcmp(type, "background") == 0) {
+        programs = &getBackgroundLayerPrograms();
+    } else if (std::strcmp(type, "circle") == 0) {
+        programs = &getCircleLayerPrograms();
+    } else if (std::strcmp(type, "raster") == 0) {
+        programs = &getRasterLayerPrograms();
+    } else if (std::strcmp(type, "heatmap") == 0) {
+        programs = &getHeatmapLayerPrograms();
+    } else if (std::strcmp(type, "hillshade") == 0) {
+        programs = &getHillshadeLayerPrograms();
+    } else if (std::strcmp(type, "fill") == 0) {
+        programs = &getFillLayerPrograms();
+    } else if (std::strcmp(type, "fill-extrusion") == 0) {
+        programs = &getFillExtrusionLayerPrograms();
+    } else if (std::strcmp(type, "line") == 0) {
+        programs = &getLineLayerPrograms();
+    } else if (std::strcmp(type, "symbol") == 0) {
+        programs = &getSymbolLayerPrograms();
+    }
+
+    // Other layer types, such as custom layers, bring their own programs.
+    if (programs) {
+        programs->precompile(context);
+    }
+}
+
 } // namespace mbgl
@@ -4,9 +4,14 @@
 #include <mbgl/programs/debug_program.hpp>
 #include <mbgl/programs/program_parameters.hpp>
 #include <memory>
+#include <unordered_set>
 
 namespace mbgl {
 
+namespace style {
+struct LayerTypeInfo;
+} // namespace style
+
 class BackgroundLayerPrograms;
 
 class CircleLayerPrograms;
@@ -33,6 +38,10 @@ public:
     LineLayerPrograms& getLineLayerPrograms() noexcept;
     SymbolLayerPrograms& getSymbolLayerPrograms() noexcept;
 
+    // Precompiles the programs drawing layers of the given type, along with the programs every
+    // frame uses, unless that has already been done. See gfx::Program::precompile().
+    void precompile(const style::LayerTypeInfo*);
+
     DebugProgram debug;
     ClippingMaskProgram clippingMask;
 
@@ -49,6 +58,8 @@ private:
 
     gfx::Context& context;
     ProgramParameters programParameters;
+
+    std::unordered_set<const style::LayerTypeInfo*> precompiledLayerTypes;
 };
 
 } // namespace mbgl
@@ -68,6 +68,9 @@ class RasterLayerPrograms final : public LayerTypePrograms {
 public:
     RasterLayerPrograms(gfx::Context& context, const ProgramParameters& programParameters)
         : raster(context, programParameters) {}
+    void precompile(gfx::Context& context) override {
+        raster.program->precompile(context);
+    }
     RasterProgram raster;
 };
 
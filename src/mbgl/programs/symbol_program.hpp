@@ -327,7 +327,8 @@ public:
             drawScopeIt = segment.drawScopes.emplace(layerID, context.createDrawScope()).first;
         }
 
-        program->draw(
+        drawOrBatch(
+            *program,
             context,
             renderPass,
             drawMode,
@@ -527,6 +528,14 @@ public:
           symbolTextAndIcon(context, programParameters),
           collisionBox(context, programParameters),
           collisionCircle(context, programParameters) {}
+    void precompile(gfx::Context& context) override {
+        symbolIcon.program->precompile(context);
+        symbolIconSDF.program->precompile(context);
+        symbolGlyph.program->precompile(context);
+        symbolTextAndIcon.program->precompile(context);
+        collisionBox.program->precompile(context);
+        collisionCircle.program->precompile(context);
+    }
     SymbolIconProgram symbolIcon;
     SymbolSDFIconProgram symbolIconSDF;
     SymbolSDFTextProgram symbolGlyph;
@@ -4,6 +4,7 @@
 #include <mbgl/style/image_impl.hpp>
 #include <mbgl/renderer/image_atlas.hpp>
 #include <mbgl/style/layer_impl.hpp>
+#include <mbgl/util/cancellation_token.hpp>
 #include <atomic>
 
 namespace mbgl {
@@ -41,12 +42,20 @@ public:
 
     virtual void update(const FeatureStates&, const GeometryTileLayer&, const std::string&, const ImagePositions&) {}
 
+    // Lets addFeature() skip the costly geometry processing once the tile this
+    // bucket is built for has become obsolete; the bucket is discarded then anyway.
+    void setCancellationToken(util::CancellationToken token) { cancellationToken = token; }
+
     // As long as this bucket has a Prepare render pass, this function is getting called. Typically,
     // this only happens once when the bucket is being rendered for the first time.
     virtual void upload(gfx::UploadPass&) = 0;
 
     virtual bool hasData() const = 0;
 
+    // Approximate memory held by the bucket's layout data, in bytes. Vertex and index data is
+    // handed over to the GPU by upload(), so this must be sampled before the first upload.
+    virtual std::size_t getMemoryUsage() const { return 0; }
+
     virtual float getQueryRadius(const RenderLayer&) const {
         return 0;
     };
@@ -71,6 +80,7 @@ public:
 protected:
     Bucket() = default;
     std::atomic<bool> uploaded { false };
+    util::CancellationToken cancellationToken;
 };
 
 } // namespace mbgl
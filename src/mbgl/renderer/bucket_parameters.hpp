@@ -2,6 +2,7 @@
 
 #include <mbgl/map/mode.hpp>
 #include <mbgl/tile/tile_id.hpp>
+#include <mbgl/util/cancellation_token.hpp>
 
 namespace mbgl {
 namespace style {
@@ -14,6 +15,8 @@ public:
     const MapMode mode;
     const float pixelRatio;
     const style::LayerTypeInfo* layerType;
+    // Set when the tile being laid out becomes obsolete.
+    const util::CancellationToken cancellationToken = {};
 };
 
 } // namespace mbgl
@@ -1,5 +1,7 @@
 #include <mbgl/renderer/buckets/circle_bucket.hpp>
 #include <mbgl/renderer/bucket_parameters.hpp>
+#include <mbgl/gfx/context.hpp>
+#include <mbgl/gfx/upload_pass.hpp>
 #include <mbgl/programs/circle_program.hpp>
 #include <mbgl/style/layers/circle_layer_impl.hpp>
 #include <mbgl/renderer/layers/render_circle_layer.hpp>
@@ -23,14 +25,53 @@ CircleBucket::CircleBucket(const std::map<std::string, Immutable<LayerProperties
 
 CircleBucket::~CircleBucket() = default;
 
+constexpr std::size_t CircleBucket::verticesPerCircle;
+constexpr std::size_t CircleBucket::indicesPerCircle;
+
 void CircleBucket::upload(gfx::UploadPass& uploadPass) {
+    const bool instanced = uploadPass.getContext().supportsInstancing;
+
     if (!uploaded) {
-        vertexBuffer = uploadPass.createVertexBuffer(std::move(vertices));
-        indexBuffer = uploadPass.createIndexBuffer(std::move(triangles));
+        if (instanced) {
+            instanceBuffer = uploadPass.createVertexBuffer(std::move(instances));
+        } else {
+            // this geometry will be of the Point type, and we'll derive
+            // two triangles from it.
+            //
+            // ┌─────────┐
+            // │ 4     3 │
+            // │         │
+            // │ 1     2 │
+            // └─────────┘
+            //
+            gfx::VertexVector<CircleLayoutVertex> vertices;
+            for (const auto& instance : instances.vector()) {
+                const Point<int16_t> point { instance.a1[0], instance.a1[1] };
+                vertices.emplace_back(CircleProgram::vertex(point, -1, -1)); // 1
+                vertices.emplace_back(CircleProgram::vertex(point, 1, -1));  // 2
+                vertices.emplace_back(CircleProgram::vertex(point, 1, 1));   // 3
+                vertices.emplace_back(CircleProgram::vertex(point, -1, 1));  // 4
+            }
+
+            // Indices are relative to the first vertex of their segment.
+            gfx::IndexVector<gfx::Triangles> triangles;
+            for (const auto& segment : segments) {
+                for (std::size_t index = 0; index < segment.vertexLength; index += verticesPerCircle) {
+                    const auto i = static_cast<uint16_t>(index);
+                    // 1, 2, 3
+                    // 1, 4, 3
+                    triangles.emplace_back(i, i + 1, i + 2);
+                    triangles.emplace_back(i, i + 3, i + 2);
+                }
+            }
+
+            vertexBuffer = uploadPass.createVertexBuffer(std::move(vertices));
+            indexBuffer = uploadPass.createIndexBuffer(std::move(triangles));
+        }
     }
 
     for (auto& pair : paintPropertyBinders) {
-        pair.second.upload(uploadPass);
+        pair.second.upload(uploadPass, instanced ? 1 : verticesPerCircle);
     }
 
     uploaded = true;
@@ -40,6 +81,10 @@ bool CircleBucket::hasData() const {
     return !segments.empty();
 }
 
+std::size_t CircleBucket::getMemoryUsage() const {
+    return instances.bytes();
+}
+
 template <class Property>
 static float get(const CirclePaintProperties::PossiblyEvaluated& evaluated, const std::string& id, const std::map<std::string, CircleProgram::Binders>& paintPropertyBinders) {
     auto it = paintPropertyBinders.find(id);
@@ -23,6 +23,7 @@ public:
     ~CircleBucket() override;
 
     bool hasData() const override;
+    std::size_t getMemoryUsage() const override;
 
     void upload(gfx::UploadPass&) override;
 
@@ -30,10 +31,19 @@ public:
 
     void update(const FeatureStates&, const GeometryTileLayer&, const std::string&, const ImagePositions&) override;
 
-    gfx::VertexVector<CircleLayoutVertex> vertices;
-    gfx::IndexVector<gfx::Triangles> triangles;
+    // Number of vertices and indices of a circle that is drawn without instancing.
+    static constexpr std::size_t verticesPerCircle = 4;
+    static constexpr std::size_t indicesPerCircle = 6;
+
+    // One record per circle, as are the vertex vectors of the paint property binders. The segments
+    // count verticesPerCircle vertices and indicesPerCircle indices per circle.
+    gfx::VertexVector<CircleInstance> instances;
     SegmentVector<CircleAttributes> segments;
 
+    // Uploaded if the context supports instancing.
+    optional<gfx::VertexBuffer<CircleInstance>> instanceBuffer;
+
+    // Otherwise, every circle is expanded into a quad on upload.
     optional<gfx::VertexBuffer<CircleLayoutVertex>> vertexBuffer;
     optional<gfx::IndexBuffer> indexBuffer;
 
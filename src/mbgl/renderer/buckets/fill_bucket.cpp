@@ -50,6 +50,10 @@ void FillBucket::addFeature(const GeometryTileFeature& feature,
                             std::size_t index,
                             const CanonicalTileID& canonical) {
     for (auto& polygon : classifyRings(geometry)) {
+        if (cancellationToken.isCancelled()) {
+            break;
+        }
+
         // Optimize polygons with many interior rings for earcut tesselation.
         limitHoles(polygon, 500);
 
@@ -142,6 +146,10 @@ bool FillBucket::hasData() const {
     return !triangleSegments.empty() || !lineSegments.empty();
 }
 
+std::size_t FillBucket::getMemoryUsage() const {
+    return vertices.bytes() + lines.bytes() + triangles.bytes();
+}
+
 float FillBucket::getQueryRadius(const RenderLayer& layer) const {
     const auto& evaluated = getEvaluated<FillLayerProperties>(layer.evaluatedProperties);
     const std::array<float, 2>& translate = evaluated.get<FillTranslate>();
@@ -57,6 +57,10 @@ void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
                                      std::size_t index,
                                      const CanonicalTileID& canonical) {
     for (auto& polygon : classifyRings(geometry)) {
+        if (cancellationToken.isCancelled()) {
+            break;
+        }
+
         // Optimize polygons with many interior rings for earcut tesselation.
         limitHoles(polygon, 500);
 
@@ -185,6 +189,10 @@ bool FillExtrusionBucket::hasData() const {
     return !triangleSegments.empty();
 }
 
+std::size_t FillExtrusionBucket::getMemoryUsage() const {
+    return vertices.bytes() + triangles.bytes();
+}
+
 float FillExtrusionBucket::getQueryRadius(const RenderLayer& layer) const {
     const auto& evaluated = getEvaluated<FillExtrusionLayerProperties>(layer.evaluatedProperties);
     const std::array<float, 2>& translate = evaluated.get<FillExtrusionTranslate>();
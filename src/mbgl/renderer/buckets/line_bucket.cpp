@@ -35,6 +35,9 @@ void LineBucket::addFeature(const GeometryTileFeature& feature,
                             std::size_t index,
                             const CanonicalTileID& canonical) {
     for (auto& line : geometryCollection) {
+        if (cancellationToken.isCancelled()) {
+            break;
+        }
         addGeometry(line, feature, canonical);
     }
 
@@ -536,6 +539,10 @@ bool LineBucket::hasData() const {
     return !segments.empty();
 }
 
+std::size_t LineBucket::getMemoryUsage() const {
+    return vertices.bytes() + triangles.bytes();
+}
+
 template <class Property>
 static float get(const LinePaintProperties::PossiblyEvaluated& evaluated, const std::string& id, const std::map<std::string, LineProgram::Binders>& paintPropertyBinders) {
     auto it = paintPropertyBinders.find(id);
@@ -108,5 +108,9 @@ bool RasterBucket::hasData() const {
     return !!image;
 }
 
+std::size_t RasterBucket::getMemoryUsage() const {
+    return (image ? image->bytes() : 0) + vertices.bytes() + indices.bytes();
+}
+
 
 } // namespace mbgl
@@ -178,6 +178,15 @@ bool SymbolBucket::hasData() const {
            hasTextCollisionBoxData() || hasIconCollisionCircleData() || hasTextCollisionCircleData();
 }
 
+std::size_t SymbolBucket::getMemoryUsage() const {
+    std::size_t bytes = symbolInstances.size() * sizeof(SymbolInstance);
+    for (const Buffer* buffer : {&text, &icon, &sdfIcon}) {
+        bytes += buffer->vertices.bytes() + buffer->dynamicVertices.bytes() + buffer->opacityVertices.bytes() +
+                 buffer->triangles.bytes() + buffer->placedSymbols.size() * sizeof(PlacedSymbol);
+    }
+    return bytes;
+}
+
 bool SymbolBucket::hasTextData() const {
     return !text.segments.empty();
 }
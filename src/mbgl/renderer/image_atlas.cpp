@@ -1,8 +1,15 @@
 #include <mbgl/renderer/image_atlas.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 
+#include <mbgl/gfx/upload_pass.hpp>
+
 #include <mapbox/shelf-pack.hpp>
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
+
 namespace mbgl {
 
 static constexpr uint32_t padding = 1;
@@ -15,18 +22,9 @@ ImagePosition::ImagePosition(const mapbox::Bin& bin, const style::Image::Impl& i
       stretchY(image.stretchY),
       content(image.content) {}
 
-const mapbox::Bin& _packImage(mapbox::ShelfPack& pack, const style::Image::Impl& image, ImageAtlas& resultImage, ImageType imageType) {
-    const mapbox::Bin& bin = *pack.packOne(-1,
-        image.image.size.width + 2 * padding,
-        image.image.size.height + 2 * padding);
-
-    resultImage.image.resize({
-        static_cast<uint32_t>(pack.width()),
-        static_cast<uint32_t>(pack.height())
-    });
-
+void _copyImage(const style::Image::Impl& image, PremultipliedImage& dst, const mapbox::Bin& bin, ImageType imageType) {
     PremultipliedImage::copy(image.image,
-                             resultImage.image,
+                             dst,
                              { 0, 0 },
                              {
                                 bin.x + padding,
@@ -40,11 +38,24 @@ const mapbox::Bin& _packImage(mapbox::ShelfPack& pack, const style::Image::Impl&
 
     if (imageType == ImageType::Pattern) {
             // Add 1 pixel wrapped padding on each side of the image.
-        PremultipliedImage::copy(image.image, resultImage.image, { 0, h - 1 }, { x, y - 1 }, { w, 1 }); // T
-        PremultipliedImage::copy(image.image, resultImage.image, { 0,     0 }, { x, y + h }, { w, 1 }); // B
-        PremultipliedImage::copy(image.image, resultImage.image, { w - 1, 0 }, { x - 1, y }, { 1, h }); // L
-        PremultipliedImage::copy(image.image, resultImage.image, { 0,     0 }, { x + w, y }, { 1, h }); // R
+        PremultipliedImage::copy(image.image, dst, { 0, h - 1 }, { x, y - 1 }, { w, 1 }); // T
+        PremultipliedImage::copy(image.image, dst, { 0,     0 }, { x, y + h }, { w, 1 }); // B
+        PremultipliedImage::copy(image.image, dst, { w - 1, 0 }, { x - 1, y }, { 1, h }); // L
+        PremultipliedImage::copy(image.image, dst, { 0,     0 }, { x + w, y }, { 1, h }); // R
     }
+}
+
+const mapbox::Bin& _packImage(mapbox::ShelfPack& pack, const style::Image::Impl& image, ImageAtlas& resultImage, ImageType imageType) {
+    const mapbox::Bin& bin = *pack.packOne(-1,
+        image.image.size.width + 2 * padding,
+        image.image.size.height + 2 * padding);
+
+    resultImage.image.resize({
+        static_cast<uint32_t>(pack.width()),
+        static_cast<uint32_t>(pack.height())
+    });
+
+    _copyImage(image, resultImage.image, bin, imageType);
     return bin;
 }
 
@@ -112,4 +123,222 @@ ImageAtlas makeImageAtlas(const ImageMap& icons, const ImageMap& patterns, const
     return result;
 }
 
+struct SharedImageAtlas::Entry {
+    // Keeps the image alive, so that its address identifies it as long as the entry exists.
+    Immutable<style::Image::Impl> image;
+    ImageType type;
+    mapbox::Bin* bin;
+    ImagePosition position;
+    std::size_t references;
+};
+
+class SharedImageAtlas::Pack {
+public:
+    explicit Pack(uint16_t maxSize_) : maxSize(maxSize_), shelfPack(initialSize, initialSize) {
+        image.resize({initialSize, initialSize});
+    }
+
+    // Returns the entry of the image, packing it if needed, or null if it does not fit.
+    Entry* add(const Immutable<style::Image::Impl>&, ImageType, uint32_t version);
+    // Copies the image into the bin of the entry and brings the entry to the given version.
+    void write(Entry&, const style::Image::Impl&, uint32_t version);
+    void release(const std::vector<Entry*>&);
+    void evictUnused();
+
+    static constexpr uint16_t initialSize = 256;
+    const uint16_t maxSize;
+
+    std::mutex mutex;
+    mapbox::ShelfPack shelfPack;
+    PremultipliedImage image;
+    // Keyed by the image object too: images replaced with a different size, or by a new style,
+    // get entries of their own while layouts using the old ones are alive.
+    std::map<std::tuple<std::string, ImageType, const style::Image::Impl*>, Entry> entries;
+    // Latest versions of the images updated in place, for layouts that still use an older one.
+    std::unordered_map<std::string, std::pair<Immutable<style::Image::Impl>, uint32_t>> updatedImages;
+    // Region of the image changed since the last upload.
+    optional<Rect<uint32_t>> dirty;
+};
+
+SharedImageAtlas::Entry* SharedImageAtlas::Pack::add(const Immutable<style::Image::Impl>& image_,
+                                                     ImageType type,
+                                                     uint32_t version) {
+    Entry* entry = nullptr;
+    auto it = entries.find(std::make_tuple(image_->id, type, image_.get()));
+    if (it != entries.end()) {
+        entry = &it->second;
+    } else {
+        const int32_t width = image_->image.size.width + 2 * padding;
+        const int32_t height = image_->image.size.height + 2 * padding;
+        mapbox::Bin* bin = shelfPack.packOne(-1, width, height);
+        while (!bin && (shelfPack.width() < maxSize || shelfPack.height() < maxSize)) {
+            // Existing bins keep their position when the pack grows.
+            shelfPack.resize(std::min<int32_t>(shelfPack.width() * 2, maxSize),
+                             std::min<int32_t>(shelfPack.height() * 2, maxSize));
+            bin = shelfPack.packOne(-1, width, height);
+        }
+        if (!bin) {
+            evictUnused();
+            bin = shelfPack.packOne(-1, width, height);
+        }
+        if (!bin) {
+            return nullptr;
+        }
+
+        image.resize({static_cast<uint32_t>(shelfPack.width()), static_cast<uint32_t>(shelfPack.height())});
+        entry = &entries
+                     .emplace(std::make_tuple(image_->id, type, image_.get()),
+                              Entry{image_, type, bin, ImagePosition{*bin, *image_, version}, 0})
+                     .first->second;
+        write(*entry, *image_, version);
+    }
+
+    auto updated = updatedImages.find(image_->id);
+    if (updated != updatedImages.end() && updated->second.second > entry->position.version &&
+        updated->second.first->image.size == image_->image.size) {
+        write(*entry, *updated->second.first, updated->second.second);
+    }
+    return entry;
+}
+
+void SharedImageAtlas::Pack::write(Entry& entry, const style::Image::Impl& image_, uint32_t version) {
+    _copyImage(image_, image, *entry.bin, entry.type);
+    entry.position.version = version;
+
+    const Rect<uint32_t> rect{static_cast<uint32_t>(entry.bin->x),
+                              static_cast<uint32_t>(entry.bin->y),
+                              static_cast<uint32_t>(entry.bin->w),
+                              static_cast<uint32_t>(entry.bin->h)};
+    if (!dirty) {
+        dirty = rect;
+    } else {
+        const uint32_t right = std::max(dirty->x + dirty->w, rect.x + rect.w);
+        const uint32_t bottom = std::max(dirty->y + dirty->h, rect.y + rect.h);
+        dirty->x = std::min(dirty->x, rect.x);
+        dirty->y = std::min(dirty->y, rect.y);
+        dirty->w = right - dirty->x;
+        dirty->h = bottom - dirty->y;
+    }
+}
+
+void SharedImageAtlas::Pack::release(const std::vector<Entry*>& released) {
+    for (Entry* entry : released) {
+        assert(entry->references);
+        --entry->references;
+    }
+}
+
+void SharedImageAtlas::Pack::evictUnused() {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.references) {
+            ++it;
+            continue;
+        }
+        // Clear the padding, which a smaller image reusing the bin relies on.
+        const mapbox::Bin& bin = *it->second.bin;
+        PremultipliedImage::clear(image,
+                                  {static_cast<uint32_t>(bin.x), static_cast<uint32_t>(bin.y)},
+                                  {static_cast<uint32_t>(bin.w), static_cast<uint32_t>(bin.h)});
+        shelfPack.unref(*it->second.bin);
+        it = entries.erase(it);
+    }
+}
+
+SharedImageAtlas::Reference::Reference(std::shared_ptr<Pack> pack_) : pack(std::move(pack_)) {}
+
+SharedImageAtlas::Reference::~Reference() {
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    pack->release(entries);
+}
+
+SharedImageAtlas::SharedImageAtlas(uint16_t maxSize) : pack(std::make_shared<Pack>(maxSize)) {}
+
+SharedImageAtlas::~SharedImageAtlas() = default;
+
+std::shared_ptr<const SharedImageAtlas::Reference> SharedImageAtlas::addImages(const ImageMap& icons,
+                                                                               const ImageMap& patterns,
+                                                                               const ImageVersionMap& versionMap) {
+    auto reference = std::make_shared<Reference>(pack);
+
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    const auto addAll = [&](const ImageMap& images, ImageType type, ImagePositions& positions) {
+        for (const auto& entry : images) {
+            auto it = versionMap.find(entry.first);
+            const uint32_t version = it != versionMap.end() ? it->second : 0;
+            Entry* atlasEntry = pack->add(entry.second, type, version);
+            if (!atlasEntry) {
+                return false;
+            }
+            ++atlasEntry->references;
+            reference->entries.push_back(atlasEntry);
+            positions.emplace(entry.second->id, atlasEntry->position);
+        }
+        return true;
+    };
+
+    if (!addAll(icons, ImageType::Icon, reference->iconPositions) ||
+        !addAll(patterns, ImageType::Pattern, reference->patternPositions)) {
+        pack->release(reference->entries);
+        reference->entries.clear();
+        return nullptr;
+    }
+
+    return reference;
+}
+
+void SharedImageAtlas::updateImage(Immutable<style::Image::Impl> image, uint32_t version) {
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    for (auto& entry : pack->entries) {
+        if (std::get<0>(entry.first) == image->id && entry.second.position.version < version &&
+            entry.second.image->image.size == image->image.size) {
+            pack->write(entry.second, *image, version);
+        }
+    }
+    const std::string id = image->id;
+    pack->updatedImages.erase(id);
+    pack->updatedImages.emplace(id, std::make_pair(std::move(image), version));
+}
+
+void SharedImageAtlas::removeImage(const std::string& id) {
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    pack->updatedImages.erase(id);
+}
+
+void SharedImageAtlas::clear() {
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    pack->updatedImages.clear();
+}
+
+void SharedImageAtlas::upload(gfx::UploadPass& uploadPass) {
+    std::unique_lock<std::mutex> lock(pack->mutex);
+    if (!texture || texture->size != pack->image.size) {
+        texture = uploadPass.createTexture(pack->image);
+        pack->dirty = nullopt;
+    } else if (pack->dirty) {
+        const Rect<uint32_t> rect = *pack->dirty;
+        PremultipliedImage patch({rect.w, rect.h});
+        PremultipliedImage::copy(pack->image, patch, {rect.x, rect.y}, {0, 0}, patch.size);
+        pack->dirty = nullopt;
+        lock.unlock();
+
+        uploadPass.updateTextureSub(
+            *texture, patch, static_cast<uint16_t>(rect.x), static_cast<uint16_t>(rect.y));
+    }
+}
+
+const gfx::Texture& SharedImageAtlas::getTexture() const {
+    assert(texture);
+    return *texture;
+}
+
+Size SharedImageAtlas::getPixelSize() const {
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    return pack->image.size;
+}
+
+std::size_t SharedImageAtlas::getImageCount() const {
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    return pack->entries.size();
+}
+
 } // namespace mbgl
@@ -1,17 +1,19 @@
 #pragma once
 
+#include <mbgl/gfx/texture.hpp>
 #include <mbgl/style/image_impl.hpp>
 #include <mbgl/util/rect.hpp>
 
 #include <mapbox/shelf-pack.hpp>
 
 #include <array>
+#include <memory>
+#include <vector>
 
 namespace mbgl {
 
 namespace gfx {
 class UploadPass;
-class Texture;
 } // namespace gfx
 
 class ImageManager;
@@ -73,4 +75,64 @@ public:
 
 ImageAtlas makeImageAtlas(const ImageMap&, const ImageMap&, const std::unordered_map<std::string, uint32_t>& versionMap);
 
+// Icon and pattern atlas shared by the layouts of all tiles of a renderer, owned by the
+// ImageManager. Works like SharedGlyphAtlas: layouts add their images from the worker threads and
+// get positions that stay valid for as long as they hold the returned reference. Images updated
+// in place are rewritten in the atlas, so that layouts do not need to be redone.
+class SharedImageAtlas {
+public:
+    class Reference;
+
+    explicit SharedImageAtlas(uint16_t maxSize = 2048);
+    SharedImageAtlas(const SharedImageAtlas&) = delete;
+    SharedImageAtlas& operator=(const SharedImageAtlas&) = delete;
+    ~SharedImageAtlas();
+
+    // Adds the images to the atlas, or references them if they are already in it. Returns null
+    // if they do not fit, in which case the caller should pack its own atlas with
+    // makeImageAtlas(). Safe to call from any thread.
+    std::shared_ptr<const Reference> addImages(const ImageMap& icons,
+                                               const ImageMap& patterns,
+                                               const ImageVersionMap&);
+
+    // Rewrites the image in the atlas with a new version of the same size.
+    void updateImage(Immutable<style::Image::Impl>, uint32_t version);
+    // Forgets the updated versions of the image, after it was removed or changed size.
+    void removeImage(const std::string&);
+    void clear();
+
+    // Uploads the images changed since the last upload. Must be called on the render thread.
+    void upload(gfx::UploadPass&);
+    const gfx::Texture& getTexture() const;
+
+    Size getPixelSize() const;
+    std::size_t getImageCount() const;
+
+private:
+    class Pack;
+    struct Entry;
+
+    // Shared with the references, which may outlive the atlas. The texture is not, so that it is
+    // always released on the render thread.
+    std::shared_ptr<Pack> pack;
+    optional<gfx::Texture> texture;
+};
+
+class SharedImageAtlas::Reference {
+public:
+    explicit Reference(std::shared_ptr<Pack>);
+    ~Reference();
+
+    const ImagePositions& getIconPositions() const { return iconPositions; }
+    const ImagePositions& getPatternPositions() const { return patternPositions; }
+
+private:
+    friend class SharedImageAtlas;
+
+    std::shared_ptr<Pack> pack;
+    std::vector<Entry*> entries;
+    ImagePositions iconPositions;
+    ImagePositions patternPositions;
+};
+
 } // namespace mbgl
@@ -62,8 +62,9 @@ bool ImageManager::updateImage(Immutable<style::Image::Impl> image_) {
             requestedImagesCacheSize += diff;
         }
         updatedImageVersions.erase(image_->id);
+        sharedAtlas.removeImage(image_->id);
     } else {
-        updatedImageVersions[image_->id]++;
+        sharedAtlas.updateImage(image_, ++updatedImageVersions[image_->id]);
     }
 
     oldImage->second = std::move(image_);
@@ -84,6 +85,7 @@ void ImageManager::removeImage(const std::string& id) {
     images.erase(it);
     availableImages.erase(id);
     updatedImageVersions.erase(id);
+    sharedAtlas.removeImage(id);
 }
 
 const style::Image::Impl* ImageManager::getImage(const std::string& id) const {
@@ -182,6 +184,7 @@ void ImageManager::clear() {
     images.clear();
     availableImages.clear();
     updatedImageVersions.clear();
+    sharedAtlas.clear();
     requestedImages.clear();
     loaded = false;
 }
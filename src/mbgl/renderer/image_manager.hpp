@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mbgl/renderer/image_atlas.hpp>
 #include <mbgl/style/image_impl.hpp>
 #include <mbgl/util/immutable.hpp>
 
@@ -51,6 +52,9 @@ public:
 
     ImageVersionMap updatedImageVersions;
 
+    // Atlas of the icons and patterns used by tile layouts.
+    SharedImageAtlas& getSharedAtlas() { return sharedAtlas; }
+
     void clear();
 
 private:
@@ -69,6 +73,8 @@ private:
     std::set<std::string> availableImages;
 
     ImageManagerObserver* observer = nullptr;
+
+    SharedImageAtlas sharedAtlas;
 };
 
 class ImageRequestor {
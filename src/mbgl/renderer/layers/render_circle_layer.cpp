@@ -2,6 +2,7 @@
 #include <mbgl/renderer/buckets/circle_bucket.hpp>
 #include <mbgl/renderer/render_tile.hpp>
 #include <mbgl/renderer/paint_parameters.hpp>
+#include <mbgl/renderer/render_static_data.hpp>
 #include <mbgl/programs/programs.hpp>
 #include <mbgl/programs/circle_program.hpp>
 #include <mbgl/tile/tile.hpp>
@@ -87,7 +88,7 @@ void RenderCircleLayer::render(PaintParameters& parameters) {
         const bool pitchWithMap = evaluated.template get<CirclePitchAlignment>() == AlignmentType::Map;
         const auto& paintPropertyBinders = circleBucket.paintPropertyBinders.at(getID());
 
-        auto& programInstance = parameters.programs.getCircleLayerPrograms().circle;
+        auto& circlePrograms = parameters.programs.getCircleLayerPrograms();
         using LayoutUniformValues = CircleProgram::LayoutUniformValues;
         const auto& allUniformValues = CircleProgram::computeAllUniformValues(
             LayoutUniformValues(
@@ -105,24 +106,52 @@ void RenderCircleLayer::render(PaintParameters& parameters) {
             paintPropertyBinders,
             evaluated,
             parameters.state.getZoom());
+
+        // The bucket was uploaded for instanced drawing if the context supports it.
+        if (circleBucket.instanceBuffer) {
+            const auto& allAttributeBindings =
+                CircleInstancedProgram::computeAllAttributeBindings(*parameters.staticData.circleQuadVertexBuffer,
+                                                                    *circleBucket.instanceBuffer,
+                                                                    paintPropertyBinders,
+                                                                    evaluated);
+
+            checkRenderability(parameters, CircleInstancedProgram::activeBindingCount(allAttributeBindings));
+
+            circlePrograms.circleInstanced.drawInstanced(parameters.context,
+                                                         *parameters.renderPass,
+                                                         gfx::Triangles(),
+                                                         parameters.depthModeForSublayer(0, gfx::DepthMaskType::ReadOnly),
+                                                         gfx::StencilMode::disabled(),
+                                                         parameters.colorModeForRenderPass(),
+                                                         gfx::CullFaceMode::disabled(),
+                                                         *parameters.staticData.quadTriangleIndexBuffer,
+                                                         segments,
+                                                         CircleBucket::verticesPerCircle,
+                                                         allUniformValues,
+                                                         allAttributeBindings,
+                                                         CircleInstancedProgram::TextureBindings{},
+                                                         getID());
+            return;
+        }
+
         const auto& allAttributeBindings =
             CircleProgram::computeAllAttributeBindings(*circleBucket.vertexBuffer, paintPropertyBinders, evaluated);
 
         checkRenderability(parameters, CircleProgram::activeBindingCount(allAttributeBindings));
 
-        programInstance.draw(parameters.context,
-                             *parameters.renderPass,
-                             gfx::Triangles(),
-                             parameters.depthModeForSublayer(0, gfx::DepthMaskType::ReadOnly),
-                             gfx::StencilMode::disabled(),
-                             parameters.colorModeForRenderPass(),
-                             gfx::CullFaceMode::disabled(),
-                             *circleBucket.indexBuffer,
-                             segments,
-                             allUniformValues,
-                             allAttributeBindings,
-                             CircleProgram::TextureBindings{},
-                             getID());
+        circlePrograms.circle.draw(parameters.context,
+                                   *parameters.renderPass,
+                                   gfx::Triangles(),
+                                   parameters.depthModeForSublayer(0, gfx::DepthMaskType::ReadOnly),
+                                   gfx::StencilMode::disabled(),
+                                   parameters.colorModeForRenderPass(),
+                                   gfx::CullFaceMode::disabled(),
+                                   *circleBucket.indexBuffer,
+                                   segments,
+                                   allUniformValues,
+                                   allAttributeBindings,
+                                   CircleProgram::TextureBindings{},
+                                   getID());
     };
 
     const bool sortFeaturesByKey = !impl_cast(baseImpl).layout.get<CircleSortKey>().isUndefined();
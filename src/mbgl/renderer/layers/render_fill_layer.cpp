@@ -76,11 +76,15 @@ void RenderFillLayer::render(PaintParameters& parameters) {
     assert(renderTiles);
     if (unevaluated.get<FillPattern>().isUndefined()) {
         parameters.renderTileClippingMasks(renderTiles);
+        // Draw the fills of all tiles before their outlines (ranks 0 and 1), rather than alternating
+        // programs.
+        parameters.renderPass->beginBatch();
         for (const RenderTile& tile : *renderTiles) {
             const LayerRenderData* renderData = getRenderDataForPass(tile, parameters.pass);
             if (!renderData) {
                 continue;
             }
+            parameters.clipToTile(tile.id);
             auto& bucket = static_cast<FillBucket&>(*renderData->bucket);
             const auto& evaluated = getEvaluated<FillLayerProperties>(renderData->layerProperties);
 
@@ -132,6 +136,7 @@ void RenderFillLayer::render(PaintParameters& parameters) {
                 && evaluated.get<FillOpacity>().constantOr(0) >= 1.0f
                 && parameters.currentLayer >= parameters.opaquePassCutoff) ? RenderPass::Opaque : RenderPass::Translucent;
             if (bucket.triangleIndexBuffer && parameters.pass == fillRenderPass) {
+                parameters.renderPass->setBatchRank(0);
                 draw(parameters.programs.getFillLayerPrograms().fill,
                      gfx::Triangles(),
                      parameters.depthModeForSublayer(1, parameters.pass == RenderPass::Opaque
@@ -143,6 +148,7 @@ void RenderFillLayer::render(PaintParameters& parameters) {
             }
 
             if (evaluated.get<FillAntialias>() && parameters.pass == RenderPass::Translucent) {
+                parameters.renderPass->setBatchRank(1);
                 draw(parameters.programs.getFillLayerPrograms().fillOutline,
                      gfx::Lines{ 2.0f },
                      parameters.depthModeForSublayer(
@@ -153,6 +159,8 @@ void RenderFillLayer::render(PaintParameters& parameters) {
                      FillOutlineProgram::TextureBindings{});
             }
         }
+        parameters.clearTileClip();
+        parameters.renderPass->endBatch();
     } else {
         if (parameters.pass != RenderPass::Translucent) {
             return;
@@ -160,11 +168,13 @@ void RenderFillLayer::render(PaintParameters& parameters) {
 
         parameters.renderTileClippingMasks(renderTiles);
 
+        parameters.renderPass->beginBatch();
         for (const RenderTile& tile : *renderTiles) {
             const LayerRenderData* renderData = getRenderDataForPass(tile, parameters.pass);
             if (!renderData) {
                 continue;
             }
+            parameters.clipToTile(tile.id);
             auto& bucket = static_cast<FillBucket&>(*renderData->bucket);
             const auto& evaluated = getEvaluated<FillLayerProperties>(renderData->layerProperties);
             const auto& crossfade = getCrossfade<FillLayerProperties>(renderData->layerProperties);
@@ -222,6 +232,7 @@ void RenderFillLayer::render(PaintParameters& parameters) {
             };
 
             if (bucket.triangleIndexBuffer) {
+                parameters.renderPass->setBatchRank(0);
                 draw(parameters.programs.getFillLayerPrograms().fillPattern,
                      gfx::Triangles(),
                      parameters.depthModeForSublayer(1, gfx::DepthMaskType::ReadWrite),
@@ -232,6 +243,7 @@ void RenderFillLayer::render(PaintParameters& parameters) {
                      });
             }
             if (evaluated.get<FillAntialias>() && unevaluated.get<FillOutlineColor>().isUndefined()) {
+                parameters.renderPass->setBatchRank(1);
                 draw(parameters.programs.getFillLayerPrograms().fillOutlinePattern,
                      gfx::Lines { 2.0f },
                      parameters.depthModeForSublayer(2, gfx::DepthMaskType::ReadOnly),
@@ -242,6 +254,8 @@ void RenderFillLayer::render(PaintParameters& parameters) {
                      });
             }
         }
+        parameters.clearTileClip();
+        parameters.renderPass->endBatch();
     }
 }
 
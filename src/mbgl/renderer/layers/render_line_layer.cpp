@@ -102,6 +102,7 @@ void RenderLineLayer::render(PaintParameters& parameters) {
         if (!renderData) {
             continue;
         }
+        parameters.clipToTile(tile.id);
         auto& bucket = static_cast<LineBucket&>(*renderData->bucket);
         const auto& evaluated = getEvaluated<LineLayerProperties>(renderData->layerProperties);
         const auto& crossfade = getCrossfade<LineLayerProperties>(renderData->layerProperties);
@@ -213,6 +214,7 @@ void RenderLineLayer::render(PaintParameters& parameters) {
                  LineProgram::TextureBindings{});
         }
     }
+    parameters.clearTileClip();
 }
 
 namespace {
@@ -414,6 +414,13 @@ void RenderSymbolLayer::render(PaintParameters& parameters) {
         );
     };
 
+    // Without sort keys, the draws of all tiles are batched: RGBA icons first, then SDF icons,
+    // text and the collision debug draws, whatever each tile contains.
+    enum BatchRank : uint32_t { IconRGBARank, IconSDFRank, TextRank, CollisionRank };
+    if (!sortFeaturesByKey) {
+        parameters.renderPass->beginBatch();
+    }
+
     for (const RenderTile& tile : *renderTiles) {
         const LayerRenderData* renderData = getRenderDataForPass(tile, parameters.pass);
         if (!renderData) {
@@ -436,6 +443,7 @@ void RenderSymbolLayer::render(PaintParameters& parameters) {
             if (sortFeaturesByKey) {
                 addRenderables(bucket.icon.segments, SymbolType::IconRGBA);
             } else {
+                parameters.renderPass->setBatchRank(IconRGBARank);
                 drawIcon(draw, tile, *renderData, std::ref(bucket.icon.segments), bucketPaintProperties, parameters, false /*sdfIcon*/);
             }
         }
@@ -444,6 +452,7 @@ void RenderSymbolLayer::render(PaintParameters& parameters) {
             if (sortFeaturesByKey) {
                 addRenderables(bucket.sdfIcon.segments, SymbolType::IconSDF);
             } else {
+                parameters.renderPass->setBatchRank(IconSDFRank);
                 drawIcon(draw, tile, *renderData, std::ref(bucket.sdfIcon.segments), bucketPaintProperties, parameters, true /*sdfIcon*/);
             }
         }
@@ -452,6 +461,7 @@ void RenderSymbolLayer::render(PaintParameters& parameters) {
             if (sortFeaturesByKey) {
                 addRenderables(bucket.text.segments, SymbolType::Text);
             } else {
+                parameters.renderPass->setBatchRank(TextRank);
                 drawText(draw, tile, *renderData, std::ref(bucket.text.segments), bucketPaintProperties, parameters);
             }
         }
@@ -529,11 +539,14 @@ void RenderSymbolLayer::render(PaintParameters& parameters) {
                     getID());
             }
         };
+        parameters.renderPass->setBatchRank(CollisionRank);
         drawCollisonData(false /*isText*/, bucket.hasIconCollisionBoxData(), bucket.hasIconCollisionCircleData());
         drawCollisonData(true /*isText*/, bucket.hasTextCollisionBoxData(), bucket.hasTextCollisionCircleData());
     }
 
-    if (sortFeaturesByKey) {
+    if (!sortFeaturesByKey) {
+        parameters.renderPass->endBatch();
+    } else {
         for (auto& renderable : renderableSegments) {
             if (renderable.type == SymbolType::Text) {
                 drawText(draw, renderable.tile, renderable.renderData, renderable.segment, renderable.bucketPaintProperties, parameters);
@@ -6,7 +6,14 @@
 #include <mbgl/gfx/command_encoder.hpp>
 #include <mbgl/gfx/render_pass.hpp>
 #include <mbgl/gfx/cull_face_mode.hpp>
+#include <mbgl/gfx/renderable.hpp>
+#include <mbgl/gfx/renderer_backend.hpp>
 #include <mbgl/map/transform_state.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/math/clamp.hpp>
+
+#include <algorithm>
+#include <cmath>
 
 namespace mbgl {
 
@@ -94,8 +101,8 @@ void PaintParameters::clearStencil() {
 namespace {
 
 // Detects a difference in keys of renderTiles and tileClippingMaskIDs
-bool tileIDsIdentical(const RenderTiles& renderTiles,
-                      const std::map<UnwrappedTileID, int32_t>& tileClippingMaskIDs) {
+template <class T>
+bool tileIDsIdentical(const RenderTiles& renderTiles, const std::map<UnwrappedTileID, T>& tileClippingMaskIDs) {
     assert(renderTiles);
     assert(std::is_sorted(renderTiles->begin(), renderTiles->end(),
                           [](const RenderTile& a, const RenderTile& b) { return a.id < b.id; }));
@@ -109,7 +116,19 @@ bool tileIDsIdentical(const RenderTiles& renderTiles,
 } // namespace
 
 void PaintParameters::renderTileClippingMasks(const RenderTiles& renderTiles) {
-    if (!renderTiles || renderTiles->empty() || tileIDsIdentical(renderTiles, tileClippingMaskIDs)) {
+    if (!renderTiles || renderTiles->empty()) {
+        return;
+    }
+
+    // The stencil buffer is only drawn into if it is to be visualized.
+    if (tileScissorClipping && !(debugOptions & MapDebugOptions::StencilClip) &&
+        (tileIDsIdentical(renderTiles, tileScissorRects) || updateTileScissorRects(renderTiles))) {
+        scissorClipping = true;
+        return;
+    }
+    scissorClipping = false;
+
+    if (tileIDsIdentical(renderTiles, tileClippingMaskIDs)) {
         // The current stencil mask is for this source already; no need to draw another one.
         return;
     }
@@ -157,7 +176,107 @@ void PaintParameters::renderTileClippingMasks(const RenderTiles& renderTiles) {
     }
 }
 
+bool PaintParameters::updateTileScissorRects(const RenderTiles& renderTiles) {
+    std::vector<UnwrappedTileID> tileIDs;
+    tileIDs.reserve(renderTiles->size());
+    for (const RenderTile& renderTile : *renderTiles) {
+        tileIDs.push_back(renderTile.id);
+    }
+
+    auto rects = computeTileScissorRects(tileIDs, transformParams, backend.getDefaultRenderable().getSize());
+    if (!rects) {
+        tileScissorRects.clear();
+        return false;
+    }
+    tileScissorRects = std::move(*rects);
+    return true;
+}
+
+optional<std::map<UnwrappedTileID, gfx::ScissorRect>> PaintParameters::computeTileScissorRects(
+    const std::vector<UnwrappedTileID>& tileIDs, const TransformParameters& transformParams, const Size size) {
+    // Overlapping tiles must be clipped to the parts of them that are not covered by the other.
+    for (auto it = tileIDs.begin(); it != tileIDs.end(); ++it) {
+        for (auto other = std::next(it); other != tileIDs.end(); ++other) {
+            if (*it == *other || it->isChildOf(*other) || other->isChildOf(*it)) {
+                return nullopt;
+            }
+        }
+    }
+
+    const std::array<Point<float>, 4> corners{
+        { { 0, 0 }, { util::EXTENT, 0 }, { 0, util::EXTENT }, { util::EXTENT, util::EXTENT } }
+    };
+    // Tolerance, in pixels, for the edges of a tile to count as horizontal or vertical.
+    constexpr double epsilon = 1.0 / 256;
+    const auto equal = [&](double a, double b) { return std::abs(a - b) < epsilon; };
+
+    // The stencil masks cover the pixels whose centers lie inside the tile; a scissor rectangle
+    // covers the same pixels if its edges are rounded to the nearest pixel boundary.
+    const auto pixelBoundary = [](double coordinate, uint32_t max) {
+        return static_cast<int32_t>(util::clamp(std::ceil(coordinate - 0.5), 0.0, double(max)));
+    };
+
+    std::map<UnwrappedTileID, gfx::ScissorRect> rects;
+    for (const UnwrappedTileID& tileID : tileIDs) {
+        mat4 matrix;
+        transformParams.state.matrixFor(matrix, tileID);
+        matrix::multiply(matrix, transformParams.projMatrix, matrix);
+
+        std::array<vec4, 4> projected;
+        matrix::transformPoints(projected.data(), corners.data(), corners.size(), matrix);
+
+        std::array<double, 4> x, y;
+        for (std::size_t i = 0; i < projected.size(); ++i) {
+            if (projected[i][3] <= 0) {
+                return nullopt;
+            }
+            x[i] = (projected[i][0] / projected[i][3] + 1) / 2 * size.width;
+            y[i] = (projected[i][1] / projected[i][3] + 1) / 2 * size.height;
+        }
+
+        // Pitched or rotated views only map tiles to rectangles when rotated by a multiple of 90°.
+        const bool upright = equal(x[0], x[2]) && equal(x[1], x[3]) && equal(y[0], y[1]) && equal(y[2], y[3]);
+        const bool sideways = equal(x[0], x[1]) && equal(x[2], x[3]) && equal(y[0], y[2]) && equal(y[1], y[3]);
+        if (!upright && !sideways) {
+            return nullopt;
+        }
+
+        const auto xs = std::minmax({ x[0], x[1], x[2], x[3] });
+        const auto ys = std::minmax({ y[0], y[1], y[2], y[3] });
+        const int32_t left = pixelBoundary(xs.first, size.width);
+        const int32_t bottom = pixelBoundary(ys.first, size.height);
+        rects.emplace(tileID,
+                      gfx::ScissorRect{ left,
+                                        bottom,
+                                        static_cast<uint32_t>(pixelBoundary(xs.second, size.width) - left),
+                                        static_cast<uint32_t>(pixelBoundary(ys.second, size.height) - bottom) });
+    }
+
+    return { std::move(rects) };
+}
+
+void PaintParameters::clipToTile(const UnwrappedTileID& tileID) {
+    if (!scissorClipping) {
+        return;
+    }
+    auto it = tileScissorRects.find(tileID);
+    assert(it != tileScissorRects.end());
+    if (it != tileScissorRects.end()) {
+        renderPass->setScissor(it->second);
+    }
+}
+
+void PaintParameters::clearTileClip() {
+    if (scissorClipping) {
+        renderPass->setScissor({});
+    }
+}
+
 gfx::StencilMode PaintParameters::stencilModeForClipping(const UnwrappedTileID& tileID) const {
+    if (scissorClipping) {
+        return gfx::StencilMode::disabled();
+    }
+
     auto it = tileClippingMaskIDs.find(tileID);
     assert(it != tileClippingMaskIDs.end());
     const int32_t id = it != tileClippingMaskIDs.end() ? it->second : 0b00000000;
@@ -8,7 +8,10 @@
 #include <mbgl/gfx/depth_mode.hpp>
 #include <mbgl/gfx/stencil_mode.hpp>
 #include <mbgl/gfx/color_mode.hpp>
+#include <mbgl/gfx/render_pass.hpp>
 #include <mbgl/util/mat4.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/size.hpp>
 
 #include <array>
 #include <map>
@@ -29,7 +32,6 @@ namespace gfx {
 class Context;
 class RendererBackend;
 class CommandEncoder;
-class RenderPass;
 } // namespace gfx
 
 
@@ -88,17 +90,38 @@ public:
 
     // Stencil handling
 public:
+    // Prepares clipping the draws of each tile to the tile. If tileScissorClipping is set, no tile
+    // overlaps another and every tile covers an axis-aligned rectangle of the framebuffer, draws
+    // are clipped with scissor rectangles (see clipToTile()); otherwise, e.g. while parent tiles
+    // stand in for children that are still loading, stencil masks are drawn.
     void renderTileClippingMasks(const RenderTiles&);
     gfx::StencilMode stencilModeForClipping(const UnwrappedTileID&) const;
     gfx::StencilMode stencilModeFor3D();
 
+    // Restricts the draws that follow to the scissor rectangle of the tile, if tiles are clipped
+    // with scissor rectangles. Must be followed by clearTileClip() once the tiles are drawn.
+    void clipToTile(const UnwrappedTileID&);
+    void clearTileClip();
+
+    // Returns the scissor rectangle of each tile in a framebuffer of `size` pixels, covering the
+    // pixels that a stencil mask of the tile covers, or nullopt if a tile overlaps another or
+    // does not cover an axis-aligned rectangle of the framebuffer.
+    static optional<std::map<UnwrappedTileID, gfx::ScissorRect>> computeTileScissorRects(
+        const std::vector<UnwrappedTileID>&, const TransformParameters&, Size size);
+
+    bool tileScissorClipping = false;
+
 private:
     void clearStencil();
+    bool updateTileScissorRects(const RenderTiles&);
 
     // This needs to be an ordered map so that we have the same order as the renderTiles.
     std::map<UnwrappedTileID, int32_t> tileClippingMaskIDs;
     int32_t nextStencilID = 1;
 
+    std::map<UnwrappedTileID, gfx::ScissorRect> tileScissorRects;
+    bool scissorClipping = false;
+
 public:
     int numSublayers = 3;
     uint32_t currentLayer;
@@ -117,7 +117,8 @@ public:
 
     virtual void updateVertexVector(std::size_t, std::size_t, const GeometryTileFeature&, const FeatureState&) = 0;
 
-    virtual void upload(gfx::UploadPass&) = 0;
+    // Uploads the vertex vectors, repeating each vertex `repeat` times in a row.
+    virtual void upload(gfx::UploadPass&, std::size_t repeat) = 0;
     virtual void setPatternParameters(const optional<ImagePosition>&, const optional<ImagePosition>&, const CrossfadeParameters&) = 0;
     virtual std::tuple<ExpandToType<As, optional<gfx::AttributeBinding>>...> attributeBinding(const PossiblyEvaluatedType& currentValue) const = 0;
     virtual std::tuple<ExpandToType<As, float>...> interpolationFactor(float currentZoom) const = 0;
@@ -143,7 +144,7 @@ public:
                               const CanonicalTileID&,
                               const style::expression::Value&) override {}
     void updateVertexVector(std::size_t, std::size_t, const GeometryTileFeature&, const FeatureState&) override {}
-    void upload(gfx::UploadPass&) override {}
+    void upload(gfx::UploadPass&, std::size_t) override {}
     void setPatternParameters(const optional<ImagePosition>&, const optional<ImagePosition>&, const CrossfadeParameters&) override {};
 
     std::tuple<optional<gfx::AttributeBinding>> attributeBinding(const PossiblyEvaluatedPropertyValue<T>&) const override {
@@ -177,7 +178,7 @@ public:
                               const CanonicalTileID&,
                               const style::expression::Value&) override {}
     void updateVertexVector(std::size_t, std::size_t, const GeometryTileFeature&, const FeatureState&) override {}
-    void upload(gfx::UploadPass&) override {}
+    void upload(gfx::UploadPass&, std::size_t) override {}
 
     void setPatternParameters(const optional<ImagePosition>& posA, const optional<ImagePosition>& posB, const CrossfadeParameters&) override {
         if (!posA || !posB) {
@@ -270,8 +271,8 @@ public:
         }
     }
 
-    void upload(gfx::UploadPass& uploadPass) override {
-        vertexBuffer = uploadPass.createVertexBuffer(std::move(vertexVector));
+    void upload(gfx::UploadPass& uploadPass, std::size_t repeat) override {
+        vertexBuffer = uploadPass.createVertexBuffer(vertexVector, repeat);
     }
 
     std::tuple<optional<gfx::AttributeBinding>> attributeBinding(const PossiblyEvaluatedPropertyValue<T>& currentValue) const override {
@@ -385,8 +386,8 @@ public:
         }
     }
 
-    void upload(gfx::UploadPass& uploadPass) override {
-        vertexBuffer = uploadPass.createVertexBuffer(std::move(vertexVector));
+    void upload(gfx::UploadPass& uploadPass, std::size_t repeat) override {
+        vertexBuffer = uploadPass.createVertexBuffer(vertexVector, repeat);
     }
 
     std::tuple<optional<gfx::AttributeBinding>> attributeBinding(const PossiblyEvaluatedPropertyValue<T>& currentValue) const override {
@@ -484,13 +485,13 @@ public:
 
     void updateVertexVector(std::size_t, std::size_t, const GeometryTileFeature&, const FeatureState&) override {}
 
-    void upload(gfx::UploadPass& uploadPass) override {
+    void upload(gfx::UploadPass& uploadPass, std::size_t repeat) override {
         if (!patternToVertexVector.empty()) {
             assert(!zoomInVertexVector.empty());
             assert(!zoomOutVertexVector.empty());
-            patternToVertexBuffer = uploadPass.createVertexBuffer(std::move(patternToVertexVector));
-            zoomInVertexBuffer = uploadPass.createVertexBuffer(std::move(zoomInVertexVector));
-            zoomOutVertexBuffer = uploadPass.createVertexBuffer(std::move(zoomOutVertexVector));
+            patternToVertexBuffer = uploadPass.createVertexBuffer(patternToVertexVector, repeat);
+            zoomInVertexBuffer = uploadPass.createVertexBuffer(zoomInVertexVector, repeat);
+            zoomOutVertexBuffer = uploadPass.createVertexBuffer(zoomOutVertexVector, repeat);
         }
     }
 
@@ -645,9 +646,11 @@ public:
         });
     }
 
-    void upload(gfx::UploadPass& uploadPass) {
+    // Uploads the binders. Buckets that populate them once per instance but draw without
+    // instancing pass the number of vertices per instance as `repeat`.
+    void upload(gfx::UploadPass& uploadPass, std::size_t repeat = 1) {
         util::ignore({
-            (binders.template get<Ps>()->upload(uploadPass), 0)...
+            (binders.template get<Ps>()->upload(uploadPass, repeat), 0)...
         });
     }
 
@@ -21,8 +21,11 @@
 #include <mbgl/geometry/line_atlas.hpp>
 #include <mbgl/style/source_impl.hpp>
 #include <mbgl/style/transition_options.hpp>
+#include <mbgl/text/glyph_atlas.hpp>
 #include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/tile/geometry_tile_worker.hpp>
 #include <mbgl/tile/tile.hpp>
+#include <mbgl/tile/tile_cache.hpp>
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/logging.hpp>
@@ -62,6 +65,8 @@ public:
                    std::vector<std::unique_ptr<RenderItem>> sourceRenderItems_,
                    LineAtlas& lineAtlas_,
                    PatternAtlas& patternAtlas_,
+                   SharedGlyphAtlas& glyphAtlas_,
+                   SharedImageAtlas& imageAtlas_,
                    RenderLayerReferences layersNeedPlacement_,
                    Immutable<Placement> placement_,
                    bool updateSymbolOpacities_)
@@ -70,6 +75,8 @@ public:
           sourceRenderItems(std::move(sourceRenderItems_)),
           lineAtlas(lineAtlas_),
           patternAtlas(patternAtlas_),
+          glyphAtlas(glyphAtlas_),
+          imageAtlas(imageAtlas_),
           layersNeedPlacement(std::move(layersNeedPlacement_)),
           placement(std::move(placement_)),
           updateSymbolOpacities(updateSymbolOpacities_) {}
@@ -91,11 +98,15 @@ public:
     }
     LineAtlas& getLineAtlas() const override { return lineAtlas; }
     PatternAtlas& getPatternAtlas() const override { return patternAtlas; }
+    SharedGlyphAtlas& getGlyphAtlas() const override { return glyphAtlas; }
+    SharedImageAtlas& getImageAtlas() const override { return imageAtlas; }
 
     std::set<LayerRenderItem> layerRenderItems;
     std::vector<std::unique_ptr<RenderItem>> sourceRenderItems;
     std::reference_wrapper<LineAtlas> lineAtlas;
     std::reference_wrapper<PatternAtlas> patternAtlas;
+    std::reference_wrapper<SharedGlyphAtlas> glyphAtlas;
+    std::reference_wrapper<SharedImageAtlas> imageAtlas;
     RenderLayerReferences layersNeedPlacement;
     Immutable<Placement> placement;
     bool updateSymbolOpacities;
@@ -109,6 +120,8 @@ RenderOrchestrator::RenderOrchestrator(bool backgroundLayerAsColor_, const optio
       imageManager(std::make_unique<ImageManager>()),
       lineAtlas(std::make_unique<LineAtlas>()),
       patternAtlas(std::make_unique<PatternAtlas>()),
+      glyphAtlas(std::make_unique<SharedGlyphAtlas>()),
+      tileCache(std::make_unique<TileCache>()),
       imageImpls(makeMutable<std::vector<Immutable<style::Image::Impl>>>()),
       sourceImpls(makeMutable<std::vector<Immutable<style::Source::Impl>>>()),
       layerImpls(makeMutable<std::vector<Immutable<style::Layer::Impl>>>()),
@@ -172,7 +185,11 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
                                         updateParameters->annotationManager,
                                         *imageManager,
                                         *glyphManager,
-                                        updateParameters->prefetchZoomDelta};
+                                        updateParameters->prefetchZoomDelta,
+                                        *tileCache,
+                                        *glyphAtlas};
+
+    tileCache->setMemoryBudget(updateParameters->tileCacheSize);
 
     glyphManager->setURL(updateParameters->glyphURL);
 
@@ -406,13 +423,48 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
             placementUpdatePeriodOverride = optional<Duration>(Milliseconds(30));
         }
 
-        renderTreeParameters->placementChanged = !placementController.placementIsRecent(
-            updateParameters->timePoint, updateParameters->transformState.getZoom(), placementUpdatePeriodOverride);
+        if (pendingPlacement && !layerIDsMatch(layersNeedPlacement, pendingPlacementLayerIDs)) {
+            // The set of symbol layers changed, so the partial result is of no use.
+            pendingPlacement = nullopt;
+            symbolsChangedSincePlacement = true;
+        }
+        symbolsChangedSincePlacement = symbolsChangedSincePlacement || symbolBucketsChanged;
+
+        bool placementCommitted = false;
+        if (pendingPlacement) {
+            if (symbolBucketsChanged) (*pendingPlacement)->restartCurrentLayer();
+            placementCommitted = continuePendingPlacement(updateParameters->timePoint);
+        } else if (!placementController.placementIsRecent(updateParameters->timePoint,
+                                                          updateParameters->transformState.getZoom(),
+                                                          placementUpdatePeriodOverride)) {
+            Mutable<Placement> placement = Placement::create(updateParameters, placementController.getPlacement());
+            if (incrementalPlacement && !symbolsChangedSincePlacement &&
+                layerIDsMatch(layersNeedPlacement, placedLayerIDs) && placement->warmStart()) {
+                placementController.setPlacement(std::move(placement));
+                placementCommitted = true;
+            } else {
+                // The placement collides the symbols as they are now.
+                symbolsChangedSincePlacement = false;
+                placedLayerIDs.clear();
+                for (const RenderLayer& layer : layersNeedPlacement) {
+                    placedLayerIDs.push_back(layer.getID());
+                }
+
+                if (placementBudget) {
+                    pendingPlacement = std::move(placement);
+                    pendingPlacementLayerIDs = placedLayerIDs;
+                    placementCommitted = continuePendingPlacement(updateParameters->timePoint);
+                } else {
+                    placement->placeLayers(layersNeedPlacement);
+                    placementController.setPlacement(std::move(placement));
+                    placementCommitted = true;
+                }
+            }
+        }
+
+        renderTreeParameters->placementChanged = placementCommitted;
         symbolBucketsChanged |= renderTreeParameters->placementChanged;
         if (renderTreeParameters->placementChanged) {
-            Mutable<Placement> placement = Placement::create(updateParameters, placementController.getPlacement());
-            placement->placeLayers(layersNeedPlacement);
-            placementController.setPlacement(std::move(placement));
             crossTileSymbolIndex.pruneUnusedLayers(usedSymbolLayers);
             for (const auto& entry : renderSources) {
                 entry.second->updateFadingTiles();
@@ -422,12 +474,14 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
         }
         renderTreeParameters->symbolFadeChange =
             placementController.getPlacement()->symbolFadeChange(updateParameters->timePoint);
-        renderTreeParameters->needsRepaint = hasTransitions(updateParameters->timePoint);
+        // Keep rendering frames until a time-sliced placement completes.
+        renderTreeParameters->needsRepaint = hasTransitions(updateParameters->timePoint) || bool(pendingPlacement);
     } else {
         renderTreeParameters->placementChanged = symbolBucketsChanged = !layersNeedPlacement.empty();
         if (renderTreeParameters->placementChanged) {
             Mutable<Placement> placement = Placement::create(updateParameters);
             placement->collectPlacedSymbolData(placedSymbolDataCollected);
+            placement->setParallelLineProjection(parallelPlacement);
             placement->placeLayers(layersNeedPlacement);
             placementController.setPlacement(std::move(placement));
         }
@@ -454,6 +508,8 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
                                             std::move(sourceRenderItems),
                                             *lineAtlas,
                                             *patternAtlas,
+                                            *glyphAtlas,
+                                            imageManager->getSharedAtlas(),
                                             std::move(layersNeedPlacement),
                                             placementController.getPlacement(),
                                             symbolBucketsChanged);
@@ -494,7 +550,7 @@ void RenderOrchestrator::queryRenderedSymbols(std::unordered_map<std::string, st
         return;
     }
     const Placement& placement = *placementController.getPlacement();
-    auto renderedSymbols = placement.getCollisionIndex().queryRenderedSymbols(geometry);
+    auto renderedSymbols = placement.queryRenderedSymbols(geometry);
     std::vector<std::reference_wrapper<const RetainedQueryData>> bucketQueryData;
     bucketQueryData.reserve(renderedSymbols.size());
     for (const auto& entry : renderedSymbols) {
@@ -642,6 +698,25 @@ void RenderOrchestrator::dumpDebugLogs() {
     }
 
     imageManager->dumpDebugLogs();
+
+    const TileCacheStats cacheStats = getTileCacheStats();
+    Log::Info(Event::General,
+              "TileCache: %zu tiles, %zu/%zu bytes, limit %zu tiles, %llu hits, %llu misses, %llu evictions",
+              cacheStats.tiles,
+              cacheStats.memoryUsage,
+              cacheStats.memoryBudget,
+              cacheStats.size,
+              static_cast<unsigned long long>(cacheStats.hits),
+              static_cast<unsigned long long>(cacheStats.misses),
+              static_cast<unsigned long long>(cacheStats.evictions));
+
+    const auto obsoleteWork = GeometryTileWorker::getObsoleteWorkStats();
+    Log::Info(Event::General,
+              "GeometryTileWorker::discardedLayouts: %llu",
+              static_cast<unsigned long long>(obsoleteWork.discardedLayouts));
+    Log::Info(Event::General,
+              "GeometryTileWorker::wastedTime: %lld ms",
+              static_cast<long long>(std::chrono::duration_cast<Milliseconds>(obsoleteWork.wastedTime).count()));
 }
 
 void RenderOrchestrator::collectPlacedSymbolData(bool enable) {
@@ -652,6 +727,46 @@ const std::vector<PlacedSymbolData>& RenderOrchestrator::getPlacedSymbolsData()
     return placementController.getPlacement()->getPlacedSymbolsData();
 }
 
+TileCacheStats RenderOrchestrator::getTileCacheStats() const {
+    return tileCache->getStats();
+}
+
+void RenderOrchestrator::setPlacementBudget(optional<Duration> budget) {
+    placementBudget = std::move(budget);
+    if (!placementBudget) {
+        pendingPlacement = nullopt;
+    }
+}
+
+void RenderOrchestrator::setIncrementalPlacement(bool enabled) {
+    incrementalPlacement = enabled;
+}
+
+void RenderOrchestrator::setParallelPlacement(bool enabled) {
+    parallelPlacement = enabled;
+}
+
+// static
+bool RenderOrchestrator::layerIDsMatch(const RenderLayerReferences& layers, const std::vector<std::string>& ids) {
+    if (layers.size() != ids.size()) return false;
+    for (std::size_t i = 0; i < layers.size(); ++i) {
+        if (layers[i].get().getID() != ids[i]) return false;
+    }
+    return true;
+}
+
+bool RenderOrchestrator::continuePendingPlacement(TimePoint now) {
+    assert(pendingPlacement);
+    assert(placementBudget);
+    const TimePoint deadline = Clock::now() + *placementBudget;
+    if (!(*pendingPlacement)->placeLayersUntil(layersNeedPlacement, now, deadline)) {
+        return false;
+    }
+    placementController.setPlacement(std::move(*pendingPlacement));
+    pendingPlacement = nullopt;
+    return true;
+}
+
 RenderLayer* RenderOrchestrator::getRenderLayer(const std::string& id) {
     auto it = renderLayers.find(id);
     return it != renderLayers.end() ? it->second.get() : nullptr;
@@ -710,9 +825,13 @@ void RenderOrchestrator::clearData() {
     renderLayers.clear();
 
     crossTileSymbolIndex.reset();
+    pendingPlacement = nullopt;
+    symbolsChangedSincePlacement = true;
 
     if (!lineAtlas->isEmpty()) lineAtlas = std::make_unique<LineAtlas>();
     if (!patternAtlas->isEmpty()) patternAtlas = std::make_unique<PatternAtlas>();
+    // Tile workers may still refer to the glyph atlas, so it is cleared rather than replaced.
+    glyphAtlas->clear();
 
     imageManager->clear();
     glyphManager->evict(fontStacks(*layerImpls));
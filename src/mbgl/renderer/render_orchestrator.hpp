@@ -29,6 +29,8 @@ class GlyphManager;
 class ImageManager;
 class LineAtlas;
 class PatternAtlas;
+class SharedGlyphAtlas;
+class TileCache;
 class CrossTileSymbolIndex;
 class RenderTree;
 
@@ -74,11 +76,18 @@ public:
     void dumpDebugLogs();
     void collectPlacedSymbolData(bool);
     const std::vector<PlacedSymbolData>& getPlacedSymbolsData() const;
+    TileCacheStats getTileCacheStats() const;
+    void setPlacementBudget(optional<Duration>);
+    void setIncrementalPlacement(bool);
+    void setParallelPlacement(bool);
     void clearData();
 
 private:
     bool isLoaded() const;
     bool hasTransitions(TimePoint) const;
+    static bool layerIDsMatch(const RenderLayerReferences&, const std::vector<std::string>&);
+    // Returns true if the pending placement was completed and committed.
+    bool continuePendingPlacement(TimePoint now);
 
     RenderSource* getRenderSource(const std::string& id) const;
 
@@ -112,6 +121,10 @@ private:
     std::unique_ptr<ImageManager> imageManager;
     std::unique_ptr<LineAtlas> lineAtlas;
     std::unique_ptr<PatternAtlas> patternAtlas;
+    // Declared before renderSources and tileCache, whose tiles use it.
+    std::unique_ptr<SharedGlyphAtlas> glyphAtlas;
+    // Declared before renderSources, whose tile pyramids remove their tiles on destruction.
+    std::unique_ptr<TileCache> tileCache;
 
     Immutable<std::vector<Immutable<style::Image::Impl>>> imageImpls;
     Immutable<std::vector<Immutable<style::Source::Impl>>> sourceImpls;
@@ -123,10 +136,20 @@ private:
 
     CrossTileSymbolIndex crossTileSymbolIndex;
     PlacementController placementController;
+    // Time-sliced placement in progress, and the layers it was started for.
+    optional<Duration> placementBudget;
+    optional<Mutable<Placement>> pendingPlacement;
+    std::vector<std::string> pendingPlacementLayerIDs;
+    // Whether placements may take over the previous one, and the symbol layers of the last
+    // placement that collided the symbols.
+    bool incrementalPlacement = false;
+    bool symbolsChangedSincePlacement = true;
+    std::vector<std::string> placedLayerIDs;
 
     const bool backgroundLayerAsColor;
     bool contextLost = false;
     bool placedSymbolDataCollected = false;
+    bool parallelPlacement = true;
 
     // Vectors with reserved capacity of layerImpls->size() to avoid reallocation
     // on each frame.
@@ -49,12 +49,23 @@ static gfx::VertexVector<HeatmapTextureLayoutVertex> heatmapTextureVertices() {
     return result;
 }
 
-RenderStaticData::RenderStaticData(gfx::Context& context, float pixelRatio)
-    : programs(context, ProgramParameters{pixelRatio, false}),
+static gfx::VertexVector<CircleInstancedProgram::QuadVertex> circleQuadVertices() {
+    gfx::VertexVector<CircleInstancedProgram::QuadVertex> result;
+    result.emplace_back(CircleInstancedProgram::quadVertex(-1, -1));
+    result.emplace_back(CircleInstancedProgram::quadVertex(1, -1));
+    result.emplace_back(CircleInstancedProgram::quadVertex(-1, 1));
+    result.emplace_back(CircleInstancedProgram::quadVertex(1, 1));
+    return result;
+}
+
+RenderStaticData::RenderStaticData(gfx::Context& context,
+                                   float pixelRatio,
+                                   const optional<std::string>& programCacheDir)
+    : programs(context, ProgramParameters{pixelRatio, false, programCacheDir}),
       clippingMaskSegments(tileTriangleSegments())
 #ifndef NDEBUG
       ,
-      overdrawPrograms(context, ProgramParameters{pixelRatio, true})
+      overdrawPrograms(context, ProgramParameters{pixelRatio, true, programCacheDir})
 #endif
 {
 }
@@ -88,6 +99,7 @@ void RenderStaticData::upload(gfx::UploadPass& uploadPass) {
         tileVertexBuffer = uploadPass.createVertexBuffer(tileVertices());
         rasterVertexBuffer = uploadPass.createVertexBuffer(rasterVertices());
         heatmapTextureVertexBuffer = uploadPass.createVertexBuffer(heatmapTextureVertices());
+        circleQuadVertexBuffer = uploadPass.createVertexBuffer(circleQuadVertices());
         quadTriangleIndexBuffer = uploadPass.createIndexBuffer(quadTriangleIndices());
         tileBorderIndexBuffer = uploadPass.createIndexBuffer(tileLineStripIndices());
         uploaded = true;
@@ -4,6 +4,7 @@
 #include <mbgl/gfx/index_buffer.hpp>
 #include <mbgl/gfx/renderbuffer.hpp>
 #include <mbgl/programs/background_program.hpp>
+#include <mbgl/programs/circle_program.hpp>
 #include <mbgl/programs/heatmap_texture_program.hpp>
 #include <mbgl/programs/programs.hpp>
 #include <mbgl/programs/raster_program.hpp>
@@ -19,13 +20,15 @@ class UploadPass;
 
 class RenderStaticData {
 public:
-    RenderStaticData(gfx::Context&, float pixelRatio);
+    RenderStaticData(gfx::Context&, float pixelRatio, const optional<std::string>& programCacheDir);
 
     void upload(gfx::UploadPass&);
 
     optional<gfx::VertexBuffer<gfx::Vertex<PositionOnlyLayoutAttributes>>> tileVertexBuffer;
     optional<gfx::VertexBuffer<RasterLayoutVertex>> rasterVertexBuffer;
     optional<gfx::VertexBuffer<HeatmapTextureLayoutVertex>> heatmapTextureVertexBuffer;
+    // Corners of the quad that instanced circles are drawn with, indexed by quadTriangleIndexBuffer.
+    optional<gfx::VertexBuffer<CircleInstancedProgram::QuadVertex>> circleQuadVertexBuffer;
 
     optional<gfx::IndexBuffer> quadTriangleIndexBuffer;
     optional<gfx::IndexBuffer> tileBorderIndexBuffer;
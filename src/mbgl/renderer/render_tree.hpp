@@ -12,6 +12,8 @@ namespace mbgl {
 
 class PaintParameters;
 class PatternAtlas;
+class SharedGlyphAtlas;
+class SharedImageAtlas;
 
 namespace gfx {
 class UploadPass;
@@ -64,6 +66,8 @@ public:
     // Resources
     virtual LineAtlas& getLineAtlas() const = 0;
     virtual PatternAtlas& getPatternAtlas() const = 0;
+    virtual SharedGlyphAtlas& getGlyphAtlas() const = 0;
+    virtual SharedImageAtlas& getImageAtlas() const = 0;
     // Parameters
     const RenderTreeParameters& getParameters() const {
         return *parameters;
@@ -3,6 +3,7 @@
 #include <mbgl/layermanager/layer_manager.hpp>
 #include <mbgl/renderer/renderer_impl.hpp>
 #include <mbgl/renderer/render_tree.hpp>
+#include <mbgl/renderer/update_parameters.hpp>
 #include <mbgl/gfx/backend_scope.hpp>
 #include <mbgl/annotation/annotation_manager.hpp>
 
@@ -29,6 +30,9 @@ void Renderer::render(const std::shared_ptr<UpdateParameters>& updateParameters)
     assert(updateParameters);
     if (auto renderTree = impl->orchestrator.createRenderTree(updateParameters)) {
         renderTree->prepare();
+        if (impl->programPrecompilation) {
+            impl->precompilePrograms(*updateParameters->layers);
+        }
         impl->render(*renderTree);
     }
 }
@@ -133,6 +137,34 @@ const std::vector<PlacedSymbolData>& Renderer::getPlacedSymbolsData() const {
     return impl->orchestrator.getPlacedSymbolsData();
 }
 
+void Renderer::setPlacementBudget(optional<Duration> budget) {
+    impl->orchestrator.setPlacementBudget(std::move(budget));
+}
+
+void Renderer::setIncrementalPlacement(bool enabled) {
+    impl->orchestrator.setIncrementalPlacement(enabled);
+}
+
+void Renderer::setParallelPlacement(bool enabled) {
+    impl->orchestrator.setParallelPlacement(enabled);
+}
+
+void Renderer::setProgramCacheDir(const optional<std::string>& dir) {
+    impl->programCacheDir = dir;
+}
+
+void Renderer::setProgramPrecompilation(bool enabled) {
+    impl->programPrecompilation = enabled;
+}
+
+void Renderer::setTileScissorClipping(bool enabled) {
+    impl->tileScissorClipping = enabled;
+}
+
+TileCacheStats Renderer::getTileCacheStats() const {
+    return impl->orchestrator.getTileCacheStats();
+}
+
 void Renderer::reduceMemoryUse() {
     gfx::BackendScope guard { impl->backend };
     impl->reduceMemoryUse();
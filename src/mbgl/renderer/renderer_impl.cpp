@@ -8,10 +8,13 @@
 #include <mbgl/gfx/cull_face_mode.hpp>
 #include <mbgl/gfx/context.hpp>
 #include <mbgl/gfx/renderable.hpp>
+#include <mbgl/renderer/image_atlas.hpp>
 #include <mbgl/renderer/pattern_atlas.hpp>
+#include <mbgl/text/glyph_atlas.hpp>
 #include <mbgl/renderer/renderer_observer.hpp>
 #include <mbgl/renderer/render_static_data.hpp>
 #include <mbgl/renderer/render_tree.hpp>
+#include <mbgl/style/layer_impl.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/logging.hpp>
 
@@ -38,6 +41,20 @@ void Renderer::Impl::setObserver(RendererObserver* observer_) {
     observer = observer_ ? observer_ : &nullObserver();
 }
 
+RenderStaticData& Renderer::Impl::getStaticData() {
+    if (!staticData) {
+        staticData = std::make_unique<RenderStaticData>(backend.getContext(), pixelRatio, programCacheDir);
+    }
+    return *staticData;
+}
+
+void Renderer::Impl::precompilePrograms(const std::vector<Immutable<style::Layer::Impl>>& layers) {
+    auto& programs = getStaticData().programs;
+    for (const auto& layer : layers) {
+        programs.precompile(layer->getTypeInfo());
+    }
+}
+
 void Renderer::Impl::render(const RenderTree& renderTree) {
     if (renderState == RenderState::Never) {
         observer->onWillStartRenderingMap();
@@ -46,10 +63,7 @@ void Renderer::Impl::render(const RenderTree& renderTree) {
     observer->onWillStartRenderingFrame();
     const auto& renderTreeParameters = renderTree.getParameters();
 
-    if (!staticData) {
-        staticData = std::make_unique<RenderStaticData>(backend.getContext(), pixelRatio);
-    }
-    staticData->has3D = renderTreeParameters.has3D;
+    getStaticData().has3D = renderTreeParameters.has3D;
 
     auto& context = backend.getContext();
 
@@ -72,6 +86,7 @@ void Renderer::Impl::render(const RenderTree& renderTree) {
 
     parameters.symbolFadeChange = renderTreeParameters.symbolFadeChange;
     parameters.opaquePassCutoff = renderTreeParameters.opaquePassCutOff;
+    parameters.tileScissorClipping = tileScissorClipping;
     const auto& sourceRenderItems = renderTree.getSourceRenderItems();
     const auto& layerRenderItems = renderTree.getLayerRenderItems();
 
@@ -90,6 +105,8 @@ void Renderer::Impl::render(const RenderTree& renderTree) {
         staticData->upload(*uploadPass);
         renderTree.getLineAtlas().upload(*uploadPass);
         renderTree.getPatternAtlas().upload(*uploadPass);
+        renderTree.getGlyphAtlas().upload(*uploadPass);
+        renderTree.getImageAtlas().upload(*uploadPass);
     }
 
     // - 3D PASS -------------------------------------------------------------------------------------
@@ -27,6 +27,9 @@ private:
 
     void render(const RenderTree&);
 
+    void precompilePrograms(const std::vector<Immutable<style::Layer::Impl>>&);
+    RenderStaticData& getStaticData();
+
     void reduceMemoryUse();
 
     // TODO: Move orchestrator to Map::Impl.
@@ -39,6 +42,10 @@ private:
     const float pixelRatio;
     std::unique_ptr<RenderStaticData> staticData;
 
+    optional<std::string> programCacheDir;
+    bool programPrecompilation = false;
+    bool tileScissorClipping = false;
+
     enum class RenderState {
         Never,
         Partial,
@@ -13,6 +13,8 @@ class FileSource;
 class AnnotationManager;
 class ImageManager;
 class GlyphManager;
+class TileCache;
+class SharedGlyphAtlas;
 
 class TileParameters {
 public:
@@ -25,6 +27,8 @@ public:
     ImageManager& imageManager;
     GlyphManager& glyphManager;
     const uint8_t prefetchZoomDelta;
+    TileCache& tileCache;
+    SharedGlyphAtlas& glyphAtlas;
 };
 
 } // namespace mbgl
@@ -1,10 +1,12 @@
 #include <mbgl/renderer/tile_pyramid.hpp>
+#include <mbgl/actor/scheduler.hpp>
 #include <mbgl/renderer/paint_parameters.hpp>
 #include <mbgl/renderer/render_source.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
 #include <mbgl/renderer/query.hpp>
 #include <mbgl/map/transform.hpp>
 #include <mbgl/math/clamp.hpp>
+#include <mbgl/util/tile_coordinate.hpp>
 #include <mbgl/util/tile_cover.hpp>
 #include <mbgl/util/tile_range.hpp>
 #include <mbgl/util/enum.hpp>
@@ -23,11 +25,27 @@ using namespace style;
 
 static TileObserver nullObserver;
 
+// Tiles around the center of the viewport are the ones the user looks at first,
+// so their work goes ahead of the rest of the visible tiles.
+static TaskPriority getVisibleTilePriority(const OverscaledTileID& tileID, const LatLng& center) {
+    const CanonicalTileID& canonical = tileID.canonical;
+    const TileCoordinate centerCoordinate = TileCoordinate::fromLatLng(canonical.z, center);
+    const double worldSize = std::pow(2.0, canonical.z);
+    const double dx = std::abs(canonical.x + tileID.wrap * worldSize + 0.5 - centerCoordinate.p.x);
+    const double dy = std::abs(canonical.y + 0.5 - centerCoordinate.p.y);
+    return std::max(dx, dy) <= 1.0 ? TaskPriority::Critical : TaskPriority::Visible;
+}
+
 TilePyramid::TilePyramid()
     : observer(&nullObserver) {
 }
 
-TilePyramid::~TilePyramid() = default;
+TilePyramid::~TilePyramid() {
+    if (cache) {
+        cache->clear(this);
+        cache->setSize(0, this);
+    }
+}
 
 bool TilePyramid::isLoaded() const {
     for (const auto& pair : tiles) {
@@ -41,7 +59,10 @@ bool TilePyramid::isLoaded() const {
 
 Tile* TilePyramid::getTile(const OverscaledTileID& tileID) {
     auto it = tiles.find(tileID);
-    return it == tiles.end() ? cache.get(tileID) : it->second.get();
+    if (it != tiles.end()) {
+        return it->second.get();
+    }
+    return cache ? cache->get(tileID, this) : nullptr;
 }
 
 const Tile* TilePyramid::getRenderedTile(const UnwrappedTileID& tileID) const {
@@ -58,21 +79,27 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
                          const Range<uint8_t> zoomRange,
                          optional<LatLngBounds> bounds,
                          std::function<std::unique_ptr<Tile>(const OverscaledTileID&)> createTile) {
+    // Annotation tiles are never cached.
+    if (sourceImpl.type != SourceType::Annotations) {
+        cache = &parameters.tileCache;
+    }
+
     // If we need a relayout, abandon any cached tiles; they're now stale.
-    if (needsRelayout) {
-        cache.clear();
+    if (needsRelayout && cache) {
+        cache->clear(this);
     }
 
     // If we're not going to render anything, move our existing tiles into
     // the cache (if they're not stale) or abandon them, and return.
     if (!needsRendering) {
-        if (!needsRelayout) {
+        if (!needsRelayout && cache) {
             for (auto& entry : tiles) {
                 // These tiles are invisible, we set optional necessity
                 // for them and thus suppress network requests on
                 // tiles expiration (see `OnlineFileRequest`).
                 entry.second->setNecessity(TileNecessity::Optional);
-                cache.add(entry.first, std::move(entry.second));
+                entry.second->setPriority(TaskPriority::Idle);
+                cache->add(entry.first, std::move(entry.second), this);
             }
         }
 
@@ -139,12 +166,24 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
     // we're actively using, e.g. as a replacement for tile that aren't loaded yet.
     std::set<OverscaledTileID> retain;
 
+    // The most urgent priority requested for each retained tile; tiles retained for
+    // prefetching or as optional fallbacks are scheduled after the visible ones.
+    std::map<OverscaledTileID, TaskPriority> priorities;
+    const LatLng center = parameters.transformState.getLatLng();
+    bool prefetching = false;
+
     auto retainTileFn = [&](Tile& tile, TileNecessity necessity) -> void {
         if (retain.emplace(tile.id).second) {
             tile.setUpdateParameters({minimumUpdateInterval, isVolatile});
             tile.setNecessity(necessity);
         }
 
+        const TaskPriority priority = (prefetching || necessity == TileNecessity::Optional)
+                                          ? TaskPriority::Prefetch
+                                          : getVisibleTilePriority(tile.id, center);
+        auto it = priorities.emplace(tile.id, priority).first;
+        it->second = std::min(it->second, priority);
+
         if (needsRelayout) {
             tile.setLayers(layers);
         }
@@ -166,12 +205,15 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
         if (tileRange && !tileRange->contains(tileID.canonical)) {
             return nullptr;
         }
-        std::unique_ptr<Tile> tile = cache.pop(tileID);
+        std::unique_ptr<Tile> tile = cache ? cache->pop(tileID, this) : nullptr;
         if (!tile) {
             tile = createTile(tileID);
             if (!tile) return nullptr;
         }
 
+        // Provisional priority, so that the initial layout is not queued with the
+        // priority of a cached tile; it is refined once all the tiles are retained.
+        tile->setPriority(prefetching ? TaskPriority::Prefetch : getVisibleTilePriority(tileID, center));
         tile->setObserver(observer);
         tile->setLayers(layers);
         return tiles.emplace(tileID, std::move(tile)).first->second.get();
@@ -188,6 +230,7 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
     renderedTiles.clear();
 
     if (!panTiles.empty()) {
+        prefetching = true;
         algorithm::updateRenderables(
             getTileFn,
             createTileFn,
@@ -196,6 +239,7 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
             panTiles,
             zoomRange,
             maxParentTileOverscaleFactor);
+        prefetching = false;
     }
 
     algorithm::updateRenderables(
@@ -212,12 +256,12 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
         }
     }
 
-    if (type != SourceType::Annotations) {
+    if (cache) {
         size_t conservativeCacheSize =
             std::max(static_cast<float>(parameters.transformState.getSize().width) / tileSize, 1.0f) *
             std::max(static_cast<float>(parameters.transformState.getSize().height) / tileSize, 1.0f) *
             (parameters.transformState.getMaxZoom() - parameters.transformState.getMinZoom() + 1) * 0.5;
-        cache.setSize(conservativeCacheSize);
+        cache->setSize(conservativeCacheSize, this);
     }
 
     // Remove stale tiles. This goes through the (sorted!) tiles map and retain set in lockstep
@@ -227,9 +271,10 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
         auto retainIt = retain.begin();
         while (tilesIt != tiles.end()) {
             if (retainIt == retain.end() || tilesIt->first < *retainIt) {
-                if (!needsRelayout) {
+                if (!needsRelayout && cache) {
                     tilesIt->second->setNecessity(TileNecessity::Optional);
-                    cache.add(tilesIt->first, std::move(tilesIt->second));
+                    tilesIt->second->setPriority(TaskPriority::Idle);
+                    cache->add(tilesIt->first, std::move(tilesIt->second), this);
                 }
                 tiles.erase(tilesIt++);
             } else {
@@ -243,6 +288,8 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
 
     for (auto& pair : tiles) {
         pair.second->setShowCollisionBoxes(parameters.debugOptions & MapDebugOptions::Collision);
+        auto it = priorities.find(pair.first);
+        pair.second->setPriority(it != priorities.end() ? it->second : TaskPriority::Prefetch);
     }
 
     // Initialize renderable tiles and update the contained layer render data.
@@ -371,11 +418,15 @@ std::vector<Feature> TilePyramid::querySourceFeatures(const SourceQueryOptions&
 }
 
 void TilePyramid::setCacheSize(size_t size) {
-    cache.setSize(size);
+    if (cache) {
+        cache->setSize(size, this);
+    }
 }
 
 void TilePyramid::reduceMemoryUse() {
-    cache.clear();
+    if (cache) {
+        cache->clear(this);
+    }
 }
 
 void TilePyramid::setObserver(TileObserver* observer_) {
@@ -392,7 +443,9 @@ void TilePyramid::clearAll() {
     fadingTiles = false;
     tiles.clear();
     renderedTiles.clear();
-    cache.clear();
+    if (cache) {
+        cache->clear(this);
+    }
 }
 
 void TilePyramid::addRenderTile(const UnwrappedTileID& tileID, Tile& tile) {
@@ -73,7 +73,8 @@ private:
     void addRenderTile(const UnwrappedTileID& tileID, Tile& tile);
 
     std::map<OverscaledTileID, std::unique_ptr<Tile>> tiles;
-    TileCache cache;
+    // Renderer-wide cache shared with the other sources; set on the first update.
+    TileCache* cache = nullptr;
 
     std::map<UnwrappedTileID, std::reference_wrapper<Tile>> renderedTiles; // Sorted by tile id.
     TileObserver* observer = nullptr;
@@ -1,4 +1,5 @@
 #include <mbgl/renderer/tile_render_data.hpp>
+#include <mbgl/text/glyph_atlas.hpp>
 
 namespace mbgl {
 
@@ -12,12 +13,18 @@ TileRenderData::~TileRenderData() = default;
 
 const gfx::Texture& TileRenderData::getGlyphAtlasTexture() const {
     assert(atlasTextures);
+    if (atlasTextures->sharedGlyph) {
+        return atlasTextures->sharedGlyph->getTexture();
+    }
     assert(atlasTextures->glyph);
     return *atlasTextures->glyph;
 }
 
 const gfx::Texture& TileRenderData::getIconAtlasTexture() const {
     assert(atlasTextures);
+    if (atlasTextures->sharedIcon) {
+        return atlasTextures->sharedIcon->getTexture();
+    }
     assert(atlasTextures->icon);
     return *atlasTextures->icon;
 }
@@ -15,11 +15,17 @@ class UploadPass;
 class Bucket;
 class LayerRenderData;
 class SourcePrepareParameters;
+class SharedGlyphAtlas;
+class SharedImageAtlas;
 
 class TileAtlasTextures {
 public:    
     optional<gfx::Texture> glyph;
     optional<gfx::Texture> icon;
+    // Set instead of `glyph` when the glyphs of the tile are in the renderer's shared atlas.
+    const SharedGlyphAtlas* sharedGlyph = nullptr;
+    // Set instead of `icon` when the images of the tile are in the ImageManager's shared atlas.
+    const SharedImageAtlas* sharedIcon = nullptr;
 };
 
 class TileRenderData {
@@ -39,6 +39,7 @@ public:
     std::shared_ptr<FileSource> fileSource;
 
     const uint8_t prefetchZoomDelta;
+    const std::size_t tileCacheSize;
     
     // For still image requests, render requested
     const bool stillImageRequest;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/storage/file_source.hpp>
+#include <mbgl/storage/response_cache.hpp>
 
 namespace mbgl {
 
@@ -15,9 +16,14 @@ public:
     bool supportsCacheOnlyRequests() const override;
     std::unique_ptr<AsyncRequest> request(const Resource&, Callback) override;
     bool canRequest(const Resource&) const override;
+    void setProperty(const std::string&, const mapbox::base::Value&) override;
+    mapbox::base::Value getProperty(const std::string&) const override;
     void pause() override;
     void resume() override;
 
+    // Hit and miss counts of the in-memory tier in front of the database.
+    ResponseCacheStats getResponseCacheStats() const;
+
 private:
     class Impl;
     const std::unique_ptr<Impl> impl;
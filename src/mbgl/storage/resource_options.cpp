@@ -10,6 +10,8 @@ public:
     std::string cachePath = ":memory:";
     std::string assetPath = ".";
     uint64_t maximumSize = mbgl::util::DEFAULT_MAX_CACHE_SIZE;
+    bool writeAheadLog = false;
+    uint32_t databaseReaderCount = 2;
     void* platformContext = nullptr;
 };
 
@@ -68,6 +70,24 @@ uint64_t ResourceOptions::maximumCacheSize() const {
     return impl_->maximumSize;
 }
 
+ResourceOptions& ResourceOptions::withWriteAheadLog(bool enabled) {
+    impl_->writeAheadLog = enabled;
+    return *this;
+}
+
+bool ResourceOptions::writeAheadLog() const {
+    return impl_->writeAheadLog;
+}
+
+ResourceOptions& ResourceOptions::withDatabaseReaderCount(uint32_t count) {
+    impl_->databaseReaderCount = count;
+    return *this;
+}
+
+uint32_t ResourceOptions::databaseReaderCount() const {
+    return impl_->databaseReaderCount;
+}
+
 ResourceOptions& ResourceOptions::withPlatformContext(void* context) {
     impl_->platformContext = context;
     return *this;
@@ -0,0 +1,107 @@
+#include <mbgl/storage/resource.hpp>
+#include <mbgl/storage/response_cache.hpp>
+
+namespace mbgl {
+
+namespace {
+
+bool isCacheable(const Resource& resource, const Response& response) {
+    return resource.storagePolicy != Resource::StoragePolicy::Volatile && !response.error && !response.notModified &&
+           response.data && response.isUsable();
+}
+
+} // namespace
+
+ResponseCache::ResponseCache(std::size_t maximumSize_) : maximumSize(maximumSize_) {}
+
+void ResponseCache::setMaximumSize(std::size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    maximumSize = size;
+    evict();
+}
+
+std::size_t ResponseCache::getMaximumSize() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return maximumSize;
+}
+
+optional<Response> ResponseCache::get(const Resource& resource) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (maximumSize == 0 || resource.storagePolicy == Resource::StoragePolicy::Volatile) {
+        return nullopt;
+    }
+
+    auto it = index.find(resource.url);
+    if (it == index.end()) {
+        ++misses;
+        return nullopt;
+    }
+
+    // Entries may have expired since they were stored.
+    if (!it->second->response.isUsable()) {
+        eraseLocked(resource.url);
+        ++misses;
+        return nullopt;
+    }
+
+    ++hits;
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->response;
+}
+
+void ResponseCache::put(const Resource& resource, const Response& response) {
+    std::lock_guard<std::mutex> lock(mutex);
+    eraseLocked(resource.url);
+
+    if (!isCacheable(resource, response)) {
+        return;
+    }
+
+    const std::size_t size = sizeof(Entry) + resource.url.size() + response.data->size();
+    if (size > maximumSize) {
+        return;
+    }
+
+    entries.push_front(Entry{resource.url, response, size});
+    index.emplace(resource.url, entries.begin());
+    currentSize += size;
+    evict();
+}
+
+void ResponseCache::erase(const Resource& resource) {
+    std::lock_guard<std::mutex> lock(mutex);
+    eraseLocked(resource.url);
+}
+
+void ResponseCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    currentSize = 0;
+}
+
+ResponseCacheStats ResponseCache::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return {hits, misses, evictions, entries.size(), currentSize};
+}
+
+void ResponseCache::evict() {
+    while (currentSize > maximumSize && !entries.empty()) {
+        const Entry& last = entries.back();
+        currentSize -= last.size;
+        index.erase(last.key);
+        entries.pop_back();
+        ++evictions;
+    }
+}
+
+void ResponseCache::eraseLocked(const std::string& key) {
+    auto it = index.find(key);
+    if (it != index.end()) {
+        currentSize -= it->second->size;
+        entries.erase(it->second);
+        index.erase(it);
+    }
+}
+
+} // namespace mbgl
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <mbgl/storage/response.hpp>
+#include <mbgl/util/optional.hpp>
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace mbgl {
+
+class Resource;
+
+struct ResponseCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    std::size_t entries = 0;
+    std::size_t bytes = 0;
+};
+
+// Bounded, thread-safe in-memory cache of usable responses, keyed by resource URL
+// and evicted in least-recently-used order once the total size exceeds the limit.
+// Cached responses share their data with the responses handed out to requesters.
+class ResponseCache {
+public:
+    explicit ResponseCache(std::size_t maximumSize);
+
+    // Zero disables the cache and drops all entries.
+    void setMaximumSize(std::size_t);
+    std::size_t getMaximumSize() const;
+
+    // Returns the cached response if it is still usable.
+    optional<Response> get(const Resource&);
+
+    // Stores responses with data that can be cached; others remove the entry.
+    void put(const Resource&, const Response&);
+
+    void erase(const Resource&);
+    void clear();
+
+    ResponseCacheStats getStats() const;
+
+private:
+    struct Entry {
+        std::string key;
+        Response response;
+        std::size_t size;
+    };
+
+    void evict();
+    void eraseLocked(const std::string& key);
+
+    mutable std::mutex mutex;
+    std::size_t maximumSize;
+    std::size_t currentSize = 0;
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+};
+
+} // namespace mbgl
@@ -12,6 +12,7 @@
 
 #include <mbgl/renderer/buckets/symbol_bucket.hpp> // For PlacedSymbol: pull out to another location
 
+#include <algorithm>
 #include <cmath>
 
 namespace mbgl {
@@ -53,7 +54,7 @@ float CollisionIndex::approximateTileDistance(const TileDistance& tileDistance,
                                               const float lastSegmentAngle,
                                               const float pixelsToTileUnits,
                                               const float cameraToAnchorDistance,
-                                              const bool pitchWithMap) {
+                                              const bool pitchWithMap) const {
     // This is a quick and dirty solution for chosing which collision circles to use (since collision circles are
     // laid out in tile units). Ideally, I think we should generate collision circles on the fly in viewport coordinates
     // at the time we do collision detection.
@@ -155,7 +156,7 @@ std::pair<bool, bool> CollisionIndex::placeFeature(
     const bool pitchWithMap,
     const bool collisionDebug,
     const optional<CollisionBoundaries>& avoidEdges,
-    const optional<std::function<bool(const IndexedSubfeature&)>>& collisionGroupPredicate,
+    const optional<CollisionGroupPredicate>& collisionGroupPredicate,
     std::vector<ProjectedCollisionBox>& projectedBoxes) {
     assert(projectedBoxes.empty());
     if (!feature.alongLine) {
@@ -174,22 +175,18 @@ std::pair<bool, bool> CollisionIndex::placeFeature(
     }
 }
 
-std::pair<bool, bool> CollisionIndex::placeLineFeature(
-    const CollisionFeature& feature,
-    const mat4& posMatrix,
-    const mat4& labelPlaneMatrix,
-    const float textPixelRatio,
-    const PlacedSymbol& symbol,
-    const float scale,
-    const float fontSize,
-    const bool allowOverlap,
-    const bool pitchWithMap,
-    const bool collisionDebug,
-    const optional<CollisionBoundaries>& avoidEdges,
-    const optional<std::function<bool(const IndexedSubfeature&)>>& collisionGroupPredicate,
-    std::vector<ProjectedCollisionBox>& projectedBoxes) {
+CollisionIndex::ProjectedLineFeature CollisionIndex::projectLineFeature(const CollisionFeature& feature,
+                                                                      const mat4& posMatrix,
+                                                                      const mat4& labelPlaneMatrix,
+                                                                      const float textPixelRatio,
+                                                                      const PlacedSymbol& symbol,
+                                                                      const float scale,
+                                                                      const float fontSize,
+                                                                      const bool pitchWithMap) const {
     assert(feature.alongLine);
-    assert(projectedBoxes.empty());
+    ProjectedLineFeature result{
+        &symbol, posMatrix, labelPlaneMatrix, textPixelRatio, scale, fontSize, pitchWithMap, {}, false, false, true};
+
     const auto tileUnitAnchorPoint = symbol.anchorPoint;
     const auto projectedAnchor = projectAnchor(posMatrix, tileUnitAnchorPoint);
 
@@ -210,9 +207,12 @@ std::pair<bool, bool> CollisionIndex::placeLineFeature(
         labelPlaneMatrix,
         /*return tile distance*/ true);
 
-    bool collisionDetected = false;
-    bool inGrid = false;
-    bool entirelyOffscreen = true;
+    result.boxes.resize(feature.boxes.size());
+    if (!firstAndLastGlyph) {
+        // The label doesn't fit on its line, so none of the circles is used.
+        return result;
+    }
+    result.fits = true;
 
     const auto tileToViewport = projectedAnchor.first * textPixelRatio;
     // pixelsToTileUnits is used for translating line geometry to tile units
@@ -220,34 +220,39 @@ std::pair<bool, bool> CollisionIndex::placeLineFeature(
     // equivalent to pixel_to_tile_units
     const auto pixelsToTileUnits = 1 / (textPixelRatio * scale);
 
-    float firstTileDistance = 0.f;
-    float lastTileDistance = 0.f;
-    if (firstAndLastGlyph) {
-        firstTileDistance = approximateTileDistance(*(firstAndLastGlyph->first.tileDistance), firstAndLastGlyph->first.angle, pixelsToTileUnits, projectedAnchor.second, pitchWithMap);
-        lastTileDistance = approximateTileDistance(*(firstAndLastGlyph->second.tileDistance), firstAndLastGlyph->second.angle, pixelsToTileUnits, projectedAnchor.second, pitchWithMap);
+    const float firstTileDistance = approximateTileDistance(*(firstAndLastGlyph->first.tileDistance), firstAndLastGlyph->first.angle, pixelsToTileUnits, projectedAnchor.second, pitchWithMap);
+    const float lastTileDistance = approximateTileDistance(*(firstAndLastGlyph->second.tileDistance), firstAndLastGlyph->second.angle, pixelsToTileUnits, projectedAnchor.second, pitchWithMap);
+
+    const auto isUsed = [&](const CollisionBox& circle) {
+        return !(circle.signedDistanceFromAnchor < -firstTileDistance ||
+                 circle.signedDistanceFromAnchor > lastTileDistance);
+    };
+
+    // Project the anchors of all circles the label extends to in one batch.
+    std::vector<Point<float>> anchors;
+    anchors.reserve(feature.boxes.size());
+    for (const CollisionBox& circle : feature.boxes) {
+        if (isUsed(circle)) anchors.push_back(circle.anchor);
     }
+    std::vector<vec4> projectedAnchors(anchors.size());
+    matrix::transformPoints(projectedAnchors.data(), anchors.data(), anchors.size(), posMatrix);
+    auto nextProjectedAnchor = projectedAnchors.cbegin();
 
     bool previousCirclePlaced = false;
-    projectedBoxes.resize(feature.boxes.size());
     for (size_t i = 0; i < feature.boxes.size(); i++) {
         const CollisionBox& circle = feature.boxes[i];
-        const float boxSignedDistanceFromAnchor = circle.signedDistanceFromAnchor;
-        if (!firstAndLastGlyph ||
-            (boxSignedDistanceFromAnchor < -firstTileDistance) ||
-            (boxSignedDistanceFromAnchor > lastTileDistance)) {
-            // The label either doesn't fit on its line or we
-            // don't need to use this circle because the label
-            // doesn't extend this far. Either way, mark the circle unused.
+        if (!isUsed(circle)) {
+            // The label doesn't extend this far, mark the circle unused.
             previousCirclePlaced = false;
             continue;
         }
 
-        const auto projectedPoint = projectPoint(posMatrix, circle.anchor);
+        const auto projectedPoint = toViewportPoint(*nextProjectedAnchor++);
         const float tileUnitRadius = (circle.x2 - circle.x1) / 2;
         const float radius = tileUnitRadius * tileToViewport;
 
         if (previousCirclePlaced) {
-            const ProjectedCollisionBox& previousCircle = projectedBoxes[i - 1];
+            const ProjectedCollisionBox& previousCircle = result.boxes[i - 1];
             assert(previousCircle.isCircle());
             const auto& previousCenter = previousCircle.circle().center;
             const float dx = projectedPoint.x - previousCenter.x;
@@ -283,14 +288,67 @@ std::pair<bool, bool> CollisionIndex::placeLineFeature(
                                                  projectedPoint.x + radius,
                                                  projectedPoint.y + radius}};
 
-        projectedBoxes[i] = ProjectedCollisionBox{projectedPoint.x, projectedPoint.y, radius};
+        result.boxes[i] = ProjectedCollisionBox{projectedPoint.x, projectedPoint.y, radius};
+
+        result.entirelyOffscreen &= isOffscreen(collisionBoundaries);
+        result.inGrid |= isInsideGrid(collisionBoundaries);
+    }
+
+    return result;
+}
+
+std::pair<bool, bool> CollisionIndex::placeLineFeature(
+    const CollisionFeature& feature,
+    const mat4& posMatrix,
+    const mat4& labelPlaneMatrix,
+    const float textPixelRatio,
+    const PlacedSymbol& symbol,
+    const float scale,
+    const float fontSize,
+    const bool allowOverlap,
+    const bool pitchWithMap,
+    const bool collisionDebug,
+    const optional<CollisionBoundaries>& avoidEdges,
+    const optional<CollisionGroupPredicate>& collisionGroupPredicate,
+    std::vector<ProjectedCollisionBox>& projectedBoxes) {
+    assert(feature.alongLine);
+    assert(projectedBoxes.empty());
+
+    const ProjectedLineFeature* projected = nullptr;
+    auto found = projectedLineFeatures.find(&feature);
+    if (found != projectedLineFeatures.end()) {
+        const ProjectedLineFeature& candidate = found->second;
+        if (candidate.symbol == &symbol && candidate.posMatrix == posMatrix &&
+            candidate.labelPlaneMatrix == labelPlaneMatrix && candidate.textPixelRatio == textPixelRatio &&
+            candidate.scale == scale && candidate.fontSize == fontSize && candidate.pitchWithMap == pitchWithMap) {
+            projected = &candidate;
+        }
+    }
+
+    ProjectedLineFeature computed;
+    if (projected) {
+        projectedBoxes = projected->boxes;
+    } else {
+        computed =
+            projectLineFeature(feature, posMatrix, labelPlaneMatrix, textPixelRatio, symbol, scale, fontSize, pitchWithMap);
+        projectedBoxes = std::move(computed.boxes);
+        projected = &computed;
+    }
 
-        entirelyOffscreen &= isOffscreen(collisionBoundaries);
-        inGrid |= isInsideGrid(collisionBoundaries);
+    bool collisionDetected = false;
+    for (size_t i = 0; i < projectedBoxes.size(); i++) {
+        if (!projectedBoxes[i].isCircle()) continue;
+        const auto& circle = projectedBoxes[i].circle();
+        CollisionBoundaries collisionBoundaries{{circle.center.x - circle.radius,
+                                                 circle.center.y - circle.radius,
+                                                 circle.center.x + circle.radius,
+                                                 circle.center.y + circle.radius}};
 
         if ((avoidEdges && !isInsideTile(collisionBoundaries, *avoidEdges)) ||
-            (!allowOverlap && collisionGrid.hitTest(projectedBoxes[i].circle(), collisionGroupPredicate))) {
+            (!allowOverlap && collisionGrid.hitTest(circle, collisionGroupPredicate))) {
             if (!collisionDebug) {
+                // Circles past the colliding one are reported as unused.
+                std::fill(projectedBoxes.begin() + i + 1, projectedBoxes.end(), ProjectedCollisionBox{});
                 return {false, false};
             } else {
                 // Don't early exit if we're showing the debug circles because we still want to calculate
@@ -300,47 +358,54 @@ std::pair<bool, bool> CollisionIndex::placeLineFeature(
         }
     }
 
-    return {!collisionDetected && firstAndLastGlyph && inGrid, entirelyOffscreen};
+    return {!collisionDetected && projected->fits && projected->inGrid, projected->entirelyOffscreen};
 }
 
 void CollisionIndex::insertFeature(const CollisionFeature& feature, const std::vector<ProjectedCollisionBox>& projectedBoxes, bool ignorePlacement, uint32_t bucketInstanceId, uint16_t collisionGroupId) {
+    const IndexedSubfeature& indexedFeature = feature.indexedFeature;
+    const CollisionGridFeature gridFeature{
+        indexedFeature.index, indexedFeature.sortIndex, bucketInstanceId, collisionGroupId, internNames(indexedFeature)};
+    CollisionGrid& grid = ignorePlacement ? ignoredGrid : collisionGrid;
+
     if (feature.alongLine) {
         for (auto& circle : projectedBoxes) {
             if (!circle.isCircle()) {
                 continue;
             }
-
-            if (ignorePlacement) {
-                ignoredGrid.insert(
-                    IndexedSubfeature(feature.indexedFeature, bucketInstanceId, collisionGroupId),
-                    circle.circle()
-                );
-            } else {
-                collisionGrid.insert(
-                    IndexedSubfeature(feature.indexedFeature, bucketInstanceId, collisionGroupId),
-                    circle.circle()
-                );
-            }
+            grid.insert(CollisionGridFeature(gridFeature), circle.circle());
         }
     } else if (!projectedBoxes.empty()) {
         assert(projectedBoxes.size() == 1);
         auto& box = projectedBoxes[0];
         assert(box.isBox());
-        if (ignorePlacement) {
-            ignoredGrid.insert(
-                IndexedSubfeature(feature.indexedFeature, bucketInstanceId, collisionGroupId),
-                box.box()
-            );
-        } else {
-            collisionGrid.insert(
-                IndexedSubfeature(feature.indexedFeature, bucketInstanceId, collisionGroupId),
-                box.box()
-            );
+        grid.insert(CollisionGridFeature(gridFeature), box.box());
+    }
+}
+
+uint32_t CollisionIndex::internNames(const IndexedSubfeature& feature) {
+    // Consecutive inserts are mostly for the same bucket.
+    if (!featureNames.empty()) {
+        const auto& last = featureNames.back();
+        if (last.first == feature.sourceLayerName && last.second == feature.bucketLeaderID) {
+            return static_cast<uint32_t>(featureNames.size() - 1);
         }
     }
+
+    std::string key = feature.sourceLayerName;
+    key.push_back('\0');
+    key.append(feature.bucketLeaderID);
+    auto it = featureNamesIDs.find(key);
+    if (it != featureNamesIDs.end()) {
+        return it->second;
+    }
+
+    const auto id = static_cast<uint32_t>(featureNames.size());
+    featureNames.emplace_back(feature.sourceLayerName, feature.bucketLeaderID);
+    featureNamesIDs.emplace(std::move(key), id);
+    return id;
 }
 
-bool polygonIntersectsBox(const LineString<float>& polygon, const GridIndex<IndexedSubfeature>::BBox& bbox) {
+bool polygonIntersectsBox(const LineString<float>& polygon, const CollisionIndex::CollisionGrid::BBox& bbox) {
     // This is just a wrapper that allows us to use the integer-based util::polygonIntersectsPolygon
     // Conversion limits our query accuracy to single-pixel resolution
     GeometryCoordinates integerPolygon;
@@ -372,29 +437,24 @@ std::unordered_map<uint32_t, std::vector<IndexedSubfeature>> CollisionIndex::que
     
     auto envelope = mapbox::geometry::envelope(gridQuery);
     
-    using QueryResult = std::pair<IndexedSubfeature, GridIndex<IndexedSubfeature>::BBox>;
-    
-    std::vector<QueryResult> features = collisionGrid.queryWithBoxes(envelope);
-    std::vector<QueryResult> ignoredFeatures = ignoredGrid.queryWithBoxes(envelope);
-    features.insert(features.end(), ignoredFeatures.begin(), ignoredFeatures.end());
-
     std::unordered_map<uint32_t, std::unordered_set<size_t>> seenBuckets;
-   for (auto& queryResult : features) {
-        auto& feature = queryResult.first;
-        auto& bbox = queryResult.second;
-
+    const auto addFeature = [&](const CollisionGridFeature& feature, const CollisionGrid::BBox& bbox) -> bool {
         // Skip already seen features.
         auto& seenFeatures = seenBuckets[feature.bucketInstanceId];
-        if (seenFeatures.find(feature.index) != seenFeatures.end())
-            continue;
-        
-        if (!polygonIntersectsBox(gridQuery, bbox)) {
-            continue;
-        }
+        if (seenFeatures.find(feature.index) != seenFeatures.end()) return false;
+
+        if (!polygonIntersectsBox(gridQuery, bbox)) return false;
 
         seenFeatures.insert(feature.index);
-        result[feature.bucketInstanceId].push_back(feature);
-    }
+        const auto& names = featureNames[feature.namesID];
+        IndexedSubfeature indexedFeature(feature.index, names.first, names.second, feature.sortIndex);
+        indexedFeature.bucketInstanceId = feature.bucketInstanceId;
+        indexedFeature.collisionGroupId = feature.collisionGroupId;
+        result[feature.bucketInstanceId].push_back(std::move(indexedFeature));
+        return false;
+    };
+    collisionGrid.visit(envelope, addFeature);
+    ignoredGrid.visit(envelope, addFeature);
 
     return result;
 
@@ -428,6 +488,10 @@ std::pair<Point<float>,float> CollisionIndex::projectAndGetPerspectiveRatio(cons
 Point<float> CollisionIndex::projectPoint(const mat4& posMatrix, const Point<float>& point) const {
     vec4 p = {{ point.x, point.y, 0, 1 }};
     matrix::transformMat4(p, p, posMatrix);
+    return toViewportPoint(p);
+}
+
+Point<float> CollisionIndex::toViewportPoint(const vec4& p) const {
     auto size = transformState.getSize();
     return Point<float> {
         static_cast<float>((((p[0] / p[3] + 1) / 2) * size.width) + viewportPadding),
@@ -7,6 +7,10 @@
 #include <mbgl/map/transform_state.hpp>
 
 #include <array>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace mbgl {
 
@@ -21,9 +25,41 @@ struct IntersectStatus {
     // Assuming tile border divides box in two sections
     int minSectionLength = 0;
 };
+// Payload of the collision grids. It refers to the source layer and bucket names of the
+// IndexedSubfeature by an ID that CollisionIndex interns, instead of copying the strings.
+struct CollisionGridFeature {
+    std::size_t index;
+    std::size_t sortIndex;
+    uint32_t bucketInstanceId;
+    uint16_t collisionGroupId;
+    uint32_t namesID;
+};
+
 class CollisionIndex {
 public:
-    using CollisionGrid = GridIndex<IndexedSubfeature>;
+    using CollisionGrid = GridIndex<CollisionGridFeature>;
+    using CollisionGroupPredicate = std::function<bool(const CollisionGridFeature&)>;
+
+    // Viewport projection of the collision circles of a line label. Unlike the collision
+    // test, it does not depend on the symbols placed before, so it can be computed ahead
+    // of placement and concurrently for different labels.
+    struct ProjectedLineFeature {
+        // Inputs of the projection.
+        const PlacedSymbol* symbol;
+        mat4 posMatrix;
+        mat4 labelPlaneMatrix;
+        float textPixelRatio;
+        float scale;
+        float fontSize;
+        bool pitchWithMap;
+
+        // Circles not used by the label are left default-constructed.
+        std::vector<ProjectedCollisionBox> boxes;
+        bool fits = false;
+        bool inGrid = false;
+        bool entirelyOffscreen = true;
+    };
+    using ProjectedLineFeatures = std::unordered_map<const CollisionFeature*, ProjectedLineFeature>;
 
     explicit CollisionIndex(const TransformState&, MapMode);
     IntersectStatus intersectsTileEdges(const CollisionBox&,
@@ -44,9 +80,22 @@ public:
         bool pitchWithMap,
         bool collisionDebug,
         const optional<CollisionBoundaries>& avoidEdges,
-        const optional<std::function<bool(const IndexedSubfeature&)>>& collisionGroupPredicate,
+        const optional<CollisionGroupPredicate>& collisionGroupPredicate,
         std::vector<ProjectedCollisionBox>& /*out*/);
 
+    ProjectedLineFeature projectLineFeature(const CollisionFeature& feature,
+                                            const mat4& posMatrix,
+                                            const mat4& labelPlaneMatrix,
+                                            float textPixelRatio,
+                                            const PlacedSymbol& symbol,
+                                            float scale,
+                                            float fontSize,
+                                            bool pitchWithMap) const;
+
+    // Makes placeFeature() reuse the given projections of line features, where they
+    // were computed for the same inputs.
+    void setProjectedLineFeatures(ProjectedLineFeatures features) { projectedLineFeatures = std::move(features); }
+
     void insertFeature(const CollisionFeature& feature, const std::vector<ProjectedCollisionBox>&, bool ignorePlacement, uint32_t bucketInstanceId, uint16_t collisionGroupId);
 
     std::unordered_map<uint32_t, std::vector<IndexedSubfeature>> queryRenderedSymbols(const ScreenLineString&) const;
@@ -75,18 +124,20 @@ private:
         bool pitchWithMap,
         bool collisionDebug,
         const optional<CollisionBoundaries>& avoidEdges,
-        const optional<std::function<bool(const IndexedSubfeature&)>>& collisionGroupPredicate,
+        const optional<CollisionGroupPredicate>& collisionGroupPredicate,
         std::vector<ProjectedCollisionBox>& /*out*/);
 
     float approximateTileDistance(const TileDistance& tileDistance,
                                   float lastSegmentAngle,
                                   float pixelsToTileUnits,
                                   float cameraToAnchorDistance,
-                                  bool pitchWithMap);
+                                  bool pitchWithMap) const;
 
     std::pair<float,float> projectAnchor(const mat4& posMatrix, const Point<float>& point) const;
     std::pair<Point<float>,float> projectAndGetPerspectiveRatio(const mat4& posMatrix, const Point<float>& point) const;
     Point<float> projectPoint(const mat4& posMatrix, const Point<float>& point) const;
+    // Converts a point transformed by a tile matrix to viewport coordinates.
+    Point<float> toViewportPoint(const vec4& projected) const;
     CollisionBoundaries getProjectedCollisionBoundaries(const mat4& posMatrix,
                                                         Point<float> shift,
                                                         float textPixelRatio,
@@ -104,6 +155,14 @@ private:
     const float gridBottomBoundary;
     
     const float pitchFactor;
+
+    ProjectedLineFeatures projectedLineFeatures;
+
+    uint32_t internNames(const IndexedSubfeature&);
+
+    // Source layer and bucket names of the inserted features, indexed by namesID.
+    std::vector<std::pair<std::string, std::string>> featureNames;
+    std::unordered_map<std::string, uint32_t> featureNamesIDs;
 };
 
 } // namespace mbgl
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <mbgl/util/optional.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace mbgl {
+
+/**
+ * @brief Map from crossTileID to per-symbol placement state, indexed directly by the ID.
+ *
+ * `CrossTileSymbolIndex` allocates the IDs of a bucket's symbols sequentially, so the IDs
+ * that are live at a time cluster into a few ranges. The values are kept in fixed-size
+ * pages covering consecutive IDs, which makes lookups a shift and an index instead of a
+ * hash lookup, and allocates once per page instead of once per symbol.
+ */
+template <typename T>
+class CrossTileIDMap {
+public:
+    CrossTileIDMap() = default;
+    CrossTileIDMap(CrossTileIDMap&&) noexcept = default;
+    CrossTileIDMap& operator=(CrossTileIDMap&&) noexcept = default;
+
+    CrossTileIDMap(const CrossTileIDMap& other) : firstPage(other.firstPage), count(other.count) {
+        pages.reserve(other.pages.size());
+        for (const auto& page : other.pages) {
+            pages.push_back(page ? std::make_unique<Page>(*page) : nullptr);
+        }
+    }
+
+    CrossTileIDMap& operator=(const CrossTileIDMap& other) {
+        if (this != &other) *this = CrossTileIDMap(other);
+        return *this;
+    }
+
+    const T* find(uint32_t id) const {
+        const Page* page = getPage(id);
+        if (!page) return nullptr;
+        const auto& slot = page->slots[id & kPageMask];
+        return slot ? &*slot : nullptr;
+    }
+
+    T* find(uint32_t id) { return const_cast<T*>(static_cast<const CrossTileIDMap&>(*this).find(id)); }
+
+    bool contains(uint32_t id) const { return find(id) != nullptr; }
+
+    // Inserts the value unless the ID is present already; returns true if inserted.
+    template <typename... Args>
+    bool emplace(uint32_t id, Args&&... args) {
+        auto& slot = getOrCreatePage(id).slots[id & kPageMask];
+        if (slot) return false;
+        slot.emplace(std::forward<Args>(args)...);
+        ++count;
+        return true;
+    }
+
+    // Inserts the value, replacing any present value.
+    void set(uint32_t id, T value) {
+        auto& slot = getOrCreatePage(id).slots[id & kPageMask];
+        if (slot) {
+            slot = nullopt;
+        } else {
+            ++count;
+        }
+        slot.emplace(std::move(value));
+    }
+
+    bool erase(uint32_t id) {
+        Page* page = getPage(id);
+        if (!page) return false;
+        auto& slot = page->slots[id & kPageMask];
+        if (!slot) return false;
+        slot = nullopt;
+        --count;
+        return true;
+    }
+
+    // Calls fn(id, value) for every entry, in ascending ID order.
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        if (count == 0) return;
+        for (std::size_t i = 0; i < pages.size(); ++i) {
+            if (!pages[i]) continue;
+            const uint32_t base = (firstPage + static_cast<uint32_t>(i)) << kPageBits;
+            for (uint32_t j = 0; j < kPageSize; ++j) {
+                const auto& slot = pages[i]->slots[j];
+                if (slot) fn(base + j, *slot);
+            }
+        }
+    }
+
+    // Sizes the page table for the ID range of another map, typically the one
+    // of the previous placement, so that it does not grow while placing.
+    template <typename U>
+    void reserveLike(const CrossTileIDMap<U>& other) {
+        if (!pages.empty() || other.pages.empty()) return;
+        firstPage = other.firstPage;
+        pages.resize(other.pages.size());
+    }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+private:
+    template <typename>
+    friend class CrossTileIDMap;
+
+    static constexpr uint32_t kPageBits = 7;
+    static constexpr uint32_t kPageSize = 1u << kPageBits;
+    static constexpr uint32_t kPageMask = kPageSize - 1;
+
+    struct Page {
+        std::array<optional<T>, kPageSize> slots;
+    };
+
+    const Page* getPage(uint32_t id) const {
+        const uint32_t index = id >> kPageBits;
+        if (index < firstPage || index - firstPage >= pages.size()) return nullptr;
+        return pages[index - firstPage].get();
+    }
+
+    Page* getPage(uint32_t id) { return const_cast<Page*>(static_cast<const CrossTileIDMap&>(*this).getPage(id)); }
+
+    Page& getOrCreatePage(uint32_t id) {
+        const uint32_t index = id >> kPageBits;
+        if (pages.empty()) {
+            firstPage = index;
+            pages.resize(1);
+        } else if (index < firstPage) {
+            std::vector<std::unique_ptr<Page>> grown(pages.size() + (firstPage - index));
+            std::move(pages.begin(), pages.end(), grown.begin() + (firstPage - index));
+            pages = std::move(grown);
+            firstPage = index;
+        } else if (index - firstPage >= pages.size()) {
+            pages.resize(index - firstPage + 1);
+        }
+        auto& page = pages[index - firstPage];
+        if (!page) page = std::make_unique<Page>();
+        return *page;
+    }
+
+    std::vector<std::unique_ptr<Page>> pages;
+    uint32_t firstPage = 0;
+    std::size_t count = 0;
+};
+
+} // namespace mbgl
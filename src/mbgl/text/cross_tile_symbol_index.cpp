@@ -4,18 +4,68 @@
 #include <mbgl/renderer/render_tile.hpp>
 #include <mbgl/tile/tile.hpp>
 
+#include <algorithm>
+
 namespace mbgl {
 
+namespace {
+
+// Matches are searched in the cells of a grid over the scaled coordinates, which is
+// sized so that a tolerance of up to one cell only reaches into the adjacent cells.
+constexpr int64_t kCellSize = 2;
+
+int64_t cellOf(int64_t value) {
+    return value >= 0 ? value / kCellSize : -((-value + kCellSize - 1) / kCellSize);
+}
+
+bool lessByKeyAndCell(const IndexedSymbolInstance& a, const IndexedSymbolInstance& b) {
+    if (a.keyHash != b.keyHash) return a.keyHash < b.keyHash;
+    if (a.keyIndex != b.keyIndex) return a.keyIndex < b.keyIndex;
+    const int64_t aCellX = cellOf(a.coord.x);
+    const int64_t bCellX = cellOf(b.coord.x);
+    if (aCellX != bCellX) return aCellX < bCellX;
+    const int64_t aCellY = cellOf(a.coord.y);
+    const int64_t bCellY = cellOf(b.coord.y);
+    if (aCellY != bCellY) return aCellY < bCellY;
+    return a.order < b.order;
+}
+
+} // namespace
+
 TileLayerIndex::TileLayerIndex(OverscaledTileID coord_,
                                std::vector<SymbolInstance>& symbolInstances,
                                uint32_t bucketInstanceId_,
                                std::string bucketLeaderId_)
     : coord(coord_), bucketInstanceId(bucketInstanceId_), bucketLeaderId(std::move(bucketLeaderId_)) {
-    for (SymbolInstance& symbolInstance : symbolInstances) {
+    indexedSymbolInstances.reserve(symbolInstances.size());
+    for (std::size_t i = 0; i < symbolInstances.size(); ++i) {
+        SymbolInstance& symbolInstance = symbolInstances[i];
         if (symbolInstance.crossTileID == SymbolInstance::invalidCrossTileID()) continue;
-        indexedSymbolInstances[symbolInstance.key].emplace_back(symbolInstance.crossTileID,
-                                                                getScaledCoordinates(symbolInstance, coord));
+        indexedSymbolInstances.emplace_back(symbolInstance.crossTileID,
+                                            getScaledCoordinates(symbolInstance, coord),
+                                            symbolInstance.keyHash,
+                                            static_cast<uint32_t>(i));
+    }
+
+    // Group the symbols by key first, comparing the keys themselves only where the hashes
+    // are equal, and number the distinct keys in that order.
+    std::sort(indexedSymbolInstances.begin(),
+              indexedSymbolInstances.end(),
+              [&](const IndexedSymbolInstance& a, const IndexedSymbolInstance& b) {
+                  if (a.keyHash != b.keyHash) return a.keyHash < b.keyHash;
+                  const std::u16string& aKey = symbolInstances[a.order].key;
+                  const std::u16string& bKey = symbolInstances[b.order].key;
+                  return aKey != bKey ? aKey < bKey : a.order < b.order;
+              });
+    for (std::size_t i = 0; i < indexedSymbolInstances.size(); ++i) {
+        const std::u16string& key = symbolInstances[indexedSymbolInstances[i].order].key;
+        if (i == 0 || indexedSymbolInstances[i - 1].keyHash != indexedSymbolInstances[i].keyHash ||
+            keys.back() != key) {
+            keys.push_back(key);
+        }
+        indexedSymbolInstances[i].keyIndex = static_cast<uint32_t>(keys.size() - 1);
     }
+    std::sort(indexedSymbolInstances.begin(), indexedSymbolInstances.end(), lessByKeyAndCell);
 }
 
 Point<int64_t> TileLayerIndex::getScaledCoordinates(SymbolInstance& symbolInstance,
@@ -29,6 +79,62 @@ Point<int64_t> TileLayerIndex::getScaledCoordinates(SymbolInstance& symbolInstan
     };
 }
 
+const IndexedSymbolInstance* TileLayerIndex::findMatch(const SymbolInstance& symbolInstance,
+                                                     const Point<int64_t>& scaledCoord,
+                                                     float tolerance,
+                                                     const std::set<uint32_t>& zoomCrossTileIDs) const {
+    struct LessByKeyHash {
+        bool operator()(const IndexedSymbolInstance& a, std::size_t b) const { return a.keyHash < b; }
+        bool operator()(std::size_t a, const IndexedSymbolInstance& b) const { return a < b.keyHash; }
+    };
+    const auto byKeyHash = std::equal_range(
+        indexedSymbolInstances.begin(), indexedSymbolInstances.end(), symbolInstance.keyHash, LessByKeyHash());
+
+    // Skip any keys that only share the hash with this one.
+    const auto lessByKeyIndex = [](const IndexedSymbolInstance& a, const IndexedSymbolInstance& b) {
+        return a.keyIndex < b.keyIndex;
+    };
+    auto first = byKeyHash.first;
+    while (first != byKeyHash.second && keys[first->keyIndex] != symbolInstance.key) {
+        first = std::upper_bound(first, byKeyHash.second, *first, lessByKeyIndex);
+    }
+    if (first == byKeyHash.second) {
+        // No symbol with this key in this bucket
+        return nullptr;
+    }
+    const auto last = std::upper_bound(first, byKeyHash.second, *first, lessByKeyIndex);
+
+    // Return the first symbol in bucket order with the same key whose coordinates are
+    // within 1 grid unit. (with a 4px grid, this covers a 12px by 12px area)
+    const IndexedSymbolInstance* match = nullptr;
+    const auto consider = [&](const IndexedSymbolInstance& thisTileSymbol) {
+        if ((!match || thisTileSymbol.order < match->order) &&
+            std::abs(thisTileSymbol.coord.x - scaledCoord.x) <= tolerance &&
+            std::abs(thisTileSymbol.coord.y - scaledCoord.y) <= tolerance &&
+            zoomCrossTileIDs.find(thisTileSymbol.crossTileID) == zoomCrossTileIDs.end()) {
+            match = &thisTileSymbol;
+        }
+    };
+
+    if (tolerance > kCellSize) {
+        std::for_each(first, last, consider);
+        return match;
+    }
+
+    const int64_t cellX = cellOf(scaledCoord.x);
+    const int64_t cellY = cellOf(scaledCoord.y);
+    for (int64_t x = cellX - 1; x <= cellX + 1; ++x) {
+        IndexedSymbolInstance lowest(0, {x * kCellSize, (cellY - 1) * kCellSize}, first->keyHash, 0);
+        lowest.keyIndex = first->keyIndex;
+        for (auto it = std::lower_bound(first, last, lowest, lessByKeyAndCell);
+             it != last && cellOf(it->coord.x) == x && cellOf(it->coord.y) <= cellY + 1;
+             ++it) {
+            consider(*it);
+        }
+    }
+    return match;
+}
+
 void TileLayerIndex::findMatches(SymbolBucket& bucket,
                                  const OverscaledTileID& newCoord,
                                  std::set<uint32_t>& zoomCrossTileIDs) const {
@@ -43,27 +149,14 @@ void TileLayerIndex::findMatches(SymbolBucket& bucket,
             continue;
         }
 
-        auto it = indexedSymbolInstances.find(symbolInstance.key);
-        if (it == indexedSymbolInstances.end()) {
-            // No symbol with this key in this bucket
-            continue;
-        }
-
-        auto scaledSymbolCoord = getScaledCoordinates(symbolInstance, newCoord);
-
-        for (const IndexedSymbolInstance& thisTileSymbol : it->second) {
-            // Return any symbol with the same keys whose coordinates are within 1
-            // grid unit. (with a 4px grid, this covers a 12px by 12px area)
-            if (std::abs(thisTileSymbol.coord.x - scaledSymbolCoord.x) <= tolerance &&
-                std::abs(thisTileSymbol.coord.y - scaledSymbolCoord.y) <= tolerance &&
-                zoomCrossTileIDs.find(thisTileSymbol.crossTileID) == zoomCrossTileIDs.end()) {
-                // Once we've marked ourselves duplicate against this parent symbol,
-                // don't let any other symbols at the same zoom level duplicate against
-                // the same parent (see issue #10844)
-                zoomCrossTileIDs.insert(thisTileSymbol.crossTileID);
-                symbolInstance.crossTileID = thisTileSymbol.crossTileID;
-                break;
-            }
+        const auto scaledSymbolCoord = getScaledCoordinates(symbolInstance, newCoord);
+        if (const IndexedSymbolInstance* thisTileSymbol =
+                findMatch(symbolInstance, scaledSymbolCoord, tolerance, zoomCrossTileIDs)) {
+            // Once we've marked ourselves duplicate against this parent symbol,
+            // don't let any other symbols at the same zoom level duplicate against
+            // the same parent (see issue #10844)
+            zoomCrossTileIDs.insert(thisTileSymbol->crossTileID);
+            symbolInstance.crossTileID = thisTileSymbol->crossTileID;
         }
     }
 }
@@ -184,10 +277,8 @@ bool CrossTileSymbolLayerIndex::addBucket(const OverscaledTileID& tileID,
 }
 
 void CrossTileSymbolLayerIndex::removeBucketCrossTileIDs(uint8_t zoom, const TileLayerIndex& removedBucket) {
-    for (const auto& key : removedBucket.indexedSymbolInstances) {
-        for (auto indexedSymbolInstance : key.second) {
-            usedCrossTileIDs[zoom].erase(indexedSymbolInstance.crossTileID);
-        }
+    for (const auto& indexedSymbolInstance : removedBucket.indexedSymbolInstances) {
+        usedCrossTileIDs[zoom].erase(indexedSymbolInstance.crossTileID);
     }
 }
 
@@ -7,6 +7,7 @@
 #include <mbgl/util/mat4.hpp>
 #include <mbgl/util/optional.hpp>
 
+#include <cstddef>
 #include <map>
 #include <set>
 #include <vector>
@@ -22,12 +23,15 @@ class SymbolBucket;
 
 class IndexedSymbolInstance {
 public:
-    IndexedSymbolInstance(uint32_t crossTileID_, Point<int64_t> coord_)
-        : crossTileID(crossTileID_), coord(coord_)
+    IndexedSymbolInstance(uint32_t crossTileID_, Point<int64_t> coord_, std::size_t keyHash_, uint32_t order_)
+        : crossTileID(crossTileID_), coord(coord_), keyHash(keyHash_), order(order_)
     {}
 
     uint32_t crossTileID;
     Point<int64_t> coord;
+    std::size_t keyHash;
+    uint32_t keyIndex = 0; // Index into TileLayerIndex::keys
+    uint32_t order;        // Position of the symbol in its bucket
 };
 
 class TileLayerIndex {
@@ -43,7 +47,18 @@ public:
     OverscaledTileID coord;
     uint32_t bucketInstanceId;
     std::string bucketLeaderId;
-    std::map<std::u16string,std::vector<IndexedSymbolInstance>> indexedSymbolInstances;
+
+    // Sorted by key hash, key, cell of a grid over the scaled coordinates and order, so that
+    // the candidates for a match are found with a few binary searches instead of a scan.
+    std::vector<IndexedSymbolInstance> indexedSymbolInstances;
+    // The distinct keys of the indexed symbols.
+    std::vector<std::u16string> keys;
+
+private:
+    const IndexedSymbolInstance* findMatch(const SymbolInstance&,
+                                           const Point<int64_t>& scaledCoord,
+                                           float tolerance,
+                                           const std::set<uint32_t>& zoomCrossTileIDs) const;
 };
 
 class CrossTileSymbolLayerIndex {
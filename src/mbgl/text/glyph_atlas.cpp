@@ -1,7 +1,12 @@
 #include <mbgl/text/glyph_atlas.hpp>
+#include <mbgl/gfx/upload_pass.hpp>
 
 #include <mapbox/shelf-pack.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <tuple>
+
 namespace mbgl {
 
 static constexpr uint32_t padding = 1;
@@ -62,4 +67,191 @@ GlyphAtlas makeGlyphAtlas(const GlyphMap& glyphs) {
     return result;
 }
 
+struct SharedGlyphAtlas::Entry {
+    // Keeps the glyph alive, so that its address identifies it as long as the entry exists.
+    Immutable<Glyph> glyph;
+    mapbox::Bin* bin;
+    GlyphPosition position;
+    std::size_t references;
+};
+
+class SharedGlyphAtlas::Pack {
+public:
+    explicit Pack(uint16_t maxSize_) : maxSize(maxSize_), shelfPack(initialSize, initialSize) {
+        image.resize({initialSize, initialSize});
+    }
+
+    // Returns the entry of the glyph, packing it if needed, or null if it does not fit.
+    Entry* add(FontStackHash, const Immutable<Glyph>&);
+    void release(const std::vector<Entry*>&);
+    void evictUnused();
+
+    static constexpr uint16_t initialSize = 128;
+    const uint16_t maxSize;
+
+    std::mutex mutex;
+    mapbox::ShelfPack shelfPack;
+    AlphaImage image;
+    // Keyed by the glyph object too: a font stack may be served by different glyph sets over the
+    // lifetime of the renderer, and layouts of both can be alive at the same time.
+    std::map<std::tuple<FontStackHash, GlyphID, const Glyph*>, Entry> entries;
+    // Region of the image changed since the last upload.
+    optional<Rect<uint32_t>> dirty;
+};
+
+SharedGlyphAtlas::Entry* SharedGlyphAtlas::Pack::add(FontStackHash fontStack, const Immutable<Glyph>& glyph) {
+    auto it = entries.find(std::make_tuple(fontStack, glyph->id, glyph.get()));
+    if (it != entries.end()) {
+        return &it->second;
+    }
+
+    const int32_t width = glyph->bitmap.size.width + 2 * padding;
+    const int32_t height = glyph->bitmap.size.height + 2 * padding;
+    mapbox::Bin* bin = shelfPack.packOne(-1, width, height);
+    while (!bin && (shelfPack.width() < maxSize || shelfPack.height() < maxSize)) {
+        // Existing bins keep their position when the pack grows.
+        shelfPack.resize(std::min<int32_t>(shelfPack.width() * 2, maxSize),
+                         std::min<int32_t>(shelfPack.height() * 2, maxSize));
+        bin = shelfPack.packOne(-1, width, height);
+    }
+    if (!bin) {
+        evictUnused();
+        bin = shelfPack.packOne(-1, width, height);
+    }
+    if (!bin) {
+        return nullptr;
+    }
+
+    image.resize({static_cast<uint32_t>(shelfPack.width()), static_cast<uint32_t>(shelfPack.height())});
+    AlphaImage::copy(glyph->bitmap, image, {0, 0}, {bin->x + padding, bin->y + padding}, glyph->bitmap.size);
+
+    const Rect<uint32_t> rect{static_cast<uint32_t>(bin->x),
+                              static_cast<uint32_t>(bin->y),
+                              static_cast<uint32_t>(bin->w),
+                              static_cast<uint32_t>(bin->h)};
+    if (!dirty) {
+        dirty = rect;
+    } else {
+        const uint32_t right = std::max(dirty->x + dirty->w, rect.x + rect.w);
+        const uint32_t bottom = std::max(dirty->y + dirty->h, rect.y + rect.h);
+        dirty->x = std::min(dirty->x, rect.x);
+        dirty->y = std::min(dirty->y, rect.y);
+        dirty->w = right - dirty->x;
+        dirty->h = bottom - dirty->y;
+    }
+
+    GlyphPosition position{Rect<uint16_t>{static_cast<uint16_t>(bin->x),
+                                          static_cast<uint16_t>(bin->y),
+                                          static_cast<uint16_t>(bin->w),
+                                          static_cast<uint16_t>(bin->h)},
+                           glyph->metrics};
+    return &entries.emplace(std::make_tuple(fontStack, glyph->id, glyph.get()), Entry{glyph, bin, position, 0})
+                .first->second;
+}
+
+void SharedGlyphAtlas::Pack::release(const std::vector<Entry*>& released) {
+    for (Entry* entry : released) {
+        assert(entry->references);
+        --entry->references;
+    }
+}
+
+void SharedGlyphAtlas::Pack::evictUnused() {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.references) {
+            ++it;
+            continue;
+        }
+        // Clear the padding, which a smaller glyph reusing the bin relies on.
+        const mapbox::Bin& bin = *it->second.bin;
+        AlphaImage::clear(image,
+                          {static_cast<uint32_t>(bin.x), static_cast<uint32_t>(bin.y)},
+                          {static_cast<uint32_t>(bin.w), static_cast<uint32_t>(bin.h)});
+        shelfPack.unref(*it->second.bin);
+        it = entries.erase(it);
+    }
+}
+
+SharedGlyphAtlas::Reference::Reference(std::shared_ptr<Pack> pack_) : pack(std::move(pack_)) {}
+
+SharedGlyphAtlas::Reference::~Reference() {
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    pack->release(entries);
+}
+
+SharedGlyphAtlas::SharedGlyphAtlas(uint16_t maxSize) : pack(std::make_shared<Pack>(maxSize)) {}
+
+SharedGlyphAtlas::~SharedGlyphAtlas() = default;
+
+std::shared_ptr<const SharedGlyphAtlas::Reference> SharedGlyphAtlas::addGlyphs(const GlyphMap& glyphs) {
+    auto reference = std::make_shared<Reference>(pack);
+
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    for (const auto& glyphMapEntry : glyphs) {
+        GlyphPositionMap& positions = reference->positions[glyphMapEntry.first];
+
+        for (const auto& entry : glyphMapEntry.second) {
+            if (!entry.second || !(*entry.second)->bitmap.valid()) {
+                continue;
+            }
+
+            Entry* atlasEntry = pack->add(glyphMapEntry.first, *entry.second);
+            if (!atlasEntry) {
+                pack->release(reference->entries);
+                reference->entries.clear();
+                return nullptr;
+            }
+            ++atlasEntry->references;
+            reference->entries.push_back(atlasEntry);
+            positions.emplace(entry.first, atlasEntry->position);
+        }
+    }
+
+    return reference;
+}
+
+void SharedGlyphAtlas::upload(gfx::UploadPass& uploadPass) {
+    std::unique_lock<std::mutex> lock(pack->mutex);
+    if (!texture || texture->size != pack->image.size) {
+        texture = uploadPass.createTexture(pack->image);
+        pack->dirty = nullopt;
+    } else if (pack->dirty) {
+        const Rect<uint32_t> rect = *pack->dirty;
+        AlphaImage patch({rect.w, rect.h});
+        AlphaImage::copy(pack->image, patch, {rect.x, rect.y}, {0, 0}, patch.size);
+        pack->dirty = nullopt;
+        lock.unlock();
+
+        uploadPass.updateTextureSub(
+            *texture, patch, static_cast<uint16_t>(rect.x), static_cast<uint16_t>(rect.y));
+    }
+}
+
+const gfx::Texture& SharedGlyphAtlas::getTexture() const {
+    assert(texture);
+    return *texture;
+}
+
+void SharedGlyphAtlas::clear() {
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    pack->evictUnused();
+    if (pack->entries.empty()) {
+        pack->shelfPack.clear();
+        pack->shelfPack.resize(Pack::initialSize, Pack::initialSize);
+        pack->image = AlphaImage({Pack::initialSize, Pack::initialSize});
+    }
+    pack->dirty = nullopt;
+    texture = nullopt;
+}
+
+Size SharedGlyphAtlas::getPixelSize() const {
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    return pack->image.size;
+}
+
+std::size_t SharedGlyphAtlas::getGlyphCount() const {
+    std::lock_guard<std::mutex> lock(pack->mutex);
+    return pack->entries.size();
+}
+
 } // namespace mbgl
@@ -1,11 +1,19 @@
 #pragma once
 
+#include <mbgl/gfx/texture.hpp>
 #include <mbgl/text/glyph.hpp>
 
 #include <mapbox/shelf-pack.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace mbgl {
 
+namespace gfx {
+class UploadPass;
+} // namespace gfx
+
 struct GlyphPosition {
     Rect<uint16_t> rect;
     GlyphMetrics metrics;
@@ -22,4 +30,58 @@ public:
 
 GlyphAtlas makeGlyphAtlas(const GlyphMap&);
 
+// Glyph atlas shared by the symbol layouts of all tiles of a renderer, so that a glyph used by
+// many tiles is packed and uploaded once. Layouts add their glyphs from the worker threads and
+// get positions that stay valid for as long as they hold the returned reference. Glyphs that are
+// no longer referenced are evicted when the atlas reaches its maximum size.
+class SharedGlyphAtlas {
+public:
+    class Reference;
+
+    explicit SharedGlyphAtlas(uint16_t maxSize = 2048);
+    SharedGlyphAtlas(const SharedGlyphAtlas&) = delete;
+    SharedGlyphAtlas& operator=(const SharedGlyphAtlas&) = delete;
+    ~SharedGlyphAtlas();
+
+    // Adds the glyphs to the atlas, or references them if they are already in it. Returns null
+    // if they do not fit, in which case the caller should pack its own atlas with
+    // makeGlyphAtlas(). Safe to call from any thread.
+    std::shared_ptr<const Reference> addGlyphs(const GlyphMap&);
+
+    // Uploads the glyphs added since the last upload. Must be called on the render thread.
+    void upload(gfx::UploadPass&);
+    const gfx::Texture& getTexture() const;
+
+    // Drops the glyphs that no layout references and the texture. If no glyphs are left, the
+    // atlas shrinks back to its initial size. Must be called on the render thread.
+    void clear();
+
+    Size getPixelSize() const;
+    std::size_t getGlyphCount() const;
+
+private:
+    class Pack;
+    struct Entry;
+
+    // Shared with the references, which may outlive the atlas. The texture is not, so that it is
+    // always released on the render thread.
+    std::shared_ptr<Pack> pack;
+    optional<gfx::Texture> texture;
+};
+
+class SharedGlyphAtlas::Reference {
+public:
+    explicit Reference(std::shared_ptr<Pack>);
+    ~Reference();
+
+    const GlyphPositions& getPositions() const { return positions; }
+
+private:
+    friend class SharedGlyphAtlas;
+
+    std::shared_ptr<Pack> pack;
+    std::vector<Entry*> entries;
+    GlyphPositions positions;
+};
+
 } // namespace mbgl
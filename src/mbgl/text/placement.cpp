@@ -1,4 +1,5 @@
 #include <list>
+#include <mbgl/actor/scheduler.hpp>
 #include <mbgl/layout/symbol_layout.hpp>
 #include <mbgl/renderer/bucket.hpp>
 #include <mbgl/renderer/buckets/symbol_bucket.hpp>
@@ -8,6 +9,12 @@
 #include <mbgl/text/placement.hpp>
 #include <mbgl/tile/geometry_tile.hpp>
 #include <mbgl/util/math.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 namespace mbgl {
@@ -47,7 +54,7 @@ const CollisionGroups::CollisionGroup& CollisionGroups::get(const std::string& s
             uint16_t nextGroupID = ++maxGroupID;
             collisionGroups.emplace(sourceID, CollisionGroup(
                 nextGroupID,
-                optional<Predicate>([nextGroupID](const IndexedSubfeature& feature) -> bool {
+                optional<Predicate>([nextGroupID](const CollisionGridFeature& feature) -> bool {
                     return feature.collisionGroupId == nextGroupID;
                 })
             ));
@@ -77,6 +84,7 @@ public:
         : bucket(bucket_),
           renderTile(renderTile_),
           state(state_),
+          posMatrix(calculatePosMatrix(renderTile_, state_)),
           pixelsToTileUnits(renderTile_.id.pixelsToTileUnits(1, placementZoom)),
           scale(std::pow(2, placementZoom - getOverscaledID().overscaledZ)),
           pixelRatio(util::tileSize * getOverscaledID().overscaleFactor() / util::EXTENT),
@@ -93,6 +101,10 @@ public:
 
     const TransformState& getTransformState() const { return state; }
 
+    // The tile matrix for the placement's transform state, which differs from the
+    // render tile's matrix once a time-sliced placement spans several frames.
+    const mat4 posMatrix;
+
     const std::vector<style::TextVariableAnchorType>& getVariableTextAnchors() const {
         return getLayout().get<style::TextVariableAnchor>();
     }
@@ -108,12 +120,11 @@ public:
     SymbolPlacementType placementType = getLayout().get<SymbolPlacement>();
 
     mat4 textLabelPlaneMatrix =
-        getLabelPlaneMatrix(renderTile.get().matrix, pitchTextWithMap, rotateTextWithMap, state, pixelsToTileUnits);
+        getLabelPlaneMatrix(posMatrix, pitchTextWithMap, rotateTextWithMap, state, pixelsToTileUnits);
     mat4 iconLabelPlaneMatrix =
         (rotateTextWithMap == rotateIconWithMap && pitchTextWithMap == pitchIconWithMap)
             ? textLabelPlaneMatrix
-            : getLabelPlaneMatrix(
-                  renderTile.get().matrix, pitchIconWithMap, rotateIconWithMap, state, pixelsToTileUnits);
+            : getLabelPlaneMatrix(posMatrix, pitchIconWithMap, rotateIconWithMap, state, pixelsToTileUnits);
 
     CollisionGroups::CollisionGroup collisionGroup;
     ZoomEvaluatedSize partiallyEvaluatedTextSize;
@@ -144,6 +155,14 @@ public:
     bool hasIconTextFit = getLayout().get<IconTextFit>() != IconTextFitType::None;
 
     optional<CollisionBoundaries> avoidEdges;
+
+private:
+    static mat4 calculatePosMatrix(const RenderTile& tile, const TransformState& state) {
+        mat4 result;
+        state.matrixFor(result, tile.id);
+        matrix::multiply(result, state.getProjectionMatrix(), result);
+        return result;
+    }
 };
 
 // PlacementController implemenation
@@ -185,6 +204,7 @@ Placement::Placement(std::shared_ptr<const UpdateParameters> updateParameters_,
       showCollisionBoxes(updateParameters->debugOptions & MapDebugOptions::Collision) {
     if (prevPlacement) {
         prevPlacement->get()->prevPlacement = nullopt; // Only hold on to one placement back
+        placements.reserveLike(prevPlacement->get()->placements);
     }
 }
 
@@ -200,6 +220,205 @@ void Placement::placeLayers(const RenderLayerReferences& layers) {
     commit();
 }
 
+bool Placement::placeLayersUntil(const RenderLayerReferences& layers, TimePoint now, TimePoint deadline) {
+    bool placedAny = false;
+    while (nextLayer < layers.size()) {
+        const RenderLayer& layer = layers[layers.size() - 1 - nextLayer];
+        const LayerPlacementData& placementData = layer.getPlacementData();
+        if (nextBucket < placementData.size()) {
+            auto it = std::next(placementData.begin(), nextBucket);
+            for (; it != placementData.end(); ++it) {
+                if (placedAny && Clock::now() >= deadline) return false;
+                const BucketPlacementData& data = *it;
+                Bucket& bucket = data.bucket;
+                bucket.place(*this, data, currentLayerCrossTileIDs);
+                ++nextBucket;
+                placedAny = true;
+            }
+        }
+        ++nextLayer;
+        nextBucket = 0;
+        currentLayerCrossTileIDs.clear();
+    }
+    // Fading starts when the result becomes visible, not when the placement started.
+    commitTime = now;
+    commit();
+    return true;
+}
+
+namespace {
+// Symbols up to the collision grid's padding outside the viewport are collided as well, so
+// panning by less than that reveals no symbols that were not collided.
+constexpr float kMaxWarmStartOffset = 50.0f;
+// Rotation and pitch in radians that are considered unchanged, or flat.
+constexpr double kMaxWarmStartAngle = 1e-4;
+
+// Returns how far the content of the map moved in the viewport, if the change from one
+// transform state to the other is a pan by a few pixels at most.
+optional<Point<float>> getWarmStartOffset(const TransformState& from, const TransformState& to) {
+    if (from.getSize() != to.getSize() || from.getZoom() != to.getZoom() ||
+        from.getEdgeInsets() != to.getEdgeInsets()) {
+        return nullopt;
+    }
+    // Panning a pitched map moves the near symbols more than the far ones.
+    if (std::abs(from.getBearing() - to.getBearing()) > kMaxWarmStartAngle || from.getPitch() > kMaxWarmStartAngle ||
+        to.getPitch() > kMaxWarmStartAngle) {
+        return nullopt;
+    }
+
+    // TransformState projects to y-up coordinates, while collision and query geometries are y-down.
+    const LatLng center = from.getLatLng();
+    const ScreenCoordinate before = from.latLngToScreenCoordinate(center);
+    const ScreenCoordinate after = to.latLngToScreenCoordinate(center);
+    const Point<float> offset(after.x - before.x, before.y - after.y);
+    if (offset.x * offset.x + offset.y * offset.y > kMaxWarmStartOffset * kMaxWarmStartOffset) {
+        return nullopt;
+    }
+    return offset;
+}
+
+} // namespace
+
+bool Placement::warmStart() {
+    const Placement* prev = getPrevPlacement();
+    // The initial placement has no symbols to take over.
+    if (!prev || !prev->updateParameters) return false;
+    // Debug collision boxes are drawn for the viewport the symbols were collided in.
+    if (showCollisionBoxes || prev->showCollisionBoxes) return false;
+    if (updateParameters->crossSourceCollisions != prev->updateParameters->crossSourceCollisions) return false;
+
+    const Immutable<Placement>& source = prev->collisionSource ? *prev->collisionSource : *prevPlacement;
+    const auto offset =
+        getWarmStartOffset(source->collisionIndex.getTransformState(), collisionIndex.getTransformState());
+    if (!offset) return false;
+
+    placements = prev->placements;
+    retainedQueryData = prev->retainedQueryData;
+    collisionSource = source;
+    collisionOffset = *offset;
+    // Variable offsets and orientations of the placed symbols are carried over from the previous placement.
+    commit();
+    return true;
+}
+
+namespace {
+// Below this number of line labels, projecting them ahead is not worth the synchronization.
+constexpr std::size_t kMinLineFeaturesToProject = 256;
+constexpr std::size_t kLineFeaturesPerTask = 64;
+} // namespace
+
+void Placement::projectLineFeatures(const RenderLayerReferences& layers) {
+    if (!parallelLineProjection) return;
+
+    struct LineFeature {
+        const CollisionFeature* feature;
+        const PlacedSymbol* symbol;
+        const PlacementContext* ctx;
+        float fontSize;
+        bool isText;
+    };
+
+    // Shared with the scheduled tasks, which may start after the projection is complete.
+    struct Job {
+        std::list<PlacementContext> contexts;
+        std::vector<LineFeature> features;
+        std::vector<CollisionIndex::ProjectedLineFeature> results;
+        std::atomic<std::size_t> next{0};
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::size_t completed = 0;
+    };
+    auto job = std::make_shared<Job>();
+
+    for (const RenderLayer& layer : layers) {
+        for (const BucketPlacementData& params : layer.getPlacementData()) {
+            if (params.sortKeyRange && !params.sortKeyRange->isFirstRange()) continue;
+            if (params.tile.get().holdForFade()) continue;
+            const auto& bucket = static_cast<const SymbolBucket&>(params.bucket.get());
+            // Only the transform dependent parts of the context are used for projecting.
+            job->contexts.emplace_back(bucket,
+                                       params.tile,
+                                       collisionIndex.getTransformState(),
+                                       placementZoom,
+                                       CollisionGroups::CollisionGroup{0, nullopt});
+            const PlacementContext& ctx = job->contexts.back();
+
+            for (const SymbolInstance& symbol : bucket.symbolInstances) {
+                if (symbol.crossTileID == SymbolInstance::invalidCrossTileID()) continue;
+                // Mirror the arguments placeSymbol() passes for line labels.
+                optional<size_t> horizontalTextIndex = symbol.getDefaultHorizontalPlacedTextIndex();
+                if (horizontalTextIndex && symbol.textCollisionFeature.alongLine) {
+                    const PlacedSymbol& placedSymbol = bucket.text.placedSymbols.at(*horizontalTextIndex);
+                    job->features.push_back({&symbol.textCollisionFeature,
+                                             &placedSymbol,
+                                             &ctx,
+                                             evaluateSizeForFeature(ctx.partiallyEvaluatedTextSize, placedSymbol),
+                                             true});
+                }
+                if (symbol.placedIconIndex && symbol.iconCollisionFeature.alongLine) {
+                    const auto& iconBuffer = symbol.hasSdfIcon() ? bucket.sdfIcon : bucket.icon;
+                    const PlacedSymbol& placedSymbol = iconBuffer.placedSymbols.at(*symbol.placedIconIndex);
+                    job->features.push_back({&symbol.iconCollisionFeature,
+                                             &placedSymbol,
+                                             &ctx,
+                                             evaluateSizeForFeature(ctx.partiallyEvaluatedIconSize, placedSymbol),
+                                             false});
+                }
+            }
+        }
+    }
+
+    const std::size_t count = job->features.size();
+    if (count < kMinLineFeaturesToProject) return;
+    job->results.resize(count);
+
+    const CollisionIndex& index = collisionIndex;
+    auto work = [&index](Job& j) {
+        const std::size_t total = j.features.size();
+        std::size_t begin;
+        while ((begin = j.next.fetch_add(kLineFeaturesPerTask)) < total) {
+            const std::size_t end = std::min(begin + kLineFeaturesPerTask, total);
+            for (std::size_t i = begin; i < end; ++i) {
+                const LineFeature& item = j.features[i];
+                const PlacementContext& ctx = *item.ctx;
+                j.results[i] =
+                    index.projectLineFeature(*item.feature,
+                                             ctx.posMatrix,
+                                             item.isText ? ctx.textLabelPlaneMatrix : ctx.iconLabelPlaneMatrix,
+                                             ctx.pixelRatio,
+                                             *item.symbol,
+                                             ctx.scale,
+                                             item.fontSize,
+                                             ctx.pitchTextWithMap);
+            }
+            std::lock_guard<std::mutex> lock(j.mutex);
+            j.completed += end - begin;
+            if (j.completed == total) j.cv.notify_all();
+        }
+    };
+
+    // The calling thread takes part, so the projection completes even if the pool is busy.
+    const std::size_t chunks = (count + kLineFeaturesPerTask - 1) / kLineFeaturesPerTask;
+    const std::size_t helpers =
+        std::min<std::size_t>(chunks, std::max(1u, std::thread::hardware_concurrency())) - 1;
+    auto scheduler = Scheduler::GetBackground();
+    for (std::size_t i = 0; i < helpers; ++i) {
+        scheduler->scheduleWithPriority(TaskPriority::Critical, [job, work] { work(*job); });
+    }
+    work(*job);
+    {
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->cv.wait(lock, [&] { return job->completed == count; });
+    }
+
+    CollisionIndex::ProjectedLineFeatures projected;
+    projected.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        projected.emplace(job->features[i].feature, std::move(job->results[i]));
+    }
+    collisionIndex.setProjectedLineFeatures(std::move(projected));
+}
+
 void Placement::placeLayer(const RenderLayer& layer, std::set<uint32_t>& seenCrossTileIDs) {
     for (const BucketPlacementData& data : layer.getPlacementData()) {
         Bucket& bucket = data.bucket;
@@ -262,7 +481,7 @@ JointPlacement Placement::placeSymbol(const SymbolInstance& symbolInstance, cons
         return kUnplaced;
     }
     const SymbolBucket& bucket = ctx.getBucket();
-    const mat4& posMatrix = ctx.getRenderTile().matrix;
+    const mat4& posMatrix = ctx.posMatrix;
     const auto& collisionGroup = ctx.collisionGroup;
     auto variableTextAnchors = ctx.getVariableTextAnchors();
     textBoxes.clear();
@@ -282,9 +501,9 @@ JointPlacement Placement::placeSymbol(const SymbolInstance& symbolInstance, cons
 
         const auto updatePreviousOrientationIfNotPlaced = [&](bool isPlaced) {
             if (bucket.allowVerticalPlacement && !isPlaced && getPrevPlacement()) {
-                auto prevOrientation = getPrevPlacement()->placedOrientations.find(symbolInstance.crossTileID);
-                if (prevOrientation != getPrevPlacement()->placedOrientations.end()) {
-                    placedOrientations[symbolInstance.crossTileID] = prevOrientation->second;
+                if (const auto* prevOrientation =
+                        getPrevPlacement()->placedOrientations.find(symbolInstance.crossTileID)) {
+                    placedOrientations.set(symbolInstance.crossTileID, *prevOrientation);
                 }
             }
         };
@@ -356,9 +575,8 @@ JointPlacement Placement::placeSymbol(const SymbolInstance& symbolInstance, cons
             // anchor to the front of the anchor list, only if the previous anchor
             // is still in the anchor list.
             if (getPrevPlacement()) {
-                auto prevOffset = getPrevPlacement()->variableOffsets.find(symbolInstance.crossTileID);
-                if (prevOffset != getPrevPlacement()->variableOffsets.end()) {
-                    const auto prevAnchor = prevOffset->second.anchor;
+                if (const auto* prevOffset = getPrevPlacement()->variableOffsets.find(symbolInstance.crossTileID)) {
+                    const auto prevAnchor = prevOffset->anchor;
                     auto found = std::find(variableTextAnchors.begin(), variableTextAnchors.end(), prevAnchor);
                     if (found != variableTextAnchors.begin() && found != variableTextAnchors.end()) {
                         std::vector<style::TextVariableAnchorType> filtered{prevAnchor};
@@ -445,19 +663,18 @@ JointPlacement Placement::placeSymbol(const SymbolInstance& symbolInstance, cons
                         // If this label was placed in the previous placement, record the anchor position
                         // to allow us to animate the transition
                         if (getPrevPlacement()) {
-                            auto prevOffset = getPrevPlacement()->variableOffsets.find(symbolInstance.crossTileID);
-                            auto prevPlacements = getPrevPlacement()->placements.find(symbolInstance.crossTileID);
-                            if (prevOffset != getPrevPlacement()->variableOffsets.end() &&
-                                prevPlacements != getPrevPlacement()->placements.end() && prevPlacements->second.text) {
+                            const auto* prevOffset = getPrevPlacement()->variableOffsets.find(symbolInstance.crossTileID);
+                            const auto* prevPlacements = getPrevPlacement()->placements.find(symbolInstance.crossTileID);
+                            if (prevOffset && prevPlacements && prevPlacements->text) {
                                 // TODO: The prevAnchor seems to be unused, needs to be fixed.
-                                prevAnchor = prevOffset->second.anchor;
+                                prevAnchor = prevOffset->anchor;
                             }
                         }
 
-                        variableOffsets.insert(std::make_pair(
+                        variableOffsets.emplace(
                             symbolInstance.crossTileID,
                             VariableOffset{
-                                symbolInstance.variableTextOffset, width, height, anchor, textBoxScale, prevAnchor}));
+                                symbolInstance.variableTextOffset, width, height, anchor, textBoxScale, prevAnchor});
 
                         if (bucket.allowVerticalPlacement) {
                             placedOrientations.emplace(symbolInstance.crossTileID, orientation);
@@ -496,9 +713,8 @@ JointPlacement Placement::placeSymbol(const SymbolInstance& symbolInstance, cons
             // If we didn't get placed, we still need to copy our position from the last placement for
             // fade animations
             if (!placeText && getPrevPlacement()) {
-                auto prevOffset = getPrevPlacement()->variableOffsets.find(symbolInstance.crossTileID);
-                if (prevOffset != getPrevPlacement()->variableOffsets.end()) {
-                    variableOffsets[symbolInstance.crossTileID] = prevOffset->second;
+                if (const auto* prevOffset = getPrevPlacement()->variableOffsets.find(symbolInstance.crossTileID)) {
+                    variableOffsets.set(symbolInstance.crossTileID, *prevOffset);
                 }
             }
         }
@@ -595,15 +811,11 @@ JointPlacement Placement::placeSymbol(const SymbolInstance& symbolInstance, cons
 
     assert(symbolInstance.crossTileID != 0);
 
-    if (placements.find(symbolInstance.crossTileID) != placements.end()) {
-        // If there's a previous placement with this ID, it comes from a tile that's fading out
-        // Erase it so that the placement result from the non-fading tile supersedes it
-        placements.erase(symbolInstance.crossTileID);
-    }
-
+    // If there's a previous placement with this ID, it comes from a tile that's fading out
+    // Replace it so that the placement result from the non-fading tile supersedes it
     JointPlacement result(
         placeText || ctx.alwaysShowText, placeIcon || ctx.alwaysShowIcon, offscreen || bucket.justReloaded);
-    placements.emplace(symbolInstance.crossTileID, result);
+    placements.set(symbolInstance.crossTileID, result);
     newSymbolPlaced(symbolInstance, ctx, result, ctx.placementType, textBoxes, iconBoxes);
     return result;
 }
@@ -657,48 +869,46 @@ void Placement::commit() {
     prevZoomAdjustment = getPrevPlacement()->zoomAdjustment(placementZoom);
     float increment = getPrevPlacement()->symbolFadeChange(commitTime);
 
+    opacities.reserveLike(getPrevPlacement()->opacities);
+
     // add the opacities from the current placement, and copy their current values from the previous placement
-    for (auto& jointPlacement : placements) {
-        auto prevOpacity = getPrevPlacement()->opacities.find(jointPlacement.first);
-        if (prevOpacity != getPrevPlacement()->opacities.end()) {
-            opacities.emplace(jointPlacement.first, JointOpacityState(prevOpacity->second, increment, jointPlacement.second.text, jointPlacement.second.icon));
+    placements.forEach([&](uint32_t crossTileID, const JointPlacement& jointPlacement) {
+        if (const auto* prevOpacity = getPrevPlacement()->opacities.find(crossTileID)) {
+            opacities.emplace(crossTileID, *prevOpacity, increment, jointPlacement.text, jointPlacement.icon);
             placementChanged = placementChanged ||
-                jointPlacement.second.icon != prevOpacity->second.icon.placed ||
-                jointPlacement.second.text != prevOpacity->second.text.placed;
+                jointPlacement.icon != prevOpacity->icon.placed ||
+                jointPlacement.text != prevOpacity->text.placed;
         } else {
-            opacities.emplace(jointPlacement.first, JointOpacityState(jointPlacement.second.text, jointPlacement.second.icon, jointPlacement.second.skipFade));
-            placementChanged = placementChanged || jointPlacement.second.icon || jointPlacement.second.text;
+            opacities.emplace(crossTileID, jointPlacement.text, jointPlacement.icon, jointPlacement.skipFade);
+            placementChanged = placementChanged || jointPlacement.icon || jointPlacement.text;
         }
-    }
+    });
 
     // copy and update values from the previous placement that aren't in the current placement but haven't finished fading
-    for (auto& prevOpacity : getPrevPlacement()->opacities) {
-        if (opacities.find(prevOpacity.first) == opacities.end()) {
-            JointOpacityState jointOpacity(prevOpacity.second, increment, false, false);
+    getPrevPlacement()->opacities.forEach([&](uint32_t crossTileID, const JointOpacityState& prevOpacity) {
+        if (!opacities.contains(crossTileID)) {
+            JointOpacityState jointOpacity(prevOpacity, increment, false, false);
             if (!jointOpacity.isHidden()) {
-                opacities.emplace(prevOpacity.first, jointOpacity);
-                placementChanged = placementChanged || prevOpacity.second.icon.placed || prevOpacity.second.text.placed;
+                opacities.emplace(crossTileID, jointOpacity);
+                placementChanged = placementChanged || prevOpacity.icon.placed || prevOpacity.text.placed;
             }
         }
-    }
+    });
 
-    for (auto& prevOffset : getPrevPlacement()->variableOffsets) {
-        const uint32_t crossTileID = prevOffset.first;
-        auto foundOffset = variableOffsets.find(crossTileID);
-        auto foundOpacity = opacities.find(crossTileID);
-        if (foundOffset == variableOffsets.end() && foundOpacity != opacities.end() && !foundOpacity->second.isHidden()) {
-            variableOffsets[prevOffset.first] = prevOffset.second;
+    getPrevPlacement()->variableOffsets.forEach([&](uint32_t crossTileID, const VariableOffset& prevOffset) {
+        const auto* foundOpacity = opacities.find(crossTileID);
+        if (!variableOffsets.contains(crossTileID) && foundOpacity && !foundOpacity->isHidden()) {
+            variableOffsets.set(crossTileID, prevOffset);
         }
-    }
+    });
 
-    for (auto& prevOrientation : getPrevPlacement()->placedOrientations) {
-        const uint32_t crossTileID = prevOrientation.first;
-        auto foundOrientation = placedOrientations.find(crossTileID);
-        auto foundOpacity = opacities.find(crossTileID);
-        if (foundOrientation == placedOrientations.end() && foundOpacity != opacities.end() && !foundOpacity->second.isHidden()) {
-            placedOrientations[prevOrientation.first] = prevOrientation.second;
-        }
-    }
+    getPrevPlacement()->placedOrientations.forEach(
+        [&](uint32_t crossTileID, style::TextWritingModeType prevOrientation) {
+            const auto* foundOpacity = opacities.find(crossTileID);
+            if (!placedOrientations.contains(crossTileID) && foundOpacity && !foundOpacity->isHidden()) {
+                placedOrientations.set(crossTileID, prevOrientation);
+            }
+        });
 
     fadeStartTime = placementChanged ? commitTime : getPrevPlacement()->fadeStartTime;
 }
@@ -774,10 +984,9 @@ bool Placement::updateBucketDynamicVertices(SymbolBucket& bucket, const Transfor
             optional<VariableOffset> variableOffset;
             const bool skipOrientation = bucket.allowVerticalPlacement && !symbol.placedOrientation;
             if (!symbol.hidden && symbol.crossTileID != 0u && !skipOrientation) {
-                auto it = variableOffsets.find(symbol.crossTileID);
-                if (it != variableOffsets.end()) {
+                if (const auto* found = variableOffsets.find(symbol.crossTileID)) {
                     bucket.hasVariablePlacement = true;
-                    variableOffset = it->second;
+                    variableOffset = *found;
                 }
             }
 
@@ -913,12 +1122,12 @@ void Placement::updateBucketOpacities(SymbolBucket& bucket,
     for (SymbolInstance& symbolInstance : bucket.symbolInstances) {
         bool isDuplicate = seenCrossTileIDs.count(symbolInstance.crossTileID) > 0;
 
-        auto it = opacities.find(symbolInstance.crossTileID);
+        const auto* found = opacities.find(symbolInstance.crossTileID);
         auto opacityState = defaultOpacityState;
         if (isDuplicate) {
             opacityState = duplicateOpacityState;
-        } else if (it != opacities.end()) {
-            opacityState = it->second;
+        } else if (found) {
+            opacityState = *found;
         }
 
         seenCrossTileIDs.insert(symbolInstance.crossTileID);
@@ -950,16 +1159,14 @@ void Placement::updateBucketOpacities(SymbolBucket& bucket,
 
             style::TextWritingModeType previousOrientation = style::TextWritingModeType::Horizontal;
             if (bucket.allowVerticalPlacement) {
-                auto prevOrientation = placedOrientations.find(symbolInstance.crossTileID);
-                if (prevOrientation != placedOrientations.end()) {
-                    previousOrientation = prevOrientation->second;
-                    markUsedOrientation(bucket, prevOrientation->second, symbolInstance);
+                if (const auto* prevOrientation = placedOrientations.find(symbolInstance.crossTileID)) {
+                    previousOrientation = *prevOrientation;
+                    markUsedOrientation(bucket, *prevOrientation, symbolInstance);
                 }
             }
 
-            auto prevOffset = variableOffsets.find(symbolInstance.crossTileID);
-            if (prevOffset != variableOffsets.end()) {
-                markUsedJustification(bucket, prevOffset->second.anchor, symbolInstance, previousOrientation);
+            if (const auto* prevOffset = variableOffsets.find(symbolInstance.crossTileID)) {
+                markUsedJustification(bucket, prevOffset->anchor, symbolInstance, previousOrientation);
             }
         }
         if (symbolInstance.hasIcon()) {
@@ -998,9 +1205,8 @@ void Placement::updateBucketOpacities(SymbolBucket& bucket,
                 }
                 bool used = true;
                 if (variablePlacement) {
-                    auto foundOffset = variableOffsets.find(symbolInstance.crossTileID);
-                    if (foundOffset != variableOffsets.end()) {
-                        const VariableOffset& variableOffset = foundOffset->second;
+                    if (const auto* foundOffset = variableOffsets.find(symbolInstance.crossTileID)) {
+                        const VariableOffset& variableOffset = *foundOffset;
                         // This will show either the currently placed position or the last
                         // successfully placed position (so you can visualize what collision
                         // just made the symbol disappear, and the most likely place for the
@@ -1174,8 +1380,7 @@ float Placement::zoomAdjustment(const float zoom) const {
 
 const JointPlacement* Placement::getSymbolPlacement(const SymbolInstance& symbol) const {
     assert(symbol.crossTileID != 0);
-    auto found = placements.find(symbol.crossTileID);
-    return (found != placements.end()) ? &found->second : nullptr;
+    return placements.find(symbol.crossTileID);
 }
 
 Duration Placement::getUpdatePeriod(const float zoom) const {
@@ -1201,8 +1406,19 @@ const std::vector<PlacedSymbolData>& Placement::getPlacedSymbolsData() const {
     return data;
 }
 
-const CollisionIndex& Placement::getCollisionIndex() const {
-    return collisionIndex;
+std::unordered_map<uint32_t, std::vector<IndexedSubfeature>> Placement::queryRenderedSymbols(
+    const ScreenLineString& geometry) const {
+    if (!collisionSource) {
+        return collisionIndex.queryRenderedSymbols(geometry);
+    }
+
+    // The symbols were collided in the viewport of the source placement.
+    ScreenLineString sourceGeometry;
+    sourceGeometry.reserve(geometry.size());
+    for (const auto& point : geometry) {
+        sourceGeometry.emplace_back(point.x - collisionOffset.x, point.y - collisionOffset.y);
+    }
+    return (*collisionSource)->collisionIndex.queryRenderedSymbols(sourceGeometry);
 }
     
 const RetainedQueryData& Placement::getQueryData(uint32_t bucketInstanceId) const {
@@ -1220,19 +1436,23 @@ public:
         : Placement(std::move(updateParameters_), nullopt) {}
 
 protected:
+    void placeLayers(const RenderLayerReferences&) override;
     void commit() override;
     float symbolFadeChange(TimePoint) const override { return 1.0f; }
     bool hasTransitions(TimePoint) const override { return false; }
     bool transitionsEnabled() const override { return false; }
 };
 
+void StaticPlacement::placeLayers(const RenderLayerReferences& layers) {
+    projectLineFeatures(layers);
+    Placement::placeLayers(layers);
+}
+
 void StaticPlacement::commit() {
     fadeStartTime = commitTime;
-    for (auto& jointPlacement : placements) {
-        opacities.emplace(
-            jointPlacement.first,
-            JointOpacityState(jointPlacement.second.text, jointPlacement.second.icon, jointPlacement.second.skipFade));
-    }
+    placements.forEach([&](uint32_t crossTileID, const JointPlacement& jointPlacement) {
+        opacities.emplace(crossTileID, jointPlacement.text, jointPlacement.icon, jointPlacement.skipFade);
+    });
 }
 
 /// Placement for Tile map mode.
@@ -1284,6 +1504,7 @@ private:
 };
 
 void TilePlacement::placeLayers(const RenderLayerReferences& layers) {
+    projectLineFeatures(layers);
     placedSymbolsData.clear();
     seenCrossTileIDs.clear();
     intersections.clear();
@@ -1313,7 +1534,7 @@ void TilePlacement::placeLayers(const RenderLayerReferences& layers) {
             return a.symbol.get().anchor.point.x < b.symbol.get().anchor.point.x;
         }
         // Finally, looking at the key hashes.
-        return std::hash<std::u16string>()(a.symbol.get().key) < std::hash<std::u16string>()(b.symbol.get().key);
+        return a.symbol.get().keyHash < b.symbol.get().keyHash;
     });
     // Place intersections.
     for (const auto& intersection : intersections) {
@@ -4,7 +4,9 @@
 #include <mbgl/renderer/renderer.hpp>
 #include <mbgl/style/transition_options.hpp>
 #include <mbgl/text/collision_index.hpp>
+#include <mbgl/text/cross_tile_id_map.hpp>
 #include <mbgl/util/chrono.hpp>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -74,7 +76,7 @@ struct RetainedQueryData {
     
 class CollisionGroups {
 public:
-    using Predicate = std::function<bool(const IndexedSubfeature&)>;
+    using Predicate = CollisionIndex::CollisionGroupPredicate;
     using CollisionGroup = std::pair<uint16_t, optional<Predicate>>;
     
     CollisionGroups(const bool crossSourceCollisions_)
@@ -119,14 +121,45 @@ public:
 
     virtual ~Placement();
     virtual void placeLayers(const RenderLayerReferences&);
+    /**
+     * @brief Time-sliced variant of `placeLayers()` for Continuous map mode.
+     *
+     * Places the buckets of the given layers, resuming where the previous call stopped, until
+     * all of them are placed or `deadline` passes; at least one bucket is placed per call.
+     * Symbols are collided against the transform state this placement was created with, so
+     * the calls may span several frames. Once all layers are placed, the placement is
+     * committed at `now`.
+     *
+     * @return `true` if the placement is complete and committed; `false` otherwise
+     */
+    bool placeLayersUntil(const RenderLayerReferences&, TimePoint now, TimePoint deadline);
+    /**
+     * @brief Makes the next `placeLayersUntil()` call revisit all buckets of the layer
+     * being placed, which is required after the layer's tiles have changed.
+     */
+    void restartCurrentLayer() { nextBucket = 0; }
+    /**
+     * @brief Warm start for Continuous map mode: takes over the symbol placement of the previous
+     * placement instead of colliding the symbols again, and commits it.
+     *
+     * Applies only if the map has been panned by a few pixels at most, without zooming, rotating
+     * or pitching, since the symbols were last collided. The caller is responsible for checking
+     * that the symbol buckets are the same.
+     *
+     * @return `true` if the placement was taken over and committed; `false` if the layers need to be placed
+     */
+    bool warmStart();
     void updateLayerBuckets(const RenderLayer&, const TransformState&, bool updateOpacities) const;
     virtual float symbolFadeChange(TimePoint now) const;
     virtual bool hasTransitions(TimePoint now) const;
     virtual bool transitionsEnabled() const;
     virtual void collectPlacedSymbolData(bool /*enable*/) {}
     virtual const std::vector<PlacedSymbolData>& getPlacedSymbolsData() const;
+    // Whether Static and Tile placements project line labels ahead, see projectLineFeatures().
+    void setParallelLineProjection(bool enable) { parallelLineProjection = enable; }
 
-    const CollisionIndex& getCollisionIndex() const;
+    // Returns the placed symbols intersecting the given viewport geometry, by bucket instance.
+    std::unordered_map<uint32_t, std::vector<IndexedSubfeature>> queryRenderedSymbols(const ScreenLineString&) const;
     TimePoint getCommitTime() const { return commitTime; }
     Duration getUpdatePeriod(float zoom) const;
 
@@ -144,6 +177,10 @@ protected:
     virtual void placeSymbolBucket(const BucketPlacementData&, std::set<uint32_t>& seenCrossTileIDs);
     JointPlacement placeSymbol(const SymbolInstance& symbolInstance, const PlacementContext&);
     void placeLayer(const RenderLayer&, std::set<uint32_t>&);
+    // Projects the collision circles of the line labels in the given layers ahead of
+    // placing them, spread over the background scheduler. Placement results are the
+    // same as when the circles are projected while placing.
+    void projectLineFeatures(const RenderLayerReferences&);
     virtual void commit();
     virtual void newSymbolPlaced(const SymbolInstance&,
                                  const PlacementContext&,
@@ -186,15 +223,27 @@ protected:
     float placementZoom = 0.0f;
     float prevZoomAdjustment = 0.0f;
 
-    std::unordered_map<uint32_t, JointPlacement> placements;
-    std::unordered_map<uint32_t, JointOpacityState> opacities;
-    std::unordered_map<uint32_t, VariableOffset> variableOffsets;
-    std::unordered_map<uint32_t, style::TextWritingModeType> placedOrientations;
+    // Per-symbol state, keyed by crossTileID.
+    CrossTileIDMap<JointPlacement> placements;
+    CrossTileIDMap<JointOpacityState> opacities;
+    CrossTileIDMap<VariableOffset> variableOffsets;
+    CrossTileIDMap<style::TextWritingModeType> placedOrientations;
 
     std::unordered_map<uint32_t, RetainedQueryData> retainedQueryData;
     CollisionGroups collisionGroups;
     mutable optional<Immutable<Placement>> prevPlacement;
     bool showCollisionBoxes = false;
+    bool parallelLineProjection = true;
+
+    // After a warm start, the placement whose collision index holds the symbols, and how far
+    // the map has been panned since, in pixels.
+    optional<Immutable<Placement>> collisionSource;
+    Point<float> collisionOffset;
+
+    // Progress of the time-sliced placement; see placeLayersUntil().
+    std::size_t nextLayer = 0;
+    std::size_t nextBucket = 0;
+    std::set<uint32_t> currentLayerCrossTileIDs;
 
     // Cache being used by placeSymbol()
     std::vector<ProjectedCollisionBox> textBoxes;
@@ -542,8 +542,14 @@ Shaping getShaping(const TaggedString& formattedString,
                    const ImagePositions& imagePositions,
                    float layoutTextSize,
                    float layoutTextSizeAtBucketZoomLevel,
-                   bool allowVerticalPlacement) {
+                   bool allowVerticalPlacement,
+                   const util::CancellationToken& cancellationToken) {
     assert(layoutTextSize);
+    if (cancellationToken.isCancelled()) {
+        // Skips line breaking, BiDi and shaping; an empty shaping is not placed.
+        return Shaping(translate[0], translate[1], writingMode);
+    }
+
     std::vector<TaggedString> reorderedLines;
     if (formattedString.sectionCount() == 1) {
         auto untaggedLines = bidi.processText(
@@ -6,6 +6,7 @@
 #include <mbgl/text/glyph.hpp>
 #include <mbgl/text/glyph_atlas.hpp>
 #include <mbgl/text/tagged_string.hpp>
+#include <mbgl/util/cancellation_token.hpp>
 
 #include <utility>
 
@@ -95,6 +96,7 @@ Shaping getShaping(const TaggedString& string,
                    const ImagePositions& imagePositions,
                    float layoutTextSize,
                    float layoutTextSizeAtBucketZoomLevel,
-                   bool allowVerticalPlacement);
+                   bool allowVerticalPlacement,
+                   const util::CancellationToken& cancellationToken = {});
 
 } // namespace mbgl
@@ -0,0 +1,272 @@
+#include <mbgl/text/shaping_cache.hpp>
+#include <mbgl/util/hash.hpp>
+#include <mbgl/util/logging.hpp>
+
+#include <limits>
+
+namespace mbgl {
+
+namespace {
+
+constexpr uint32_t missingGlyph = std::numeric_limits<uint32_t>::max();
+
+// Number of lookups between two hit rate reports in the debug log.
+constexpr uint64_t statsInterval = 10000;
+
+// Advance used for the given glyph by line breaking and shaping, or `missingGlyph` if neither
+// positions it.
+uint32_t glyphAdvance(char16_t codePoint, FontStackHash fontStackHash, const GlyphMap& glyphMap) {
+    auto glyphs = glyphMap.find(fontStackHash);
+    if (glyphs == glyphMap.end()) {
+        return missingGlyph;
+    }
+    auto it = glyphs->second.find(codePoint);
+    if (it == glyphs->second.end() || !it->second) {
+        return missingGlyph;
+    }
+    return (*it->second)->metrics.advance;
+}
+
+// Points the glyphs of a cached shaping at the atlases of the caller, looking them up the same
+// way shapeLines() does. Returns false if one of them is not available there.
+bool rebindGlyphs(Shaping& shaping,
+                  const GlyphMap& glyphMap,
+                  const GlyphPositions& glyphPositions,
+                  const ImagePositions& imagePositions) {
+    for (auto& line : shaping.positionedLines) {
+        for (auto& positionedGlyph : line.positionedGlyphs) {
+            if (positionedGlyph.imageID) {
+                auto image = imagePositions.find(*positionedGlyph.imageID);
+                if (image == imagePositions.end()) {
+                    return false;
+                }
+                positionedGlyph.rect = image->second.paddedRect;
+                continue;
+            }
+
+            auto glyphPositionMap = glyphPositions.find(positionedGlyph.font);
+            if (glyphPositionMap == glyphPositions.end()) {
+                return false;
+            }
+            auto glyphPosition = glyphPositionMap->second.find(positionedGlyph.glyph);
+            if (glyphPosition != glyphPositionMap->second.end()) {
+                positionedGlyph.rect = glyphPosition->second.rect;
+                positionedGlyph.metrics = glyphPosition->second.metrics;
+                continue;
+            }
+
+            auto glyphs = glyphMap.find(positionedGlyph.font);
+            if (glyphs == glyphMap.end()) {
+                return false;
+            }
+            auto glyph = glyphs->second.find(positionedGlyph.glyph);
+            if (glyph == glyphs->second.end() || !glyph->second) {
+                return false;
+            }
+            positionedGlyph.rect = {};
+            positionedGlyph.metrics = (*glyph->second)->metrics;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool ShapingCache::SectionKey::operator==(const SectionKey& rhs) const {
+    return scale == rhs.scale && fontStackHash == rhs.fontStackHash && imageID == rhs.imageID &&
+           imageSize == rhs.imageSize;
+}
+
+bool ShapingCache::Key::operator==(const Key& rhs) const {
+    return hash == rhs.hash && maxWidth == rhs.maxWidth && lineHeight == rhs.lineHeight && spacing == rhs.spacing &&
+           translate == rhs.translate && layoutTextSize == rhs.layoutTextSize &&
+           layoutTextSizeAtBucketZoomLevel == rhs.layoutTextSizeAtBucketZoomLevel && textAnchor == rhs.textAnchor &&
+           textJustify == rhs.textJustify && writingMode == rhs.writingMode &&
+           allowVerticalPlacement == rhs.allowVerticalPlacement && text == rhs.text && sections == rhs.sections &&
+           advances == rhs.advances;
+}
+
+ShapingCache::ShapingCache(std::size_t capacity_) : capacity(capacity_) {}
+
+ShapingCache& ShapingCache::getShared() {
+    static ShapingCache cache(8192);
+    return cache;
+}
+
+Shaping ShapingCache::getShaping(const TaggedString& formattedString,
+                                 const float maxWidth,
+                                 const float lineHeight,
+                                 const style::SymbolAnchorType textAnchor,
+                                 const style::TextJustifyType textJustify,
+                                 const float spacing,
+                                 const std::array<float, 2>& translate,
+                                 const WritingModeType writingMode,
+                                 BiDi& bidi,
+                                 const GlyphMap& glyphMap,
+                                 const GlyphPositions& glyphPositions,
+                                 const ImagePositions& imagePositions,
+                                 const float layoutTextSize,
+                                 const float layoutTextSizeAtBucketZoomLevel,
+                                 const bool allowVerticalPlacement,
+                                 const util::CancellationToken& cancellationToken) {
+    const auto shape = [&] {
+        return mbgl::getShaping(formattedString,
+                                maxWidth,
+                                lineHeight,
+                                textAnchor,
+                                textJustify,
+                                spacing,
+                                translate,
+                                writingMode,
+                                bidi,
+                                glyphMap,
+                                glyphPositions,
+                                imagePositions,
+                                layoutTextSize,
+                                layoutTextSizeAtBucketZoomLevel,
+                                allowVerticalPlacement,
+                                cancellationToken);
+    };
+
+    if (!capacity || cancellationToken.isCancelled()) {
+        return shape();
+    }
+
+    Key key{formattedString.getStyledText(),
+            {},
+            {},
+            maxWidth,
+            lineHeight,
+            spacing,
+            translate,
+            layoutTextSize,
+            layoutTextSizeAtBucketZoomLevel,
+            textAnchor,
+            textJustify,
+            writingMode,
+            allowVerticalPlacement,
+            0};
+
+    std::size_t hash = util::hash(formattedString.rawText(),
+                                  maxWidth,
+                                  lineHeight,
+                                  spacing,
+                                  translate[0],
+                                  translate[1],
+                                  layoutTextSize,
+                                  layoutTextSizeAtBucketZoomLevel,
+                                  static_cast<uint8_t>(textAnchor),
+                                  static_cast<uint8_t>(textJustify),
+                                  static_cast<uint8_t>(writingMode),
+                                  allowVerticalPlacement);
+
+    key.sections.reserve(formattedString.sectionCount());
+    for (const SectionOptions& section : formattedString.getSections()) {
+        optional<std::array<float, 2>> imageSize;
+        if (section.imageID) {
+            auto image = imagePositions.find(*section.imageID);
+            if (image != imagePositions.end()) {
+                imageSize = image->second.displaySize();
+            }
+        }
+        util::hash_combine(hash, section.scale);
+        util::hash_combine(hash, section.fontStackHash);
+        key.sections.push_back({section.scale, section.fontStackHash, section.imageID, imageSize});
+    }
+
+    key.advances.reserve(formattedString.length());
+    for (std::size_t i = 0; i < formattedString.length(); ++i) {
+        const uint8_t sectionIndex = formattedString.getSectionIndex(i);
+        const SectionOptions& section = formattedString.sectionAt(sectionIndex);
+        const uint32_t advance =
+            section.imageID ? 0 : glyphAdvance(formattedString.getCharCodeAt(i), section.fontStackHash, glyphMap);
+        util::hash_combine(hash, sectionIndex);
+        util::hash_combine(hash, advance);
+        key.advances.push_back(advance);
+    }
+    key.hash = hash;
+
+    if (auto cached = find(key)) {
+        Shaping shaping = *cached;
+        if (rebindGlyphs(shaping, glyphMap, glyphPositions, imagePositions)) {
+            uint64_t hits_, misses_;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                hits_ = ++hits;
+                misses_ = misses;
+            }
+            logStats(hits_, misses_);
+            return shaping;
+        }
+    }
+
+    Shaping shaping = shape();
+    if (cancellationToken.isCancelled()) {
+        // The shaping may have been cut short.
+        return shaping;
+    }
+    insert(std::move(key), std::make_shared<const Shaping>(shaping));
+    return shaping;
+}
+
+std::shared_ptr<const Shaping> ShapingCache::find(const Key& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        return nullptr;
+    }
+    recency.splice(recency.begin(), recency, it->second.recency);
+    return it->second.shaping;
+}
+
+void ShapingCache::insert(Key key, std::shared_ptr<const Shaping> shaping) {
+    uint64_t hits_, misses_;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        hits_ = hits;
+        misses_ = ++misses;
+
+        auto it = entries.find(key);
+        if (it != entries.end()) {
+            // Another thread shaped the same text in the meantime, or the cached shaping did not
+            // fit the atlases of the caller.
+            it->second.shaping = std::move(shaping);
+            recency.splice(recency.begin(), recency, it->second.recency);
+        } else {
+            it = entries.emplace(std::move(key), Entry{std::move(shaping), recency.end()}).first;
+            recency.push_front(&it->first);
+            it->second.recency = recency.begin();
+        }
+
+        while (entries.size() > capacity) {
+            entries.erase(*recency.back());
+            recency.pop_back();
+        }
+    }
+    logStats(hits_, misses_);
+}
+
+void ShapingCache::logStats(uint64_t hits_, uint64_t misses_) const {
+    const uint64_t lookups = hits_ + misses_;
+    if (lookups % statsInterval == 0) {
+        Log::Debug(Event::General,
+                   "ShapingCache: %llu lookups, %.1f%% hits",
+                   static_cast<unsigned long long>(lookups),
+                   100.0 * hits_ / lookups);
+    }
+}
+
+ShapingCache::Stats ShapingCache::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return {hits, misses, entries.size()};
+}
+
+void ShapingCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    recency.clear();
+    hits = 0;
+    misses = 0;
+}
+
+} // namespace mbgl
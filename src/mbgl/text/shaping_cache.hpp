@@ -0,0 +1,110 @@
+#pragma once
+
+#include <mbgl/text/shaping.hpp>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+
+// Bounded, thread-safe cache of text shapings, so that a label which appears in many tiles and at
+// many zoom levels, such as a street name, goes through BiDi processing and line breaking once.
+//
+// Entries are keyed by the text and its sections, the shaping parameters and the advance of every
+// glyph and the size of every image the text uses, which together determine the layout exactly.
+// Cached shapings are immutable; a hit returns a copy whose atlas rects are taken from the glyph
+// and image positions of the caller, since each tile packs its own atlases.
+class ShapingCache {
+public:
+    explicit ShapingCache(std::size_t capacity);
+
+    // The cache shared by the symbol layouts of all GeometryTileWorkers.
+    static ShapingCache& getShared();
+
+    // Same contract as mbgl::getShaping().
+    Shaping getShaping(const TaggedString& string,
+                       float maxWidth,
+                       float lineHeight,
+                       style::SymbolAnchorType textAnchor,
+                       style::TextJustifyType textJustify,
+                       float spacing,
+                       const std::array<float, 2>& translate,
+                       WritingModeType,
+                       BiDi& bidi,
+                       const GlyphMap& glyphMap,
+                       const GlyphPositions& glyphPositions,
+                       const ImagePositions& imagePositions,
+                       float layoutTextSize,
+                       float layoutTextSizeAtBucketZoomLevel,
+                       bool allowVerticalPlacement,
+                       const util::CancellationToken& cancellationToken = {});
+
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        std::size_t size;
+    };
+    Stats getStats() const;
+
+    void clear();
+
+private:
+    struct SectionKey {
+        double scale;
+        FontStackHash fontStackHash;
+        optional<std::string> imageID;
+        // Display size of the image, if the section is an image and it is available.
+        optional<std::array<float, 2>> imageSize;
+
+        bool operator==(const SectionKey&) const;
+    };
+
+    struct Key {
+        StyledText text;
+        std::vector<SectionKey> sections;
+        // Advance of each glyph of the text, or `missingGlyph`; zero for image characters.
+        std::vector<uint32_t> advances;
+        float maxWidth;
+        float lineHeight;
+        float spacing;
+        std::array<float, 2> translate;
+        float layoutTextSize;
+        float layoutTextSizeAtBucketZoomLevel;
+        style::SymbolAnchorType textAnchor;
+        style::TextJustifyType textJustify;
+        WritingModeType writingMode;
+        bool allowVerticalPlacement;
+        std::size_t hash;
+
+        bool operator==(const Key&) const;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const { return key.hash; }
+    };
+
+    struct Entry {
+        std::shared_ptr<const Shaping> shaping;
+        std::list<const Key*>::iterator recency;
+    };
+
+    std::shared_ptr<const Shaping> find(const Key&);
+    void insert(Key, std::shared_ptr<const Shaping>);
+    void logStats(uint64_t hits, uint64_t misses) const;
+
+    const std::size_t capacity;
+
+    mutable std::mutex mutex;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    // Keys of `entries`, most recently used first.
+    std::list<const Key*> recency;
+
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+} // namespace mbgl
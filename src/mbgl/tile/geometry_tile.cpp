@@ -22,6 +22,7 @@
 #include <mbgl/util/logging.hpp>
 
 #include <mbgl/gfx/upload_pass.hpp>
+#include <unordered_set>
 #include <utility>
 
 namespace mbgl {
@@ -110,7 +111,8 @@ void GeometryTileRenderData::upload(gfx::UploadPass& uploadPass) {
 }
 
 void GeometryTileRenderData::prepare(const SourcePrepareParameters& parameters) {
-    if (!layoutResult) return;
+    // The shared image atlas is updated by the ImageManager itself.
+    if (!layoutResult || layoutResult->imageAtlasReference) return;
     imagePatches = layoutResult->iconAtlas.getImagePatchesAndUpdateVersions(parameters.imageManager);
 }
 
@@ -154,9 +156,12 @@ GeometryTile::GeometryTile(const OverscaledTileID& id_,
              obsolete,
              parameters.mode,
              parameters.pixelRatio,
-             parameters.debugOptions & MapDebugOptions::Collision),
+             parameters.debugOptions & MapDebugOptions::Collision,
+             parameters.glyphAtlas,
+             parameters.imageManager.getSharedAtlas()),
       fileSource(parameters.fileSource),
       glyphManager(parameters.glyphManager),
+      glyphAtlas(parameters.glyphAtlas),
       imageManager(parameters.imageManager),
       mode(parameters.mode),
       showCollisionBoxes(parameters.debugOptions & MapDebugOptions::Collision) {
@@ -167,12 +172,20 @@ GeometryTile::~GeometryTile() {
     markObsolete();
 }
 
+void GeometryTile::setPriority(TaskPriority priority) {
+    worker.setPriority(priority);
+}
+
+std::size_t GeometryTile::getMemoryUsage() const {
+    return memoryUsage;
+}
+
 void GeometryTile::cancel() {
     markObsolete();
 }
 
 void GeometryTile::markObsolete() {
-    obsolete = true;
+    *obsolete = true;
 }
 
 void GeometryTile::setError(std::exception_ptr err) {
@@ -246,9 +259,37 @@ void GeometryTile::onLayout(std::shared_ptr<LayoutResult> result, const uint64_t
     }
 
     layoutResult = std::move(result);
+    memoryUsage = 0;
+    std::unordered_set<const Bucket*> buckets;
+    for (const auto& pair : layoutResult->layerRenderData) {
+        // Layers sharing a layout also share their bucket.
+        if (pair.second.bucket && buckets.insert(pair.second.bucket.get()).second) {
+            memoryUsage += pair.second.bucket->getMemoryUsage();
+        }
+    }
+    if (layoutResult->featureIndex) {
+        memoryUsage += layoutResult->featureIndex->getMemoryUsage();
+    }
+    if (layoutResult->glyphAtlasImage) {
+        memoryUsage += layoutResult->glyphAtlasImage->bytes();
+    }
+    memoryUsage += layoutResult->iconAtlas.image.bytes();
+
     if (!atlasTextures) {
     	atlasTextures = std::make_shared<TileAtlasTextures>();
     }
+    if (layoutResult->glyphAtlasReference) {
+        atlasTextures->glyph = nullopt;
+        atlasTextures->sharedGlyph = &glyphAtlas;
+    } else {
+        atlasTextures->sharedGlyph = nullptr;
+    }
+    if (layoutResult->imageAtlasReference) {
+        atlasTextures->icon = nullopt;
+        atlasTextures->sharedIcon = &imageManager.getSharedAtlas();
+    } else {
+        atlasTextures->sharedIcon = nullptr;
+    }
     
     observer->onTileChanged(*this);
 }
@@ -4,6 +4,7 @@
 #include <mbgl/geometry/feature_index.hpp>
 #include <mbgl/gfx/texture.hpp>
 #include <mbgl/renderer/image_manager.hpp>
+#include <mbgl/text/glyph_atlas.hpp>
 #include <mbgl/text/glyph_manager.hpp>
 #include <mbgl/tile/tile.hpp>
 #include <mbgl/tile/geometry_tile_worker.hpp>
@@ -21,7 +22,6 @@ class GeometryTileData;
 class RenderLayer;
 class SourceQueryOptions;
 class TileParameters;
-class GlyphAtlas;
 class ImageAtlas;
 class TileAtlasTextures;
 
@@ -42,6 +42,8 @@ public:
     std::unique_ptr<TileRenderData> createRenderData() override;
     void setLayers(const std::vector<Immutable<style::LayerProperties>>&) override;
     void setShowCollisionBoxes(bool showCollisionBoxes) override;
+    void setPriority(TaskPriority) override;
+    std::size_t getMemoryUsage() const override;
 
     void onGlyphsAvailable(GlyphMap) override;
     void onImagesAvailable(ImageMap, ImageMap, ImageVersionMap versionMap, uint64_t imageCorrelationID) override;
@@ -69,19 +71,28 @@ public:
     public:
         std::unordered_map<std::string, LayerRenderData> layerRenderData;
         std::shared_ptr<FeatureIndex> featureIndex;
+        // Set if the glyphs of the layout are not in the shared glyph atlas.
         optional<AlphaImage> glyphAtlasImage;
+        std::shared_ptr<const SharedGlyphAtlas::Reference> glyphAtlasReference;
+        // Set if the images of the layout are in the shared image atlas; `iconAtlas` then has
+        // no image of its own.
         ImageAtlas iconAtlas;
+        std::shared_ptr<const SharedImageAtlas::Reference> imageAtlasReference;
 
         LayerRenderData* getLayerRenderData(const style::Layer::Impl&);
 
         LayoutResult(std::unordered_map<std::string, LayerRenderData> renderData_,
                      std::unique_ptr<FeatureIndex> featureIndex_,
                      optional<AlphaImage> glyphAtlasImage_,
-                     ImageAtlas iconAtlas_)
+                     std::shared_ptr<const SharedGlyphAtlas::Reference> glyphAtlasReference_,
+                     ImageAtlas iconAtlas_,
+                     std::shared_ptr<const SharedImageAtlas::Reference> imageAtlasReference_)
             : layerRenderData(std::move(renderData_)),
               featureIndex(std::move(featureIndex_)),
               glyphAtlasImage(std::move(glyphAtlasImage_)),
-              iconAtlas(std::move(iconAtlas_)) {}
+              glyphAtlasReference(std::move(glyphAtlasReference_)),
+              iconAtlas(std::move(iconAtlas_)),
+              imageAtlasReference(std::move(imageAtlasReference_)) {}
     };
     void onLayout(std::shared_ptr<LayoutResult>, uint64_t correlationID);
 
@@ -105,18 +116,21 @@ private:
     void markObsolete();
 
     // Used to signal the worker that it should abandon parsing this tile as soon as possible.
-    std::atomic<bool> obsolete { false };
+    const std::shared_ptr<std::atomic<bool>> obsolete = std::make_shared<std::atomic<bool>>(false);
 
     std::shared_ptr<Mailbox> mailbox;
     Actor<GeometryTileWorker> worker;
 
     std::shared_ptr<FileSource> fileSource;
     GlyphManager& glyphManager;
+    SharedGlyphAtlas& glyphAtlas;
     ImageManager& imageManager;
 
     uint64_t correlationID = 0;
 
     std::shared_ptr<LayoutResult> layoutResult;
+    // Sampled when a layout result arrives, before its buckets are uploaded.
+    std::size_t memoryUsage = 0;
     std::shared_ptr<TileAtlasTextures> atlasTextures;
 
     const MapMode mode;
@@ -6,9 +6,11 @@
 #include <mbgl/layout/symbol_layout.hpp>
 #include <mbgl/layout/pattern_layout.hpp>
 #include <mbgl/renderer/bucket_parameters.hpp>
+#include <mbgl/renderer/image_atlas.hpp>
 #include <mbgl/renderer/group_by_layout.hpp>
 #include <mbgl/style/filter.hpp>
 #include <mbgl/style/layers/symbol_layer_impl.hpp>
+#include <mbgl/text/glyph_atlas.hpp>
 #include <mbgl/renderer/layers/render_fill_layer.hpp>
 #include <mbgl/renderer/layers/render_fill_extrusion_layer.hpp>
 #include <mbgl/renderer/layers/render_line_layer.hpp>
@@ -31,21 +33,45 @@ GeometryTileWorker::GeometryTileWorker(ActorRef<GeometryTileWorker> self_,
                                        ActorRef<GeometryTile> parent_,
                                        OverscaledTileID id_,
                                        std::string sourceID_,
-                                       const std::atomic<bool>& obsolete_,
+                                       std::shared_ptr<const std::atomic<bool>> obsolete_,
                                        const MapMode mode_,
                                        const float pixelRatio_,
-                                       const bool showCollisionBoxes_)
+                                       const bool showCollisionBoxes_,
+                                       SharedGlyphAtlas& glyphAtlas_,
+                                       SharedImageAtlas& imageAtlas_)
     : self(std::move(self_)),
       parent(std::move(parent_)),
       id(id_),
       sourceID(std::move(sourceID_)),
       obsolete(obsolete_),
+      cancellationToken(obsolete_),
       mode(mode_),
       pixelRatio(pixelRatio_),
+      glyphAtlas(glyphAtlas_),
+      imageAtlas(imageAtlas_),
       showCollisionBoxes(showCollisionBoxes_) {}
 
 GeometryTileWorker::~GeometryTileWorker() = default;
 
+namespace {
+
+std::atomic<uint64_t> discardedLayoutCount{0};
+std::atomic<Duration::rep> wastedLayoutTime{0};
+
+} // namespace
+
+// static
+GeometryTileWorker::ObsoleteWorkStats GeometryTileWorker::getObsoleteWorkStats() {
+    return {discardedLayoutCount.load(), Duration(wastedLayoutTime.load())};
+}
+
+void GeometryTileWorker::discardObsoleteWork(TimePoint start) {
+    workTime += Clock::now() - start;
+    ++discardedLayoutCount;
+    wastedLayoutTime += workTime.count();
+    workTime = Duration::zero();
+}
+
 /*
    GeometryTileWorker is a state machine. This is its transition diagram.
    States are indicated by [state], lines are transitions triggered by
@@ -339,9 +365,16 @@ void GeometryTileWorker::parse() {
     }
 
     MBGL_TIMING_START(watch)
+    const TimePoint start = Clock::now();
+    workTime = Duration::zero();
 
     std::unordered_map<std::string, std::unique_ptr<SymbolLayout>> symbolLayoutMap;
 
+    // Holds one layer per source layer until the end of the parse. Tile data keeps decoded features
+    // only while a layer refers to them, so this lets the style layers that read the same source
+    // layer share them, and frees them once the parse and the layouts it created are done.
+    std::unordered_map<std::string, std::unique_ptr<GeometryTileLayer>> sourceLayers;
+
     renderData.clear();
     layouts.clear();
 
@@ -358,7 +391,8 @@ void GeometryTileWorker::parse() {
 
     for (auto& pair : groupMap) {
         const auto& group = pair.second;
-        if (obsolete) {
+        if (*obsolete) {
+            discardObsoleteWork(start);
             return;
         }
 
@@ -367,12 +401,15 @@ void GeometryTileWorker::parse() {
         }
 
         const style::Layer::Impl& leaderImpl = *(group.at(0)->baseImpl);
-        BucketParameters parameters { id, mode, pixelRatio, leaderImpl.getTypeInfo() };
+        BucketParameters parameters { id, mode, pixelRatio, leaderImpl.getTypeInfo(), cancellationToken };
 
         auto geometryLayer = (*data)->getLayer(leaderImpl.sourceLayer);
         if (!geometryLayer) {
             continue;
         }
+        if (!sourceLayers.count(leaderImpl.sourceLayer)) {
+            sourceLayers.emplace(leaderImpl.sourceLayer, (*data)->getLayer(leaderImpl.sourceLayer));
+        }
 
         std::vector<std::string> layerIDs(group.size());
         for (const auto& layer : group) {
@@ -397,8 +434,9 @@ void GeometryTileWorker::parse() {
             const Filter& filter = leaderImpl.filter;
             const std::string& sourceLayerID = leaderImpl.sourceLayer;
             std::shared_ptr<Bucket> bucket = LayerManager::get()->createBucket(parameters, group);
+            bucket->setCancellationToken(cancellationToken);
 
-            for (std::size_t i = 0; !obsolete && i < geometryLayer->featureCount(); i++) {
+            for (std::size_t i = 0; !*obsolete && i < geometryLayer->featureCount(); i++) {
                 std::unique_ptr<GeometryTileFeature> feature = geometryLayer->getFeature(i);
 
                 if (!filter(expression::EvaluationContext(static_cast<float>(this->id.overscaledZ), feature.get())
@@ -428,6 +466,7 @@ void GeometryTileWorker::parse() {
                        " SourceID: " << sourceID.c_str() <<
                        " Canonical: " << static_cast<int>(id.canonical.z) << "/" << id.canonical.x << "/" << id.canonical.y <<
                        " Time");
+    workTime += Clock::now() - start;
     finalizeLayout();
 }
 
@@ -450,18 +489,37 @@ void GeometryTileWorker::finalizeLayout() {
     }
     
     MBGL_TIMING_START(watch)
+    const TimePoint start = Clock::now();
     optional<AlphaImage> glyphAtlasImage;
-    ImageAtlas iconAtlas = makeImageAtlas(imageMap, patternMap, versionMap);
+    std::shared_ptr<const SharedGlyphAtlas::Reference> glyphAtlasReference;
+    // Fall back to an atlas of our own if the images don't fit in the shared one.
+    ImageAtlas iconAtlas;
+    std::shared_ptr<const SharedImageAtlas::Reference> imageAtlasReference =
+        imageAtlas.addImages(imageMap, patternMap, versionMap);
+    if (imageAtlasReference) {
+        iconAtlas.iconPositions = imageAtlasReference->getIconPositions();
+        iconAtlas.patternPositions = imageAtlasReference->getPatternPositions();
+    } else {
+        iconAtlas = makeImageAtlas(imageMap, patternMap, versionMap);
+    }
     if (!layouts.empty()) {
-        GlyphAtlas glyphAtlas = makeGlyphAtlas(glyphMap);
-        glyphAtlasImage = std::move(glyphAtlas.image);
+        // Fall back to an atlas of our own if the glyphs don't fit in the shared one.
+        GlyphAtlas tileGlyphAtlas;
+        glyphAtlasReference = glyphAtlas.addGlyphs(glyphMap);
+        if (!glyphAtlasReference) {
+            tileGlyphAtlas = makeGlyphAtlas(glyphMap);
+            glyphAtlasImage = std::move(tileGlyphAtlas.image);
+        }
+        const GlyphPositions& glyphPositions =
+            glyphAtlasReference ? glyphAtlasReference->getPositions() : tileGlyphAtlas.positions;
 
         for (auto& layout : layouts) {
-            if (obsolete) {
+            if (*obsolete) {
+                discardObsoleteWork(start);
                 return;
             }
 
-            layout->prepareSymbols(glyphMap, glyphAtlas.positions, imageMap, iconAtlas.iconPositions);
+            layout->prepareSymbols(glyphMap, glyphPositions, imageMap, iconAtlas.iconPositions);
 
             if (!layout->hasSymbolInstances()) {
                 continue;
@@ -475,7 +533,14 @@ void GeometryTileWorker::finalizeLayout() {
 
     layouts.clear();
 
+    if (*obsolete) {
+        // The parent tile is going away and would drop the result anyway.
+        discardObsoleteWork(start);
+        return;
+    }
+
     firstLoad = false;
+    workTime = Duration::zero();
     
     MBGL_TIMING_FINISH(watch,
                        " Action: " << "SymbolLayout," <<
@@ -487,7 +552,9 @@ void GeometryTileWorker::finalizeLayout() {
         std::move(renderData),
         std::move(featureIndex),
         std::move(glyphAtlasImage),
-        std::move(iconAtlas)
+        std::move(glyphAtlasReference),
+        std::move(iconAtlas),
+        std::move(imageAtlasReference)
     ), correlationID);
 }
 
@@ -12,6 +12,8 @@
 #include <mbgl/renderer/bucket.hpp>
 #include <mbgl/renderer/render_layer.hpp>
 #include <mbgl/tile/tile.hpp>
+#include <mbgl/util/cancellation_token.hpp>
+#include <mbgl/util/chrono.hpp>
 
 #include <atomic>
 #include <memory>
@@ -21,6 +23,8 @@ namespace mbgl {
 class GeometryTile;
 class GeometryTileData;
 class Layout;
+class SharedGlyphAtlas;
+class SharedImageAtlas;
 
 namespace style {
 class Layer;
@@ -32,10 +36,12 @@ public:
                        ActorRef<GeometryTile> parent,
                        OverscaledTileID,
                        std::string,
-                       const std::atomic<bool>&,
+                       std::shared_ptr<const std::atomic<bool>>,
                        MapMode,
                        float pixelRatio,
-                       bool showCollisionBoxes_);
+                       bool showCollisionBoxes_,
+                       SharedGlyphAtlas&,
+                       SharedImageAtlas&);
     ~GeometryTileWorker();
 
     void setLayers(std::vector<Immutable<style::LayerProperties>>,
@@ -53,6 +59,14 @@ public:
                            ImageVersionMap versionMap,
                            uint64_t imageCorrelationID);
 
+    // Process-wide totals of the layout work thrown away because the tile
+    // became obsolete before the result could be delivered.
+    struct ObsoleteWorkStats {
+        uint64_t discardedLayouts;
+        Duration wastedTime;
+    };
+    static ObsoleteWorkStats getObsoleteWorkStats();
+
 private:
     void coalesced();
     void parse();
@@ -69,14 +83,20 @@ private:
 
     void checkPatternLayout(std::unique_ptr<Layout> layout);
 
+    // Accounts the work done since `start`, and for the current layout so far, as wasted.
+    void discardObsoleteWork(TimePoint start);
+
     ActorRef<GeometryTileWorker> self;
     ActorRef<GeometryTile> parent;
 
     const OverscaledTileID id;
     const std::string sourceID;
-    const std::atomic<bool>& obsolete;
+    const std::shared_ptr<const std::atomic<bool>> obsolete;
+    const util::CancellationToken cancellationToken;
     const MapMode mode;
     const float pixelRatio;
+    SharedGlyphAtlas& glyphAtlas;
+    SharedImageAtlas& imageAtlas;
     
     std::unique_ptr<FeatureIndex> featureIndex;
     std::unordered_map<std::string, LayerRenderData> renderData;
@@ -108,6 +128,9 @@ private:
 
     bool showCollisionBoxes;
     bool firstLoad = true;
+
+    // Time spent on the layout in progress, across parse() and finalizeLayout().
+    Duration workTime = Duration::zero();
 };
 
 } // namespace mbgl
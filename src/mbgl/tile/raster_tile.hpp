@@ -24,6 +24,8 @@ public:
 
     std::unique_ptr<TileRenderData> createRenderData() override;
     void setNecessity(TileNecessity) override;
+    void setPriority(TaskPriority) override;
+    std::size_t getMemoryUsage() const override;
     void setUpdateParameters(const TileUpdateParameters&) override;
 
     void setError(std::exception_ptr);
@@ -29,6 +29,7 @@ class RenderedQueryOptions;
 class SourceQueryOptions;
 class CollisionIndex;
 class SourceFeatureState;
+enum class TaskPriority : uint8_t;
 
 namespace gfx {
 class UploadPass;
@@ -46,6 +47,14 @@ inline bool operator==(const TileUpdateParameters& a, const TileUpdateParameters
 inline bool operator!=(const TileUpdateParameters& a, const TileUpdateParameters& b) {
     return !(a == b);
 }
+
+// How expensive it is to get a tile back once it has been evicted from the tile cache.
+enum class TileReloadCost : uint8_t {
+    Memory,  // Regenerated from source data held in memory, e.g. GeoJSON
+    Disk,    // Loaded from the ambient cache or an offline database
+    Network  // Fetched from the network
+};
+
 class Tile {
 public:
     enum class Kind : uint8_t {
@@ -65,8 +74,14 @@ public:
 
     virtual void setNecessity(TileNecessity) {}
 
+    // Sets the priority of this tile's background work (parsing, layout, decoding).
+    virtual void setPriority(TaskPriority) {}
+
     virtual void setUpdateParameters(const TileUpdateParameters&) {}
 
+    // Approximate memory held by this tile's render data (buckets, feature index, atlases), in bytes.
+    virtual std::size_t getMemoryUsage() const { return 0; }
+
     // Mark this tile as no longer needed and cancel any pending work.
     virtual void cancel();
 
@@ -96,6 +111,9 @@ public:
 
     void setTriedCache();
 
+    void setReloadCost(TileReloadCost cost) { reloadCost = cost; }
+    TileReloadCost getReloadCost() const { return reloadCost; }
+
     // Returns true when the tile source has received a first response, regardless of whether a load
     // error occurred or actual data was loaded.
     bool hasTriedCache() const {
@@ -156,7 +174,7 @@ protected:
     bool renderable = false;
     bool pending = false;
     bool loaded = false;
-
+    TileReloadCost reloadCost = TileReloadCost::Memory;
 
     TileObserver* observer = nullptr;
 };
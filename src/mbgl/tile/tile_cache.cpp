@@ -1,73 +1,163 @@
 #include <mbgl/tile/tile_cache.hpp>
+#include <mbgl/renderer/renderer.hpp>
+#include <mbgl/util/hash.hpp>
+
+#include <algorithm>
 #include <cassert>
 
 namespace mbgl {
 
-void TileCache::setSize(size_t size_) {
-    size = size_;
+namespace {
+
+// Relative cost of bringing a tile back once it has been evicted. Every tile has to be parsed
+// and laid out again; disk and network loads add their latency on top.
+double reloadCost(const Tile& tile) {
+    switch (tile.getReloadCost()) {
+        case TileReloadCost::Memory:
+            return 1;
+        case TileReloadCost::Disk:
+            return 4;
+        case TileReloadCost::Network:
+            return 16;
+    }
+    return 1;
+}
+
+} // namespace
+
+std::size_t TileCache::KeyHash::operator()(const Key& key) const {
+    return util::hash(key.first, key.second);
+}
+
+TileCache::TileCache(size_t size_) {
+    setSize(size_);
+}
+
+TileCache::~TileCache() = default;
 
-    while (orderedKeys.size() > size) {
-        auto key = orderedKeys.front();
-        orderedKeys.remove(key);
-        tiles.erase(key);
+void TileCache::setSize(size_t size_, Owner owner) {
+    auto it = sizes.find(owner);
+    if (it != sizes.end()) {
+        size -= it->second;
+        sizes.erase(it);
+    }
+    if (size_) {
+        sizes.emplace(owner, size_);
+        size += size_;
     }
 
-    assert(orderedKeys.size() <= size);
+    evict();
+}
+
+void TileCache::setMemoryBudget(size_t memoryBudget_) {
+    memoryBudget = memoryBudget_;
+
+    evict();
 }
 
-void TileCache::add(const OverscaledTileID& key, std::unique_ptr<Tile> tile) {
-    if (!tile->isRenderable() || !size) {
+void TileCache::add(const OverscaledTileID& key, std::unique_ptr<Tile> tile, Owner owner) {
+    if (!tile->isRenderable() || (!memoryBudget && !size)) {
         return;
     }
 
     // insert new or query existing tile
-    if (!tiles.emplace(key, std::move(tile)).second) {
-        // remove existing tile key
-        orderedKeys.remove(key);
+    auto result = entries.emplace(Key{owner, key}, Entry{nullptr, 0, ranks.end()});
+    if (result.second) {
+        Entry& entry = result.first->second;
+        entry.bytes = tile->getMemoryUsage();
+        entry.tile = std::move(tile);
+        memoryUsage += entry.bytes;
     }
 
-    // (re-)insert tile key as newest
-    orderedKeys.push_back(key);
-
-    // purge oldest key/tile if necessary
-    if (orderedKeys.size() > size) {
-        pop(orderedKeys.front());
-    }
+    // (re-)rank the tile as most recently used
+    touch(result.first);
 
-    assert(orderedKeys.size() <= size);
+    // purge tiles if necessary
+    evict();
 }
 
-Tile* TileCache::get(const OverscaledTileID& key) {
-    auto it = tiles.find(key);
-    if (it != tiles.end()) {
-        return it->second.get();
+Tile* TileCache::get(const OverscaledTileID& key, Owner owner) {
+    auto it = entries.find(Key{owner, key});
+    if (it != entries.end()) {
+        return it->second.tile.get();
     } else {
         return nullptr;
     }
 }
 
-std::unique_ptr<Tile> TileCache::pop(const OverscaledTileID& key) {
+std::unique_ptr<Tile> TileCache::pop(const OverscaledTileID& key, Owner owner) {
 
     std::unique_ptr<Tile> tile;
 
-    auto it = tiles.find(key);
-    if (it != tiles.end()) {
-        tile = std::move(it->second);
-        tiles.erase(it);
-        orderedKeys.remove(key);
+    auto it = entries.find(Key{owner, key});
+    if (it != entries.end()) {
+        tile = std::move(it->second.tile);
+        erase(it);
         assert(tile->isRenderable());
+        hits++;
+    } else {
+        misses++;
     }
 
     return tile;
 }
 
-bool TileCache::has(const OverscaledTileID& key) {
-    return tiles.find(key) != tiles.end();
+bool TileCache::has(const OverscaledTileID& key, Owner owner) {
+    return entries.find(Key{owner, key}) != entries.end();
 }
 
 void TileCache::clear() {
-    orderedKeys.clear();
-    tiles.clear();
+    entries.clear();
+    ranks.clear();
+    memoryUsage = 0;
+}
+
+void TileCache::clear(Owner owner) {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->first.first == owner) {
+            erase(it++);
+        } else {
+            ++it;
+        }
+    }
+}
+
+TileCacheStats TileCache::getStats() const {
+    return {entries.size(), memoryUsage, memoryBudget, size, hits, misses, evictions};
+}
+
+void TileCache::touch(Entries::iterator it) {
+    Entry& entry = it->second;
+    if (entry.rank != ranks.end()) {
+        ranks.erase(entry.rank);
+    }
+
+    // Normalized to cost per KiB; tiny tiles are treated as 1 KiB so that they don't rank
+    // above everything else.
+    const double priority =
+        inflation + reloadCost(*entry.tile) * 1024.0 / std::max<size_t>(entry.bytes, 1024);
+    entry.rank = ranks.emplace(Rank{priority, sequence++}, it->first).first;
+}
+
+void TileCache::evict() {
+    // The count limit also applies with a budget, so that tiles reporting almost no memory
+    // cannot grow the cache without bound.
+    while (entries.size() > size || (memoryBudget && memoryUsage > memoryBudget)) {
+        assert(!ranks.empty());
+        auto rank = ranks.begin();
+        inflation = rank->first.first;
+        erase(entries.find(rank->second));
+        evictions++;
+    }
+}
+
+void TileCache::erase(Entries::iterator it) {
+    assert(memoryUsage >= it->second.bytes);
+    memoryUsage -= it->second.bytes;
+    if (it->second.rank != ranks.end()) {
+        ranks.erase(it->second.rank);
+    }
+    entries.erase(it);
 }
 
 } // namespace mbgl
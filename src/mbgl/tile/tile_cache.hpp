@@ -4,29 +4,89 @@
 #include <mbgl/tile/tile.hpp>
 
 
-#include <list>
-#include <memory>
 #include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
 
 namespace mbgl {
 
+struct TileCacheStats;
+
+// Cache of tiles that are no longer in view, shared by all sources of a renderer. Tiles are
+// keyed by the source that owns them, so that each source only sees its own tiles.
+//
+// The cache is bounded by a tile count, which is the sum of the counts requested by each
+// source, and, when set, also by a single memory budget in bytes. Tiles differ in size by
+// orders of magnitude, so the budget is the better bound where memory is scarce. Tiles are
+// evicted using GreedyDual-Size: a tile's retention priority is the cost of reloading it per
+// byte it holds, aged so that tiles which have not been used for a while eventually go even if
+// they are expensive to reload. Lookups are O(1), insertion and eviction O(log n).
 class TileCache {
 public:
-    TileCache(size_t size_ = 0) : size(size_) {}
+    // Identifies the source (in practice, its TilePyramid) that owns a cached tile.
+    using Owner = const void*;
+
+    TileCache(size_t size_ = 0);
+    ~TileCache();
 
-    void setSize(size_t);
+    // Sets the number of tiles the given owner wants to keep cached; zero withdraws the request.
+    void setSize(size_t, Owner = nullptr);
     size_t getSize() const { return size; };
-    void add(const OverscaledTileID& key, std::unique_ptr<Tile> tile);
-    std::unique_ptr<Tile> pop(const OverscaledTileID& key);
-    Tile* get(const OverscaledTileID& key);
-    bool has(const OverscaledTileID& key);
+
+    // Sets the maximum memory held by cached tiles, in bytes, in addition to the tile count
+    // limit; zero removes it.
+    void setMemoryBudget(size_t);
+    size_t getMemoryBudget() const { return memoryBudget; }
+    // Memory held by cached tiles as reported by Tile::getMemoryUsage() when they were added.
+    size_t getMemoryUsage() const { return memoryUsage; }
+
+    void add(const OverscaledTileID& key, std::unique_ptr<Tile> tile, Owner = nullptr);
+    std::unique_ptr<Tile> pop(const OverscaledTileID& key, Owner = nullptr);
+    Tile* get(const OverscaledTileID& key, Owner = nullptr);
+    bool has(const OverscaledTileID& key, Owner = nullptr);
+
+    // Removes the tiles of all owners.
     void clear();
+    // Removes the tiles of the given owner.
+    void clear(Owner);
+
+    TileCacheStats getStats() const;
 
 private:
-    std::map<OverscaledTileID, std::unique_ptr<Tile>> tiles;
-    std::list<OverscaledTileID> orderedKeys;
+    using Key = std::pair<Owner, OverscaledTileID>;
+    struct KeyHash {
+        std::size_t operator()(const Key&) const;
+    };
+    // Eviction order: lowest priority first, then least recently added.
+    using Rank = std::pair<double, uint64_t>;
+
+    struct Entry {
+        std::unique_ptr<Tile> tile;
+        size_t bytes;
+        std::map<Rank, Key>::iterator rank;
+    };
+    using Entries = std::unordered_map<Key, Entry, KeyHash>;
+
+    void touch(Entries::iterator);
+    void evict();
+    void erase(Entries::iterator);
+
+    Entries entries;
+    std::map<Rank, Key> ranks;
+    std::unordered_map<Owner, size_t> sizes;
+
+    size_t size = 0;
+    size_t memoryBudget = 0;
+    size_t memoryUsage = 0;
+
+    // GreedyDual-Size inflation value: the priority of the last evicted tile.
+    double inflation = 0;
+    uint64_t sequence = 0;
 
-    size_t size;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
 };
 
 } // namespace mbgl
@@ -144,6 +144,11 @@ void TileLoader<T>::loadedData(const Response& res) {
         resource.priorExpires = res.expires;
         resource.priorEtag = res.etag;
         tile.setMetadata(res.modified, res.expires);
+        // Unless the response is volatile, it is now in the ambient cache as well.
+        tile.setReloadCost(resource.loadingMethod == Resource::LoadingMethod::CacheOnly ||
+                                   resource.storagePolicy == Resource::StoragePolicy::Permanent
+                               ? TileReloadCost::Disk
+                               : TileReloadCost::Network);
         tile.setData(res.noContent ? nullptr : res.data);
     }
 }
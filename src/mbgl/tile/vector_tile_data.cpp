@@ -3,13 +3,62 @@
 
 namespace mbgl {
 
-VectorTileFeature::VectorTileFeature(const mapbox::vector_tile::layer& layer,
-                                     const protozero::data_view& view)
-    : feature(view, layer) {
+VectorTileLayerData::VectorTileLayerData(std::shared_ptr<const std::string> data_,
+                                         const protozero::data_view& view)
+    : data(std::move(data_)), layer(view), features(layer.featureCount()) {
+}
+
+std::size_t VectorTileLayerData::featureCount() const {
+    return features.size();
+}
+
+std::string VectorTileLayerData::getName() const {
+    return layer.getName();
+}
+
+VectorTileLayerData::DecodedFeature& VectorTileLayerData::getDecoded(std::size_t i) const {
+    auto& decoded = features.at(i);
+    if (!decoded) {
+        decoded = std::make_unique<DecodedFeature>();
+    }
+    return *decoded;
+}
+
+const mapbox::vector_tile::feature& VectorTileLayerData::getFeature(std::size_t i) const {
+    auto& decoded = getDecoded(i);
+    if (!decoded.feature) {
+        decoded.feature.emplace(layer.getFeature(i), layer);
+    }
+    return *decoded.feature;
+}
+
+const PropertyMap& VectorTileLayerData::getProperties(std::size_t i) const {
+    auto& decoded = getDecoded(i);
+    if (!decoded.properties) {
+        decoded.properties = getFeature(i).getProperties();
+    }
+    return *decoded.properties;
+}
+
+const GeometryCollection& VectorTileLayerData::getGeometries(std::size_t i) const {
+    auto& decoded = getDecoded(i);
+    if (!decoded.geometries) {
+        const auto& feature = getFeature(i);
+        const float scale = float(util::EXTENT) / feature.getExtent();
+        decoded.geometries = feature.getGeometries<GeometryCollection>(scale);
+        if (feature.getVersion() < 2 && feature.getType() == mapbox::vector_tile::GeomType::POLYGON) {
+            decoded.geometries = fixupPolygons(*decoded.geometries);
+        }
+    }
+    return *decoded.geometries;
+}
+
+VectorTileFeature::VectorTileFeature(std::shared_ptr<const VectorTileLayerData> layer_, std::size_t index_)
+    : layer(std::move(layer_)), index(index_) {
 }
 
 FeatureType VectorTileFeature::getType() const {
-    switch (feature.getType()) {
+    switch (layer->getFeature(index).getType()) {
     case mapbox::vector_tile::GeomType::POINT:
         return FeatureType::Point;
     case mapbox::vector_tile::GeomType::LINESTRING:
@@ -22,47 +71,44 @@ FeatureType VectorTileFeature::getType() const {
 }
 
 optional<Value> VectorTileFeature::getValue(const std::string& key) const {
-    const optional<Value> value(feature.getValue(key));
-    return value->is<NullValue>() ? nullopt : value;
+    // Filters and data-driven properties look up the same keys for every style layer that
+    // uses this feature, so decode the full property map once instead of rescanning tags.
+    const PropertyMap& properties = getProperties();
+    auto it = properties.find(key);
+    if (it == properties.end() || it->second.is<NullValue>()) {
+        return nullopt;
+    }
+    return it->second;
 }
 
 const PropertyMap& VectorTileFeature::getProperties() const {
-    if (!properties) {
-        properties = feature.getProperties();
-    }
-    return *properties;
+    return layer->getProperties(index);
 }
 
 FeatureIdentifier VectorTileFeature::getID() const {
-    return feature.getID();
+    return layer->getFeature(index).getID();
 }
 
 const GeometryCollection& VectorTileFeature::getGeometries() const {
-    if (!lines) {
-        const float scale = float(util::EXTENT) / feature.getExtent();
-        lines = feature.getGeometries<GeometryCollection>(scale);
-        if (feature.getVersion() < 2 && feature.getType() == mapbox::vector_tile::GeomType::POLYGON) {
-            lines = fixupPolygons(*lines);
-        }
-    }
-    return *lines;
+    return layer->getGeometries(index);
 }
 
-VectorTileLayer::VectorTileLayer(std::shared_ptr<const std::string> data_,
-                                 const protozero::data_view& view)
-    : data(std::move(data_)), layer(view) {
+VectorTileLayer::VectorTileLayer(std::shared_ptr<const VectorTileLayerData> layer_)
+    : layer(std::move(layer_)) {
 }
 
 std::size_t VectorTileLayer::featureCount() const {
-    return layer.featureCount();
+    return layer->featureCount();
 }
 
 std::unique_ptr<GeometryTileFeature> VectorTileLayer::getFeature(std::size_t i) const {
-    return std::make_unique<VectorTileFeature>(layer, layer.getFeature(i));
+    // Decode the feature header up front so that out-of-range indices throw here.
+    layer->getFeature(i);
+    return std::make_unique<VectorTileFeature>(layer, i);
 }
 
 std::string VectorTileLayer::getName() const {
-    return layer.getName();
+    return layer->getName();
 }
 
 VectorTileData::VectorTileData(std::shared_ptr<const std::string> data_) : data(std::move(data_)) {
@@ -73,6 +119,13 @@ std::unique_ptr<GeometryTileData> VectorTileData::clone() const {
 }
 
 std::unique_ptr<GeometryTileLayer> VectorTileData::getLayer(const std::string& name) const {
+    auto decoded = decodedLayers.find(name);
+    if (decoded != decodedLayers.end()) {
+        if (auto layer = decoded->second.lock()) {
+            return std::make_unique<VectorTileLayer>(std::move(layer));
+        }
+    }
+
     if (!parsed) {
         // We're parsing this lazily so that we can construct VectorTileData objects on the main
         // thread without incurring the overhead of parsing immediately.
@@ -82,7 +135,9 @@ std::unique_ptr<GeometryTileLayer> VectorTileData::getLayer(const std::string& n
 
     auto it = layers.find(name);
     if (it != layers.end()) {
-        return std::make_unique<VectorTileLayer>(data, it->second);
+        auto layer = std::make_shared<const VectorTileLayerData>(data, it->second);
+        decodedLayers[name] = layer;
+        return std::make_unique<VectorTileLayer>(std::move(layer));
     }
     return nullptr;
 }
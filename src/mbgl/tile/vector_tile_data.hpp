@@ -9,9 +9,39 @@
 
 namespace mbgl {
 
+// Decoded contents of a single vector tile layer. Features are decoded lazily and at most
+// once: every VectorTileLayer and VectorTileFeature handed out by the same VectorTileData
+// shares this object while any of them is alive, so style layers reading the same source layer
+// reuse each other's work. Not thread-safe; VectorTileData::clone() creates an independent cache.
+class VectorTileLayerData {
+public:
+    VectorTileLayerData(std::shared_ptr<const std::string> data, const protozero::data_view&);
+
+    std::size_t featureCount() const;
+    std::string getName() const;
+
+    const mapbox::vector_tile::feature& getFeature(std::size_t i) const;
+    const PropertyMap& getProperties(std::size_t i) const;
+    const GeometryCollection& getGeometries(std::size_t i) const;
+
+private:
+    struct DecodedFeature {
+        optional<mapbox::vector_tile::feature> feature;
+        optional<PropertyMap> properties;
+        optional<GeometryCollection> geometries;
+    };
+
+    DecodedFeature& getDecoded(std::size_t i) const;
+
+    std::shared_ptr<const std::string> data;
+    mapbox::vector_tile::layer layer;
+    // Allocated on first use, so that reading a single feature doesn't pay for all of them.
+    mutable std::vector<std::unique_ptr<DecodedFeature>> features;
+};
+
 class VectorTileFeature : public GeometryTileFeature {
 public:
-    VectorTileFeature(const mapbox::vector_tile::layer&, const protozero::data_view&);
+    VectorTileFeature(std::shared_ptr<const VectorTileLayerData>, std::size_t index);
 
     FeatureType getType() const override;
     optional<Value> getValue(const std::string& key) const override;
@@ -20,22 +50,20 @@ public:
     const GeometryCollection& getGeometries() const override;
 
 private:
-    mapbox::vector_tile::feature feature;
-    mutable optional<GeometryCollection> lines;
-    mutable optional<PropertyMap> properties;
+    std::shared_ptr<const VectorTileLayerData> layer;
+    std::size_t index;
 };
 
 class VectorTileLayer : public GeometryTileLayer {
 public:
-    VectorTileLayer(std::shared_ptr<const std::string> data, const protozero::data_view&);
+    VectorTileLayer(std::shared_ptr<const VectorTileLayerData>);
 
     std::size_t featureCount() const override;
     std::unique_ptr<GeometryTileFeature> getFeature(std::size_t i) const override;
     std::string getName() const override;
 
 private:
-    std::shared_ptr<const std::string> data;
-    mapbox::vector_tile::layer layer;
+    std::shared_ptr<const VectorTileLayerData> layer;
 };
 
 class VectorTileData : public GeometryTileData {
@@ -51,6 +79,9 @@ private:
     std::shared_ptr<const std::string> data;
     mutable bool parsed = false;
     mutable std::map<std::string, const protozero::data_view> layers;
+    // Decoded layers are owned by the layers and features handed out, not by the tile data, so that
+    // they are freed once the parse or query that needed them is done.
+    mutable std::unordered_map<std::string, std::weak_ptr<const VectorTileLayerData>> decodedLayers;
 };
 
 } // namespace mbgl
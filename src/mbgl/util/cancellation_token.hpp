@@ -0,0 +1,27 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+namespace mbgl {
+namespace util {
+
+// Shared view of a cancellation flag. Long running background work, such as
+// tile layout, checks it cooperatively and bails out early once it is set. The
+// token keeps the flag alive, as buckets holding one may outlive the tile that
+// sets it. A default constructed token is never cancelled.
+class CancellationToken {
+public:
+    CancellationToken() = default;
+    explicit CancellationToken(std::shared_ptr<const std::atomic<bool>> flag_) : flag(std::move(flag_)) {}
+
+    bool isCancelled() const {
+        return flag && flag->load(std::memory_order_relaxed);
+    }
+
+private:
+    std::shared_ptr<const std::atomic<bool>> flag;
+};
+
+} // namespace util
+} // namespace mbgl
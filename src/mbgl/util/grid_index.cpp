@@ -1,8 +1,8 @@
 #include <mbgl/util/grid_index.hpp>
 #include <mbgl/geometry/feature_index.hpp>
+#include <mbgl/text/collision_index.hpp>
 #include <mbgl/math/minmax.hpp>
 
-#include <unordered_set>
 #include <cmath>
 
 namespace mbgl {
@@ -25,52 +25,54 @@ GridIndex<T>::GridIndex(const float width_, const float height_, const uint32_t
 
 template <class T>
 void GridIndex<T>::insert(T&& t, const BBox& bbox) {
-    size_t uid = boxElements.size();
-
-    auto cx1 = convertToXCellCoord(bbox.min.x);
-    auto cy1 = convertToYCellCoord(bbox.min.y);
-    auto cx2 = convertToXCellCoord(bbox.max.x);
-    auto cy2 = convertToYCellCoord(bbox.max.y);
-
-    std::size_t x;
-    std::size_t y;
-    std::size_t cellIndex;
-    for (x = cx1; x <= cx2; ++x) {
-        for (y = cy1; y <= cy2; ++y) {
-            cellIndex = xCellCount * y + x;
-            boxCells[cellIndex].push_back(uid);
-        }
-    }
-
-    boxElements.emplace_back(t, bbox);
+    const auto uid = static_cast<uint32_t>(boxElements.size());
+    insertIntoCells(boxCells, boxCellNodes, uid, bbox);
+    boxElements.push_back({std::move(t),
+                           bbox,
+                           static_cast<uint32_t>(convertToXCellCoord(bbox.min.x)),
+                           static_cast<uint32_t>(convertToYCellCoord(bbox.min.y))});
 }
 
 template <class T>
 void GridIndex<T>::insert(T&& t, const BCircle& bcircle) {
-    size_t uid = circleElements.size();
+    const auto uid = static_cast<uint32_t>(circleElements.size());
+    const BBox bbox = convertToBox(bcircle);
+    insertIntoCells(circleCells, circleCellNodes, uid, bbox);
+    circleElements.push_back({std::move(t),
+                              bcircle,
+                              static_cast<uint32_t>(convertToXCellCoord(bbox.min.x)),
+                              static_cast<uint32_t>(convertToYCellCoord(bbox.min.y))});
+}
 
-    auto cx1 = convertToXCellCoord(bcircle.center.x - bcircle.radius);
-    auto cy1 = convertToYCellCoord(bcircle.center.y - bcircle.radius);
-    auto cx2 = convertToXCellCoord(bcircle.center.x + bcircle.radius);
-    auto cy2 = convertToYCellCoord(bcircle.center.y + bcircle.radius);
+template <class T>
+void GridIndex<T>::insertIntoCells(std::vector<Cell>& cells,
+                                   std::vector<CellNode>& nodes,
+                                   const uint32_t element,
+                                   const BBox& bbox) {
+    auto cx1 = convertToXCellCoord(bbox.min.x);
+    auto cy1 = convertToYCellCoord(bbox.min.y);
+    auto cx2 = convertToXCellCoord(bbox.max.x);
+    auto cy2 = convertToYCellCoord(bbox.max.y);
 
-    std::size_t x;
-    std::size_t y;
-    std::size_t cellIndex;
-    for (x = cx1; x <= cx2; ++x) {
-        for (y = cy1; y <= cy2; ++y) {
-            cellIndex = xCellCount * y + x;
-            circleCells[cellIndex].push_back(uid);
+    for (std::size_t x = cx1; x <= cx2; ++x) {
+        for (std::size_t y = cy1; y <= cy2; ++y) {
+            Cell& cell = cells[xCellCount * y + x];
+            const auto node = static_cast<uint32_t>(nodes.size());
+            nodes.push_back({element, kNoNode});
+            if (cell.last == kNoNode) {
+                cell.first = node;
+            } else {
+                nodes[cell.last].next = node;
+            }
+            cell.last = node;
         }
     }
-
-    circleElements.emplace_back(t, bcircle);
 }
 
 template <class T>
 std::vector<T> GridIndex<T>::query(const BBox& queryBBox) const {
     std::vector<T> result;
-    query(queryBBox, [&](const T& t, const BBox&) -> bool {
+    visit(queryBBox, [&](const T& t, const BBox&) -> bool {
         result.push_back(t);
         return false;
     });
@@ -80,7 +82,7 @@ std::vector<T> GridIndex<T>::query(const BBox& queryBBox) const {
 template <class T>
 std::vector<std::pair<T, typename GridIndex<T>::BBox>> GridIndex<T>::queryWithBoxes(const BBox& queryBBox) const {
     std::vector<std::pair<T, BBox>> result;
-    query(queryBBox, [&](const T& t, const BBox& bbox) -> bool {
+    visit(queryBBox, [&](const T& t, const BBox& bbox) -> bool {
         result.push_back(std::make_pair(t, bbox));
         return false;
     });
@@ -88,31 +90,14 @@ std::vector<std::pair<T, typename GridIndex<T>::BBox>> GridIndex<T>::queryWithBo
 }
 
 template <class T>
-bool GridIndex<T>::hitTest(const BBox& queryBBox, optional<std::function<bool(const T&)>> predicate) const {
-    bool hit = false;
-    query(queryBBox, [&](const T& t, const BBox&) -> bool {
-        if (!predicate || (*predicate)(t)) {
-            hit = true;
-            return true;
-        } else {
-            return false;
-        }
-    });
-    return hit;
+bool GridIndex<T>::hitTest(const BBox& queryBBox, const optional<std::function<bool(const T&)>>& predicate) const {
+    return visit(queryBBox, [&](const T& t, const BBox&) -> bool { return !predicate || (*predicate)(t); });
 }
 
 template <class T>
-bool GridIndex<T>::hitTest(const BCircle& queryBCircle, optional<std::function<bool(const T&)>> predicate) const {
-    bool hit = false;
-    query(queryBCircle, [&](const T& t, const BBox&) -> bool {
-        if (!predicate || (*predicate)(t)) {
-            hit = true;
-            return true;
-        } else {
-            return false;
-        }
-    });
-    return hit;
+bool GridIndex<T>::hitTest(const BCircle& queryBCircle,
+                           const optional<std::function<bool(const T&)>>& predicate) const {
+    return visit(queryBCircle, [&](const T& t, const BBox&) -> bool { return !predicate || (*predicate)(t); });
 }
 
 template <class T>
@@ -131,136 +116,6 @@ typename GridIndex<T>::BBox GridIndex<T>::convertToBox(const BCircle& circle) co
                 {circle.center.x + circle.radius, circle.center.y + circle.radius}};
 }
 
-template <class T>
-void GridIndex<T>::query(const BBox& queryBBox, std::function<bool (const T&, const BBox&)> resultFn) const {
-    std::unordered_set<size_t> seenBoxes;
-    std::unordered_set<size_t> seenCircles;
-    
-    if (noIntersection(queryBBox)) {
-        return;
-    } else if (completeIntersection(queryBBox)) {
-        for (auto& element : boxElements) {
-            if (resultFn(element.first, element.second)) {
-                return;
-            }
-        }
-        for (auto& element : circleElements) {
-            if (resultFn(element.first, convertToBox(element.second))) {
-                return;
-            }
-        }
-        return;
-    }
-
-    auto cx1 = convertToXCellCoord(queryBBox.min.x);
-    auto cy1 = convertToYCellCoord(queryBBox.min.y);
-    auto cx2 = convertToXCellCoord(queryBBox.max.x);
-    auto cy2 = convertToYCellCoord(queryBBox.max.y);
-
-    std::size_t x;
-    std::size_t y;
-    std::size_t cellIndex;
-    for (x = cx1; x <= cx2; ++x) {
-        for (y = cy1; y <= cy2; ++y) {
-            cellIndex = xCellCount * y + x;
-            // Look up other boxes
-            for (auto uid : boxCells[cellIndex]) {
-                if (seenBoxes.count(uid) == 0) {
-                    seenBoxes.insert(uid);
-
-                    auto& pair = boxElements.at(uid);
-                    auto& bbox = pair.second;
-                    if (boxesCollide(queryBBox, bbox)) {
-                        if (resultFn(pair.first, bbox)) {
-                            return;
-                        }
-                    }
-                }
-            }
-            
-            // Look up circles
-            for (auto uid : circleCells[cellIndex]) {
-                if (seenCircles.count(uid) == 0) {
-                    seenCircles.insert(uid);
-
-                    auto& pair = circleElements.at(uid);
-                    auto& bcircle = pair.second;
-                    if (circleAndBoxCollide(bcircle, queryBBox)) {
-                        if (resultFn(pair.first, convertToBox(bcircle))) {
-                            return;
-                        }
-                    }
-                }
-            }
-        }
-    }
-}
-
-template <class T>
-void GridIndex<T>::query(const BCircle& queryBCircle, std::function<bool (const T&, const BBox&)> resultFn) const {
-    std::unordered_set<size_t> seenBoxes;
-    std::unordered_set<size_t> seenCircles;
-
-    BBox queryBBox = convertToBox(queryBCircle);
-    if (noIntersection(queryBBox)) {
-        return;
-    } else if (completeIntersection(queryBBox)) {
-        for (auto& element : boxElements) {
-            if (resultFn(element.first, element.second)) {
-                return;
-            }
-        }
-        for (auto& element : circleElements) {
-            if (resultFn(element.first, convertToBox(element.second))) {
-                return;
-            }
-        }
-    }
-
-    auto cx1 = convertToXCellCoord(queryBCircle.center.x - queryBCircle.radius);
-    auto cy1 = convertToYCellCoord(queryBCircle.center.y - queryBCircle.radius);
-    auto cx2 = convertToXCellCoord(queryBCircle.center.x + queryBCircle.radius);
-    auto cy2 = convertToYCellCoord(queryBCircle.center.y + queryBCircle.radius);
-
-    std::size_t x;
-    std::size_t y;
-    std::size_t cellIndex;
-    for (x = cx1; x <= cx2; ++x) {
-        for (y = cy1; y <= cy2; ++y) {
-            cellIndex = xCellCount * y + x;
-            // Look up boxes
-            for (auto uid : boxCells[cellIndex]) {
-                if (seenBoxes.count(uid) == 0) {
-                    seenBoxes.insert(uid);
-
-                    auto& pair = boxElements.at(uid);
-                    auto& bbox = pair.second;
-                    if (circleAndBoxCollide(queryBCircle, bbox)) {
-                        if (resultFn(pair.first, bbox)) {
-                            return;
-                        }
-                    }
-                }
-            }
-            
-            // Look up other circles
-            for (auto uid : circleCells[cellIndex]) {
-                if (seenCircles.count(uid) == 0) {
-                    seenCircles.insert(uid);
-
-                    auto& pair = circleElements.at(uid);
-                    auto& bcircle = pair.second;
-                    if (circlesCollide(queryBCircle, bcircle)) {
-                        if (resultFn(pair.first, convertToBox(bcircle))) {
-                            return;
-                        }
-                    }
-                }
-            }
-        }
-    }
-}
-
 template <class T>
 std::size_t GridIndex<T>::convertToXCellCoord(const float x) const {
     return util::max(0.0, util::min(xCellCount - 1.0, std::floor(x * xScale)));
@@ -272,7 +127,7 @@ std::size_t GridIndex<T>::convertToYCellCoord(const float y) const {
 }
 
 template <class T>
-bool GridIndex<T>::boxesCollide(const BBox& first, const BBox& second) const {
+bool GridIndex<T>::boxesCollide(const BBox& first, const BBox& second) {
 	return first.min.x <= second.max.x &&
            first.min.y <= second.max.y &&
            first.max.x >= second.min.x &&
@@ -280,7 +135,7 @@ bool GridIndex<T>::boxesCollide(const BBox& first, const BBox& second) const {
 }
 
 template <class T>
-bool GridIndex<T>::circlesCollide(const BCircle& first, const BCircle& second) const {
+bool GridIndex<T>::circlesCollide(const BCircle& first, const BCircle& second) {
     auto dx = second.center.x - first.center.x;
     auto dy = second.center.y - first.center.y;
     auto bothRadii = first.radius + second.radius;
@@ -288,7 +143,7 @@ bool GridIndex<T>::circlesCollide(const BCircle& first, const BCircle& second) c
 }
 
 template <class T>
-bool GridIndex<T>::circleAndBoxCollide(const BCircle& circle, const BBox& box) const {
+bool GridIndex<T>::circleAndBoxCollide(const BCircle& circle, const BBox& box) {
     auto halfRectWidth = (box.max.x - box.min.x) / 2;
     auto distX = std::abs(circle.center.x - (box.min.x + halfRectWidth));
     if (distX > (halfRectWidth + circle.radius)) {
@@ -317,5 +172,6 @@ bool GridIndex<T>::empty() const {
 
 
 template class GridIndex<IndexedSubfeature>;
+template class GridIndex<CollisionGridFeature>;
 
 } // namespace mbgl
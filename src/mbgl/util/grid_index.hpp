@@ -4,10 +4,12 @@
 #include <mapbox/geometry/box.hpp>
 #include <mbgl/util/optional.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstddef>
-#include <vector>
 #include <functional>
+#include <limits>
+#include <vector>
 
 namespace mbgl {
 
@@ -67,25 +69,63 @@ public:
     std::vector<T> query(const BBox&) const;
     std::vector<std::pair<T,BBox>> queryWithBoxes(const BBox&) const;
     
-    bool hitTest(const BBox&, optional<std::function<bool(const T&)>> predicate = nullopt) const;
-    bool hitTest(const BCircle&, optional<std::function<bool(const T&)>> predicate = nullopt) const;
+    bool hitTest(const BBox&, const optional<std::function<bool(const T&)>>& predicate = nullopt) const;
+    bool hitTest(const BCircle&, const optional<std::function<bool(const T&)>>& predicate = nullopt) const;
+
+    // Calls visitor(const T&, const BBox&) for each element intersecting the query geometry, in the
+    // order query() returns them, until the visitor returns true. Returns whether it did. Does not
+    // allocate.
+    template <typename Visitor>
+    bool visit(const BBox&, Visitor&&) const;
+    template <typename Visitor>
+    bool visit(const BCircle&, Visitor&&) const;
     
     bool empty() const;
 
 private:
+    static constexpr uint32_t kNoNode = std::numeric_limits<uint32_t>::max();
+
+    // The elements of a cell form a list, in insertion order, of nodes stored in one array per
+    // element kind. Inserting appends to that array instead of to a vector per cell.
+    struct Cell {
+        uint32_t first = kNoNode;
+        uint32_t last = kNoNode;
+    };
+
+    struct CellNode {
+        uint32_t element;
+        uint32_t next;
+    };
+
+    template <typename Geometry>
+    struct Element {
+        T value;
+        Geometry geometry;
+        // The first cell covered by the element, which is where a query visits it.
+        uint32_t cellX;
+        uint32_t cellY;
+    };
+
     bool noIntersection(const BBox& queryBBox) const;
     bool completeIntersection(const BBox& queryBBox) const;
     BBox convertToBox(const BCircle& circle) const;
 
-    void query(const BBox&, std::function<bool (const T&, const BBox&)>) const;
-    void query(const BCircle&, std::function<bool (const T&, const BBox&)>) const;
+    template <typename QueryGeometry, typename Visitor>
+    bool visitCells(const QueryGeometry&, const BBox& queryBBox, Visitor&&) const;
+
+    void insertIntoCells(std::vector<Cell>&, std::vector<CellNode>&, uint32_t element, const BBox&);
 
     std::size_t convertToXCellCoord(float x) const;
     std::size_t convertToYCellCoord(float y) const;
 
-    bool boxesCollide(const BBox&, const BBox&) const;
-    bool circlesCollide(const BCircle&, const BCircle&) const;
-    bool circleAndBoxCollide(const BCircle&, const BBox&) const;
+    static bool collide(const BBox& query, const BBox& bbox) { return boxesCollide(query, bbox); }
+    static bool collide(const BBox& query, const BCircle& circle) { return circleAndBoxCollide(circle, query); }
+    static bool collide(const BCircle& query, const BBox& bbox) { return circleAndBoxCollide(query, bbox); }
+    static bool collide(const BCircle& query, const BCircle& circle) { return circlesCollide(query, circle); }
+
+    static bool boxesCollide(const BBox&, const BBox&);
+    static bool circlesCollide(const BCircle&, const BCircle&);
+    static bool circleAndBoxCollide(const BCircle&, const BBox&);
 
     const float width;
     const float height;
@@ -95,12 +135,77 @@ private:
     const double xScale;
     const double yScale;
 
-    std::vector<std::pair<T, BBox>> boxElements;
-    std::vector<std::pair<T, BCircle>> circleElements;
+    std::vector<Element<BBox>> boxElements;
+    std::vector<Element<BCircle>> circleElements;
     
-    std::vector<std::vector<size_t>> boxCells;
-    std::vector<std::vector<size_t>> circleCells;
+    std::vector<Cell> boxCells;
+    std::vector<Cell> circleCells;
+    std::vector<CellNode> boxCellNodes;
+    std::vector<CellNode> circleCellNodes;
 
 };
 
+template <class T>
+template <typename Visitor>
+bool GridIndex<T>::visit(const BBox& queryBBox, Visitor&& visitor) const {
+    return visitCells(queryBBox, queryBBox, std::forward<Visitor>(visitor));
+}
+
+template <class T>
+template <typename Visitor>
+bool GridIndex<T>::visit(const BCircle& queryBCircle, Visitor&& visitor) const {
+    return visitCells(queryBCircle, convertToBox(queryBCircle), std::forward<Visitor>(visitor));
+}
+
+template <class T>
+template <typename QueryGeometry, typename Visitor>
+bool GridIndex<T>::visitCells(const QueryGeometry& query, const BBox& queryBBox, Visitor&& visitor) const {
+    if (noIntersection(queryBBox)) {
+        return false;
+    } else if (completeIntersection(queryBBox)) {
+        for (const auto& element : boxElements) {
+            if (visitor(element.value, element.geometry)) {
+                return true;
+            }
+        }
+        for (const auto& element : circleElements) {
+            if (visitor(element.value, convertToBox(element.geometry))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const auto cx1 = convertToXCellCoord(queryBBox.min.x);
+    const auto cy1 = convertToYCellCoord(queryBBox.min.y);
+    const auto cx2 = convertToXCellCoord(queryBBox.max.x);
+    const auto cy2 = convertToYCellCoord(queryBBox.max.y);
+
+    // An element covering several of the queried cells is only tested in the first of them.
+    const auto isFirstVisit = [&](const auto& element, std::size_t x, std::size_t y) {
+        return std::max<std::size_t>(element.cellX, cx1) == x && std::max<std::size_t>(element.cellY, cy1) == y;
+    };
+
+    for (std::size_t x = cx1; x <= cx2; ++x) {
+        for (std::size_t y = cy1; y <= cy2; ++y) {
+            const std::size_t cellIndex = xCellCount * y + x;
+            for (uint32_t node = boxCells[cellIndex].first; node != kNoNode; node = boxCellNodes[node].next) {
+                const auto& element = boxElements[boxCellNodes[node].element];
+                if (isFirstVisit(element, x, y) && collide(query, element.geometry) &&
+                    visitor(element.value, element.geometry)) {
+                    return true;
+                }
+            }
+            for (uint32_t node = circleCells[cellIndex].first; node != kNoNode; node = circleCellNodes[node].next) {
+                const auto& element = circleElements[circleCellNodes[node].element];
+                if (isFirstVisit(element, x, y) && collide(query, element.geometry) &&
+                    visitor(element.value, convertToBox(element.geometry))) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
 } // namespace mbgl
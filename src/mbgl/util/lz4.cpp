@@ -0,0 +1,211 @@
+#include <mbgl/util/lz4.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace mbgl {
+namespace util {
+namespace lz4 {
+
+namespace {
+
+constexpr std::size_t kHeaderSize = 4;
+constexpr std::size_t kMinMatch = 4;
+// The last match must start at least this many bytes before the end of the input,
+// and the last bytes are always stored as literals.
+constexpr std::size_t kMatchFindLimit = 12;
+constexpr std::size_t kLastLiterals = 5;
+constexpr std::size_t kMaxOffset = 65535;
+// Each byte of a block decodes to at most this many bytes, as a length byte adds at most 255.
+constexpr std::size_t kMaxRatio = 255;
+constexpr unsigned kHashBits = 14;
+
+uint32_t read32(const char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+uint32_t hash(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+void writeLength(std::string& out, std::size_t length) {
+    while (length >= 255) {
+        out.push_back(static_cast<char>(255));
+        length -= 255;
+    }
+    out.push_back(static_cast<char>(length));
+}
+
+void writeSequence(std::string& out, const char* literals, std::size_t literalLength, std::size_t offset, std::size_t matchLength) {
+    const std::size_t extraMatch = matchLength - kMinMatch;
+    const auto token = static_cast<uint8_t>(((literalLength < 15 ? literalLength : 15) << 4) |
+                                            (extraMatch < 15 ? extraMatch : 15));
+    out.push_back(static_cast<char>(token));
+    if (literalLength >= 15) {
+        writeLength(out, literalLength - 15);
+    }
+    out.append(literals, literalLength);
+    out.push_back(static_cast<char>(offset & 0xFF));
+    out.push_back(static_cast<char>(offset >> 8));
+    if (extraMatch >= 15) {
+        writeLength(out, extraMatch - 15);
+    }
+}
+
+void writeLastLiterals(std::string& out, const char* literals, std::size_t literalLength) {
+    out.push_back(static_cast<char>((literalLength < 15 ? literalLength : 15) << 4));
+    if (literalLength >= 15) {
+        writeLength(out, literalLength - 15);
+    }
+    out.append(literals, literalLength);
+}
+
+std::size_t readLength(const std::string& in, std::size_t& ip) {
+    std::size_t length = 0;
+    uint8_t byte;
+    do {
+        if (ip >= in.size()) {
+            throw std::runtime_error("truncated lz4 block");
+        }
+        byte = static_cast<uint8_t>(in[ip++]);
+        length += byte;
+    } while (byte == 255);
+    return length;
+}
+
+} // namespace
+
+std::string compress(const std::string& raw) {
+    if (raw.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("input too large for lz4 block");
+    }
+
+    const std::size_t size = raw.size();
+    const char* const in = raw.data();
+
+    std::string out;
+    out.reserve(kHeaderSize + size + size / 255 + 16);
+    for (std::size_t i = 0; i < kHeaderSize; ++i) {
+        out.push_back(static_cast<char>((size >> (8 * i)) & 0xFF));
+    }
+
+    std::size_t anchor = 0;
+    if (size > kMatchFindLimit) {
+        // Positions are stored off by one so that zero marks an empty slot.
+        std::vector<uint32_t> table(std::size_t(1) << kHashBits, 0);
+        const std::size_t matchFindLimit = size - kMatchFindLimit;
+        const std::size_t matchEndLimit = size - kLastLiterals;
+
+        std::size_t ip = 0;
+        while (ip < matchFindLimit) {
+            const uint32_t sequence = read32(in + ip);
+            uint32_t& slot = table[hash(sequence)];
+            const std::size_t candidate = slot;
+            slot = static_cast<uint32_t>(ip + 1);
+
+            if (candidate == 0 || ip - (candidate - 1) > kMaxOffset || read32(in + candidate - 1) != sequence) {
+                ++ip;
+                continue;
+            }
+
+            const std::size_t ref = candidate - 1;
+            std::size_t matchLength = kMinMatch;
+            while (ip + matchLength < matchEndLimit && in[ref + matchLength] == in[ip + matchLength]) {
+                ++matchLength;
+            }
+
+            writeSequence(out, in + anchor, ip - anchor, ip - ref, matchLength);
+            ip += matchLength;
+            anchor = ip;
+        }
+    }
+
+    writeLastLiterals(out, in + anchor, size - anchor);
+    return out;
+}
+
+std::string decompress(const std::string& in) {
+    if (in.size() < kHeaderSize + 1) {
+        throw std::runtime_error("truncated lz4 block");
+    }
+
+    std::size_t size = 0;
+    for (std::size_t i = 0; i < kHeaderSize; ++i) {
+        size |= std::size_t(static_cast<uint8_t>(in[i])) << (8 * i);
+    }
+    // The size is read from untrusted data; reject it before allocating.
+    if (size > (in.size() - kHeaderSize) * kMaxRatio) {
+        throw std::runtime_error("corrupt lz4 block");
+    }
+
+    std::string out(size, '\0');
+    char* const dst = &out[0];
+    std::size_t op = 0;
+    std::size_t ip = kHeaderSize;
+
+    while (true) {
+        if (ip >= in.size()) {
+            throw std::runtime_error("truncated lz4 block");
+        }
+        const auto token = static_cast<uint8_t>(in[ip++]);
+
+        std::size_t literalLength = token >> 4;
+        if (literalLength == 15) {
+            literalLength += readLength(in, ip);
+        }
+        if (literalLength > in.size() - ip || literalLength > size - op) {
+            throw std::runtime_error("corrupt lz4 block");
+        }
+        std::memcpy(dst + op, in.data() + ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        // The last sequence has literals only.
+        if (ip == in.size()) {
+            break;
+        }
+
+        if (in.size() - ip < 2) {
+            throw std::runtime_error("truncated lz4 block");
+        }
+        const std::size_t offset =
+            std::size_t(static_cast<uint8_t>(in[ip])) | (std::size_t(static_cast<uint8_t>(in[ip + 1])) << 8);
+        ip += 2;
+
+        std::size_t matchLength = token & 0x0F;
+        if (matchLength == 15) {
+            matchLength += readLength(in, ip);
+        }
+        matchLength += kMinMatch;
+
+        if (offset == 0 || offset > op || matchLength > size - op) {
+            throw std::runtime_error("corrupt lz4 block");
+        }
+
+        const char* match = dst + op - offset;
+        if (offset >= matchLength) {
+            std::memcpy(dst + op, match, matchLength);
+        } else {
+            // Overlapping copy repeats the last `offset` bytes.
+            for (std::size_t i = 0; i < matchLength; ++i) {
+                dst[op + i] = match[i];
+            }
+        }
+        op += matchLength;
+    }
+
+    if (op != size) {
+        throw std::runtime_error("corrupt lz4 block");
+    }
+
+    return out;
+}
+
+} // namespace lz4
+} // namespace util
+} // namespace mbgl
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+namespace mbgl {
+namespace util {
+namespace lz4 {
+
+// Block compression in the LZ4 block format, prefixed with the uncompressed
+// size as a 32-bit little-endian integer. Compresses worse than deflate, but
+// decompresses several times faster, which matters for cache reads on the way
+// to the first rendered frame.
+std::string compress(const std::string& raw);
+
+// Throws std::runtime_error if the input is malformed.
+std::string decompress(const std::string& compressed);
+
+} // namespace lz4
+} // namespace util
+} // namespace mbgl
@@ -24,6 +24,14 @@
 
 #include <cmath>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MBGL_MAT4_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define MBGL_MAT4_NEON 1
+#include <arm_neon.h>
+#endif
+
 namespace mbgl {
 
 namespace matrix {
@@ -380,6 +388,52 @@ void transformMat4(vec4& out, const vec4& a, const mat4& m) {
     out[3] = m[3] * x + m[7] * y + m[11] * z + m[15] * w;
 }
 
+void transformPoints(vec4* out, const Point<float>* points, std::size_t count, const mat4& m) {
+    // The products and sums are evaluated in the same order as in transformMat4(), including
+    // the terms for z = 0 and w = 1, so that both give bit-identical results. This file is built
+    // with -ffp-contract=off so that the compiler does not fuse the scalar ones into FMAs.
+#if defined(MBGL_MAT4_SSE2)
+    const __m128d c0l = _mm_loadu_pd(&m[0]), c0h = _mm_loadu_pd(&m[2]);
+    const __m128d c1l = _mm_loadu_pd(&m[4]), c1h = _mm_loadu_pd(&m[6]);
+    const __m128d c2l = _mm_loadu_pd(&m[8]), c2h = _mm_loadu_pd(&m[10]);
+    const __m128d c3l = _mm_loadu_pd(&m[12]), c3h = _mm_loadu_pd(&m[14]);
+    const __m128d z = _mm_setzero_pd();
+    const __m128d w = _mm_set1_pd(1.0);
+    for (std::size_t i = 0; i < count; ++i) {
+        const __m128d x = _mm_set1_pd(points[i].x);
+        const __m128d y = _mm_set1_pd(points[i].y);
+        __m128d lo = _mm_add_pd(_mm_mul_pd(c0l, x), _mm_mul_pd(c1l, y));
+        __m128d hi = _mm_add_pd(_mm_mul_pd(c0h, x), _mm_mul_pd(c1h, y));
+        lo = _mm_add_pd(_mm_add_pd(lo, _mm_mul_pd(c2l, z)), _mm_mul_pd(c3l, w));
+        hi = _mm_add_pd(_mm_add_pd(hi, _mm_mul_pd(c2h, z)), _mm_mul_pd(c3h, w));
+        _mm_storeu_pd(&out[i][0], lo);
+        _mm_storeu_pd(&out[i][2], hi);
+    }
+#elif defined(MBGL_MAT4_NEON)
+    const float64x2_t c0l = vld1q_f64(&m[0]), c0h = vld1q_f64(&m[2]);
+    const float64x2_t c1l = vld1q_f64(&m[4]), c1h = vld1q_f64(&m[6]);
+    const float64x2_t c2l = vld1q_f64(&m[8]), c2h = vld1q_f64(&m[10]);
+    const float64x2_t c3l = vld1q_f64(&m[12]), c3h = vld1q_f64(&m[14]);
+    const float64x2_t z = vdupq_n_f64(0.0);
+    const float64x2_t w = vdupq_n_f64(1.0);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float64x2_t x = vdupq_n_f64(points[i].x);
+        const float64x2_t y = vdupq_n_f64(points[i].y);
+        float64x2_t lo = vaddq_f64(vmulq_f64(c0l, x), vmulq_f64(c1l, y));
+        float64x2_t hi = vaddq_f64(vmulq_f64(c0h, x), vmulq_f64(c1h, y));
+        lo = vaddq_f64(vaddq_f64(lo, vmulq_f64(c2l, z)), vmulq_f64(c3l, w));
+        hi = vaddq_f64(vaddq_f64(hi, vmulq_f64(c2h, z)), vmulq_f64(c3h, w));
+        vst1q_f64(&out[i][0], lo);
+        vst1q_f64(&out[i][2], hi);
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = {{points[i].x, points[i].y, 0, 1}};
+        transformMat4(out[i], out[i], m);
+    }
+#endif
+}
+
 } // namespace matrix
 
 } // namespace mbgl
@@ -23,6 +23,8 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
+#include <mbgl/util/geometry.hpp>
 #include <mbgl/util/vectors.hpp>
 
 namespace mbgl {
@@ -45,5 +47,10 @@ void multiply(mat4& out, const mat4& a, const mat4& b);
 
 void transformMat4(vec4& out, const vec4& a, const mat4& m);
 
+// Transforms `count` points (x, y, 0, 1) by the matrix. The results are the same as
+// those of transformMat4(), but are computed two components at a time on SSE2 and
+// AArch64 NEON.
+void transformPoints(vec4* out, const Point<float>* points, std::size_t count, const mat4& m);
+
 } // namespace matrix
 } // namespace mbgl
@@ -5,6 +5,8 @@
 #include <mbgl/util/platform.hpp>
 #include <mbgl/util/string.hpp>
 
+#include <algorithm>
+
 namespace mbgl {
 
 ThreadedSchedulerBase::~ThreadedSchedulerBase() = default;
@@ -56,4 +58,177 @@ void ThreadedSchedulerBase::schedule(std::function<void()> fn) {
     cv.notify_one();
 }
 
+struct WorkStealingScheduler::Worker {
+    Worker(WorkStealingScheduler& owner_, std::size_t index_) : owner(owner_), index(index_) {}
+
+    WorkStealingScheduler& owner;
+    const std::size_t index;
+
+    // One lane per priority.
+    struct Lane {
+        // Tasks scheduled by this worker's own thread.
+        util::WorkStealingDeque<Task> deque;
+
+        // Tasks scheduled by other threads, or overflowing the deque. The size is
+        // tracked separately so that idle workers can skip empty inboxes without locking.
+        std::mutex inboxMutex;
+        std::queue<std::unique_ptr<Task>> inbox;
+        std::atomic<std::size_t> inboxSize{0};
+
+        void pushInbox(std::unique_ptr<Task> task) {
+            std::lock_guard<std::mutex> lock(inboxMutex);
+            inbox.push(std::move(task));
+            ++inboxSize;
+        }
+
+        std::unique_ptr<Task> popInbox() {
+            if (inboxSize == 0) return {};
+            std::lock_guard<std::mutex> lock(inboxMutex);
+            if (inbox.empty()) return {};
+            auto task = std::move(inbox.front());
+            inbox.pop();
+            --inboxSize;
+            return task;
+        }
+    };
+
+    std::array<Lane, TaskPriorityCount> lanes;
+};
+
+// static
+util::ThreadLocal<WorkStealingScheduler::Worker>& WorkStealingScheduler::currentWorker() {
+    static util::ThreadLocal<Worker> worker;
+    return worker;
+}
+
+WorkStealingScheduler::WorkStealingScheduler(std::size_t threadCount) {
+    threadCount = std::max<std::size_t>(threadCount, 1u);
+    workers.reserve(threadCount);
+    for (std::size_t i = 0u; i < threadCount; ++i) {
+        workers.emplace_back(std::make_unique<Worker>(*this, i));
+    }
+    threads.reserve(threadCount);
+    for (std::size_t i = 0u; i < threadCount; ++i) {
+        threads.emplace_back([this, i] { run(i); });
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        terminated = true;
+    }
+    cv.notify_all();
+
+    for (auto& thread : threads) {
+        assert(std::this_thread::get_id() != thread.get_id());
+        thread.join();
+    }
+
+    // Release the tasks that never got the chance to run.
+    for (auto& worker : workers) {
+        for (auto& lane : worker->lanes) {
+            while (Task* task = lane.deque.pop()) {
+                delete task;
+            }
+        }
+    }
+}
+
+// static
+std::size_t WorkStealingScheduler::defaultThreadCount() {
+    auto value = platform::Settings::getInstance().get(platform::EXPERIMENTAL_THREAD_POOL_SIZE);
+    if (uint64_t* size = value.getUint()) {
+        if (*size > 0) return static_cast<std::size_t>(*size);
+    }
+    const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+    return std::max<std::size_t>(hardwareThreads > 1 ? hardwareThreads - 1 : 0, 2u);
+}
+
+void WorkStealingScheduler::schedule(std::function<void()> fn) {
+    scheduleWithPriority(TaskPriority::Visible, std::move(fn));
+}
+
+void WorkStealingScheduler::scheduleWithPriority(TaskPriority priority, std::function<void()> fn) {
+    assert(fn);
+    auto task = std::make_unique<Task>(std::move(fn));
+    const auto lane = static_cast<std::size_t>(priority);
+    assert(lane < TaskPriorityCount);
+
+    Worker* worker = currentWorker().get();
+    if (worker && &worker->owner == this && worker->lanes[lane].deque.push(task.get())) {
+        task.release();
+    } else {
+        const std::size_t index = nextInbox.fetch_add(1, std::memory_order_relaxed) % workers.size();
+        workers[index]->lanes[lane].pushInbox(std::move(task));
+    }
+
+    // Counted after publishing, so that a woken worker does not spin waiting for the task
+    // to appear. The counter might temporarily go negative if the task is taken first.
+    pending.fetch_add(1);
+
+    // Only pay for the lock when a worker may be waiting for work. Both counters are
+    // sequentially consistent, so either the sleeping worker sees the pending task in
+    // its wait predicate, or this thread sees the sleeping worker and wakes it up.
+    if (sleeping.load() > 0) {
+        { std::lock_guard<std::mutex> lock(mutex); }
+        cv.notify_one();
+    }
+}
+
+std::unique_ptr<WorkStealingScheduler::Task> WorkStealingScheduler::findTask(std::size_t index) {
+    const std::size_t count = workers.size();
+
+    // Drain the most urgent lane of the whole pool before moving to the next one.
+    for (std::size_t lane = 0u; lane < TaskPriorityCount; ++lane) {
+        auto& own = workers[index]->lanes[lane];
+        if (Task* task = own.deque.pop()) {
+            return std::unique_ptr<Task>(task);
+        }
+        if (auto task = own.popInbox()) {
+            return task;
+        }
+
+        for (std::size_t i = 1u; i < count; ++i) {
+            auto& victim = workers[(index + i) % count]->lanes[lane];
+            if (Task* task = victim.deque.steal()) {
+                return std::unique_ptr<Task>(task);
+            }
+            if (auto task = victim.popInbox()) {
+                return task;
+            }
+        }
+    }
+
+    return {};
+}
+
+void WorkStealingScheduler::run(std::size_t index) {
+    auto& settings = platform::Settings::getInstance();
+    auto value = settings.get(platform::EXPERIMENTAL_THREAD_PRIORITY_WORKER);
+    if (auto* priority = value.getDouble()) {
+        platform::setCurrentThreadPriority(*priority);
+    }
+
+    platform::setCurrentThreadName(std::string{"Worker "} + util::toString(index + 1));
+    platform::attachThread();
+    currentWorker().set(workers[index].get());
+
+    while (!terminated) {
+        if (auto task = findTask(index)) {
+            pending.fetch_sub(1);
+            if (*task) (*task)();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        sleeping.fetch_add(1);
+        cv.wait(lock, [this] { return pending.load() > 0 || terminated; });
+        sleeping.fetch_sub(1);
+    }
+
+    currentWorker().set(nullptr);
+    platform::detachThread();
+}
+
 } // namespace mbgl
@@ -2,12 +2,17 @@
 
 #include <mbgl/actor/mailbox.hpp>
 #include <mbgl/actor/scheduler.hpp>
+#include <mbgl/util/thread_local.hpp>
+#include <mbgl/util/work_stealing_deque.hpp>
 
 #include <array>
+#include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 
 namespace mbgl {
 
@@ -66,6 +71,63 @@ class SequencedScheduler : public ThreadedScheduler<1> {};
 template <std::size_t extra>
 using ParallelScheduler = ThreadedScheduler<1 + extra>;
 
-class ThreadPool : public ParallelScheduler<3> {};
+/**
+ * @brief WorkStealingScheduler implements Scheduler interface over a pool of
+ * worker threads whose size is chosen at runtime.
+ *
+ * Each worker owns a lock-free deque: tasks scheduled from a worker thread are
+ * pushed to its own deque, tasks scheduled from any other thread are spread
+ * round-robin over the workers' inboxes. Idle workers steal from the other
+ * workers' deques, so there is no single lock shared by all of the workers.
+ *
+ * Tasks are kept in separate lanes per `TaskPriority`, and the workers drain the
+ * most urgent lane of the whole pool before looking at less urgent ones. Tasks
+ * scheduled without a priority use `TaskPriority::Visible`.
+ *
+ * Note: tasks might be executed in parallel and in any order; per-actor ordering
+ * is provided by `Mailbox`, which never has more than one task scheduled at a time.
+ */
+class WorkStealingScheduler : public Scheduler {
+public:
+    explicit WorkStealingScheduler(std::size_t threadCount);
+    ~WorkStealingScheduler() override;
+
+    void schedule(std::function<void()>) override;
+    void scheduleWithPriority(TaskPriority, std::function<void()>) override;
+    mapbox::base::WeakPtr<Scheduler> makeWeakPtr() override { return weakFactory.makeWeakPtr(); }
+
+    std::size_t getThreadCount() const { return workers.size(); }
+
+    // Returns the pool size set with `EXPERIMENTAL_THREAD_POOL_SIZE` setting, or
+    // one less than the number of hardware threads (at least 2) otherwise.
+    static std::size_t defaultThreadCount();
+
+private:
+    using Task = std::function<void()>;
+    struct Worker;
+
+    static util::ThreadLocal<Worker>& currentWorker();
+    std::unique_ptr<Task> findTask(std::size_t index);
+    void run(std::size_t index);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+
+    std::atomic<int64_t> pending{0};
+    std::atomic<std::size_t> sleeping{0};
+    std::atomic<std::size_t> nextInbox{0};
+    std::atomic<bool> terminated{false};
+
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    mapbox::base::WeakPtrFactory<Scheduler> weakFactory{this};
+};
+
+class ThreadPool : public WorkStealingScheduler {
+public:
+    ThreadPool() : WorkStealingScheduler(defaultThreadCount()) {}
+    explicit ThreadPool(std::size_t threadCount) : WorkStealingScheduler(threadCount) {}
+};
 
 } // namespace mbgl
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace mbgl {
+namespace util {
+
+/**
+ * @brief Bounded Chase-Lev work-stealing deque.
+ *
+ * The owning thread pushes and pops at the bottom end (LIFO), while any other
+ * thread may concurrently steal from the top end (FIFO) without taking a lock.
+ * The deque stores raw pointers and never takes ownership of them; callers are
+ * responsible for freeing items that are still queued on destruction.
+ *
+ * See "Correct and Efficient Work-Stealing for Weak Memory Models", Lê et al., 2013.
+ * Sequentially consistent operations are used instead of standalone fences, which
+ * thread sanitizer does not understand.
+ *
+ * @tparam T pointee type
+ * @tparam Capacity maximum number of queued items, must be a power of two
+ */
+template <typename T, std::size_t Capacity = 1024>
+class WorkStealingDeque {
+public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
+    WorkStealingDeque() {
+        for (auto& slot : buffer) {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only. Returns false if the deque is full.
+    bool push(T* item) {
+        const int64_t b = bottom.load(std::memory_order_relaxed);
+        const int64_t t = top.load(std::memory_order_acquire);
+        if (b - t >= static_cast<int64_t>(Capacity)) {
+            return false;
+        }
+        buffer[b & mask].store(item, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Owner only. Returns nullptr if the deque is empty or the last item was stolen.
+    T* pop() {
+        const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_seq_cst);
+
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* item = buffer[b & mask].load(std::memory_order_relaxed);
+        if (t == b) {
+            // Last item: race against concurrent stealers.
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // Any thread. Returns nullptr if the deque is empty or the steal lost a race.
+    T* steal() {
+        int64_t t = top.load(std::memory_order_seq_cst);
+        const int64_t b = bottom.load(std::memory_order_seq_cst);
+
+        if (t >= b) {
+            return nullptr;
+        }
+
+        T* item = buffer[t & mask].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    // Approximate; only exact when called by the owner with no concurrent stealers.
+    bool empty() const {
+        return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr int64_t mask = static_cast<int64_t>(Capacity) - 1;
+
+    std::atomic<int64_t> top{0};
+    std::atomic<int64_t> bottom{0};
+    std::array<std::atomic<T*>, Capacity> buffer;
+};
+
+} // namespace util
+} // namespace mbgl
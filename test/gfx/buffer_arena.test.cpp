@@ -0,0 +1,45 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/buffer_arena.hpp>
+
+using namespace mbgl;
+
+TEST(BufferArena, Allocate) {
+    gfx::BufferArena arena { 256 };
+    EXPECT_EQ(256u, arena.getCapacity());
+    EXPECT_TRUE(arena.empty());
+
+    // Sizes are rounded up to the alignment.
+    EXPECT_EQ(optional<std::size_t>(0), arena.allocate(10));
+    EXPECT_EQ(optional<std::size_t>(16), arena.allocate(100));
+    EXPECT_EQ(128u, arena.getUsed());
+
+    EXPECT_EQ(optional<std::size_t>(128), arena.allocate(128));
+    EXPECT_EQ(256u, arena.getUsed());
+    EXPECT_FALSE(arena.allocate(1));
+}
+
+TEST(BufferArena, Reuse) {
+    gfx::BufferArena arena { 256 };
+    const auto a = arena.allocate(64);
+    const auto b = arena.allocate(64);
+    const auto c = arena.allocate(64);
+    ASSERT_TRUE(a && b && c);
+
+    // Freed ranges are reused, preferring the one that fits best.
+    arena.release(*a, 64);
+    EXPECT_EQ(a, arena.allocate(32));
+    EXPECT_EQ(optional<std::size_t>(*a + 32), arena.allocate(32));
+
+    // Neighbouring free ranges are merged.
+    arena.release(*b, 64);
+    arena.release(*a, 32);
+    arena.release(*a + 32, 32);
+    EXPECT_EQ(a, arena.allocate(128));
+    EXPECT_FALSE(arena.allocate(128));
+
+    arena.release(*a, 128);
+    arena.release(*c, 64);
+    EXPECT_TRUE(arena.empty());
+    EXPECT_EQ(optional<std::size_t>(0), arena.allocate(256));
+}
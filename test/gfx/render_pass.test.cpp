@@ -0,0 +1,87 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/render_pass.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+class StubRenderPass : public gfx::RenderPass {
+private:
+    void pushDebugGroup(const char*) override {}
+    void popDebugGroup() override {}
+    void applyScissor(const optional<gfx::ScissorRect>&) override {}
+};
+
+class StubDraws : public gfx::BatchedDraws {
+public:
+    StubDraws(std::string& order_, char prefix_) : order(order_), prefix(prefix_) {}
+
+    void draw(std::size_t index) override {
+        order += prefix + std::to_string(draws.at(index)) + " ";
+    }
+    void clear() override { draws.clear(); }
+
+    void record(gfx::RenderPass& renderPass, int tile) {
+        draws.push_back(tile);
+        renderPass.batch(*this, draws.size() - 1);
+    }
+
+    std::vector<int> draws;
+
+private:
+    std::string& order;
+    const char prefix;
+};
+
+} // namespace
+
+TEST(RenderPass, BatchOrder) {
+    StubRenderPass renderPass;
+    std::string order;
+    const int icon = 0;
+    const int text = 0;
+    auto& icons = renderPass.getBatchedDraws<StubDraws>(&icon, order, 'i');
+    auto& texts = renderPass.getBatchedDraws<StubDraws>(&text, order, 't');
+
+    // The first tile only has text, the second one has both.
+    renderPass.beginBatch();
+    renderPass.setBatchRank(1);
+    texts.record(renderPass, 1);
+    renderPass.setBatchRank(0);
+    icons.record(renderPass, 2);
+    renderPass.setBatchRank(1);
+    texts.record(renderPass, 2);
+    EXPECT_EQ("", order);
+
+    // Lower ranks are drawn first, whatever the order in which their keys appeared.
+    renderPass.endBatch();
+    EXPECT_EQ("i2 t1 t2 ", order);
+    EXPECT_TRUE(texts.draws.empty());
+}
+
+TEST(RenderPass, BatchedDrawsAreKept) {
+    StubRenderPass renderPass;
+    std::string order;
+    const int program = 0;
+    auto& draws = renderPass.getBatchedDraws<StubDraws>(&program, order, 'p');
+
+    renderPass.beginBatch();
+    for (int tile = 0; tile < 16; ++tile) {
+        draws.record(renderPass, tile);
+    }
+    renderPass.endBatch();
+    const auto capacity = draws.draws.capacity();
+
+    // The next batch with the same key records into the same storage, without growing it.
+    EXPECT_EQ(&draws, &renderPass.getBatchedDraws<StubDraws>(&program, order, 'p'));
+    renderPass.beginBatch();
+    for (int tile = 0; tile < 16; ++tile) {
+        draws.record(renderPass, tile);
+    }
+    EXPECT_EQ(capacity, draws.draws.capacity());
+    renderPass.endBatch();
+}
@@ -0,0 +1,38 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gl/binary_program.hpp>
+
+using namespace mbgl;
+
+TEST(BinaryProgram, Serialization) {
+    gl::BinaryProgram program { "identifier\nvendor\nrenderer\nversion\n" };
+    program.insert(3, 0x8741, std::string("\0\1\2\3", 4));
+    program.insert(0, 0x1234, "code");
+
+    const auto parsed = gl::BinaryProgram::parse(program.serialize());
+    EXPECT_EQ("identifier\nvendor\nrenderer\nversion\n", parsed.identifier());
+    EXPECT_EQ((std::vector<uint32_t>{ 0, 3 }), parsed.keys());
+
+    const auto* variant = parsed.find(3);
+    ASSERT_NE(nullptr, variant);
+    EXPECT_EQ(0x8741u, variant->format);
+    EXPECT_EQ(std::string("\0\1\2\3", 4), variant->code);
+
+    variant = parsed.find(0);
+    ASSERT_NE(nullptr, variant);
+    EXPECT_EQ(0x1234u, variant->format);
+    EXPECT_EQ("code", variant->code);
+
+    EXPECT_EQ(nullptr, parsed.find(1));
+}
+
+TEST(BinaryProgram, Malformed) {
+    EXPECT_THROW(gl::BinaryProgram::parse(""), std::runtime_error);
+    EXPECT_THROW(gl::BinaryProgram::parse("\x0a\x10" "truncated"), std::runtime_error);
+
+    gl::BinaryProgram program { "identifier" };
+    std::string data = program.serialize();
+    // A variant without key, format or code.
+    data += std::string("\x12\x00", 2);
+    EXPECT_THROW(gl::BinaryProgram::parse(data), std::runtime_error);
+}
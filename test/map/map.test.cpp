@@ -33,6 +33,9 @@
 #include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
 
+#include <mapbox/pixelmatch.hpp>
+
+#include <algorithm>
 #include <atomic>
 
 using namespace mbgl;
@@ -728,6 +731,64 @@ TEST(Map, WithoutVAOExtension) {
     test::checkImage("test/fixtures/map/no_vao", test.frontend.render(test.map).image, 0.002);
 }
 
+TEST(Map, CirclesWithoutInstancing) {
+    const std::string style = R"STYLE({
+      "version": 8,
+      "sources": {
+        "points": {
+          "type": "geojson",
+          "data": {
+            "type": "FeatureCollection",
+            "features": [
+              { "type": "Feature", "properties": { "r": 4, "c": "red" },
+                "geometry": { "type": "Point", "coordinates": [ -20, 10 ] } },
+              { "type": "Feature", "properties": { "r": 12, "c": "blue" },
+                "geometry": { "type": "Point", "coordinates": [ 0, 0 ] } },
+              { "type": "Feature", "properties": { "r": 8, "c": "green" },
+                "geometry": { "type": "Point", "coordinates": [ 30, -15 ] } }
+            ]
+          }
+        }
+      },
+      "layers": [{
+        "id": "circles",
+        "type": "circle",
+        "source": "points",
+        "paint": {
+          "circle-radius": [ "get", "r" ],
+          "circle-color": [ "get", "c" ],
+          "circle-stroke-width": 2,
+          "circle-blur": 0.2
+        }
+      }]
+    })STYLE";
+
+    // Circles drawn per vertex must look like circles drawn as instances of one quad.
+    auto render = [&](bool instancing) {
+        MapTest<> test;
+        if (!instancing) {
+            gfx::BackendScope scope { *test.frontend.getBackend() };
+            test.frontend.getBackend()->getContext().supportsInstancing = false;
+        }
+        test.map.getStyle().loadJSON(style);
+        test.map.jumpTo(CameraOptions().withCenter(LatLng { 0, 0 }).withZoom(1.0));
+        return test.frontend.render(test.map).image;
+    };
+
+    const PremultipliedImage instanced = render(true);
+    const PremultipliedImage notInstanced = render(false);
+    ASSERT_EQ(instanced.size, notInstanced.size);
+
+    PremultipliedImage diff { instanced.size };
+    double pixels = mapbox::pixelmatch(instanced.data.get(),
+                                       notInstanced.data.get(),
+                                       instanced.size.width,
+                                       instanced.size.height,
+                                       diff.data.get(),
+                                       0.1);
+    EXPECT_EQ(0, pixels);
+}
+
 TEST(Map, RemoveLayer) {
     MapTest<> test;
 
@@ -1561,4 +1622,135 @@ TEST(Map, VolatileSource) {
     test.observer.didFinishLoadingMapCallback = [&] { test.runLoop.stop(); };
     test.runLoop.run();
     EXPECT_EQ(8, requestedTiles);
-}
\ No newline at end of file
+}
+TEST(Map, PlacementBudget) {
+    MapTest<> test{1, MapMode::Continuous};
+    // Without any budget, every frame places a single bucket, so the placement spans several frames.
+    test.frontend.getRenderer()->setPlacementBudget(Duration::zero());
+
+    test.map.getStyle().loadJSON(
+        R"STYLE({
+                "version": 8,
+                "sources": {
+                    "a": { "type": "geojson", "data": { "type": "Point", "coordinates": [0, 0] } },
+                    "b": { "type": "geojson", "data": { "type": "Point", "coordinates": [0, 0] } },
+                    "c": { "type": "geojson", "data": { "type": "Point", "coordinates": [0, 0] } }
+                },
+                "layers": [
+                    { "id": "a", "type": "symbol", "source": "a",
+                      "layout": { "icon-image": "test-icon", "icon-allow-overlap": true } },
+                    { "id": "b", "type": "symbol", "source": "b",
+                      "layout": { "icon-image": "test-icon", "icon-allow-overlap": true } },
+                    { "id": "c", "type": "symbol", "source": "c",
+                      "layout": { "icon-image": "test-icon", "icon-allow-overlap": true } }
+                ]
+                })STYLE");
+    test.map.getStyle().addImage(std::make_unique<style::Image>(
+        "test-icon", decodeImage(util::read_file("test/fixtures/sprites/default_marker.png")), 1.0));
+    test.map.jumpTo(CameraOptions().withCenter(LatLng{0, 0}).withZoom(1.0));
+
+    unsigned placementChanges = 0;
+    test.observer.didFinishRenderingFrameCallback = [&](MapObserver::RenderFrameStatus status) {
+        if (status.placementChanged) ++placementChanges;
+    };
+    // The map does not become idle while a placement is in progress.
+    test.observer.didBecomeIdleCallback = [&] { test.runLoop.stop(); };
+    test.runLoop.run();
+
+    EXPECT_LT(0u, placementChanges);
+    auto features = test.frontend.getRenderer()->queryRenderedFeatures(test.map.pixelForLatLng({0, 0}));
+    EXPECT_EQ(3u, features.size());
+}
+
+TEST(Map, IncrementalPlacement) {
+    // Pans by a few pixels; the placement taken over still finds the symbol where it is now.
+    auto checkPan = [](const ScreenCoordinate& offset) {
+        MapTest<> test{1, MapMode::Continuous};
+        test.frontend.getRenderer()->setIncrementalPlacement(true);
+
+        test.map.getStyle().loadJSON(
+            R"STYLE({
+                    "version": 8,
+                    "sources": {
+                        "a": { "type": "geojson", "data": { "type": "Point", "coordinates": [0, 0] } }
+                    },
+                    "layers": [
+                        { "id": "a", "type": "symbol", "source": "a", "layout": { "icon-image": "test-icon" } }
+                    ]
+                    })STYLE");
+        test.map.getStyle().addImage(std::make_unique<style::Image>(
+            "test-icon", decodeImage(util::read_file("test/fixtures/sprites/default_marker.png")), 1.0));
+        test.map.jumpTo(CameraOptions().withCenter(LatLng{0, 0}).withZoom(1.0));
+        test.observer.didBecomeIdleCallback = [&] { test.runLoop.stop(); };
+        test.runLoop.run();
+
+        test.map.moveBy(offset);
+        test.runLoop.run();
+
+        const ScreenCoordinate symbol = test.map.pixelForLatLng({0, 0});
+        EXPECT_EQ(1u, test.frontend.getRenderer()->queryRenderedFeatures(symbol).size());
+        EXPECT_EQ(0u,
+                  test.frontend.getRenderer()
+                      ->queryRenderedFeatures(ScreenCoordinate{symbol.x - offset.x, symbol.y - offset.y})
+                      .size());
+    };
+
+    checkPan({30, 30});
+    checkPan({0, 40});
+    checkPan({0, -40});
+}
+
+TEST(Map, ParallelLinePlacement) {
+    // Enough labels along lines for their collision circles to be projected on the helper threads.
+    std::string lines;
+    for (int line = 0; line < 31; ++line) {
+        const int lat = 2 * line - 30;
+        lines += (line ? "," : "") + R"({ "type": "Feature", "properties": { "line": )"s + std::to_string(line) +
+                 R"( }, "geometry": { "type": "LineString", "coordinates": [[-60, )" + std::to_string(lat) +
+                 "], [60, " + std::to_string(lat) + "]] } }";
+    }
+    const std::string style = R"STYLE({
+        "version": 8,
+        "glyphs": "http://example.com/{fontstack}/{range}.pbf",
+        "sources": {
+            "a": { "type": "geojson", "data": { "type": "FeatureCollection", "features": [)STYLE" +
+                              lines + R"STYLE(] } }
+        },
+        "layers": [{
+            "id": "a",
+            "type": "symbol",
+            "source": "a",
+            "layout": { "symbol-placement": "line", "symbol-spacing": 10, "text-field": "x", "text-size": 10 }
+        }]
+    })STYLE";
+
+    struct Result {
+        PremultipliedImage image;
+        std::vector<uint64_t> lines;
+    };
+    auto place = [&](MapMode mode, bool parallel) {
+        MapTest<> test{1, mode};
+        test.fileSource->glyphsResponse = makeResponse("glyphs.pbf");
+        test.frontend.getRenderer()->setParallelPlacement(parallel);
+        test.map.getStyle().loadJSON(style);
+        test.map.jumpTo(CameraOptions().withCenter(LatLng{0, 0}).withZoom(2));
+
+        Result result{test.frontend.render(test.map).image, {}};
+        const Size size = test.frontend.getSize();
+        for (auto& feature : test.frontend.getRenderer()->queryRenderedFeatures(
+                 ScreenBox{{}, {double(size.width), double(size.height)}})) {
+            result.lines.push_back(feature.properties["line"].get<uint64_t>());
+        }
+        std::sort(result.lines.begin(), result.lines.end());
+        return result;
+    };
+
+    for (const MapMode mode : {MapMode::Static, MapMode::Tile}) {
+        const Result parallel = place(mode, true);
+        const Result serial = place(mode, false);
+        EXPECT_FALSE(serial.lines.empty());
+        EXPECT_EQ(serial.lines, parallel.lines);
+        // Identical images mean identical symbol opacities.
+        EXPECT_EQ(serial.image, parallel.image);
+    }
+}
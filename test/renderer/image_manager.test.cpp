@@ -62,6 +62,36 @@ TEST(ImageManager, Update) {
     EXPECT_EQ(0, imageManager.updatedImageVersions.size());
 }
 
+TEST(ImageManager, SharedAtlas) {
+    ImageManager imageManager;
+    SharedImageAtlas& atlas = imageManager.getSharedAtlas();
+
+    Immutable<style::Image::Impl> one = makeMutable<style::Image::Impl>("one", PremultipliedImage({16, 16}), 1);
+    imageManager.addImage(one);
+    const ImageMap icons{{"one", one}};
+
+    auto first = atlas.addImages(icons, {}, {});
+    auto second = atlas.addImages(icons, {}, {});
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(1u, atlas.getImageCount());
+    EXPECT_EQ(first->getIconPositions().at("one").paddedRect, second->getIconPositions().at("one").paddedRect);
+    EXPECT_TRUE(first->getPatternPositions().empty());
+
+    // Updating the image in place rewrites it in the atlas, also for layouts that still have the
+    // previous version.
+    imageManager.updateImage(makeMutable<style::Image::Impl>("one", PremultipliedImage({16, 16}), 1));
+    auto third = atlas.addImages(icons, {}, {});
+    ASSERT_TRUE(third);
+    EXPECT_EQ(1u, third->getIconPositions().at("one").version);
+    EXPECT_EQ(1u, atlas.getImageCount());
+
+    // Patterns are packed separately, with wrapped padding.
+    auto pattern = atlas.addImages({}, icons, {});
+    ASSERT_TRUE(pattern);
+    EXPECT_EQ(2u, atlas.getImageCount());
+}
+
 TEST(ImageManager, RemoveReleasesBinPackRect) {
     FixtureLog log;
     ImageManager imageManager;
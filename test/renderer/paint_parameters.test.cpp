@@ -0,0 +1,88 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/map/transform.hpp>
+#include <mbgl/renderer/paint_parameters.hpp>
+#include <mbgl/tile/tile_id.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+const Size size{512, 512};
+
+optional<std::map<UnwrappedTileID, gfx::ScissorRect>> scissorRects(const CameraOptions& camera,
+                                                                   const std::vector<UnwrappedTileID>& tileIDs) {
+    Transform transform;
+    transform.resize(size);
+    transform.jumpTo(camera);
+    return PaintParameters::computeTileScissorRects(tileIDs, TransformParameters(transform.getState()), size);
+}
+
+// The four tiles of zoom level 1 cover the viewport around 0, 0 from zoom 1 on.
+const std::vector<UnwrappedTileID> quadrants{{1, 0, 0}, {1, 1, 0}, {1, 0, 1}, {1, 1, 1}};
+
+// Checks that the rectangles lie in the framebuffer and tile it without gaps or overlap.
+void checkTiling(const std::map<UnwrappedTileID, gfx::ScissorRect>& rects) {
+    uint64_t area = 0;
+    for (const auto& rect : rects) {
+        EXPECT_GE(rect.second.x, 0);
+        EXPECT_GE(rect.second.y, 0);
+        EXPECT_LE(rect.second.x + int32_t(rect.second.width), int32_t(size.width));
+        EXPECT_LE(rect.second.y + int32_t(rect.second.height), int32_t(size.height));
+        area += uint64_t(rect.second.width) * rect.second.height;
+    }
+    EXPECT_EQ(uint64_t(size.width) * size.height, area);
+
+    for (auto it = rects.begin(); it != rects.end(); ++it) {
+        for (auto other = std::next(it); other != rects.end(); ++other) {
+            const gfx::ScissorRect& a = it->second;
+            const gfx::ScissorRect& b = other->second;
+            const bool disjoint = a.x + int32_t(a.width) <= b.x || b.x + int32_t(b.width) <= a.x ||
+                                  a.y + int32_t(a.height) <= b.y || b.y + int32_t(b.height) <= a.y;
+            EXPECT_TRUE(disjoint);
+        }
+    }
+}
+
+} // namespace
+
+TEST(PaintParameters, TileScissorRectsFractionalZoom) {
+    for (const double zoom : {1.0, 1.3, 1.5, 1.77}) {
+        const auto rects = scissorRects(CameraOptions().withCenter(LatLng{0, 0}).withZoom(zoom), quadrants);
+        ASSERT_TRUE(bool(rects));
+        ASSERT_EQ(quadrants.size(), rects->size());
+        checkTiling(*rects);
+    }
+
+    // An off-center view puts the tile boundary between pixel centers.
+    const auto rects = scissorRects(CameraOptions().withCenter(LatLng{1.234, -2.345}).withZoom(1.41), quadrants);
+    ASSERT_TRUE(bool(rects));
+    checkTiling(*rects);
+}
+
+TEST(PaintParameters, TileScissorRectsRotated) {
+    for (const double bearing : {90.0, 180.0, 270.0}) {
+        const auto rects =
+            scissorRects(CameraOptions().withCenter(LatLng{0, 0}).withZoom(1.3).withBearing(bearing), quadrants);
+        ASSERT_TRUE(bool(rects));
+        checkTiling(*rects);
+    }
+
+    // Tiles that are not axis-aligned rectangles of the framebuffer must be clipped with stencil masks.
+    EXPECT_FALSE(scissorRects(CameraOptions().withCenter(LatLng{0, 0}).withZoom(1.3).withBearing(45), quadrants));
+    EXPECT_FALSE(scissorRects(CameraOptions().withCenter(LatLng{0, 0}).withZoom(1.3).withBearing(0.5), quadrants));
+    EXPECT_FALSE(scissorRects(CameraOptions().withCenter(LatLng{0, 0}).withZoom(1.3).withPitch(30), quadrants));
+}
+
+TEST(PaintParameters, TileScissorRectsOverlap) {
+    const CameraOptions camera = CameraOptions().withCenter(LatLng{0, 0}).withZoom(1.3);
+
+    // A parent tile standing in for a child that is still loading.
+    EXPECT_FALSE(scissorRects(camera, {{1, 0, 0}, {2, 0, 0}, {1, 1, 0}}));
+    EXPECT_FALSE(scissorRects(camera, {{0, 0, 0}, {1, 1, 1}}));
+
+    // Tiles of different zoom levels that do not overlap.
+    const auto rects = scissorRects(camera, {{1, 0, 0}, {2, 2, 0}, {2, 3, 0}, {2, 2, 1}, {2, 3, 1}, {1, 0, 1}, {1, 1, 1}});
+    ASSERT_TRUE(bool(rects));
+    checkTiling(*rects);
+}
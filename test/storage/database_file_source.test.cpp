@@ -2,6 +2,7 @@
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/resource_options.hpp>
 #include <mbgl/test/util.hpp>
+#include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/timer.hpp>
 
@@ -54,4 +55,38 @@ TEST(DatabaseFileSource, VolatileResource) {
         });
     });
     loop.run();
-}
\ No newline at end of file
+}
+
+TEST(DatabaseFileSource, TEST_REQUIRES_WRITE(WriteAheadLogReaders)) {
+    util::RunLoop loop;
+
+    const std::string path = "test/fixtures/offline_database/wal.db";
+    util::deleteFile(path);
+
+    {
+        std::shared_ptr<FileSource> dbfs = FileSourceManager::get()->getFileSource(
+            FileSourceType::Database,
+            ResourceOptions().withCachePath(path).withWriteAheadLog(true).withDatabaseReaderCount(2));
+
+        Resource resource{Resource::Unknown, "http://127.0.0.1:3000/test", {}, Resource::LoadingMethod::CacheOnly};
+        Response response{};
+        response.data = std::make_shared<std::string>("Cached value");
+        std::unique_ptr<mbgl::AsyncRequest> req;
+
+        // Forwarded responses are committed before the callback runs, so readers see them.
+        dbfs->forward(resource, response, [&] {
+            req = dbfs->request(resource, [&](Response res) {
+                req.reset();
+                EXPECT_EQ(nullptr, res.error);
+                ASSERT_TRUE(res.data.get());
+                EXPECT_EQ("Cached value", *res.data);
+                loop.stop();
+            });
+        });
+        loop.run();
+    }
+
+    util::deleteFile(path);
+    util::deleteFile(path + "-wal");
+    util::deleteFile(path + "-shm");
+}
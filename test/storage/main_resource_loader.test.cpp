@@ -6,6 +6,7 @@
 #include <mbgl/storage/online_file_source.hpp>
 #include <mbgl/storage/resource_options.hpp>
 #include <mbgl/storage/resource_transform.hpp>
+#include <mbgl/test/stub_file_source.hpp>
 #include <mbgl/test/util.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/timer.hpp>
@@ -343,6 +344,138 @@ TEST(MainResourceLoader, OptionalExpired) {
     loop.run();
 }
 
+TEST(MainResourceLoader, ResponseCache) {
+    util::RunLoop loop;
+    MainResourceLoader fs(ResourceOptions{});
+
+    const Resource optionalResource{
+        Resource::Unknown, "http://127.0.0.1:3000/response-cache", {}, Resource::LoadingMethod::CacheOnly};
+
+    using namespace std::chrono_literals;
+
+    Response response;
+    response.data = std::make_shared<std::string>("Cached value");
+    response.expires = util::now() + 1h;
+
+    Response updated;
+    updated.data = std::make_shared<std::string>("Updated value");
+    updated.expires = util::now() + 1h;
+
+    std::unique_ptr<AsyncRequest> req;
+    std::shared_ptr<const std::string> firstData;
+    std::shared_ptr<FileSource> dbfs =
+        FileSourceManager::get()->getFileSource(FileSourceType::Database, ResourceOptions{});
+    dbfs->forward(optionalResource, response, [&] {
+        req = fs.request(optionalResource, [&](Response res1) {
+            ASSERT_TRUE(res1.data.get());
+            EXPECT_EQ("Cached value", *res1.data);
+            firstData = res1.data;
+
+            // The second read is served from memory, without reading the database again.
+            dbfs->forward(optionalResource, updated, [&] {
+                req = fs.request(optionalResource, [&](Response res2) {
+                    req.reset();
+                    ASSERT_TRUE(res2.data.get());
+                    EXPECT_EQ("Cached value", *res2.data);
+                    EXPECT_EQ(firstData, res2.data);
+
+                    const auto stats = fs.getResponseCacheStats();
+                    EXPECT_EQ(1u, stats.hits);
+                    EXPECT_EQ(1u, stats.misses);
+                    EXPECT_EQ(1u, stats.entries);
+                    loop.stop();
+                });
+            });
+        });
+    });
+
+    loop.run();
+}
+
+TEST(MainResourceLoader, ResponseCacheClearedWithDatabase) {
+    util::RunLoop loop;
+    MainResourceLoader fs(ResourceOptions{});
+
+    const Resource optionalResource{
+        Resource::Unknown, "http://127.0.0.1:3000/response-cache-cleared", {}, Resource::LoadingMethod::CacheOnly};
+
+    using namespace std::chrono_literals;
+
+    Response response;
+    response.data = std::make_shared<std::string>("Cached value");
+    response.expires = util::now() + 1h;
+
+    std::unique_ptr<AsyncRequest> req;
+    std::shared_ptr<FileSource> fileSource =
+        FileSourceManager::get()->getFileSource(FileSourceType::Database, ResourceOptions{});
+    auto dbfs = std::static_pointer_cast<DatabaseFileSource>(fileSource);
+    dbfs->forward(optionalResource, response, [&] {
+        req = fs.request(optionalResource, [&](Response res1) {
+            ASSERT_TRUE(res1.data.get());
+            EXPECT_EQ("Cached value", *res1.data);
+
+            // Clearing the ambient cache drops the response from memory too, so the next
+            // request misses instead of serving the deleted resource.
+            dbfs->clearAmbientCache([&](std::exception_ptr error) {
+                EXPECT_FALSE(error);
+                loop.invoke([&] {
+                    req = fs.request(optionalResource, [&](Response res2) {
+                        req.reset();
+                        ASSERT_TRUE(res2.error.get());
+                        EXPECT_EQ(Response::Error::Reason::NotFound, res2.error->reason);
+                        EXPECT_FALSE(res2.data);
+
+                        const auto stats = fs.getResponseCacheStats();
+                        EXPECT_EQ(0u, stats.hits);
+                        EXPECT_EQ(2u, stats.misses);
+                        EXPECT_EQ(0u, stats.entries);
+                        loop.stop();
+                    });
+                });
+            });
+        });
+    });
+
+    loop.run();
+}
+
+TEST(MainResourceLoader, CustomDatabaseFileSource) {
+    util::RunLoop loop;
+
+    // A database file source that does not own a memory tier.
+    auto* manager = FileSourceManager::get();
+    auto previousFactory = manager->unRegisterFileSourceFactory(FileSourceType::Database);
+    manager->registerFileSourceFactory(FileSourceType::Database, [](const ResourceOptions&) {
+        auto fileSource = std::make_unique<StubFileSource>();
+        fileSource->response = [](const Resource&) {
+            Response response;
+            response.data = std::make_shared<std::string>("Custom value");
+            return optional<Response>(response);
+        };
+        return fileSource;
+    });
+
+    {
+        MainResourceLoader fs(ResourceOptions{}.withCachePath("test/fixtures/custom_database_file_source"));
+        const Resource optionalResource{
+            Resource::Unknown, "http://127.0.0.1:3000/custom-database", {}, Resource::LoadingMethod::CacheOnly};
+
+        std::unique_ptr<AsyncRequest> req = fs.request(optionalResource, [&](Response res) {
+            ASSERT_TRUE(res.data.get());
+            EXPECT_EQ("Custom value", *res.data);
+            loop.stop();
+        });
+
+        loop.run();
+    }
+
+    if (previousFactory) {
+        manager->registerFileSourceFactory(FileSourceType::Database, std::move(previousFactory));
+    } else {
+        manager->unRegisterFileSourceFactory(FileSourceType::Database);
+    }
+}
+
 TEST(MainResourceLoader, OptionalNotFound) {
     util::RunLoop loop;
     MainResourceLoader fs(ResourceOptions{});
@@ -100,6 +100,25 @@ static int databaseAutoVacuum(const std::string& path) {
     return query.get<int>(0);
 }
 
+static int64_t databaseResourceAccessed(const std::string& path, const std::string& url) {
+    mapbox::sqlite::Database db = mapbox::sqlite::Database::open(path, mapbox::sqlite::ReadOnly);
+    mapbox::sqlite::Statement stmt{db, "SELECT accessed FROM resources WHERE url = ?"};
+    mapbox::sqlite::Query query{stmt};
+    query.bind(1, url);
+    query.run();
+    return query.get<int64_t>(0);
+}
+
+static void setDatabaseResourceAccessed(const std::string& path, const std::string& url, int64_t accessed) {
+    mapbox::sqlite::Database db = mapbox::sqlite::Database::open(path, mapbox::sqlite::ReadWriteCreate);
+    db.setBusyTimeout(Milliseconds::max());
+    mapbox::sqlite::Statement stmt{db, "UPDATE resources SET accessed = ?1 WHERE url = ?2"};
+    mapbox::sqlite::Query query{stmt};
+    query.bind(1, accessed);
+    query.bind(2, url);
+    query.run();
+}
+
 namespace fixture {
 
 const Resource resource{ Resource::Style, "mapbox://test" };
@@ -387,6 +406,35 @@ TEST(OfflineDatabase, PutTile) {
     EXPECT_EQ(0u, log.uncheckedCount());
 }
 
+TEST(OfflineDatabase, FastCompression) {
+    FixtureLog log;
+    OfflineDatabase db(":memory:");
+
+    Response response;
+    response.data = std::make_shared<std::string>(1024, 'x');
+
+    const Resource deflated = Resource::style("http://example.com/deflated");
+    const Resource tile = Resource::tile("http://example.com/{z}/{x}/{y}.pbf", 1, 0, 0, 0, Tileset::Scheme::XYZ);
+    EXPECT_EQ(17u, db.put(deflated, response).second);
+
+    db.setFastCompression(true);
+    const Resource fast = Resource::style("http://example.com/fast");
+    const auto fastSize = db.put(fast, response).second;
+    EXPECT_LT(0u, fastSize);
+    EXPECT_GT(1024u, fastSize);
+    db.put(tile, response);
+
+    // Rows keep the codec they were written with.
+    db.setFastCompression(false);
+    for (const auto& resource : { deflated, fast, tile }) {
+        auto result = db.get(resource);
+        ASSERT_TRUE(result && result->data);
+        EXPECT_EQ(*response.data, *result->data);
+    }
+
+    EXPECT_EQ(0u, log.uncheckedCount());
+}
+
 TEST(OfflineDatabase, PutResourceNoContent) {
     FixtureLog log;
     OfflineDatabase db(":memory:");
@@ -1074,6 +1122,61 @@ TEST(OfflineDatabase, PutEvictsLeastRecentlyUsedResources) {
     EXPECT_EQ(0u, log.uncheckedCount());
 }
 
+TEST(OfflineDatabase, TEST_REQUIRES_WRITE(BatchAccessedUpdates)) {
+    FixtureLog log;
+    deleteDatabaseFiles();
+
+    const std::string url = "http://example.com/style.json";
+    {
+        OfflineDatabase db(filename);
+        db.setBatchAccessedUpdates(true);
+        db.put(Resource::style(url), fixture::response);
+        setDatabaseResourceAccessed(filename, url, 1);
+
+        // Reads are recorded in memory only.
+        EXPECT_TRUE(bool(db.get(Resource::style(url))));
+        EXPECT_EQ(1, databaseResourceAccessed(filename, url));
+
+        // Misses don't record anything.
+        EXPECT_FALSE(bool(db.get(Resource::style("http://example.com/missing.json"))));
+    }
+
+    // Pending timestamps are written when the database is closed.
+    EXPECT_LT(1, databaseResourceAccessed(filename, url));
+
+    EXPECT_EQ(0u, log.uncheckedCount());
+}
+
+TEST(OfflineDatabase, TEST_REQUIRES_WRITE(BatchAccessedUpdatesEvictLeastRecentlyUsed)) {
+    FixtureLog log;
+    deleteDatabaseFiles();
+
+    OfflineDatabase db(filename);
+    db.setBatchAccessedUpdates(true);
+    db.setMaximumAmbientCacheSize(1024 * 100);
+
+    Response response;
+    response.data = randomString(1024);
+
+    for (uint32_t i = 1; i <= 100; ++i) {
+        const std::string url = "http://example.com/"s + util::toString(i);
+        db.put(Resource::style(url), response);
+        setDatabaseResourceAccessed(filename, url, i);
+    }
+
+    // The oldest resource is read, but the new timestamp is still pending.
+    EXPECT_TRUE(bool(db.get(Resource::style("http://example.com/1"))));
+    EXPECT_EQ(1, databaseResourceAccessed(filename, "http://example.com/1"));
+
+    // Eviction must see the pending timestamp and remove other resources instead.
+    db.put(Resource::style("http://example.com/101"), response);
+    EXPECT_TRUE(bool(db.get(Resource::style("http://example.com/1"))));
+    EXPECT_FALSE(bool(db.get(Resource::style("http://example.com/2"))));
+    EXPECT_TRUE(bool(db.get(Resource::style("http://example.com/101"))));
+
+    EXPECT_EQ(0u, log.uncheckedCount());
+}
+
 TEST(OfflineDatabase, OfflineRegionDoesNotAffectAmbientCacheSize) {
     FixtureLog log;
     OfflineDatabase db(":memory:");
@@ -1451,6 +1554,29 @@ TEST(OfflineDatabase, MigrateFromV4Schema) {
 }
 
 
+TEST(OfflineDatabase, TEST_REQUIRES_WRITE(WriteAheadLog)) {
+    FixtureLog log;
+    deleteDatabaseFiles();
+
+    {
+        OfflineDatabase db(filename, true /*writeAheadLog*/);
+        db.put(fixture::resource, fixture::response);
+        EXPECT_EQ("wal", databaseJournalMode(filename));
+
+        // A read-only connection reads committed data while the writer is open.
+        OfflineDatabase reader(filename, true /*writeAheadLog*/, true /*readOnly*/);
+        auto result = reader.get(fixture::resource);
+        ASSERT_TRUE(result && result->data);
+        EXPECT_EQ("first", *result->data);
+    }
+
+    // Opening without a write-ahead log migrates back to the rollback journal.
+    { OfflineDatabase db(filename); }
+    EXPECT_EQ("delete", databaseJournalMode(filename));
+
+    EXPECT_EQ(0u, log.uncheckedCount());
+}
+
 TEST(OfflineDatabase, MigrateFromV5Schema) {
     // v5.db is a v5 database, migrated from v2, v3 & v4.
     FixtureLog log;
@@ -0,0 +1,96 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/storage/resource.hpp>
+#include <mbgl/storage/response_cache.hpp>
+
+using namespace mbgl;
+using namespace std::chrono_literals;
+
+namespace {
+
+Response makeResponse(std::size_t size) {
+    Response response;
+    response.data = std::make_shared<std::string>(size, 'x');
+    return response;
+}
+
+} // namespace
+
+TEST(ResponseCache, SharesData) {
+    ResponseCache cache(1024 * 1024);
+    const Resource resource = Resource::style("http://example.com/style.json");
+    const Response response = makeResponse(100);
+
+    EXPECT_FALSE(cache.get(resource));
+    cache.put(resource, response);
+
+    auto cached = cache.get(resource);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(response.data, cached->data);
+
+    const auto stats = cache.getStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(1u, stats.entries);
+}
+
+TEST(ResponseCache, EvictsLeastRecentlyUsed) {
+    const Resource a = Resource::style("http://example.com/a");
+    const Resource b = Resource::style("http://example.com/b");
+    const Resource c = Resource::style("http://example.com/c");
+
+    // Room for two entries of 1000 bytes.
+    ResponseCache cache(2500);
+    cache.put(a, makeResponse(1000));
+    cache.put(b, makeResponse(1000));
+    EXPECT_TRUE(cache.get(a));
+
+    cache.put(c, makeResponse(1000));
+    EXPECT_TRUE(cache.get(a));
+    EXPECT_FALSE(cache.get(b));
+    EXPECT_TRUE(cache.get(c));
+    EXPECT_EQ(1u, cache.getStats().evictions);
+
+    // Entries larger than the cache are not stored.
+    cache.put(b, makeResponse(5000));
+    EXPECT_FALSE(cache.get(b));
+
+    cache.setMaximumSize(0);
+    EXPECT_EQ(0u, cache.getStats().entries);
+    EXPECT_EQ(0u, cache.getStats().bytes);
+    cache.put(a, makeResponse(10));
+    EXPECT_FALSE(cache.get(a));
+}
+
+TEST(ResponseCache, StoresOnlyUsableResponses) {
+    ResponseCache cache(1024 * 1024);
+    const Resource resource = Resource::style("http://example.com/style.json");
+
+    Response error = makeResponse(10);
+    error.error = std::make_unique<Response::Error>(Response::Error::Reason::Server, "error");
+    cache.put(resource, error);
+    EXPECT_FALSE(cache.get(resource));
+
+    Response noContent;
+    noContent.noContent = true;
+    cache.put(resource, noContent);
+    EXPECT_FALSE(cache.get(resource));
+
+    Response expired = makeResponse(10);
+    expired.mustRevalidate = true;
+    expired.expires = util::now() - 1h;
+    cache.put(resource, expired);
+    EXPECT_FALSE(cache.get(resource));
+
+    Resource volatileResource = resource;
+    volatileResource.storagePolicy = Resource::StoragePolicy::Volatile;
+    cache.put(volatileResource, makeResponse(10));
+    EXPECT_FALSE(cache.get(resource));
+
+    // A 304 leaves nothing to serve from memory.
+    cache.put(resource, makeResponse(10));
+    Response notModified;
+    notModified.notModified = true;
+    cache.put(resource, notModified);
+    EXPECT_FALSE(cache.get(resource));
+}
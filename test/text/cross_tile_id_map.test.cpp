@@ -0,0 +1,101 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/text/cross_tile_id_map.hpp>
+
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+struct ConstValue {
+    ConstValue(int value_) : value(value_) {}
+    const int value;
+};
+
+} // namespace
+
+TEST(CrossTileIDMap, EmplaceFindErase) {
+    CrossTileIDMap<ConstValue> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(nullptr, map.find(1));
+
+    EXPECT_TRUE(map.emplace(1, 10));
+    EXPECT_FALSE(map.emplace(1, 11));
+    ASSERT_NE(nullptr, map.find(1));
+    EXPECT_EQ(10, map.find(1)->value);
+
+    map.set(1, 12);
+    EXPECT_EQ(12, map.find(1)->value);
+    EXPECT_EQ(1u, map.size());
+
+    EXPECT_FALSE(map.contains(2));
+    EXPECT_FALSE(map.erase(2));
+    EXPECT_TRUE(map.erase(1));
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(CrossTileIDMap, SparseIDs) {
+    CrossTileIDMap<uint32_t> map;
+    // Insert above and below the first page, and far apart.
+    const std::vector<uint32_t> ids{5000, 5001, 200, 1000000, 0, 129};
+    for (uint32_t id : ids) {
+        EXPECT_TRUE(map.emplace(id, id * 2));
+    }
+    EXPECT_EQ(ids.size(), map.size());
+    for (uint32_t id : ids) {
+        ASSERT_TRUE(map.contains(id));
+        EXPECT_EQ(id * 2, *map.find(id));
+    }
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_FALSE(map.contains(5002));
+    EXPECT_FALSE(map.contains(2000000));
+
+    std::vector<uint32_t> visited;
+    map.forEach([&](uint32_t id, uint32_t value) {
+        EXPECT_EQ(id * 2, value);
+        visited.push_back(id);
+    });
+    EXPECT_EQ((std::vector<uint32_t>{0, 129, 200, 5000, 5001, 1000000}), visited);
+}
+
+TEST(CrossTileIDMap, ReserveLike) {
+    CrossTileIDMap<int> previous;
+    previous.emplace(300, 1);
+    previous.emplace(700, 2);
+
+    CrossTileIDMap<float> map;
+    map.reserveLike(previous);
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(300));
+
+    map.emplace(100, 1.0f);
+    map.emplace(700, 2.0f);
+    map.emplace(900, 3.0f);
+    EXPECT_EQ(3u, map.size());
+    EXPECT_EQ(1.0f, *map.find(100));
+    EXPECT_EQ(2.0f, *map.find(700));
+    EXPECT_EQ(3.0f, *map.find(900));
+}
+
+TEST(CrossTileIDMap, Copy) {
+    CrossTileIDMap<int> map;
+    map.emplace(3, 1);
+    map.emplace(400, 2);
+
+    CrossTileIDMap<int> copy(map);
+    copy.set(3, 5);
+    copy.erase(400);
+    copy.emplace(10, 6);
+
+    EXPECT_EQ(2u, map.size());
+    EXPECT_EQ(1, *map.find(3));
+    EXPECT_EQ(2, *map.find(400));
+    EXPECT_FALSE(map.contains(10));
+
+    map = copy;
+    EXPECT_EQ(2u, map.size());
+    EXPECT_EQ(5, *map.find(3));
+    EXPECT_EQ(6, *map.find(10));
+    EXPECT_FALSE(map.contains(400));
+}
@@ -417,3 +417,74 @@ TEST(CrossTileSymbolLayerIndex, offscreenSymbols) {
     EXPECT_EQ(symbolBucket.symbolInstances.at(0).crossTileID, 1u);
     EXPECT_EQ(symbolBucket.symbolInstances.at(1).crossTileID, 2u);
 }
+
+TEST(CrossTileSymbolLayerIndex, manySymbolsWithSameKey) {
+    uint32_t maxCrossTileID = 0;
+    uint32_t maxBucketInstanceId = 0;
+    CrossTileSymbolLayerIndex index(maxCrossTileID);
+
+    Immutable<style::SymbolLayoutProperties::PossiblyEvaluated> layout =
+        makeMutable<style::SymbolLayoutProperties::PossiblyEvaluated>();
+    bool iconsNeedLinear = false;
+    bool sortFeaturesByY = false;
+    std::string bucketLeaderID = "test";
+    const std::size_t count = 50;
+
+    OverscaledTileID mainID(6, 0, 6, 8, 8);
+    std::vector<SymbolInstance> mainInstances;
+    std::vector<SortKeyRange> mainRanges;
+    for (std::size_t i = 0; i < count; ++i) {
+        const float position = 100.0f + 80.0f * i;
+        mainInstances.push_back(makeSymbolInstance(position, position, u"Main Street"));
+    }
+    SymbolBucket mainBucket{layout,
+                            {},
+                            16.0f,
+                            1.0f,
+                            0,
+                            iconsNeedLinear,
+                            sortFeaturesByY,
+                            bucketLeaderID,
+                            std::move(mainInstances),
+                            std::move(mainRanges),
+                            1.0f,
+                            false,
+                            {},
+                            false /*iconsInText*/};
+    mainBucket.bucketInstanceId = ++maxBucketInstanceId;
+    index.addBucket(mainID, mat4{}, mainBucket);
+
+    // The same symbols in reverse order, moved by less than a grid unit so that some
+    // of them end up in the neighbouring cells of the index.
+    OverscaledTileID childID(7, 0, 7, 16, 16);
+    std::vector<SymbolInstance> childInstances;
+    std::vector<SortKeyRange> childRanges;
+    for (std::size_t i = count; i-- > 0;) {
+        const float position = 2.0f * (100.0f + 80.0f * i) + 40.0f;
+        childInstances.push_back(makeSymbolInstance(position, position, u"Main Street"));
+    }
+    childInstances.push_back(makeSymbolInstance(9000, 9000, u"Main Street"));
+    SymbolBucket childBucket{layout,
+                             {},
+                             16.0f,
+                             1.0f,
+                             0,
+                             iconsNeedLinear,
+                             sortFeaturesByY,
+                             bucketLeaderID,
+                             std::move(childInstances),
+                             std::move(childRanges),
+                             1.0f,
+                             false,
+                             {},
+                             false /*iconsInText*/};
+    childBucket.bucketInstanceId = ++maxBucketInstanceId;
+    index.addBucket(childID, mat4{}, childBucket);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(childBucket.symbolInstances.at(count - 1 - i).crossTileID,
+                  mainBucket.symbolInstances.at(i).crossTileID);
+    }
+    // does not match because of different location
+    EXPECT_EQ(childBucket.symbolInstances.at(count).crossTileID, count + 1);
+}
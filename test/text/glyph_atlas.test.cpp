@@ -0,0 +1,88 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/text/glyph_atlas.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+Immutable<Glyph> makeGlyph(GlyphID id, uint32_t size) {
+    Glyph glyph;
+    glyph.id = id;
+    glyph.bitmap = AlphaImage({size, size});
+    glyph.metrics.width = size;
+    glyph.metrics.height = size;
+    glyph.metrics.advance = size;
+    return Immutable<Glyph>(makeMutable<Glyph>(std::move(glyph)));
+}
+
+} // namespace
+
+TEST(SharedGlyphAtlas, SharesGlyphs) {
+    SharedGlyphAtlas atlas;
+    const FontStackHash fontStack = FontStackHasher()({"font-stack"});
+    const GlyphMap glyphs{{fontStack, {{u'a', makeGlyph(u'a', 10)}, {u' ', nullopt}}}};
+
+    auto first = atlas.addGlyphs(glyphs);
+    auto second = atlas.addGlyphs(glyphs);
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(1u, atlas.getGlyphCount());
+
+    const GlyphPosition& position = first->getPositions().at(fontStack).at(u'a');
+    EXPECT_EQ(position.rect, second->getPositions().at(fontStack).at(u'a').rect);
+    EXPECT_EQ(12, position.rect.w);
+    EXPECT_EQ(0u, first->getPositions().at(fontStack).count(u' '));
+
+    // Unreferenced glyphs stay in the atlas until it runs out of space.
+    first.reset();
+    second.reset();
+    EXPECT_EQ(1u, atlas.getGlyphCount());
+}
+
+TEST(SharedGlyphAtlas, EvictsUnreferencedGlyphs) {
+    SharedGlyphAtlas atlas(128);
+    const FontStackHash fontStack = FontStackHasher()({"font-stack"});
+    const GlyphMap full{
+        {fontStack,
+         {{u'a', makeGlyph(u'a', 60)}, {u'b', makeGlyph(u'b', 60)}, {u'c', makeGlyph(u'c', 60)}, {u'd', makeGlyph(u'd', 60)}}}};
+    const GlyphMap other{{fontStack, {{u'e', makeGlyph(u'e', 60)}}}};
+
+    auto first = atlas.addGlyphs(full);
+    ASSERT_TRUE(first);
+    EXPECT_EQ(Size(128, 128), atlas.getPixelSize());
+
+    // The atlas is full, and every glyph in it is in use.
+    EXPECT_FALSE(atlas.addGlyphs(other));
+    EXPECT_EQ(4u, atlas.getGlyphCount());
+
+    first.reset();
+    auto second = atlas.addGlyphs(other);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(1u, atlas.getGlyphCount());
+}
+
+TEST(SharedGlyphAtlas, Clear) {
+    SharedGlyphAtlas atlas;
+    const FontStackHash fontStack = FontStackHasher()({"font-stack"});
+    const GlyphMap large{{fontStack, {{u'a', makeGlyph(u'a', 200)}}}};
+    const GlyphMap small{{fontStack, {{u'b', makeGlyph(u'b', 10)}}}};
+
+    auto first = atlas.addGlyphs(large);
+    auto second = atlas.addGlyphs(small);
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(Size(256, 256), atlas.getPixelSize());
+
+    // Referenced glyphs are kept where they are.
+    first.reset();
+    atlas.clear();
+    EXPECT_EQ(1u, atlas.getGlyphCount());
+    EXPECT_EQ(Size(256, 256), atlas.getPixelSize());
+
+    second.reset();
+    atlas.clear();
+    EXPECT_EQ(0u, atlas.getGlyphCount());
+    EXPECT_EQ(Size(128, 128), atlas.getPixelSize());
+    EXPECT_TRUE(atlas.addGlyphs(small));
+}
@@ -6,6 +6,9 @@
 #include <mbgl/text/shaping.hpp>
 #include <mbgl/util/constants.hpp>
 
+#include <atomic>
+#include <memory>
+
 using namespace mbgl;
 using namespace util;
 
@@ -104,4 +107,28 @@ TEST(Shaping, ZWSP) {
         ASSERT_EQ(shaping.right, 0);
         ASSERT_EQ(shaping.writingMode, WritingModeType::Horizontal);
     }
+
+    // Cancelled layout is not shaped.
+    {
+        auto cancelled = std::make_shared<std::atomic<bool>>(true);
+        TaggedString string(u"中中\u200b", sectionOptions);
+        auto shaping = getShaping(string,
+                                  2 * ONE_EM,
+                                  ONE_EM, // lineHeight
+                                  style::SymbolAnchorType::Center,
+                                  style::TextJustifyType::Center,
+                                  0,              // spacing
+                                  {{0.0f, 0.0f}}, // translate
+                                  WritingModeType::Horizontal,
+                                  bidi,
+                                  glyphs,
+                                  glyphPositions,
+                                  imagePositions,
+                                  layoutTextSize,
+                                  layoutTextSizeAtBucketZoomLevel,
+                                  /*allowVerticalPlacement*/ false,
+                                  CancellationToken(cancelled));
+        ASSERT_FALSE(shaping);
+        ASSERT_TRUE(shaping.positionedLines.empty());
+    }
 }
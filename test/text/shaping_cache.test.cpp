@@ -0,0 +1,123 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/text/bidi.hpp>
+#include <mbgl/text/shaping_cache.hpp>
+#include <mbgl/text/tagged_string.hpp>
+#include <mbgl/util/constants.hpp>
+
+using namespace mbgl;
+using namespace util;
+
+namespace {
+
+struct ShapingCacheTest {
+    ShapingCacheTest() {
+        GlyphPosition glyphPosition;
+        glyphPosition.rect = {1, 2, 24, 24};
+        glyphPosition.metrics.width = 18;
+        glyphPosition.metrics.height = 18;
+        glyphPosition.metrics.left = 2;
+        glyphPosition.metrics.top = -8;
+        glyphPosition.metrics.advance = 21;
+
+        Glyph glyph;
+        glyph.id = u'中';
+        glyph.metrics = glyphPosition.metrics;
+
+        glyphs = {{FontStackHasher()(fontStack), {{u'中', Immutable<Glyph>(makeMutable<Glyph>(std::move(glyph)))}}}};
+        glyphPositions = {{FontStackHasher()(fontStack), {{u'中', glyphPosition}}}};
+    }
+
+    Shaping shape(ShapingCache& cache, const TaggedString& string, float maxWidth) {
+        return cache.getShaping(string,
+                                maxWidth,
+                                ONE_EM, // lineHeight
+                                style::SymbolAnchorType::Center,
+                                style::TextJustifyType::Center,
+                                0,              // spacing
+                                {{0.0f, 0.0f}}, // translate
+                                WritingModeType::Horizontal,
+                                bidi,
+                                glyphs,
+                                glyphPositions,
+                                imagePositions,
+                                16.0f,
+                                16.0f,
+                                /*allowVerticalPlacement*/ false);
+    }
+
+    const FontStack fontStack{{"font-stack"}};
+    BiDi bidi;
+    GlyphMap glyphs;
+    GlyphPositions glyphPositions;
+    ImagePositions imagePositions;
+};
+
+} // namespace
+
+TEST(ShapingCache, Hit) {
+    ShapingCacheTest test;
+    ShapingCache cache(16);
+    const TaggedString string(u"中中\u200b中", SectionOptions(1.0f, test.fontStack));
+
+    const Shaping first = test.shape(cache, string, ONE_EM);
+    const Shaping second = test.shape(cache, string, ONE_EM);
+    EXPECT_EQ(1u, cache.getStats().hits);
+    EXPECT_EQ(1u, cache.getStats().misses);
+
+    ASSERT_EQ(first.positionedLines.size(), second.positionedLines.size());
+    EXPECT_EQ(first.top, second.top);
+    EXPECT_EQ(first.bottom, second.bottom);
+    EXPECT_EQ(first.left, second.left);
+    EXPECT_EQ(first.right, second.right);
+
+    // A different max width is shaped separately.
+    test.shape(cache, string, 5 * ONE_EM);
+    EXPECT_EQ(2u, cache.getStats().misses);
+    EXPECT_EQ(2u, cache.getStats().size);
+}
+
+TEST(ShapingCache, RebindsAtlasPositions) {
+    ShapingCacheTest test;
+    ShapingCache cache(16);
+    const TaggedString string(u"中中", SectionOptions(1.0f, test.fontStack));
+    test.shape(cache, string, 0);
+
+    // Another tile packs the same glyph elsewhere in its atlas.
+    auto& position = test.glyphPositions[FontStackHasher()(test.fontStack)][u'中'];
+    position.rect = {30, 40, 24, 24};
+    const Shaping shaping = test.shape(cache, string, 0);
+    EXPECT_EQ(1u, cache.getStats().hits);
+    ASSERT_EQ(1u, shaping.positionedLines.size());
+    for (const auto& glyph : shaping.positionedLines[0].positionedGlyphs) {
+        EXPECT_EQ(position.rect, glyph.rect);
+    }
+
+    // Different glyph metrics make a different key.
+    position.metrics.advance = 24;
+    Glyph glyph;
+    glyph.id = u'中';
+    glyph.metrics = position.metrics;
+    test.glyphs[FontStackHasher()(test.fontStack)][u'中'] = Immutable<Glyph>(makeMutable<Glyph>(std::move(glyph)));
+    test.shape(cache, string, 0);
+    EXPECT_EQ(2u, cache.getStats().misses);
+}
+
+TEST(ShapingCache, EvictsLeastRecentlyUsed) {
+    ShapingCacheTest test;
+    ShapingCache cache(2);
+    const TaggedString a(u"中", SectionOptions(1.0f, test.fontStack));
+    const TaggedString b(u"中中", SectionOptions(1.0f, test.fontStack));
+    const TaggedString c(u"中中中", SectionOptions(1.0f, test.fontStack));
+
+    test.shape(cache, a, 0);
+    test.shape(cache, b, 0);
+    test.shape(cache, a, 0);
+    test.shape(cache, c, 0);
+    EXPECT_EQ(2u, cache.getStats().size);
+
+    test.shape(cache, a, 0);
+    EXPECT_EQ(2u, cache.getStats().hits);
+    test.shape(cache, b, 0);
+    EXPECT_EQ(4u, cache.getStats().misses);
+}
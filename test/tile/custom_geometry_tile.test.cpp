@@ -14,6 +14,8 @@
 #include <mbgl/annotation/annotation_manager.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/text/glyph_atlas.hpp>
+#include <mbgl/tile/tile_cache.hpp>
 
 #include <memory>
 
@@ -29,6 +31,8 @@ public:
     AnnotationManager annotationManager { style };
     ImageManager imageManager;
     GlyphManager glyphManager;
+    TileCache tileCache;
+    SharedGlyphAtlas glyphAtlas;
 
     TileParameters tileParameters{1.0,
                                   MapDebugOptions(),
@@ -38,7 +42,9 @@ public:
                                   annotationManager.makeWeakPtr(),
                                   imageManager,
                                   glyphManager,
-                                  0};
+                                  0,
+                                  tileCache,
+                                  glyphAtlas};
 };
 
 TEST(CustomGeometryTile, InvokeFetchTile) {
@@ -13,6 +13,8 @@
 #include <mbgl/style/sources/geojson_source.hpp>
 #include <mbgl/style/style.hpp>
 #include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/text/glyph_atlas.hpp>
+#include <mbgl/tile/tile_cache.hpp>
 #include <mbgl/util/run_loop.hpp>
 
 #include <memory>
@@ -29,6 +31,8 @@ public:
     AnnotationManager annotationManager { style };
     ImageManager imageManager;
     GlyphManager glyphManager;
+    TileCache tileCache;
+    SharedGlyphAtlas glyphAtlas;
     Tileset tileset { { "https://example.com" }, { 0, 22 }, "none" };
 
     TileParameters tileParameters{1.0,
@@ -39,7 +43,9 @@ public:
                                   annotationManager.makeWeakPtr(),
                                   imageManager,
                                   glyphManager,
-                                  0};
+                                  0,
+                                  tileCache,
+                                  glyphAtlas};
 };
 
 namespace {
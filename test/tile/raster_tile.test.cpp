@@ -11,6 +11,8 @@
 #include <mbgl/renderer/buckets/raster_bucket.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/text/glyph_atlas.hpp>
+#include <mbgl/tile/tile_cache.hpp>
 
 using namespace mbgl;
 
@@ -23,6 +25,8 @@ public:
     AnnotationManager annotationManager { style };
     ImageManager imageManager;
     GlyphManager glyphManager;
+    TileCache tileCache;
+    SharedGlyphAtlas glyphAtlas;
     Tileset tileset { { "https://example.com" }, { 0, 22 }, "none" };
 
     TileParameters tileParameters{1.0,
@@ -33,7 +37,9 @@ public:
                                   annotationManager.makeWeakPtr(),
                                   imageManager,
                                   glyphManager,
-                                  0};
+                                  0,
+                                  tileCache,
+                                  glyphAtlas};
 };
 
 TEST(RasterTile, setError) {
@@ -1,5 +1,6 @@
 #include <mbgl/test/util.hpp>
 
+#include <mbgl/text/glyph_atlas.hpp>
 #include <mbgl/tile/tile_cache.hpp>
 
 #include <mbgl/test/fake_file_source.hpp>
@@ -13,6 +14,7 @@
 #include <mbgl/renderer/buckets/symbol_bucket.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/renderer/query.hpp>
+#include <mbgl/renderer/renderer.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
 #include <mbgl/style/layers/symbol_layer.hpp>
 #include <mbgl/style/style.hpp>
@@ -32,6 +34,8 @@ public:
     AnnotationManager annotationManager{style};
     ImageManager imageManager;
     GlyphManager glyphManager;
+    TileCache tileCache;
+    SharedGlyphAtlas glyphAtlas;
     Tileset tileset{{"https://example.com"}, {0, 22}, "none"};
 
     TileParameters tileParameters{1.0,
@@ -42,7 +46,9 @@ public:
                                   annotationManager.makeWeakPtr(),
                                   imageManager,
                                   glyphManager,
-                                  0};
+                                  0,
+                                  tileCache,
+                                  glyphAtlas};
 };
 
 class VectorTileMock : public VectorTile {
@@ -85,3 +91,142 @@ TEST(TileCache, Issue15926) {
     EXPECT_FALSE(cache.has(id0));
     EXPECT_TRUE(cache.has(id1));
 }
+
+class SizedTileMock : public VectorTileMock {
+public:
+    SizedTileMock(const OverscaledTileID& id_, const TileParameters& parameters, const Tileset& tileset, size_t bytes_)
+        : VectorTileMock(id_, "source", parameters, tileset), bytes(bytes_) {}
+
+    size_t getMemoryUsage() const override { return bytes; }
+
+private:
+    const size_t bytes;
+};
+
+TEST(TileCache, EvictsOldestFirst) {
+    VectorTileTest test;
+    TileCache cache(2);
+    OverscaledTileID id0(1, 0, 0);
+    OverscaledTileID id1(1, 1, 0);
+    OverscaledTileID id2(1, 0, 1);
+
+    cache.add(id0, std::make_unique<VectorTileMock>(id0, "source", test.tileParameters, test.tileset));
+    cache.add(id1, std::make_unique<VectorTileMock>(id1, "source", test.tileParameters, test.tileset));
+    // Re-adding marks the tile as newest.
+    cache.add(id0, std::make_unique<VectorTileMock>(id0, "source", test.tileParameters, test.tileset));
+    cache.add(id2, std::make_unique<VectorTileMock>(id2, "source", test.tileParameters, test.tileset));
+
+    EXPECT_TRUE(cache.has(id0));
+    EXPECT_FALSE(cache.has(id1));
+    EXPECT_TRUE(cache.has(id2));
+
+    EXPECT_TRUE(cache.pop(id0));
+    EXPECT_FALSE(cache.has(id0));
+    EXPECT_FALSE(cache.pop(id0));
+}
+
+TEST(TileCache, MemoryBudget) {
+    VectorTileTest test;
+    TileCache cache(10);
+    cache.setMemoryBudget(1000);
+    OverscaledTileID id0(1, 0, 0);
+    OverscaledTileID id1(1, 1, 0);
+    OverscaledTileID id2(1, 0, 1);
+
+    cache.add(id0, std::make_unique<SizedTileMock>(id0, test.tileParameters, test.tileset, 600));
+    cache.add(id1, std::make_unique<SizedTileMock>(id1, test.tileParameters, test.tileset, 300));
+    EXPECT_EQ(900u, cache.getMemoryUsage());
+
+    // Adding a tile over budget evicts the oldest tiles until it fits.
+    cache.add(id2, std::make_unique<SizedTileMock>(id2, test.tileParameters, test.tileset, 200));
+    EXPECT_FALSE(cache.has(id0));
+    EXPECT_TRUE(cache.has(id1));
+    EXPECT_TRUE(cache.has(id2));
+    EXPECT_EQ(500u, cache.getMemoryUsage());
+
+    cache.pop(id1);
+    EXPECT_EQ(200u, cache.getMemoryUsage());
+
+    // Lowering the budget evicts immediately.
+    cache.setMemoryBudget(100);
+    EXPECT_FALSE(cache.has(id2));
+    EXPECT_EQ(0u, cache.getMemoryUsage());
+}
+
+TEST(TileCache, MemoryBudgetKeepsCountLimit) {
+    VectorTileTest test;
+    TileCache cache(2);
+    cache.setMemoryBudget(1000);
+    OverscaledTileID id0(1, 0, 0);
+    OverscaledTileID id1(1, 1, 0);
+    OverscaledTileID id2(1, 0, 1);
+
+    // Tiles that hold no memory are still bounded by the tile count.
+    cache.add(id0, std::make_unique<SizedTileMock>(id0, test.tileParameters, test.tileset, 0));
+    cache.add(id1, std::make_unique<SizedTileMock>(id1, test.tileParameters, test.tileset, 0));
+    cache.add(id2, std::make_unique<SizedTileMock>(id2, test.tileParameters, test.tileset, 0));
+    EXPECT_FALSE(cache.has(id0));
+    EXPECT_TRUE(cache.has(id1));
+    EXPECT_TRUE(cache.has(id2));
+    EXPECT_EQ(2u, cache.getStats().tiles);
+    EXPECT_EQ(1u, cache.getStats().evictions);
+}
+
+TEST(TileCache, ReloadCost) {
+    VectorTileTest test;
+    TileCache cache(10);
+    cache.setMemoryBudget(8192);
+    OverscaledTileID id0(1, 0, 0);
+    OverscaledTileID id1(1, 1, 0);
+    OverscaledTileID id2(1, 0, 1);
+
+    auto network = std::make_unique<SizedTileMock>(id0, test.tileParameters, test.tileset, 4096);
+    network->setReloadCost(TileReloadCost::Network);
+    cache.add(id0, std::move(network));
+    auto disk = std::make_unique<SizedTileMock>(id1, test.tileParameters, test.tileset, 4096);
+    disk->setReloadCost(TileReloadCost::Disk);
+    cache.add(id1, std::move(disk));
+
+    // The disk tile is the cheapest to reload per byte, so it goes first even though it isn't the oldest.
+    auto small = std::make_unique<SizedTileMock>(id2, test.tileParameters, test.tileset, 2048);
+    small->setReloadCost(TileReloadCost::Network);
+    cache.add(id2, std::move(small));
+    EXPECT_TRUE(cache.has(id0));
+    EXPECT_FALSE(cache.has(id1));
+    EXPECT_TRUE(cache.has(id2));
+
+    const TileCacheStats stats = cache.getStats();
+    EXPECT_EQ(2u, stats.tiles);
+    EXPECT_EQ(6144u, stats.memoryUsage);
+    EXPECT_EQ(1u, stats.evictions);
+}
+
+TEST(TileCache, Owners) {
+    VectorTileTest test;
+    TileCache cache;
+    int source0 = 0, source1 = 0;
+    OverscaledTileID id(0, 0, 0);
+
+    cache.setSize(1, &source0);
+    cache.setSize(1, &source1);
+    EXPECT_EQ(2u, cache.getSize());
+
+    // Each source only sees its own tiles, but they share one limit.
+    cache.add(id, std::make_unique<VectorTileMock>(id, "source0", test.tileParameters, test.tileset), &source0);
+    EXPECT_TRUE(cache.has(id, &source0));
+    EXPECT_FALSE(cache.has(id, &source1));
+    cache.add(id, std::make_unique<VectorTileMock>(id, "source1", test.tileParameters, test.tileset), &source1);
+    EXPECT_TRUE(cache.has(id, &source0));
+    EXPECT_TRUE(cache.has(id, &source1));
+
+    cache.clear(&source0);
+    EXPECT_FALSE(cache.has(id, &source0));
+    EXPECT_TRUE(cache.has(id, &source1));
+
+    cache.setSize(0, &source1);
+    EXPECT_EQ(1u, cache.getSize());
+    EXPECT_FALSE(cache.pop(id, &source0));
+    EXPECT_TRUE(cache.pop(id, &source1));
+    EXPECT_EQ(1u, cache.getStats().hits);
+    EXPECT_EQ(1u, cache.getStats().misses);
+}
@@ -15,6 +15,8 @@
 #include <mbgl/annotation/annotation_manager.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/text/glyph_atlas.hpp>
+#include <mbgl/tile/tile_cache.hpp>
 
 #include <memory>
 
@@ -29,6 +31,8 @@ public:
     AnnotationManager annotationManager { style };
     ImageManager imageManager;
     GlyphManager glyphManager;
+    TileCache tileCache;
+    SharedGlyphAtlas glyphAtlas;
     Tileset tileset { { "https://example.com" }, { 0, 22 }, "none" };
 
     TileParameters tileParameters{1.0,
@@ -39,7 +43,9 @@ public:
                                   annotationManager.makeWeakPtr(),
                                   imageManager,
                                   glyphManager,
-                                  0};
+                                  0,
+                                  tileCache,
+                                  glyphAtlas};
 };
 
 TEST(VectorTile, setError) {
@@ -104,3 +110,31 @@ TEST(VectorTileData, ParseResults) {
 
     ASSERT_EQ(feature->getValue("invalid"), nullopt);
 }
+
+TEST(VectorTileData, DecodesFeaturesOnce) {
+    VectorTileData data(std::make_shared<std::string>(util::read_file("test/fixtures/map/issue12432/0-0-0.mvt")));
+
+    // Layers and features obtained separately share the decoded feature data.
+    std::unique_ptr<GeometryTileFeature> first = data.getLayer("admin")->getFeature(0u);
+    std::unique_ptr<GeometryTileFeature> second = data.getLayer("admin")->getFeature(0u);
+    ASSERT_EQ(&first->getGeometries(), &second->getGeometries());
+    ASSERT_EQ(&first->getProperties(), &second->getProperties());
+
+    // The shared data outlives the layer objects.
+    ASSERT_EQ(first->getID().get<uint64_t>(), 1u);
+    ASSERT_EQ(first->getProperties().size(), 3u);
+
+    // Clones decode independently so that they can be used on another thread.
+    std::unique_ptr<GeometryTileData> clone = data.clone();
+    std::unique_ptr<GeometryTileFeature> cloned = clone->getLayer("admin")->getFeature(0u);
+    ASSERT_NE(&first->getGeometries(), &cloned->getGeometries());
+    ASSERT_TRUE(first->getGeometries() == cloned->getGeometries());
+
+    // The tile data doesn't keep decoded features alive by itself; they are decoded again once
+    // every layer and feature using them is gone.
+    first.reset();
+    second.reset();
+    std::unique_ptr<GeometryTileFeature> again = data.getLayer("admin")->getFeature(0u);
+    ASSERT_EQ(again->getID().get<uint64_t>(), 1u);
+    ASSERT_TRUE(again->getGeometries() == cloned->getGeometries());
+}
@@ -0,0 +1,87 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/compression.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/lz4.hpp>
+
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+std::vector<std::string> samples() {
+    std::mt19937 random;
+    std::string noise(70000, 0);
+    for (auto& c : noise) {
+        c = static_cast<char>(random());
+    }
+
+    return {
+        "",
+        "a",
+        "abcdefghijkl",
+        std::string(100000, 'x'),
+        noise,
+        util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf"),
+    };
+}
+
+} // namespace
+
+TEST(Compression, Deflate) {
+    for (const auto& sample : samples()) {
+        EXPECT_EQ(sample, util::decompress(util::compress(sample)));
+    }
+
+    EXPECT_THROW(util::decompress("not compressed"), std::runtime_error);
+}
+
+TEST(Compression, DeflateConcurrent) {
+    const auto inputs = samples();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < 10; ++j) {
+                for (const auto& sample : inputs) {
+                    EXPECT_EQ(sample, util::decompress(util::compress(sample)));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+TEST(Compression, LZ4) {
+    for (const auto& sample : samples()) {
+        const std::string compressed = util::lz4::compress(sample);
+        EXPECT_EQ(sample, util::lz4::decompress(compressed));
+    }
+
+    // Repetitive input compresses.
+    EXPECT_GT(1000u, util::lz4::compress(std::string(100000, 'x')).size());
+
+    const std::string compressed = util::lz4::compress(std::string(1000, 'x'));
+    EXPECT_THROW(util::lz4::decompress(""), std::runtime_error);
+    EXPECT_THROW(util::lz4::decompress(compressed.substr(0, compressed.size() - 1)), std::runtime_error);
+
+    // A size that doesn't match the content is rejected.
+    std::string wrongSize = compressed;
+    wrongSize[0] = static_cast<char>(wrongSize[0] + 1);
+    EXPECT_THROW(util::lz4::decompress(wrongSize), std::runtime_error);
+
+    // A size that the block cannot decode to is rejected before it is allocated.
+    std::string hugeSize = compressed;
+    hugeSize.replace(0, 4, "\xff\xff\xff\xff");
+    EXPECT_THROW(util::lz4::decompress(hugeSize), std::runtime_error);
+
+    // The most compressible input still decodes.
+    const std::string zeros(1 << 20, '\0');
+    EXPECT_EQ(zeros, util::lz4::decompress(util::lz4::compress(zeros)));
+}
@@ -56,3 +56,28 @@ TEST(GridIndex, IndexesFeaturesOverflow) {
     grid.insert(0, {{4500, 4500}, {4900, 4900}});
     EXPECT_EQ(grid.query({{4000, 4000}, {5000, 5000}}), (std::vector<int16_t>{0}));
 }
+
+TEST(GridIndex, Visit) {
+    using BBox = GridIndex<int16_t>::BBox;
+    using BCircle = GridIndex<int16_t>::BCircle;
+    GridIndex<int16_t> grid(100, 100, 10);
+    grid.insert(0, {{5, 5}, {45, 45}});
+    grid.insert(1, {{30, 30}, 10});
+    grid.insert(2, {{80, 80}, {90, 90}});
+
+    // Elements spanning several cells are visited once.
+    std::vector<int16_t> visited;
+    EXPECT_FALSE(grid.visit(BBox{{0, 0}, {50, 50}}, [&](int16_t value, const BBox&) {
+        visited.push_back(value);
+        return false;
+    }));
+    EXPECT_EQ(visited, (std::vector<int16_t>{0, 1}));
+
+    // The visitor stops the query by returning true.
+    visited.clear();
+    EXPECT_TRUE(grid.visit(BCircle{{30, 30}, 20}, [&](int16_t value, const BBox&) {
+        visited.push_back(value);
+        return true;
+    }));
+    EXPECT_EQ(visited, (std::vector<int16_t>{0}));
+}
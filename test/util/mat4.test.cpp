@@ -0,0 +1,67 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/mat4.hpp>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+void expectSameAsTransformMat4(const mat4& m, const std::vector<Point<float>>& points) {
+    std::vector<vec4> batched(points.size());
+    matrix::transformPoints(batched.data(), points.data(), points.size(), m);
+
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        vec4 single;
+        matrix::transformMat4(single, vec4{{points[i].x, points[i].y, 0, 1}}, m);
+        // Compared bit for bit, so that e.g. -0 and 0 are told apart.
+        EXPECT_EQ(0, std::memcmp(single.data(), batched[i].data(), sizeof(vec4)))
+            << "point " << points[i].x << ", " << points[i].y;
+    }
+}
+
+} // namespace
+
+TEST(Mat4, TransformPointsMatchesTransformMat4) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> element(-1000.0, 1000.0);
+    std::uniform_real_distribution<float> coordinate(-8192.0f, 8192.0f);
+
+    std::vector<Point<float>> points{{0, 0}, {-0.0f, 0}, {1, -1}, {8192, 8192}, {-8192, 8192}};
+    for (int i = 0; i < 100; ++i) {
+        points.emplace_back(coordinate(generator), coordinate(generator));
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        mat4 m;
+        for (double& value : m) {
+            value = element(generator);
+        }
+        // Random matrices put many points at w <= 0; this one puts all of them there.
+        if (i == 0) {
+            m[3] = m[7] = 0;
+            m[15] = -1;
+        }
+        expectSameAsTransformMat4(m, points);
+    }
+
+    // Points behind the camera of a perspective projection.
+    mat4 projection;
+    matrix::perspective(projection, M_PI / 4, 1.0, 1.0, 100.0);
+    mat4 view;
+    matrix::identity(view);
+    matrix::translate(view, view, 0, 0, -1000);
+    matrix::rotate_x(view, view, M_PI / 3);
+    mat4 m;
+    matrix::multiply(m, projection, view);
+    expectSameAsTransformMat4(m, points);
+}
+
+TEST(Mat4, TransformPointsEmpty) {
+    mat4 m;
+    matrix::identity(m);
+    matrix::transformPoints(nullptr, nullptr, 0, m);
+}
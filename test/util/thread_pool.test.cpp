@@ -0,0 +1,159 @@
+#include <mbgl/util/thread_pool.hpp>
+
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/platform/settings.hpp>
+#include <mbgl/test/util.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace mbgl;
+
+TEST(ThreadPool, ExternalTasks) {
+    ThreadPool pool(4);
+    EXPECT_EQ(4u, pool.getThreadCount());
+
+    constexpr int count = 10000;
+    std::atomic<int> executed{0};
+    std::promise<void> done;
+    for (int i = 0; i < count; ++i) {
+        pool.schedule([&] {
+            if (++executed == count) done.set_value();
+        });
+    }
+    done.get_future().get();
+    EXPECT_EQ(count, executed);
+}
+
+TEST(ThreadPool, NestedTasksAreStolen) {
+    ThreadPool pool(4);
+
+    // All tasks are scheduled from a single worker thread and block for a little
+    // while, so they can only complete in time if other workers steal them.
+    constexpr int count = 64;
+    std::atomic<int> executed{0};
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::promise<void> done;
+
+    pool.schedule([&] {
+        for (int i = 0; i < count; ++i) {
+            pool.schedule([&] {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    threads.insert(std::this_thread::get_id());
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                if (++executed == count) done.set_value();
+            });
+        }
+    });
+
+    done.get_future().get();
+    EXPECT_EQ(count, executed);
+    EXPECT_LT(1u, threads.size());
+}
+
+TEST(ThreadPool, PoolSizeSetting) {
+    auto& settings = platform::Settings::getInstance();
+    settings.set(platform::EXPERIMENTAL_THREAD_POOL_SIZE, uint64_t(6));
+    {
+        ThreadPool pool;
+        EXPECT_EQ(6u, pool.getThreadCount());
+    }
+    settings.set(platform::EXPERIMENTAL_THREAD_POOL_SIZE, mapbox::base::NullValue());
+
+    ThreadPool pool;
+    EXPECT_LE(2u, pool.getThreadCount());
+}
+
+TEST(ThreadPool, MailboxOrdering) {
+    class Recorder {
+    public:
+        Recorder(ActorRef<Recorder>) {}
+
+        void record(int value, int last, std::promise<void>* done) {
+            EXPECT_EQ(expected++, value);
+            if (value == last) done->set_value();
+        }
+
+    private:
+        int expected = 0;
+    };
+
+    ThreadPool pool(4);
+    std::vector<std::unique_ptr<Actor<Recorder>>> actors;
+    std::vector<std::promise<void>> promises(16);
+    for (std::size_t i = 0; i < promises.size(); ++i) {
+        actors.emplace_back(std::make_unique<Actor<Recorder>>(pool));
+    }
+
+    constexpr int count = 1000;
+    for (int value = 0; value < count; ++value) {
+        for (std::size_t i = 0; i < actors.size(); ++i) {
+            actors[i]->self().invoke(&Recorder::record, value, count - 1, &promises[i]);
+        }
+    }
+
+    for (auto& promise : promises) {
+        promise.get_future().get();
+    }
+}
+
+TEST(ThreadPool, DestroyWithPendingTasks) {
+    std::atomic<int> executed{0};
+    {
+        ThreadPool pool(1);
+        std::promise<void> started;
+        std::promise<void> release;
+        auto released = release.get_future().share();
+        pool.schedule([&, released] {
+            started.set_value();
+            released.wait();
+        });
+        started.get_future().get();
+        for (int i = 0; i < 100; ++i) {
+            pool.schedule([&] { ++executed; });
+        }
+        release.set_value();
+        // Should not hang nor leak the tasks that did not run.
+    }
+    EXPECT_GE(100, executed);
+}
+
+TEST(ThreadPool, Priorities) {
+    ThreadPool pool(1);
+
+    // Block the only worker so that all of the following tasks are queued together.
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    pool.schedule([released] { released.wait(); });
+
+    std::mutex mutex;
+    std::vector<TaskPriority> order;
+    std::promise<void> done;
+    auto record = [&](TaskPriority priority) {
+        return [&, priority] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(priority);
+            if (order.size() == 4) done.set_value();
+        };
+    };
+
+    pool.scheduleWithPriority(TaskPriority::Idle, record(TaskPriority::Idle));
+    pool.scheduleWithPriority(TaskPriority::Prefetch, record(TaskPriority::Prefetch));
+    pool.schedule(record(TaskPriority::Visible));
+    pool.scheduleWithPriority(TaskPriority::Critical, record(TaskPriority::Critical));
+
+    release.set_value();
+    done.get_future().get();
+
+    std::vector<TaskPriority> expected{
+        TaskPriority::Critical, TaskPriority::Visible, TaskPriority::Prefetch, TaskPriority::Idle};
+    EXPECT_EQ(expected, order);
+}